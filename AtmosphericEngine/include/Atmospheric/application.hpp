@@ -12,11 +12,14 @@
 
 #include "physics_server_2d.hpp"
 #include "scene.hpp"
+#include "scene_arena.hpp"
+#include <span>
 
 // Forward declarations
 class Window;
 class GameObject;
 class EditorLayer;
+struct SceneProps;
 
 struct FrameData {
     FrameData(uint64_t number, float time, float deltaTime) {
@@ -41,6 +44,13 @@ struct AppConfig {
     bool enableGraphics3D = true;
     bool enablePhysics3D = true;
     float fixedTimeStep = FIXED_TIME_STEP;
+    int physics2DWorkers = 0;// Box2D solver threads; 0 = one per JobSystem thread
+    float fileCallbackBudget = 0.002f;// seconds per frame spent on FileSystem completion callbacks
+    size_t textureUploadBudget = size_t(8) << 20;// bytes of texture data uploaded per frame
+    std::string textureCacheDir = ".cache/textures";// decoded-texture disk cache (native only); empty disables
+    bool compressTextures = false;// encode RGBA textures as BC1/BC3 when the GPU supports S3TC
+    bool hotReload = false;// watch loaded asset files and reload them in place when they change (native only)
+    std::string assetStatsFile;// per-asset load times written here on exit, CSV or .json (native only); empty disables
     bool useDefaultTextures = false;
     bool useDefaultShaders = true;
 };
@@ -106,6 +116,12 @@ public:
     std::shared_ptr<Window> GetWindow();
     void LoadScene(const SceneDef& scene);
     void LoadScene(const std::string& jsonContent);
+    // JSON and baked scenes are both read into SceneProps (scene_props.hpp)
+    // and built here
+    void LoadScene(const SceneProps& scene);
+    // Instantiates a scene baked by tools/scene_baker (see scene_bake.hpp).
+    // Returns false, creating nothing, if the bytes are not a valid baked scene.
+    bool LoadBakedScene(std::span<const uint8_t> bytes);
     void ReloadScene();
     void GoScene(const std::string& sceneName, std::function<void()> onReady = nullptr);
 
@@ -115,6 +131,18 @@ public:
 
     GameObject* CreateGameObject(glm::vec2 position, float rotation = 0.0f);
 
+    // Allocates the game object from `arena`; the application keeps it in the
+    // scene but never deletes it (see ReleaseSceneArena)
+    GameObject* CreateGameObject(SceneArena& arena, glm::vec3 position, glm::vec3 rotation, glm::vec3 scale);
+
+    // Memory for objects that live until the next scene change
+    SceneArena& GetSceneArena() {
+        return _sceneArena;
+    }
+    // Drops every game object allocated from the scene arena and releases it.
+    // GoScene does this before loading the next scene.
+    void ReleaseSceneArena();
+
 protected:
     // These subsystems will be game accessible
     AudioManager audio;
@@ -149,6 +177,8 @@ protected:
 
 private:
     void RegisterComponents();
+    // Hot reload: reloads changed asset files, and the current scene when its own file changed
+    void ReloadChangedAssets();
 
     AppConfig _config;
 
@@ -163,6 +193,7 @@ private:
     bool _sceneReady = false;
     std::vector<GameObject*> _entities;
     EntityID _nextEntityID = 0;
+    SceneArena _sceneArena;
     GameObject* _defaultGameObject = nullptr;
 
     std::vector<Layer*> _layers;
@@ -0,0 +1,103 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Asset dependency graph
+//
+// One node per asset AssetManager knows about, plus one per source file on
+// disk.  An edge runs from an asset to what it was built from or refers to:
+//
+//   scene ──▶ texture ──▶ file          material ──▶ texture
+//   scene ──▶ shader  ──▶ file (×2-4)   mesh     ──▶ file, material
+//
+// When a file changes, Invalidate walks the edges backwards and returns the
+// file's dependents, transitive ones included, dependencies first, each with
+// its version bumped.  Nothing outside that set is touched, so reloading one
+// texture in a large project costs as much as its own dependents.
+//
+// Handles are slot indices with a generation that is bumped when the slot is
+// freed, so a handle to a removed asset never aliases the next one.
+//
+// No GL here; the graph only stores names and edges.
+// ─────────────────────────────────────────────────────────────────────────────
+
+enum class AssetKind : uint8_t { File, Texture, Shader, Material, Mesh, Scene, Count };
+
+struct AssetHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0;// 0 = null handle
+
+    bool IsValid() const {
+        return generation != 0;
+    }
+    bool operator==(const AssetHandle&) const = default;
+};
+
+class AssetGraph {
+public:
+    // Returns the existing node when `name` is already registered for `kind`
+    AssetHandle Register(AssetKind kind, const std::string& name);
+    AssetHandle Find(AssetKind kind, const std::string& name) const;
+    // Unlinks every edge and frees the slot; `handle` goes stale
+    void Remove(AssetHandle handle);
+    void Clear();
+
+    bool IsAlive(AssetHandle handle) const;
+    AssetKind GetKind(AssetHandle handle) const;
+    const std::string& GetName(AssetHandle handle) const;
+    // Bumped every time the asset is invalidated
+    uint32_t GetVersion(AssetHandle handle) const;
+
+    // `dependent` is built from or refers to `dependency`
+    void AddDependency(AssetHandle dependent, AssetHandle dependency);
+    void RemoveDependencies(AssetHandle dependent);
+    std::vector<AssetHandle> GetDependencies(AssetHandle handle) const;
+    std::vector<AssetHandle> GetDependents(AssetHandle handle) const;
+
+    // References held outside the graph (AssetManager::Acquire); dependents
+    // count as references too
+    void AddRef(AssetHandle handle);
+    void Release(AssetHandle handle);
+    uint32_t GetRefCount(AssetHandle handle) const;
+
+    // Bumps the version of `handle` and of everything that depends on it,
+    // directly or not, and returns them ordered so each asset comes after
+    // every one of its invalidated dependencies.  `handle` is first.
+    std::vector<AssetHandle> Invalidate(AssetHandle handle);
+
+    void ForEach(AssetKind kind, const std::function<void(AssetHandle, const std::string&)>& fn) const;
+    size_t GetCount() const {
+        return _nodes.size() - _free.size();
+    }
+
+private:
+    struct Node {
+        std::string name;
+        AssetKind kind = AssetKind::File;
+        uint32_t generation = 1;
+        uint32_t version = 0;
+        uint32_t refs = 0;
+        bool alive = false;
+        std::vector<uint32_t> dependencies;
+        std::vector<uint32_t> dependents;
+    };
+
+    const Node* Lookup(AssetHandle handle) const;
+    AssetHandle HandleOf(uint32_t index) const {
+        return { index, _nodes[index].generation };
+    }
+
+    std::vector<Node> _nodes;
+    std::vector<uint32_t> _free;
+    std::array<std::unordered_map<std::string, uint32_t>, size_t(AssetKind::Count)> _byName;
+
+    // Invalidate scratch, indexed by node and reset through _stamp
+    std::vector<uint32_t> _stamp;
+    std::vector<uint32_t> _pending;// invalidated dependencies not yet emitted
+    uint32_t _epoch = 0;
+};
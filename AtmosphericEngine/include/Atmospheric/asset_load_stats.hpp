@@ -0,0 +1,81 @@
+#pragma once
+#include "asset_graph.hpp"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Asset load statistics
+//
+// One record per load AssetManager performed: how many bytes the source had,
+// how long reading, decoding and uploading it took, and whether the disk
+// cache or deduplication answered instead.  Textures from the streaming
+// pipeline are recorded when their last level is uploaded, so `uploadMs`
+// spans frames but counts only time spent inside the uploads.
+//
+// Requests the memory cache answers don't add records; they are counted on
+// the asset's latest record instead, so a game fetching the same texture
+// every frame costs a lookup, not memory.  At most MAX_RECORDS are kept (a few dozen
+// bytes each), later loads are only counted.  Exported as CSV or JSON; with
+// Tracy each record also feeds the "Assets/…" plots and a message naming the
+// asset.  Main thread only.
+// ─────────────────────────────────────────────────────────────────────────────
+
+enum class AssetCacheStatus : uint8_t {
+    Miss,  // loaded from its source
+    Memory,// the same path was already loaded
+    Dedup, // another path with identical bytes was already loaded
+    Disk,  // decoded payload read back from the texture disk cache
+};
+
+struct AssetLoadRecord {
+    std::string      name;
+    AssetKind        kind        = AssetKind::File;
+    AssetCacheStatus cache       = AssetCacheStatus::Miss;
+    uint64_t         bytes       = 0;// source file size
+    uint64_t         contentHash = 0;// 0 = not hashed
+    float            readMs      = 0.0f;
+    float            decodeMs    = 0.0f;
+    float            uploadMs    = 0.0f;
+    uint64_t         memoryHits  = 0;// later requests the memory cache answered
+
+    float GetTotalMs() const {
+        return readMs + decodeMs + uploadMs;
+    }
+};
+
+class AssetLoadStats {
+public:
+    static constexpr size_t MAX_RECORDS = 16384;
+
+    void Record(AssetLoadRecord record);
+    void Clear();
+
+    const std::vector<AssetLoadRecord>& GetRecords() const {
+        return _records;
+    }
+    // The `count` records with the longest total time, slowest first
+    std::vector<AssetLoadRecord> GetSlowest(size_t count) const;
+    // Loads past MAX_RECORDS that were counted but not kept
+    uint64_t GetDroppedCount() const {
+        return _dropped;
+    }
+    // Source bytes that deduplication kept from being loaded again
+    uint64_t GetDedupedBytes() const {
+        return _dedupedBytes;
+    }
+
+    std::string ToCSV() const;
+    std::string ToJSON() const;
+    // CSV, or JSON when `path` ends in ".json".  Logs and returns false on failure.
+    bool Write(const std::string& path) const;
+
+private:
+    std::vector<AssetLoadRecord> _records;
+    // Per kind: asset name → index of its latest record
+    std::array<std::unordered_map<std::string, size_t>, size_t(AssetKind::Count)> _latest;
+    uint64_t _dedupedBytes = 0;
+    uint64_t _dropped      = 0;
+};
@@ -1,11 +1,16 @@
 #pragma once
+#include "asset_graph.hpp"
+#include "asset_load_stats.hpp"
+#include "content_hash.hpp"
 #include "globals.hpp"
+#include "texture_pipeline.hpp"
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+class FileWatcher;
 class Mesh;
 class Material;
 class ShaderProgram;
@@ -58,6 +63,7 @@ public:
     ShaderProgram* GetShaderByID(uint32_t id) const;
     void LoadDefaultShaders();
     void LoadShaders(const std::unordered_map<std::string, ShaderProgramProps>& shaderDefs);
+    // Recompiles every shader program in place; one that fails keeps its old program
     void ReloadShaders();
 
     // ========== GPU Resource Management ==========
@@ -67,7 +73,14 @@ public:
     GLuint GetTextureByID(uint32_t id) const;
     std::string GetTexturePath(GLuint id) const;
     void LoadDefaultTextures();
+    // Queues the paths on the texture pipeline; each slot gets a placeholder
+    // that fills in as PumpTextureUploads() uploads its mips.
     void LoadTextures(const std::vector<std::string>& paths);
+    // Main thread, once per frame: uploads decoded levels up to byteBudget.
+    void PumpTextureUploads(size_t byteBudget);
+    // Filter, BC encoding and disk cache for textures loaded from now on.
+    // preferS3TC is ignored; it follows the GL context's extensions.
+    void SetTexturePipelineConfig(const TexturePipelineConfig& config);
     Mesh* CreateMesh(Mesh* mesh = nullptr);
     Mesh* CreateMesh(const std::string& name, Mesh* mesh = nullptr);
     Mesh* CreateCubeMesh(const std::string& name, float size = 1.0f);
@@ -77,6 +90,9 @@ public:
     Mesh* CreateCapsuleMesh(const std::string& name, float radius = 0.5f, float height = 3.0f);
     Mesh* CreateTerrainMesh(const std::string& name, float worldSize = 1024.f, int resolution = 10);
     Mesh* GetMesh(const std::string& name) const;
+    // Cooked .aemesh (tools/mesh_cooker), cached under its path
+    Mesh* LoadMesh(const std::string& path);
+    // Load the cooked sibling of an OBJ / glTF ("model.obj" → "model.aemesh")
     std::shared_ptr<Mesh> LoadOBJ(const std::string& path);
     std::shared_ptr<Mesh> LoadGLTF(const std::string& path);
 
@@ -93,6 +109,48 @@ public:
 
     size_t getTotalTextureBytes() const;
 
+    // ========== Dependencies & Hot Reload ==========
+    // Every texture, shader, material, mesh and scene is a node in the graph,
+    // linked to the files it was loaded from and the assets it refers to.
+    const AssetGraph& GetAssetGraph() const {
+        return _graph;
+    }
+    AssetHandle FindAsset(AssetKind kind, const std::string& name) const {
+        return _graph.Find(kind, name);
+    }
+    // A texture with references left survives ClearSceneAssets
+    void Acquire(AssetHandle handle);
+    void Release(AssetHandle handle);
+    // Records the scene, the files it is read from (its .json and .aesb) and
+    // the assets it declares
+    AssetHandle TrackScene(
+      const std::string& name,
+      const std::vector<std::string>& sourcePaths,
+      const std::vector<std::string>& texturePaths,
+      const std::vector<std::string>& shaderNames
+    );
+    // Watches the source file of every asset loaded from disk from now on,
+    // and of those already loaded
+    void EnableHotReload();
+    // Reloads the textures, shaders and meshes built from `path` in place and
+    // bumps the version of everything depending on them.  A texture or mesh
+    // deduplicated with another path's is detached first: it gets its own GL
+    // texture (its `textures` slots follow) or Mesh, and the other paths keep
+    // the old contents.  Returns the assets built directly from the file;
+    // scenes among them are the caller's to reload.
+    std::vector<AssetHandle> ReloadSource(const std::string& path);
+    // Main thread, once per frame: ReloadSource for each watched file that changed
+    std::vector<AssetHandle> PollHotReload();
+
+    // ========== Load Statistics ==========
+    // Every texture, shader and mesh load since startup; Clear keeps them
+    const AssetLoadStats& GetLoadStats() const {
+        return _loadStats;
+    }
+    AssetLoadStats& GetLoadStats() {
+        return _loadStats;
+    }
+
     // ========== Cleanup ==========
     void Clear();
     void ClearSceneAssets();  // Clears scene assets only, preserving defaults.
@@ -103,11 +161,38 @@ private:
 
     static AssetManager* instance;
 
+    AssetHandle TrackSource(const std::string& path);
+    AssetHandle TrackTexture(const std::string& path);
+    AssetHandle TextureAtIndex(int index) const;// `textures` index, as materials store them
+    void ReloadAsset(AssetHandle handle);
+    void EnsureTexturePipeline();
+    GLuint CreateTextureFromImage(const std::shared_ptr<Image>& image, const std::string& key);
+    // XXH3 of `path`'s bytes, 0 if unreadable.  With `cachedOnly`, bytes not
+    // already in memory (mounted pack or file cache) aren't read.
+    uint64_t HashSource(const std::string& path, bool cachedOnly, uint64_t* bytes = nullptr);
+    // Points `path` at the texture already loaded with the same contents, if
+    // any; returns its GL name or 0
+    GLuint ShareTexture(const std::string& path, AssetLoadRecord record);
+    // Gives `path`, whose GL name other paths share, a texture of its own
+    // loaded from its current file, and moves its `textures` slots onto it
+    void DetachTexture(const std::string& path, GLuint shared);
+
+    AssetGraph _graph;
+    std::unique_ptr<FileWatcher> _watcher;
+    AssetLoadStats _loadStats;
+
+    // Content hash → first path loaded with those bytes; a later path with
+    // identical bytes shares that path's image, texture or mesh
+    ContentIndex _imageContent;
+    ContentIndex _textureContent;
+    ContentIndex _meshContent;
+
     // Images
     std::unordered_map<std::string, std::shared_ptr<Image>> _imageCache;
 
     // Shaders
     std::vector<ShaderProgram*> shaders;
+    std::vector<ShaderProgramProps> _shaderProps;// by shader ID, for reloading
     std::unordered_map<std::string, uint32_t> _shaderCache;
     uint32_t _nextShaderID = 0;
     uint32_t _defaultShaderCount = 0;
@@ -121,7 +206,12 @@ private:
     std::vector<GLuint> defaultTextures;
     std::vector<GLuint> textures;
     std::unordered_map<std::string, Texture2D> _textureCache;
+    // Slots in `textures` handed out for a path that shares another's GL name
+    std::unordered_map<std::string, std::vector<size_t>> _textureAliasSlots;
     uint32_t _nextTextureID = 0;
+    TexturePipelineConfig _texturePipelineConfig;
+    std::unique_ptr<TextureUploadSink> _textureSink;
+    std::unique_ptr<TexturePipeline> _texturePipeline;
 
     // Meshes
     std::vector<Mesh*> meshes;
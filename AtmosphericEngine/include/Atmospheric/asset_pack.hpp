@@ -0,0 +1,131 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Asset pack
+//
+// Read-only archive of many small assets, built offline by tools/asset_packer
+// and mounted with FileSystem::MountPack.  One open + mmap replaces an
+// fopen/fread per file, and uncompressed entries are handed out as views
+// straight into the mapping.
+//
+// Layout (little-endian)
+// ──────────────────────
+//   AssetPackHeader
+//   AssetPackEntry[entryCount]   sorted by pathHash → binary search lookup
+//   path table                   entry paths, to resolve hash collisions
+//   entry data                   each entry starts on an ALIGNMENT boundary
+//
+// Entries may be stored LZ4 or zstd compressed when the engine is built with
+// AE_USE_LZ4 / AE_USE_ZSTD; those are inflated once on first View().
+// ─────────────────────────────────────────────────────────────────────────────
+enum class AssetPackCompression : uint32_t { None = 0, LZ4 = 1, Zstd = 2 };
+
+struct AssetPackHeader {
+    char     magic[4];          // "AEPK"
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t alignment;
+    uint64_t pathTableOffset;
+    uint64_t pathTableSize;
+};
+static_assert(sizeof(AssetPackHeader) == 32, "AssetPackHeader layout changed");
+
+struct AssetPackEntry {
+    uint64_t pathHash;          // HashAssetPath(path)
+    uint64_t offset;            // from the start of the pack
+    uint64_t size;              // stored bytes
+    uint64_t rawSize;           // bytes after decompression
+    uint32_t pathOffset;        // into the path table
+    uint32_t pathLength;
+    uint32_t compression;       // AssetPackCompression
+    uint32_t reserved;
+};
+static_assert(sizeof(AssetPackEntry) == 48, "AssetPackEntry layout changed");
+
+// FNV-1a over the normalized path ("assets/textures/hero.png")
+uint64_t HashAssetPath(std::string_view path);
+
+// Whether this build can read and write entries compressed with `compression`
+bool IsCompressionAvailable(AssetPackCompression compression);
+
+class AssetPack {
+public:
+    static constexpr char     MAGIC[4]  = { 'A', 'E', 'P', 'K' };
+    static constexpr uint32_t VERSION   = 1;
+    static constexpr uint32_t ALIGNMENT = 64;
+    // Open() rejects compressed entries claiming to inflate past either
+    // bound, so a corrupt rawSize can't trigger a huge allocation.
+    static constexpr uint64_t MAX_RAW_SIZE = 1ull << 30;
+    static constexpr uint64_t MaxInflateRatio(AssetPackCompression compression) {
+        switch (compression) {
+        case AssetPackCompression::LZ4:  return 255;  // one byte extends a match by 255
+        case AssetPackCompression::Zstd: return 32768;// 4-byte RLE block → 128 KiB
+        default:                         return 1;
+        }
+    }
+
+    AssetPack() = default;
+    ~AssetPack();
+    AssetPack(const AssetPack&)            = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    // Maps the pack (mmap on Linux / macOS, whole-file read elsewhere) and
+    // validates its tables.  On failure `error` describes why.
+    bool Open(const std::string& path, std::string* error = nullptr);
+    void Close();
+    bool IsOpen() const { return _data != nullptr; }
+
+    const AssetPackEntry* Find(std::string_view path) const;
+    std::span<const AssetPackEntry> GetEntries() const { return _entries; }
+    std::string_view GetPath(const AssetPackEntry& entry) const;
+
+    // Uncompressed bytes of an entry (one of GetEntries(), or a copy of it).
+    // Stored entries point into the mapping; compressed ones are inflated on
+    // first use, outside the lock, and kept until Close().  Returns an empty
+    // span if the entry fails to inflate.
+    std::span<const uint8_t> View(const AssetPackEntry& entry);
+
+private:
+    std::span<const uint8_t> Stored(const AssetPackEntry& entry) const;
+
+    const uint8_t*                  _data = nullptr;
+    size_t                          _size = 0;
+    bool                            _mapped = false;
+    std::vector<uint8_t>            _buffer;    // backing store when mmap is unavailable
+    std::span<const AssetPackEntry> _entries;
+    std::string_view                _paths;
+
+    std::mutex _inflateMutex;
+    std::unordered_map<uint64_t, std::unique_ptr<std::vector<uint8_t>>> _inflated;// by entry offset
+};
+
+// Builds a pack in memory and writes it out; used by tools/asset_packer.
+class AssetPackWriter {
+public:
+    // `path` is stored as given; use the path the game passes to FileSystem.
+    // Compression falls back to None when unavailable, when it doesn't help,
+    // or for entries over AssetPack::MAX_RAW_SIZE.
+    void Add(std::string path, std::vector<uint8_t> bytes,
+             AssetPackCompression compression = AssetPackCompression::None);
+
+    bool Write(const std::string& outPath, std::string* error = nullptr) const;
+
+    size_t GetCount() const { return _items.size(); }
+
+private:
+    struct Item {
+        std::string          path;
+        std::vector<uint8_t> stored;
+        uint64_t             rawSize;
+        AssetPackCompression compression;
+    };
+    std::vector<Item> _items;
+};
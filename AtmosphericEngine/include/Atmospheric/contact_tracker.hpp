@@ -0,0 +1,94 @@
+#pragma once
+#include "globals.hpp"
+#include <functional>
+#include <vector>
+
+class GameObject;
+
+// One touching body pair, aggregated over all points of all its manifolds
+struct ContactEvent {
+    GameObject* a;
+    GameObject* b;
+    int layerA;           // collision filter group of each body
+    int layerB;
+    glm::vec3 point;      // world-space position of the deepest contact point
+    glm::vec3 normal;     // its world-space normal on B
+    float impulse;        // sum of applied impulses this step
+    float depth = 0.0f;   // penetration of that point, > 0 when overlapping
+};
+
+struct ContactEvents {
+    std::vector<ContactEvent> begin;
+    std::vector<ContactEvent> stay;
+    std::vector<ContactEvent> end;
+
+    void Clear() {
+        begin.clear();
+        stay.clear();
+        end.clear();
+    }
+};
+
+struct ContactFilter {
+    int layerMask = -1;                                 // either body's layer must match
+    std::function<bool(const GameObject*)> predicate;   // optional, e.g. "has component T"
+
+    bool Matches(const ContactEvent& e) const;
+};
+
+using ContactListener = std::function<void(const ContactEvents&)>;
+using ContactSubscriberID = uint32_t;
+
+// Diffs the set of touching pairs between two steps into begin/stay/end
+// arrays.  Independent of the physics backend: bodies are opaque keys.
+class ContactTracker {
+public:
+    // Record one touching pair for the current step; order of a/b does not matter.
+    void AddContact(const void* bodyA, const void* bodyB, const ContactEvent& contact);
+
+    // Diffs the pairs recorded since the last call against the previous set
+    // and fills GetEvents().
+    void Update();
+
+    // Forget a body that is leaving the world so no event references it.
+    void RemoveBody(const void* body);
+    void Clear();
+
+    const ContactEvents& GetEvents() const {
+        return _events;
+    }
+
+    // Safe to call from a listener: a subscriber added during Dispatch() is
+    // first called next frame, one removed is not called again.
+    ContactSubscriberID Subscribe(const ContactFilter& filter, ContactListener listener);
+    void Unsubscribe(ContactSubscriberID id);
+
+    // Invoke each subscriber once with the events that pass its filter
+    void Dispatch();
+
+private:
+    struct Pair {
+        const void* lo;
+        const void* hi;
+        ContactEvent event;
+
+        bool operator<(const Pair& o) const {
+            return lo != o.lo ? lo < o.lo : hi < o.hi;
+        }
+    };
+    struct Subscriber {
+        ContactSubscriberID id;
+        ContactFilter filter;
+        ContactListener listener;
+        bool removed = false;
+    };
+
+    std::vector<Pair> _prev;
+    std::vector<Pair> _curr;
+    ContactEvents _events;
+    ContactEvents _filtered; // scratch for Dispatch
+    std::vector<Subscriber> _subscribers;
+    std::vector<Subscriber> _added;  // subscribed during Dispatch
+    bool _dispatching = false;
+    ContactSubscriberID _nextSubscriberID = 0;
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Content hashing
+//
+// HashContent is XXH3-64 over a file's bytes.  It keys the texture disk cache
+// and AssetManager's deduplication: two paths whose bytes hash the same are
+// loaded once and share the image, GL texture or mesh.
+//
+// ContentIndex remembers which asset first loaded each hash.  An asset is
+// its holder until it is unloaded or its file changes, at which point it
+// must be erased so the hash doesn't point at stale contents.
+// ─────────────────────────────────────────────────────────────────────────────
+
+uint64_t HashContent(std::span<const uint8_t> bytes);
+
+class ContentIndex {
+public:
+    // Name of the asset holding `hash`, or nullptr
+    const std::string* Find(uint64_t hash) const;
+    // Records `name` as the holder of `hash` unless another asset already
+    // is; returns the holder
+    const std::string& Insert(uint64_t hash, const std::string& name);
+    // No-op for names that hold nothing
+    void Erase(const std::string& name);
+    void Clear();
+
+    size_t GetCount() const {
+        return _byHash.size();
+    }
+
+private:
+    std::unordered_map<uint64_t, std::string> _byHash;
+    std::unordered_map<std::string, uint64_t> _byName;
+};
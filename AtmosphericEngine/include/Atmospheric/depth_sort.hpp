@@ -0,0 +1,50 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+// Order-preserving float -> uint32 mapping (negative values included), so
+// floats can be compared and radix sorted as plain integers.
+inline uint32_t FloatSortKey(float f) {
+    uint32_t u = std::bit_cast<uint32_t>(f);
+    return (u & 0x80000000u) ? ~u : (u | 0x80000000u);
+}
+
+// Monotone `bits`-wide key (1..31) for a non-negative depth or squared
+// distance.  Keeps the exponent and the top mantissa bits, so precision is
+// relative to the depth itself; no near/far range is needed.
+inline uint32_t QuantizeDepth(float depth, int bits) {
+    uint32_t u = std::bit_cast<uint32_t>(std::max(depth, 0.0f));
+    return u >> (31 - bits);
+}
+
+// Sorts 32-bit keys computed once per element, returning a permutation.
+// Elements are identified by their position in the caller's key array; when
+// that array keeps a stable element order between frames, the previous
+// result seeds the next sort and a mostly unchanged scene finishes with an
+// insertion pass instead of a full sort.  The history is positional only: a
+// changed count drops it and goes straight to the radix sort.  Not
+// thread-safe; keep one sorter per consumer.
+class DepthSorter {
+public:
+    // Insertion sort gives up after this many element moves per element
+    static constexpr uint32_t MAX_MOVES_PER_ELEMENT = 4;
+
+    // Returns indices into keys[0, count) in ascending key order.  Ties keep
+    // their previous relative order.
+    const std::vector<uint32_t>& Sort(const uint32_t* keys, uint32_t count);
+
+    // Statistics of the last Sort(), for profiling
+    bool UsedInsertionSort() const {
+        return _usedInsertion;
+    }
+
+private:
+    std::vector<uint32_t> _order;
+    std::vector<uint32_t> _scratch;
+    bool _usedInsertion = false;
+
+    bool InsertionSort(const uint32_t* keys);
+    void RadixSort(const uint32_t* keys);
+};
@@ -1,6 +1,8 @@
 #pragma once
 #include <cstdint>
 #include <functional>
+#include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -12,8 +14,11 @@
 // Platform implementations
 // ────────────────────────
 //   Native (Linux / macOS / Windows)
-//     • ReadAsync  : synchronous disk read; callback invoked before returning.
-//     • Prefetch   : parallel disk reads via JobSystem; warms in-memory cache.
+//     • ReadAsync  : queued on dedicated I/O threads by priority; callback
+//                    runs on the main thread from PumpCompletions().
+//     • Prefetch   : parallel disk reads via JobSystem; warms in-memory cache
+//                    and blocks until done (startup, before the main loop).
+//     • PrefetchAsync : same through the I/O queue; never blocks the frame.
 //                    fopen() already works natively — no extra magic needed.
 //
 //   Web (Emscripten / WebAssembly)
@@ -51,27 +56,73 @@
 //                             Text files are small; this is acceptable.
 //   IndexedDB:                emscripten_fetch persists the raw bytes.
 //                             Subsequent page-loads skip the network entirely.
+//
+// Asset packs
+// ───────────
+//   MountPack() serves paths from an archive built by tools/asset_packer
+//   ahead of the cache and loose files.  Native Linux / macOS builds mmap
+//   the pack, so ReadView() hands out spans without any copy or syscall.
 // ─────────────────────────────────────────────────────────────────────────────
 class FileSystem {
 public:
     using Bytes              = std::vector<uint8_t>;
+    using SharedBytes        = std::shared_ptr<const Bytes>;
     using ReadCallback       = std::function<void(Bytes data, bool success)>;
     using CompletionCallback = std::function<void()>;
+    using RequestID          = uint64_t;// 0 = completed inline, nothing to cancel
+
+    // Streaming order: higher priority first, then earlier deadline
+    enum class Priority { Low, Normal, High, Critical };
+
+    struct CacheStats {
+        uint64_t hits        = 0;
+        uint64_t misses      = 0;
+        uint64_t evictions   = 0;
+        size_t   bytes       = 0;
+        size_t   pinnedBytes = 0;   // held by readers; not evictable
+        size_t   entries     = 0;
+        size_t   budget      = 0;
+    };
 
     static FileSystem& Get();
 
     // ── Async read ────────────────────────────────────────────────────────────
     // Cache-hit → callback fires immediately (same call stack).
     // Cache-miss on web    → emscripten_fetch; callback fires asynchronously.
-    // Cache-miss on native → synchronous disk read; callback fires inline.
+    // Cache-miss on native → Stream(path, cb): callback fires from a later
+    //                        PumpCompletions() on the main thread.
     // The callback is always invoked, even on failure (check `success`).
     void ReadAsync(const std::string& path, ReadCallback cb);
 
+    // ── Streaming ─────────────────────────────────────────────────────────────
+    // Like ReadAsync with a priority and an optional deadline hint (seconds
+    // from now, <= 0 for none) that orders requests of equal priority.
+    // Returns an ID for Cancel().  Priorities and cancellation apply on
+    // native; web fetches already complete on the browser event loop.
+    RequestID Stream(const std::string& path, ReadCallback cb,
+                     Priority priority = Priority::Normal, float deadline = 0.0f);
+
+    // Drops a request that hasn't completed; its callback never fires.
+    bool Cancel(RequestID id);
+
+    // Runs finished Stream/ReadAsync/PrefetchAsync callbacks on the calling
+    // (main) thread until `budgetSeconds` is spent.  Application calls this
+    // once per frame with AppConfig::fileCallbackBudget.  Returns how many ran.
+    size_t PumpCompletions(float budgetSeconds);
+
+    // Stream requests not yet delivered
+    size_t GetPendingCount() const;
+
     // ── Sync read ─────────────────────────────────────────────────────────────
     // Returns cached bytes if available; otherwise reads from disk (native) or
     // returns {} with an error log (web — must Prefetch first).
     Bytes ReadSync(const std::string& path);
 
+    // Like ReadSync without the copy: returns the cached buffer itself (native
+    // cache misses are read from disk and cached).  Holding the pointer pins
+    // the entry against eviction.  nullptr on failure.
+    SharedBytes ReadShared(const std::string& path);
+
     // Like ReadSync but moves the cached entry out and erases it.
     // Use for one-shot binary consumption (e.g., KTX2 → GPU upload):
     //   auto bytes = FileSystem::Get().ConsumeSync("hero.ktx2");
@@ -95,6 +146,12 @@ public:
     // Already-cached paths are skipped without launching a new fetch / read.
     void Prefetch(const std::vector<std::string>& paths, CompletionCallback onDone);
 
+    // Non-blocking Prefetch: reads go through the streaming queue and onDone
+    // fires from PumpCompletions() once every path settled.  Identical to
+    // Prefetch on web.
+    void PrefetchAsync(const std::vector<std::string>& paths, CompletionCallback onDone,
+                       Priority priority = Priority::Normal);
+
     // ── Utilities ─────────────────────────────────────────────────────────────
     // Checks in-memory cache then std::filesystem (MEMFS on web, disk native).
     bool Exists(const std::string& path) const;
@@ -108,6 +165,28 @@ public:
     // longer need the cached bytes (e.g., between level loads).
     void ClearCache();
 
+    // Total bytes the cache may hold before evicting least-recently-used,
+    // unpinned entries.  Default 512 MB native; unlimited on web, where the
+    // cache is the only copy of prefetched files.
+    void SetCacheBudget(size_t bytes);
+    size_t GetCacheBudget() const;
+
+    CacheStats GetCacheStats() const;
+
+    // ── Asset packs ───────────────────────────────────────────────────────────
+    // Mounts an asset pack; every read first looks the path up in mounted
+    // packs (later mounts shadow earlier ones).  Returns false and logs on a
+    // missing or corrupt pack.
+    bool MountPack(const std::string& packPath);
+
+    // Unmounts every pack; invalidates all spans returned by ReadView.
+    void UnmountPacks();
+
+    // Zero-copy read from a mounted pack.  The span stays valid until
+    // UnmountPacks().  Returns an empty span when no mounted pack holds the
+    // path — fall back to ReadSync() for loose files.
+    std::span<const uint8_t> ReadView(const std::string& path);
+
 private:
     FileSystem()                             = default;
     ~FileSystem()                            = default;
@@ -0,0 +1,54 @@
+#pragma once
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// File watcher
+//
+// Reports loose files that were rewritten since the last Poll.  Linux uses
+// inotify on each file's directory, which also catches editors that save by
+// writing a temp file and renaming it over the original.  Other native
+// platforms compare modification times, at most every POLL_INTERVAL.  On the
+// web nothing is watched.
+//
+// Paths are reported exactly as they were passed to Watch.  If the kernel's
+// event queue overflowed, events were lost, so Poll reports every watched
+// file: a spurious reload is cheap, a missed one leaves stale data on screen.
+// ─────────────────────────────────────────────────────────────────────────────
+class FileWatcher {
+public:
+    static constexpr std::chrono::milliseconds POLL_INTERVAL{ 500 };
+
+    FileWatcher();
+    ~FileWatcher();
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    bool IsSupported() const;
+
+    void Watch(const std::string& path);
+    // Stops reporting `path`; its directory is unwatched with its last file
+    void Unwatch(const std::string& path);
+
+    // Main thread, once per frame.  Each changed path is reported once.
+    std::vector<std::string> Poll();
+
+private:
+    std::unordered_set<std::string> _files;
+#ifdef __linux__
+    int _fd = -1;
+    struct DirectoryWatch {
+        int wd = -1;
+        size_t files = 0;// watched files in the directory
+    };
+    std::unordered_map<int, std::string> _directories;// watch descriptor → directory
+    std::unordered_map<std::string, DirectoryWatch> _watches;
+#elif !defined(__EMSCRIPTEN__)
+    std::unordered_map<std::string, std::filesystem::file_time_type> _modified;
+    std::chrono::steady_clock::time_point _lastPoll{};
+#endif
+};
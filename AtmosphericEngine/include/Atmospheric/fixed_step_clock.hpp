@@ -0,0 +1,36 @@
+#pragma once
+#include <cmath>
+
+// Fixed-timestep accumulator shared by the 2D and 3D physics servers.
+// At most maxSubSteps steps run per frame; any surplus after a hitch is
+// dropped, so the simulation briefly runs slower than real time instead of
+// spiralling into ever more steps.
+struct FixedStepClock {
+    float step = 1.0f / 60.0f;
+    int maxSubSteps = 4;
+    float accumulator = 0.0f;
+
+    // Adds dt and returns the number of steps to run this frame
+    int Advance(float dt) {
+        accumulator += dt;
+        int steps = 0;
+        while (accumulator >= step && steps < maxSubSteps) {
+            accumulator -= step;
+            ++steps;
+        }
+        if (accumulator >= step) {
+            accumulator = std::fmod(accumulator, step);
+        }
+        return steps;
+    }
+
+    // Fraction of a step left in the accumulator, in [0, 1).  Rendered
+    // transforms lerp from the previous to the current step state by this.
+    float GetAlpha() const {
+        return accumulator / step;
+    }
+
+    void Reset() {
+        accumulator = 0.0f;
+    }
+};
@@ -104,11 +104,17 @@ public:
         _name = name;
     }
 
+    // Called every frame this object touches another, the first one included
     void SetCollisionCallback(std::function<void(GameObject*)> callback) {
         _collisionCallback = callback;
     }
+    // Called once when this object starts touching another
+    void SetCollisionEnterCallback(std::function<void(GameObject*)> callback) {
+        _collisionEnterCallback = callback;
+    }
 
     void OnCollision(GameObject* other);
+    void OnCollisionEnter(GameObject* other);
 
 private:
     std::string _name = " ";
@@ -120,4 +126,5 @@ private:
     glm::vec3 _angularVelocity = glm::vec3(0, 0, 0);
     bool _isTransformDirty = false;
     std::function<void(GameObject*)> _collisionCallback;
+    std::function<void(GameObject*)> _collisionEnterCallback;
 };
\ No newline at end of file
@@ -10,6 +10,8 @@
 #include <glm/gtc/quaternion.hpp>
 #include <vector>
 
+struct MeshView;
+
 enum class MeshType {
     PRIM    = 0,
     TERRAIN = 1,
@@ -40,6 +42,9 @@ public:
 
     void Initialize(const std::vector<Vertex>& verts);
     void Initialize(const std::vector<Vertex>& verts, const std::vector<uint16_t>& tris);
+    // Cooked mesh: uploads the packed vertex and index bytes as they are and
+    // takes the bounds from the file header
+    void Initialize(const MeshView& cooked);
 
     // Dynamic update methods for per-frame geometry (legacy)
     template<typename VertexType>
@@ -62,6 +67,11 @@ public:
         return _primitiveType;
     }
 
+    // GL_UNSIGNED_SHORT, or GL_UNSIGNED_INT for large cooked meshes
+    GLenum GetIndexType() const {
+        return _indexType;
+    }
+
     std::array<glm::vec3, 8> GetBoundingBox() const {
         return _bounds;
     }
@@ -93,6 +103,7 @@ public:
 private:
     GLuint vbo, ebo;
     GLenum _primitiveType = GL_TRIANGLES;
+    GLenum _indexType = GL_UNSIGNED_SHORT;
     std::array<glm::vec3, 8> _bounds;
 
     Material* _material;
@@ -87,6 +87,10 @@ public:
         return _vertices;
     }
 
+    // Multiply the positions of all accumulated vertices by `factor`.
+    // Used by LOD meshes, which are built on a downsampled voxel grid.
+    void Scale(int factor);
+
     // Get vertex count
     size_t GetVertexCount() const {
         return _vertices.size();
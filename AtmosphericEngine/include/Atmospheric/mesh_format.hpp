@@ -0,0 +1,96 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Cooked mesh (.aemesh)
+//
+// Written offline by tools/mesh_cooker from OBJ / glTF, already optimised for
+// the post-transform vertex cache, overdraw and vertex fetch.  Loading is
+// zero-parse: ParseMeshFile validates the header and the index range and
+// hands back spans into the file bytes, which go to glBufferData as-is — so
+// the bytes can come straight from an mmap'd asset pack.
+//
+// Layout (little-endian)
+// ──────────────────────
+//   MeshFileHeader
+//   PackedVertex[vertexCount]          at vertexOffset, 16-byte aligned
+//   uint16 or uint32[indexCount]       at indexOffset,  16-byte aligned
+//
+// Indices are 16-bit unless the mesh has more than 65536 vertices.
+// ─────────────────────────────────────────────────────────────────────────────
+constexpr char     MESH_FILE_MAGIC[4]  = { 'A', 'E', 'M', 'S' };
+constexpr uint32_t MESH_FILE_VERSION   = 1;
+constexpr uint32_t MESH_FILE_ALIGNMENT = 16;
+
+enum MeshFileFlags : uint32_t {
+    MESH_FILE_INDEX32 = 1u << 0,
+};
+
+struct MeshFileHeader {
+    char     magic[4];          // "AEMS"
+    uint32_t version;
+    uint32_t flags;             // MeshFileFlags
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    uint32_t vertexStride;      // sizeof(PackedVertex)
+    uint64_t vertexOffset;      // from the start of the file
+    uint64_t indexOffset;
+    float    boundsMin[3];
+    float    boundsMax[3];
+    float    sphereCenter[3];
+    float    sphereRadius;
+};
+static_assert(sizeof(MeshFileHeader) == 80, "MeshFileHeader layout changed");
+
+// 28 bytes against Vertex's 56.  The attribute locations and shader inputs
+// are unchanged; GL widens the packed types to float when fetching.
+struct PackedVertex {
+    float    position[3];
+    uint16_t uv[2];             // half float
+    uint32_t normal;            // snorm 2_10_10_10_REV, w unused
+    uint32_t tangent;
+    uint32_t bitangent;
+};
+static_assert(sizeof(PackedVertex) == 28, "PackedVertex layout changed");
+
+// Quantisation helpers, shared with the cooker's round-trip check
+uint16_t FloatToHalf(float value);
+float    HalfToFloat(uint16_t half);
+uint32_t PackSnorm1010102(float x, float y, float z);
+void     UnpackSnorm1010102(uint32_t packed, float out[3]);
+
+// Spans into the parsed file; valid as long as its bytes are
+struct MeshView {
+    const MeshFileHeader*          header = nullptr;
+    std::span<const PackedVertex>  vertices;
+    std::span<const uint8_t>       indices;     // indexCount * GetIndexSize() bytes
+
+    bool     Is32BitIndices() const { return header && (header->flags & MESH_FILE_INDEX32); }
+    size_t   GetIndexSize() const { return Is32BitIndices() ? 4 : 2; }
+    size_t   GetIndexCount() const { return header ? header->indexCount : 0; }
+    uint32_t GetIndex(size_t i) const;
+};
+
+// Validates and maps `file`, which must be aligned to alignof(MeshFileHeader),
+// i.e. 8 bytes (vectors and pack views are).  Rejects any index >= vertexCount.  On failure `error`
+// describes why.
+bool ParseMeshFile(std::span<const uint8_t> file, MeshView& out, std::string* error = nullptr);
+
+// Uncompressed input to WriteMeshFile.  Per-vertex arrays; the optional ones
+// may be empty.  Tangent w is the bitangent sign: B = cross(N, T) * w.
+struct MeshSource {
+    std::vector<float>    positions;    // xyz
+    std::vector<float>    uvs;          // uv
+    std::vector<float>    normals;      // xyz
+    std::vector<float>    tangents;     // xyzw
+    std::vector<uint32_t> indices;      // triangle list
+
+    size_t GetVertexCount() const { return positions.size() / 3; }
+};
+
+// Quantises and serialises `mesh` in its current vertex and index order;
+// optimise first.  Computes the AABB and bounding sphere.
+std::vector<uint8_t> WriteMeshFile(const MeshSource& mesh);
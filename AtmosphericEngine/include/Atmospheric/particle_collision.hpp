@@ -0,0 +1,75 @@
+#pragma once
+
+#include "particle_storage.hpp"
+#include <glm/glm.hpp>
+#include <vector>
+
+class TerrainComponent;
+class VoxelWorld;
+
+namespace Atmospheric {
+    // Collision shapes seen by CPU particles.  Particles live outside of
+    // spheres and boxes and above planes and heightfields.
+    struct ParticlePlaneCollider {
+        glm::vec3 normal;// unit length
+        float distance;  // dot(normal, p) == distance on the plane
+    };
+
+    struct ParticleSphereCollider {
+        glm::vec3 center;
+        float radius;
+    };
+
+    struct ParticleBoxCollider {
+        glm::vec3 min;
+        glm::vec3 max;
+    };
+
+    // Coarse height grid, row-major [z * width + x]; x/z outside the grid
+    // are not collided.
+    struct ParticleHeightfieldCollider {
+        const float* heights = nullptr;
+        int width = 0;
+        int depth = 0;
+        glm::vec3 origin = glm::vec3(0.0f);// world position of sample (0, 0), height 0
+        float cellSize = 1.0f;
+
+        static ParticleHeightfieldCollider FromTerrain(const TerrainComponent& terrain);
+    };
+
+    struct ParticleColliders {
+        std::vector<ParticlePlaneCollider> planes;
+        std::vector<ParticleSphereCollider> spheres;
+        std::vector<ParticleBoxCollider> boxes;
+        std::vector<ParticleHeightfieldCollider> heightfields;
+        const VoxelWorld* voxels = nullptr;
+
+        bool IsEmpty() const {
+            return planes.empty() && spheres.empty() && boxes.empty() && heightfields.empty() && !voxels;
+        }
+        void Clear() {
+            *this = ParticleColliders();
+        }
+    };
+
+    enum class ParticleCollisionResponse { Bounce, Kill };
+
+    struct ParticleCollisionParams {
+        ParticleCollisionResponse response = ParticleCollisionResponse::Bounce;
+        float restitution = 0.5f;// normal velocity kept after a bounce
+        float friction = 0.2f;   // tangential velocity lost per contact
+        float radius = 0.0f;     // particle radius used for contact
+        float dt = 0.0f;         // step just integrated, to recover the previous position
+    };
+
+    // Resolves [begin, end) against every collider after IntegrateParticles.
+    // Bounce pushes particles back to the surface and reflects their velocity;
+    // Kill zeroes their life so the next compaction drops them.
+    void CollideParticles(
+      ParticleStorage& s,
+      uint32_t begin,
+      uint32_t end,
+      const ParticleColliders& colliders,
+      const ParticleCollisionParams& params
+    );
+}// namespace Atmospheric
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "component.hpp"
+#include "depth_sort.hpp"
 #include "globals.hpp"
+#include "particle_collision.hpp"
+#include "particle_storage.hpp"
 #include <glm/vec3.hpp>
 #include <string>
 
@@ -20,8 +23,45 @@ namespace Atmospheric {
 
     class ParticleServer;
 
+    // GPU simulates with transform feedback; CPU simulates SoA storage on the
+    // JobSystem and uploads instance data (works without GL for headless runs).
+    enum class ParticleBackend { GPU, CPU };
+
     struct ParticleEmitterProps {
-        // Add properties here
+        ParticleBackend backend = ParticleBackend::GPU;
+
+        // CPU backend only
+        float emissionRate = 1000.0f;// particles per second
+        float lifetimeMin = 2.0f;
+        float lifetimeMax = 5.0f;
+        float speedMin = 0.5f;
+        float speedMax = 1.0f;
+        glm::vec3 direction = glm::vec3(0.0f, 1.0f, 0.0f);
+        float spread = 0.5f;// 0 = straight along direction, 1 = full sphere
+        float spawnRadius = 0.1f;
+        float sizeMin = 0.05f;
+        float sizeMax = 0.1f;
+        glm::vec3 gravity = glm::vec3(0.0f, -9.8f, 0.0f);
+        float drag = 0.1f;// fraction of velocity lost per second
+        glm::vec4 colorStart = glm::vec4(1.0f);
+        glm::vec4 colorEnd = glm::vec4(1.0f, 1.0f, 1.0f, 0.0f);
+
+        // Spawning is deterministic per seed; 0 picks a unique one
+        uint32_t seed = 0;
+        // Under the global spawn budget higher priorities are served first
+        int priority = 0;
+        // Spawn rate falls linearly to zero at this camera distance; 0 disables
+        float throttleDistance = 0.0f;
+
+        // Collide against ParticleServer::GetColliders()
+        bool collide = false;
+        ParticleCollisionResponse collisionResponse = ParticleCollisionResponse::Bounce;
+        float restitution = 0.5f;
+        float friction = 0.2f;
+        float collisionRadius = 0.0f;
+
+        // Draw back to front, for alpha-blended (non-additive) particles
+        bool sortByDepth = false;
     };
 
     class ParticleEmitterComponent : public Component {
@@ -30,12 +70,33 @@ namespace Atmospheric {
         ~ParticleEmitterComponent() override;
 
         // --- Component Interface ---
+        std::string GetName() const override {
+            return "ParticleEmitterComponent";
+        }
         void OnAttach() override;
         void OnDetach() override;
 
         uint32_t GetMaxParticles() const {
             return max_particles;
         }
+        // Instances to draw: alive particles on the CPU backend, the whole pool on GPU
+        uint32_t GetDrawCount() const {
+            return props.backend == ParticleBackend::CPU ? storage.count : max_particles;
+        }
+        bool IsCPU() const {
+            return props.backend == ParticleBackend::CPU;
+        }
+        const ParticleEmitterProps& GetProps() const {
+            return props;
+        }
+        const ParticleStorage& GetStorage() const {
+            return storage;
+        }
+        // Latest CPU simulation output, in the same layout as the GPU buffers
+        // and in draw order
+        const std::vector<Particle>& GetInstances() const {
+            return props.sortByDepth ? sorted_instances : instances;
+        }
 
         GLuint GetCurrentSourceVBO() const;
         GLuint GetCurrentDestinationVBO() const;
@@ -50,8 +111,21 @@ namespace Atmospheric {
         friend class ParticleServer;
 
         ParticleServer& server;
+        ParticleEmitterProps props;
         uint32_t max_particles;
 
+        // CPU backend state; storage grows on demand from the ParticlePool
+        ParticleStorage storage;
+        std::vector<Particle> instances;
+        float emission_accumulator = 0.0f;
+        uint32_t seed = 0;
+        uint32_t spawn_counter = 0;
+        uint32_t spawn_allowance = 0;// granted by the server each frame
+        uint32_t vbo_capacity = 0;
+        DepthSorter sorter;
+        std::vector<uint32_t> sort_keys;
+        std::vector<Particle> sorted_instances;
+
         // We manage raw GLuints here as they are specific to this system
         GLuint particle_vbos[2] = { 0, 0 };
         GLuint vao = 0;// VAO to define particle layout for simulation pass
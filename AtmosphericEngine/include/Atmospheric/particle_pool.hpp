@@ -0,0 +1,50 @@
+#pragma once
+
+#include "particle_storage.hpp"
+#include <mutex>
+#include <vector>
+
+namespace Atmospheric {
+    // Shared backing memory for CPU emitters.  Emitters start empty and grow
+    // in power-of-two steps as they need room; the total capacity handed out
+    // never exceeds the global budget, and storage released by one emitter is
+    // recycled for the next one that needs the same size.
+    class ParticlePool {
+    public:
+        static constexpr uint32_t MIN_CAPACITY = 64;
+        static constexpr size_t MAX_RECYCLED = 32;
+
+        static ParticlePool& Get() {
+            static ParticlePool instance;
+            return instance;
+        }
+
+        ParticlePool(const ParticlePool&) = delete;
+        void operator=(const ParticlePool&) = delete;
+
+        void SetBudget(uint32_t maxParticles);
+        uint32_t GetBudget() const {
+            return budget;
+        }
+        uint32_t GetInUse() const {
+            return in_use;
+        }
+
+        // Grows `storage` so it can hold `wanted` particles, never past `limit`
+        // or the remaining budget.  Alive particles are kept.  Thread-safe.
+        // Returns the resulting capacity (unchanged when the budget is spent).
+        uint32_t Grow(ParticleStorage& storage, uint32_t wanted, uint32_t limit);
+        // Returns the storage's capacity to the budget and keeps its memory for reuse
+        void Release(ParticleStorage& storage);
+        // Frees all recycled memory
+        void Trim();
+
+    private:
+        ParticlePool() = default;
+
+        std::mutex mutex;
+        uint32_t budget = 1u << 20;
+        uint32_t in_use = 0;
+        std::vector<ParticleStorage> recycled;
+    };
+}// namespace Atmospheric
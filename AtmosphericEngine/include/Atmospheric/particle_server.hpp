@@ -1,5 +1,6 @@
 #pragma once
 
+#include "particle_collision.hpp"
 #include <glm/glm.hpp>
 #include <vector>
 
@@ -38,9 +39,34 @@ namespace Atmospheric {
         void CreateEmitterResources(ParticleEmitterComponent* emitter);
         void ReleaseEmitterResources(ParticleEmitterComponent* emitter);
 
+        // Steps every emitter: GPU emitters via transform feedback, CPU
+        // emitters on the JobSystem.  Safe to call without Init() when all
+        // emitters use the CPU backend (headless).
         void Simulate(float deltaTime);
         void Draw(const CameraInfo& camInfo);
 
+        // Upper bound on CPU particles spawned per Simulate() across all
+        // emitters, handed out by priority, then by distance to the viewer
+        void SetSpawnBudget(uint32_t particlesPerFrame) {
+            spawn_budget = particlesPerFrame;
+        }
+        uint32_t GetSpawnBudget() const {
+            return spawn_budget;
+        }
+        uint32_t GetSpawnsDeniedLastFrame() const {
+            return spawns_denied;
+        }
+        // World shapes CPU emitters with `collide` set bounce off or die on.
+        // Read by worker jobs during Simulate(); don't modify it meanwhile.
+        ParticleColliders& GetColliders() {
+            return colliders;
+        }
+
+        // Defaults to the camera of the last Draw(); set it for headless runs
+        void SetViewerPosition(const glm::vec3& position) {
+            viewer_position = position;
+        }
+
     private:
         ParticleServer() = default;
         ~ParticleServer() = default;
@@ -54,7 +80,18 @@ namespace Atmospheric {
 
         Mesh* quad_mesh = nullptr;
 
+        ParticleColliders colliders;
+        uint32_t spawn_budget = 50000;
+        uint32_t spawns_denied = 0;
+        glm::vec3 viewer_position = glm::vec3(0.0f);
+
+        static constexpr uint32_t CPU_GRAIN = 16384;// particles per integration job
+
         void CreatePipelines();
         void CreateSharedResources();
+        void SimulateGPU(float deltaTime);
+        void SimulateCPU(float deltaTime);
+        void AllocateSpawns(const std::vector<ParticleEmitterComponent*>& cpuEmitters, float deltaTime);
+        static void EmitParticles(ParticleEmitterComponent* emitter);
     };
 }// namespace Atmospheric
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace Atmospheric {
+    struct Particle;
+
+    // Structure-of-arrays particle state for the CPU backend.  Alive particles
+    // are packed in [0, count); arrays are padded to a multiple of LANES so the
+    // SIMD loops never need a scalar tail.  Only the fields touched every step
+    // stay float; spawn-time constants are packed to 16 bits.
+    struct ParticleStorage {
+        static constexpr uint32_t LANES = 4;
+        static constexpr float LIFETIME_TICKS = 1024.0f;// per second, ~64 s max
+
+        std::vector<float> px, py, pz;
+        std::vector<float> vx, vy, vz;
+        std::vector<float> life;        // seconds left
+        std::vector<uint16_t> lifetime; // seconds at spawn * LIFETIME_TICKS
+        std::vector<uint16_t> size;     // half float
+        uint32_t count = 0;
+        uint32_t capacity = 0;
+
+        // Reallocates for `maxParticles` and drops all particles
+        void Allocate(uint32_t maxParticles);
+        // Copies the alive particles of `other`; capacity must suffice
+        void CopyFrom(const ParticleStorage& other);
+
+        void SetLifetime(uint32_t i, float seconds);
+        float GetLifetime(uint32_t i) const;
+        void SetSize(uint32_t i, float size);
+        float GetSize(uint32_t i) const;
+
+        // Moves the last alive particle into slot i
+        void Kill(uint32_t i);
+    };
+
+    struct ParticleIntegrateParams {
+        glm::vec3 gravity;
+        float damping;// velocity scale per step, 1 - drag * dt
+        float dt;
+    };
+
+    // v += g dt; v *= damping; p += v dt; life -= dt, over [begin, end).
+    // begin must be a multiple of LANES.
+    void IntegrateParticles(ParticleStorage& s, uint32_t begin, uint32_t end, const ParticleIntegrateParams& params);
+
+    // Swap-removes particles whose life ran out; returns how many died
+    uint32_t CompactParticles(ParticleStorage& s);
+
+    // Writes [begin, end) as instance records, fading color by remaining life
+    void WriteParticleInstances(
+      const ParticleStorage& s,
+      uint32_t begin,
+      uint32_t end,
+      const glm::vec4& colorStart,
+      const glm::vec4& colorEnd,
+      Particle* out
+    );
+}// namespace Atmospheric
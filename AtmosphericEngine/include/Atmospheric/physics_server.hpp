@@ -1,6 +1,9 @@
 #pragma once
 #include "globals.hpp"
 #include "server.hpp"
+#include "contact_tracker.hpp"
+#include "fixed_step_clock.hpp"
+#include "physics_snapshot.hpp"
 
 class GameObject;
 
@@ -17,6 +20,26 @@ struct RaycastHit {
     float hitFraction;
 };
 
+using ColliderID = uint32_t;
+
+// Batched query inputs.  Results are written to caller-owned arrays; a miss
+// leaves gameObject == nullptr and hitFraction == 1.
+struct RayQuery {
+    glm::vec3 from;
+    glm::vec3 to;
+};
+
+struct SweepQuery {
+    ColliderID shape;     // a convex collider (cube, sphere, ...)
+    glm::vec3 from;
+    glm::vec3 to;
+};
+
+struct OverlapQuery {
+    ColliderID shape;
+    glm::vec3 position;
+};
+
 class btCollisionConfiguration;
 class btCollisionDispatcher;
 class btBroadphaseInterface;
@@ -28,8 +51,6 @@ class PhysicsDebugDrawer;
 class RigidbodyComponent;
 class BulletTaskScheduler;
 
-using ColliderID = uint32_t;
-
 class PhysicsServer : public Server
 {
 private:
@@ -56,8 +77,71 @@ public:
     void DestroyCollider(ColliderID col);
 
     bool Raycast(const glm::vec3& from, const glm::vec3& to, RaycastHit& hit);
+
+    // Batched queries, split across JobSystem workers.  Call outside of
+    // Process() (the world must not be stepping).  Each returns the number
+    // of queries that hit anything.
+    // Closest hit per ray into hits[i].
+    size_t RaycastBatch(const RayQuery* rays, size_t count, RaycastHit* hits);
+    // Every hit of every ray, packed into hits[0 .. maxHits): ray i's hits
+    // are hits[offsets[i] .. offsets[i + 1]), nearest first, so `offsets`
+    // needs count + 1 entries.  Once maxHits is reached the remaining hits
+    // are dropped, the last rays' first.
+    size_t RaycastAllBatch(const RayQuery* rays, size_t count, RaycastHit* hits, size_t maxHits, uint32_t* offsets);
+    // Closest hit of a convex shape swept from `from` to `to`.
+    size_t SweepBatch(const SweepQuery* sweeps, size_t count, RaycastHit* hits);
+    // Up to maxResultsPerQuery overlapping objects per query into
+    // results[i * maxResultsPerQuery ...]; resultCounts[i] receives the count.
+    size_t OverlapBatch(
+      const OverlapQuery* queries, size_t count, GameObject** results, size_t maxResultsPerQuery, uint32_t* resultCounts
+    );
+
+    // Contact events of the last Process(), diffed against the previous one.
+    // Subscribers are called once per frame with all events passing their filter.
+    const ContactEvents& GetContactEvents() const {
+        return _contacts.GetEvents();
+    }
+    ContactSubscriberID SubscribeContacts(const ContactFilter& filter, ContactListener listener) {
+        return _contacts.Subscribe(filter, std::move(listener));
+    }
+    void UnsubscribeContacts(ContactSubscriberID id) {
+        _contacts.Unsubscribe(id);
+    }
     void SetGravity(const glm::vec3& acc);
 
+    // Render-facing transforms interpolate between the last two steps by this
+    float GetInterpolationAlpha() const {
+        return _clock.GetAlpha();
+    }
+    int GetLastStepCount() const {
+        return _lastStepCount;
+    }
+    void SetMaxSubSteps(int maxSubSteps) {
+        _clock.maxSubSteps = maxSubSteps;
+    }
+
+    // Writes interpolated poses to the GameObjects of bodies that moved in the
+    // last stepped frame, plus a final settle for bodies that just stopped.
+    // Sleeping bodies are never visited.
+    void SyncTransforms();
+    // Called from the rigidbody motion state when Bullet moves a body
+    void MarkMoved(RigidbodyComponent* rb);
+
+    // Snapshot of every registered body (transform, velocities, sleep state)
+    // plus the step accumulator.  Bullet's contact manifolds can't be
+    // serialized, so LoadSnapshot drops them: bodies in contact restart
+    // without warm starting and drift slightly from the run that was saved,
+    // while bodies out of contact continue bit for bit.  For bit-identical
+    // replays, start every run from a loaded snapshot.  Returns false, and
+    // leaves the world untouched, if the snapshot is malformed or doesn't
+    // match the registered bodies.
+    void SaveSnapshot(PhysicsSnapshot& snapshot) const;
+    bool LoadSnapshot(const PhysicsSnapshot& snapshot);
+    uint64_t ComputeStateHash() const;
+    // Loads the snapshot, then runs `steps` fixed steps, calling
+    // applyInput(i) before step i.  Contact events are not dispatched.
+    bool Resimulate(const PhysicsSnapshot& snapshot, int steps, const std::function<void(int)>& applyInput = nullptr);
+
     void DrawDebug();
     void EnableDebugUI(bool enable = true);
 
@@ -71,7 +155,18 @@ private:
     std::unique_ptr<BulletTaskScheduler> _taskScheduler;
     std::unordered_map<ColliderID, btCollisionShape*> _colliders;
     std::vector<RigidbodyComponent*> _impostors;
-    float _timeAccum;
+    ContactTracker _contacts;
+    FixedStepClock _clock;
+    int _lastStepCount = 0;
+    uint64_t _frame = 0;
+    std::vector<RigidbodyComponent*> _moved;          // moved during _frame
+    std::vector<RigidbodyComponent*> _movedLastFrame; // candidates to settle
+
+    void CollectContacts();
+    void StepSimulation(int steps, const std::function<void(int)>& beforeStep = nullptr);
+
+    // Runs fn(begin, end) over [0, count) in JobSystem-sized slices and waits
+    void ParallelQuery(size_t count, const std::function<void(size_t, size_t)>& fn);
 
     bool _debugUIEnabled = false;
     ColliderID _nextColliderID = 0;
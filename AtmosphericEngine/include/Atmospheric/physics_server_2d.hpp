@@ -1,13 +1,17 @@
 #pragma once
 
+#include "fixed_step_clock.hpp"
+#include "physics_snapshot.hpp"
 #include "server.hpp"
 #include <box2d/box2d.h>
 #include <functional>
 #include <glm/vec2.hpp>
+#include <memory>
 #include <vector>
 
 class Rigidbody2DComponent;
 class GameObject;
+class Box2DTaskScheduler;
 
 // Collision callback types
 using CollisionCallback = std::function<void(Rigidbody2DComponent*, Rigidbody2DComponent*)>;
@@ -29,6 +33,13 @@ public:
     void Process(float dt) override;
     void DrawImGui(float dt) override;
 
+    // Box2D solver threads, bridged onto the JobSystem.  Must be set before
+    // Init(); <= 0 uses every JobSystem thread, 1 keeps stepping serial.
+    void SetWorkerCount(int workerCount) {
+        _workerCount = workerCount;
+    }
+    int GetWorkerCount() const;
+
     // World management
     void SetGravity(const glm::vec2& gravity);
     glm::vec2 GetGravity() const;
@@ -45,6 +56,32 @@ public:
     void SetBeginContactCallback(CollisionCallback callback);
     void SetEndContactCallback(CollisionCallback callback);
 
+    // Fixed-step state; transforms are interpolated by GetInterpolationAlpha()
+    float GetInterpolationAlpha() const {
+        return _clock.GetAlpha();
+    }
+    int GetLastStepCount() const {
+        return _lastStepCount;
+    }
+    void SetMaxSteps(int maxSteps) {
+        _clock.maxSubSteps = maxSteps;
+    }
+
+    // Snapshot of every registered body (transform, velocities, awake flag)
+    // plus the step accumulator.  Box2D v3 doesn't expose its contact cache
+    // or sleep timers, so those are not captured: LoadSnapshot destroys every
+    // contact and the next step rebuilds them without warm starting, which
+    // may report touching pairs as ending and beginning again.  Bodies out of
+    // contact continue bit for bit.  LoadSnapshot returns false, and leaves
+    // the world untouched, if the snapshot is malformed or doesn't match the
+    // registered bodies.
+    void SaveSnapshot(PhysicsSnapshot& snapshot) const;
+    bool LoadSnapshot(const PhysicsSnapshot& snapshot);
+    uint64_t ComputeStateHash() const;
+    // Loads the snapshot, then runs `steps` fixed steps, calling
+    // applyInput(i) before step i.  Contact callbacks are not fired.
+    bool Resimulate(const PhysicsSnapshot& snapshot, int steps, const std::function<void(int)>& applyInput = nullptr);
+
     // Debug drawing
     void SetDebugDraw(bool enabled) {
         _debugDrawEnabled = enabled;
@@ -91,11 +128,22 @@ public:
 
 private:
     b2WorldId _worldId;
+    std::unique_ptr<Box2DTaskScheduler> _taskScheduler;
+    int _workerCount = 0;
     std::vector<Rigidbody2DComponent*> _rigidbodies;
     bool _debugDrawEnabled = false;
 
     // Simulation parameters
-    int _subSteps = 4;
-    float _accumulator = 0.0f;
-    const float _fixedTimeStep = 1.0f / 60.0f;
+    int _subSteps = 4;// Box2D solver sub-steps per fixed step
+    FixedStepClock _clock;
+    int _lastStepCount = 0;
+
+    // Change-driven sync: only bodies reported by b2World_GetBodyEvents are
+    // touched, so sleeping bodies cost nothing per frame.
+    void StepSimulation(int steps, const std::function<void(int)>& beforeStep = nullptr);
+    void CollectMovedBodies();
+    void SyncMovedBodies();
+    uint64_t _frame = 0;
+    std::vector<Rigidbody2DComponent*> _moved;
+    std::vector<Rigidbody2DComponent*> _movedLastFrame;
 };
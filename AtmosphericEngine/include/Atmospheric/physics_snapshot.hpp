@@ -0,0 +1,68 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Compact binary image of a physics world, produced by
+// PhysicsServer/Physics2DServer::SaveSnapshot.  Bodies are stored in
+// registration order, so a snapshot only restores into a world holding the
+// same bodies registered in the same order.
+struct PhysicsSnapshot {
+    std::vector<uint8_t> data;
+
+    bool IsEmpty() const {
+        return data.empty();
+    }
+};
+
+// Little helpers to (de)serialize trivially copyable values into a snapshot
+class SnapshotWriter {
+public:
+    explicit SnapshotWriter(PhysicsSnapshot& snapshot) : _data(snapshot.data) {
+        _data.clear();
+    }
+
+    template<typename T>
+    void Write(const T& value) {
+        size_t offset = _data.size();
+        _data.resize(offset + sizeof(T));
+        std::memcpy(_data.data() + offset, &value, sizeof(T));
+    }
+
+private:
+    std::vector<uint8_t>& _data;
+};
+
+class SnapshotReader {
+public:
+    explicit SnapshotReader(const PhysicsSnapshot& snapshot) : _data(snapshot.data) {
+    }
+
+    // Returns false (and leaves value untouched) when the snapshot is truncated
+    template<typename T>
+    bool Read(T& value) {
+        if (_offset + sizeof(T) > _data.size()) return false;
+        std::memcpy(&value, _data.data() + _offset, sizeof(T));
+        _offset += sizeof(T);
+        return true;
+    }
+
+    bool AtEnd() const {
+        return _offset == _data.size();
+    }
+
+private:
+    const std::vector<uint8_t>& _data;
+    size_t _offset = 0;
+};
+
+// FNV-1a over the snapshot bytes; equal hashes step by step mean the two
+// simulations stayed bit-identical.
+inline uint64_t HashSnapshot(const PhysicsSnapshot& snapshot) {
+    uint64_t hash = 14695981039346656037ull;
+    for (uint8_t byte : snapshot.data) {
+        hash ^= byte;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
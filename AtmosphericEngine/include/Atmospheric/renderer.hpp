@@ -3,12 +3,14 @@
 #include "batch_renderer_2d.hpp"
 #include "buffer.hpp"
 #include "config.hpp"
+#include "depth_sort.hpp"
 #include "glm/mat4x4.hpp"
 #include "globals.hpp"
 #include "mesh.hpp"
 #include "render_target.hpp"
 #include <memory>
 
+class CanvasDrawable;
 class GraphicsServer;
 class ShaderProgram;
 class Renderer;
@@ -66,11 +68,23 @@ public:
 class WorldCanvasPass : public RenderPass {
 public:
     void Execute(GraphicsServer* ctx, Renderer& renderer, CommandEncoder* enc = nullptr) override;
+
+private:
+    // Kept across frames so a steady scene re-sorts with an insertion pass
+    DepthSorter _sorter;
+    std::vector<uint32_t> _keys;
 };
 
 class CanvasPass : public RenderPass {
 public:
     void Execute(GraphicsServer* ctx, Renderer& renderer, CommandEncoder* enc = nullptr) override;
+
+private:
+    // Per-frame buffers, kept to avoid reallocating
+    DepthSorter _sorter;
+    std::vector<uint32_t> _keys;
+    std::vector<CanvasDrawable*> _drawables;
+    std::vector<CanvasDrawable*> _sorted;
 };
 
 // Final composite blit: ACES tonemapping + optional chromatic aberration.
@@ -66,7 +66,11 @@ public:
         return true;
     }
 
-    void SyncToTransform(float dt);
+    // Writes the body pose, interpolated between the last two steps by
+    // alpha, to the GameObject transform.
+    void SyncToTransform(float alpha);
+    void StorePreviousTransform();
+    void StoreCurrentTransform();
 
     // Position and rotation (in pixels and radians)
     glm::vec2 GetPosition() const;
@@ -123,4 +127,14 @@ private:
     Rigidbody2DProps _props;
     Shape2DDef _shapeDef;
     b2BodyId _bodyId;
+    b2Transform _prevTransform = b2Transform_identity;
+    b2Transform _currTransform = b2Transform_identity;
+    uint64_t _lastMovedFrame = UINT64_MAX;
+
+    // Fed from Box2D body move events after each step
+    void OnStepTransform(const b2Transform& t) {
+        _prevTransform = _currTransform;
+        _currTransform = t;
+    }
+    friend class Physics2DServer;
 };
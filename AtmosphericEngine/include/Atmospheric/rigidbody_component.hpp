@@ -20,6 +20,7 @@ struct RigidbodyProps {
 
 class GameObject;
 class PhysicsServer;
+class RigidbodyMotionState;
 
 class RigidbodyComponent : public Component {
 public:
@@ -44,6 +45,12 @@ public:
     glm::mat4 GetWorldTransform();
     void SetWorldTransform(const glm::vec3& position, const glm::vec3& rotation);
 
+    // Transform lerped/slerped between the last two physics steps; alpha
+    // comes from PhysicsServer::GetInterpolationAlpha().
+    glm::mat4 GetInterpolatedTransform(float alpha) const;
+    void StorePreviousTransform();
+    void StoreCurrentTransform();
+
     void WakeUp();
     void Sleep();
 
@@ -71,5 +78,12 @@ public:
 
 private:
     btRigidBody* _rigidbody;
+    glm::vec3 _prevPosition, _currPosition;
+    glm::quat _prevRotation, _currRotation;
+    uint64_t _lastMovedFrame = UINT64_MAX;
+
+    // Called by the motion state whenever Bullet moves an awake body
+    void OnStepTransform(const btTransform& t);
+    friend class RigidbodyMotionState;
     friend class PhysicsServer;
 };
\ No newline at end of file
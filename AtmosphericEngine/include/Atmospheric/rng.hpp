@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <random>
 
 namespace Atmospheric {
@@ -18,4 +19,36 @@ namespace Atmospheric {
     private:
         std::mt19937 rng;
     };
+
+    // Stateless integer hash: the same (seed, counter) always yields the same
+    // value, so work can be split across threads without sharing RNG state.
+    inline uint32_t HashRandom(uint32_t seed, uint32_t counter) {
+        uint32_t x = counter * 0xB5297A4Du;
+        x += seed;
+        x ^= x >> 8;
+        x += 0x68E31DA4u;
+        x ^= x << 8;
+        x *= 0x1B56C4E9u;
+        x ^= x >> 8;
+        return x;
+    }
+
+    // Counter-based generator over HashRandom; copy it freely, there is no
+    // hidden state beyond the counter.
+    struct CounterRNG {
+        uint32_t seed = 0;
+        uint32_t counter = 0;
+
+        uint32_t Next() {
+            return HashRandom(seed, counter++);
+        }
+
+        float RandomFloat() {
+            return static_cast<float>(Next() >> 8) * (1.0f / 16777216.0f);
+        }
+
+        float RandomFloatInRange(float min, float max) {
+            return min + (max - min) * RandomFloat();
+        }
+    };
 }// namespace Atmospheric
@@ -0,0 +1,97 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Scene arena
+//
+// Bump allocator for objects that live exactly as long as the current scene
+// (see Application::GetSceneArena).  Allocation is a pointer bump inside a
+// block; Reserve lets a loader that knows its node count up front get one
+// block big enough for the whole scene.  Objects with non-trivial destructors
+// are threaded onto an intrusive list stored in the arena itself, so Release
+// runs them newest-first and then drops the blocks in one go instead of
+// freeing object by object.  The largest block is kept for the next scene.
+//
+// Not thread-safe: scenes are built and torn down on the main thread.
+// ─────────────────────────────────────────────────────────────────────────────
+class SceneArena {
+    struct Finalizer {
+        void (*destroy)(void*);
+        void* object;
+        Finalizer* next;
+    };
+
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = size_t(64) << 10;
+
+    SceneArena() = default;
+    ~SceneArena() {
+        Release();
+    }
+    SceneArena(const SceneArena&) = delete;
+    SceneArena& operator=(const SceneArena&) = delete;
+
+    // Upper bound on the arena bytes one New<T> takes, for sizing Reserve
+    template<typename T> static constexpr size_t SizeFor() {
+        size_t size = sizeof(T) + alignof(T) - 1;
+        if constexpr (!std::is_trivially_destructible_v<T>) size += sizeof(Finalizer) + alignof(Finalizer) - 1;
+        return size;
+    }
+
+    // Makes sure the next `bytes` of allocations fit without a new block
+    void Reserve(size_t bytes);
+
+    void* Allocate(size_t size, size_t alignment);
+
+    template<typename T, typename... Args> T* New(Args&&... args) {
+        T* object = new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            auto* node = static_cast<Finalizer*>(Allocate(sizeof(Finalizer), alignof(Finalizer)));
+            node->destroy = [](void* p) { static_cast<T*>(p)->~T(); };
+            node->object = object;
+            node->next = _finalizers;
+            _finalizers = node;
+        }
+        return object;
+    }
+
+    // Copies the characters into the arena; the view is valid until Release
+    std::string_view CopyString(std::string_view text);
+
+    // Destroys everything made with New and resets the arena
+    void Release();
+
+    // Whether `p` points into memory handed out since the last Release
+    bool Owns(const void* p) const;
+
+    size_t GetBytesUsed() const {
+        return _bytesUsed;
+    }
+    size_t GetBlockCount() const {
+        return _blocks.size();
+    }
+    // Blocks requested from the heap over the arena's lifetime
+    size_t GetBlockAllocations() const {
+        return _blockAllocations;
+    }
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size = 0;
+    };
+
+    void AddBlock(size_t minSize);
+
+    std::vector<Block> _blocks;
+    size_t _offset = 0;// into _blocks.back()
+    size_t _bytesUsed = 0;
+    size_t _blockAllocations = 0;
+    Finalizer* _finalizers = nullptr;
+};
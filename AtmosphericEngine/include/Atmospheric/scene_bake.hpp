@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct SceneProps;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Baked scenes (.aesb)
+//
+// A JSON scene (assets/scenes/<name>.json, see Application::LoadScene) baked
+// offline into the flatbuffer described by schemas/BakedScene.fbs.  Baking
+// reads the JSON with ReadSceneJSON (scene_props.hpp) — so everything the
+// JSON loader works out per load, from component type strings and enum names
+// to defaults and degrees → radians, is settled once — then interns every
+// string and flattens the entity and action trees into arrays.
+// Application::LoadBakedScene reads it back with ReadBakedScene, no JSON
+// parsing involved.
+//
+// Each bake records HashSceneSource of its JSON.  SceneTransition only uses a
+// bake whose hash matches the JSON beside it, so an edited scene is never
+// shadowed by a stale .aesb; shipped builds without the JSON use the bake.
+// ─────────────────────────────────────────────────────────────────────────────
+
+// Bakes JSON scene text.  On failure returns false and, if `error` is given,
+// says why; `out` is left empty.
+bool BakeScene(std::string_view json, std::vector<uint8_t>& out, std::string* error = nullptr);
+
+// Reads a buffer from BakeScene back into the props its JSON gave.  Returns
+// false if it doesn't verify.
+bool ReadBakedScene(std::span<const uint8_t> bytes, SceneProps& out);
+
+// HashContent of the JSON text, as stored in the bake
+uint64_t HashSceneSource(std::string_view json);
+
+// The hash a baked scene was made from; 0 for bakes that predate it.
+// Returns false if the bytes are not a valid baked scene.
+bool GetBakedSceneSourceHash(std::span<const uint8_t> bytes, uint64_t& sourceHash);
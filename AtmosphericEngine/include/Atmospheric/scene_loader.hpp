@@ -2,11 +2,13 @@
 #include "globals.hpp"
 #include <functional>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 class Application;
 class GameObject;
+class SceneArena;
 
 struct TextProps;
 
@@ -21,14 +23,21 @@ namespace flatbuffers {
     struct NodeAction;
 }// namespace flatbuffers
 
-// Result of loading a scene file
+// Result of loading a scene file.  The nodes, their components and the name
+// strings live in the application's scene arena, so everything here is only
+// valid until the next scene change (Application::ReleaseSceneArena).
 struct SceneLoadResult {
     GameObject* root = nullptr;
-    std::vector<GameObject*> allNodes;
-    std::unordered_map<int, GameObject*> nodesByActionTag;
-    std::unordered_map<std::string, GameObject*> nodesByName;
+    std::vector<GameObject*> allNodes;// pre-order
+    // Sorted by key.  When several nodes share a key the last one in
+    // pre-order wins.
+    std::vector<std::pair<int, GameObject*>> nodesByActionTag;
+    std::vector<std::pair<std::string_view, GameObject*>> nodesByName;
     bool success = false;
     std::string error;
+
+    GameObject* FindByActionTag(int actionTag) const;
+    GameObject* FindByName(std::string_view name) const;
 };
 
 // Configuration for scene loading
@@ -74,6 +83,12 @@ public:
 private:
     Application* _app;
 
+    // Allocates the node from the scene arena
+    GameObject* NewNode(glm::vec3 position, glm::vec3 rotation, glm::vec3 scale);
+
+    // Pre-pass: sizes the arena and result tables before any node is created
+    void ReserveFor(const flatbuffers::CSParseBinary* csb, SceneLoadResult& result);
+
     // Parse the binary and create node hierarchy
     GameObject* ParseNodeTree(
       const flatbuffers::NodeTree* nodeTree, const SceneLoadConfig& config, SceneLoadResult& result, GameObject* parent
@@ -0,0 +1,81 @@
+#pragma once
+#include "action.hpp"
+#include "animator_2d.hpp"
+#include "camera_component.hpp"
+#include "light_component.hpp"
+#include "shader.hpp"
+#include "sprite_component.hpp"
+#include "text_component.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Scene props
+//
+// What a JSON scene (assets/scenes/<name>.json) or its baked form (.aesb, see
+// scene_bake.hpp) describes, decoded into the props the components are built
+// from.  Both readers produce this, and Application instantiates it in one
+// place, so the two formats cannot build different objects; the only rules
+// that differ per format are how the fields are read.  Nothing here touches
+// GL or the asset manager — texture paths stay paths until instantiation.
+// ─────────────────────────────────────────────────────────────────────────────
+
+enum class SceneActionType : uint8_t { MoveTo, MoveBy, RotateTo, RotateBy, ScaleTo, ColorTo, FadeTo, Sequence, RepeatForever };
+
+// An action tree as the readers accept it: a Sequence holds no RepeatForever
+// and a RepeatForever holds exactly one non-RepeatForever action, so every
+// node builds.  `value` is the position / delta / rotation (radians) / scale
+// in xyz, the color, or the alpha in x.
+struct SceneActionProps {
+    SceneActionType type = SceneActionType::MoveTo;
+    float duration = 0.0f;
+    EasingType easing = EasingType::Linear;
+    glm::vec4 value = glm::vec4(0.0f);
+    std::vector<SceneActionProps> children;
+};
+
+struct SceneSpriteProps {
+    SpriteProps props;// textureID unset
+    std::string texture;
+};
+
+struct SceneAnimatorProps {
+    std::vector<AnimationClip> clips;
+    std::string autoPlay;
+};
+
+struct SceneActionsProps {
+    std::vector<SceneActionProps> actions;
+};
+
+using SceneComponentProps =
+  std::variant<SceneSpriteProps, TextProps, CameraProps, LightProps, SceneAnimatorProps, SceneActionsProps>;
+
+struct SceneEntityProps {
+    std::string name;
+    int parent = -1;// index into SceneProps::entities, always below this one's
+    bool active = true;
+    glm::vec3 position = glm::vec3(0.0f);
+    glm::vec3 rotation = glm::vec3(0.0f);// radians
+    glm::vec3 scale = glm::vec3(1.0f);
+    std::vector<SceneComponentProps> components;
+};
+
+struct SceneProps {
+    std::string name;
+    std::vector<std::string> textures;
+    std::unordered_map<std::string, ShaderProgramProps> shaders;
+    // Pre-order, parents before children
+    std::vector<SceneEntityProps> entities;
+    // Baked scenes only: HashContent of the JSON they were baked from, 0 for
+    // bakes older than the field
+    uint64_t sourceHash = 0;
+};
+
+// JSON scene text.  Unknown component types and unbuildable actions are
+// skipped.  On malformed JSON returns false and, if given, sets `error`.
+bool ReadSceneJSON(std::string_view json, SceneProps& out, std::string* error = nullptr);
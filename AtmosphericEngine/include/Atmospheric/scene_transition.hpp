@@ -1,5 +1,7 @@
 #pragma once
+#include <cstdint>
 #include <functional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -7,18 +9,24 @@
 #include <unordered_map>
 
 // Describes the assets required by one game/scene.
-// Loaded from assets/scenes/<name>.json.
+// Loaded from assets/scenes/<name>.aesb (baked, see scene_bake.hpp) or
+// assets/scenes/<name>.json.
 struct GameManifest {
     std::string              name;
     std::vector<std::string> textures;
     std::unordered_map<std::string, ShaderProgramProps> shaders;
 
     static GameManifest FromJSON(const std::string& json);
+    // Returns false if the bytes are not a valid baked scene
+    static bool FromBaked(std::span<const uint8_t> bytes, GameManifest& out);
 };
 
 // Async scene transition: prefetch assets → clear previous scene → load new assets → callback.
 //
-// Manifest path convention: assets/scenes/<sceneName>.json
+// Manifest path convention: assets/scenes/<sceneName>.aesb, falling back to
+// assets/scenes/<sceneName>.json when there is no bake or it is stale (see
+// ResolveScenePath).  The scene's asset-graph node depends on both files, so
+// editing either reloads it.
 //
 // Usage:
 //   SceneTransition::Go("poker", [this]{
@@ -34,6 +42,11 @@ public:
     static void Go(const std::string& sceneName, OnReadyFn onReady, OnErrorFn onError = nullptr,
                    const std::string& currentSceneName = "");
 
+    // The file a scene loads from: its .aesb when that verifies and was baked
+    // from the .json beside it — or no .json ships, as in a packed build —
+    // otherwise the .json.  A stale or invalid bake is logged.
+    static std::string ResolveScenePath(const std::string& sceneName);
+
 private:
     static constexpr const char* kManifestDir = "assets/scenes/";
 };
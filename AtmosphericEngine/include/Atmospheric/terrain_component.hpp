@@ -36,11 +36,29 @@ public:
     }
     void SetMaterial(Material* material);
 
+    // Heightmap in world units, row-major [z * width + x], spanning
+    // worldSize x worldSize centred on the owner's position.
+    const std::vector<float>& GetHeightData() const {
+        return _heightData;
+    }
+    int GetHeightmapWidth() const {
+        return _heightmapWidth;
+    }
+    int GetHeightmapDepth() const {
+        return _heightmapDepth;
+    }
+    float GetWorldSize() const {
+        return _worldSize;
+    }
+
 private:
     GraphicsServer* _graphics;
     PhysicsServer* _physics;
     Mesh* _mesh;
     std::vector<float> _heightData;// Keep heightmap data alive
+    int _heightmapWidth = 0;
+    int _heightmapDepth = 0;
+    float _worldSize = 0.0f;
 
     void LoadHeightmap(const std::string& path, const TerrainProps& props);
 };
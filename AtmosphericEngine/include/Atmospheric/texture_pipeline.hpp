@@ -0,0 +1,172 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TexturePipeline
+//
+// Staged texture loading:
+//
+//   Request (main)  → placeholder handle, valid immediately
+//   JobSystem jobs  → read → disk cache hit, or
+//                     decode (stb) → CPU mip chain (box or Kaiser filter)
+//                     → optional BC1/BC3 encode → disk cache store;
+//                     KTX2 files are transcoded (basisu) instead
+//   Pump (main)     → uploads finished mips within a per-frame byte budget,
+//                     smallest level first, so a texture sharpens over a
+//                     few frames instead of stalling one.
+//
+// Every GPU call goes through a TextureUploadSink, so the CPU stages run
+// headless against a stub sink.
+// ─────────────────────────────────────────────────────────────────────────────
+using TextureHandle = uint32_t;
+
+class JobSystem;
+class TextureDiskCache;
+struct JobCounter;
+
+enum class TexturePixelFormat { R8, RGBA8, BC1, BC3, ETC1, ETC2_RGBA };
+
+enum class MipFilter { Box, Kaiser };
+
+struct TextureMip {
+    uint32_t             width  = 0;
+    uint32_t             height = 0;
+    std::vector<uint8_t> data;
+};
+
+struct TexturePayload {
+    TexturePixelFormat      format = TexturePixelFormat::RGBA8;
+    std::vector<TextureMip> mips;   // [0] = full resolution
+
+    size_t GetByteSize() const;
+};
+
+// Where one request's time went; upload time is summed over the frames its
+// levels were spread across
+struct TextureLoadTimes {
+    uint64_t fileBytes    = 0;
+    uint64_t contentHash  = 0;// set when the disk cache is on
+    float    readMs       = 0.0f;
+    float    decodeMs     = 0.0f;// decode, mips and BC encode, or KTX2 transcode
+    float    uploadMs     = 0.0f;
+    bool     diskCacheHit = false;
+};
+
+// ── CPU stages (thread-safe, no GL) ──────────────────────────────────────────
+// Decodes PNG / JPG / … into R8 or RGBA8 level 0.
+bool DecodeTextureImage(std::span<const uint8_t> file, TexturePayload& out);
+
+// Appends mips down to 1×1 from payload.mips[0]; uncompressed formats only.
+void GenerateMipChain(TexturePayload& payload, MipFilter filter);
+
+// Re-encodes an RGBA8 payload (every mip) as BC1, or BC3 if any texel of
+// level 0 is translucent.  Level 0 must be a multiple of 4 in both
+// dimensions; returns false and leaves the payload alone otherwise.
+bool CompressTextureBC(TexturePayload& payload);
+
+// Transcodes every level of a KTX2 file to BC1/BC3 (preferS3TC) or ETC1/ETC2.
+// Requires basisu_transcoder_init() to have run; false without Basis support.
+bool TranscodeKTX2(std::span<const uint8_t> file, bool preferS3TC, TexturePayload& out);
+
+// ── GPU side ─────────────────────────────────────────────────────────────────
+class TextureUploadSink {
+public:
+    virtual ~TextureUploadSink() = default;
+
+    // A sampleable 1×1 texture; its handle later receives the real levels
+    virtual TextureHandle CreatePlaceholder() = 0;
+    // Uploads one level.  Levels arrive smallest first; afterwards the
+    // texture should sample only levels [level, mips - 1].
+    virtual void UploadLevel(TextureHandle handle, const TexturePayload& payload, uint32_t level) = 0;
+    // Every level of `payload` is uploaded
+    virtual void OnComplete(
+      TextureHandle /*handle*/,
+      const std::string& /*path*/,
+      const TexturePayload& /*payload*/,
+      const TextureLoadTimes& /*times*/
+    ) {
+    }
+    // Loading failed; the placeholder stays
+    virtual void OnFailed(TextureHandle /*handle*/, const std::string& /*path*/) {
+    }
+};
+
+struct TexturePipelineConfig {
+    MipFilter   filter        = MipFilter::Box;
+    bool        preferS3TC    = false;// KTX2 target: BC1/BC3 if true, else ETC1/ETC2
+    bool        blockCompress = false;// with preferS3TC: encode RGBA8 images as BC1/BC3
+    int         workerCount   = -1;   // textures in flight as jobs; -1 = half the JobSystem's threads; 0 = run stages inline
+    std::string diskCacheDir;          // decoded payloads are cached here; empty = off (always off on web)
+};
+
+class TexturePipeline {
+public:
+    explicit TexturePipeline(TextureUploadSink& sink, TexturePipelineConfig config = {});
+    ~TexturePipeline();
+    TexturePipeline(const TexturePipeline&)            = delete;
+    TexturePipeline& operator=(const TexturePipeline&) = delete;
+
+    // Main thread.  Returns the placeholder handle and queues the CPU stages.
+    TextureHandle Request(const std::string& path);
+    // Main thread.  Loads `path` again into an existing handle, which keeps
+    // showing its old levels until the new ones arrive.  Supersedes any load
+    // still in flight for the handle.
+    void Reload(TextureHandle handle, const std::string& path);
+
+    // Main thread.  Uploads finished levels until `byteBudget` bytes went to
+    // the sink (at least one level when any is ready).  Returns bytes uploaded.
+    size_t Pump(size_t byteBudget);
+
+    // Forgets a request; results arriving later are dropped.  Call before
+    // deleting the handle, since the name may be recycled.
+    void Cancel(TextureHandle handle);
+    void CancelAll();
+
+    // Requests not yet fully uploaded
+    size_t GetPendingCount() const;
+
+private:
+    struct Job {
+        TextureHandle handle;
+        uint64_t      ticket;
+        std::string   path;
+    };
+    struct Result {
+        Job              job;
+        TexturePayload   payload;
+        TextureLoadTimes times;
+        bool             ok = false;
+    };
+
+    void Enqueue(TextureHandle handle, const std::string& path);
+    void ProcessNext();
+    void Process(Job job);
+    bool IsLive(const Job& job) const;   // caller holds _mutex
+
+    TextureUploadSink&                _sink;
+    TexturePipelineConfig             _config;
+    std::unique_ptr<TextureDiskCache> _diskCache;
+    JobSystem*                        _jobSystem;
+    std::unique_ptr<JobCounter>       _jobsInFlight;
+    int                               _maxJobs  = 0;
+    int                               _running  = 0;  // jobs submitted, not finished
+    bool                              _stopping = false;
+
+    mutable std::mutex                          _mutex;
+    std::deque<Job>                             _jobs;
+    std::deque<Result>                          _results;
+    std::unordered_map<TextureHandle, uint64_t> _live;  // handle → ticket of its current request
+    uint64_t                                    _nextTicket = 1;
+
+    // Main thread only: the payload being uploaded across frames
+    Result   _uploading;
+    bool     _hasUpload = false;
+    uint32_t _nextLevel = 0;// counts down to 0
+};
@@ -5,13 +5,25 @@
 #include "globals.hpp"
 #include <array>
 #include <cstdint>
+#include <vector>
 #include <glm/vec3.hpp>
 
 class GraphicsServer;
 
 class VoxelChunkComponent : public Component {
 public:
-    static constexpr int SIZE = 32;
+    static constexpr int SIZE  = 32;
+    static constexpr int SHIFT = 5;        // log2(SIZE)
+    static constexpr int MASK  = SIZE - 1;
+    static_assert((1 << SHIFT) == SIZE, "chunk SIZE must be a power of two");
+    // LOD n meshes a grid downsampled by 2^n (LOD 3 = 8x, 4^3 cells per chunk)
+    static constexpr int MAX_LOD = 3;
+
+    // World voxel coordinate -> chunk coordinate / local coordinate.
+    // Arithmetic shift and mask floor toward -inf, so negative coordinates
+    // map to the correct chunk (-1 -> chunk -1, local 31).
+    static constexpr int WorldToChunk(int w) { return w >> SHIFT; }
+    static constexpr int WorldToLocal(int w) { return w & MASK; }
 
     VoxelChunkComponent(GameObject* owner, GraphicsServer* gfx, glm::ivec3 chunkPos);
     ~VoxelChunkComponent();
@@ -28,7 +40,25 @@ public:
     // dx, dz in {-1, 0, 1}
     void SetNeighbor(int dx, int dz, VoxelChunkComponent* neighbor);
 
+    // Rebuilds the mesh if dirty and clears the flag.  Without a
+    // GraphicsServer (headless worlds) the vertices are built, counted and
+    // dropped; nothing is uploaded.
     void RebuildMesh();
+    // Greedy-meshes the chunk at its current LOD into an empty `builder`, in
+    // local voxel units.  CPU only, the dirty flag is left alone.
+    void BuildMesh(VoxelMeshBuilder& builder);
+    // Vertices produced by the last RebuildMesh()
+    size_t GetVertexCount() const { return _vertexCount; }
+
+    // Changing the LOD marks the chunk dirty; the next RebuildMesh() meshes
+    // at the new resolution.
+    void SetLOD(int lod);
+    int  GetLOD() const { return _lod; }
+
+    // Downsampled voxel for LOD `lod` at cell (x, y, z) in [0, SIZE >> lod).
+    // A cell is solid when at least half of its voxels are solid, and takes
+    // the type of its topmost solid voxel (terrain palette is height driven).
+    uint8_t GetLODVoxel(int x, int y, int z, int lod) const;
 
     bool       IsDirty()    const { return _dirty; }
     void       MarkDirty()        { _dirty = true; }
@@ -50,9 +80,13 @@ private:
     glm::ivec3           _chunkPos;
     uint8_t              _voxels[SIZE][SIZE][SIZE];
     bool                 _dirty = true;
+    int                  _lod   = 0;
     Mesh*                _mesh  = nullptr;
+    size_t               _vertexCount = 0;
     VoxelChunkComponent* _neighbors[3][3];
+    std::vector<uint8_t> _lodVoxels; // downsampled grid, valid during RebuildMesh
 
     uint8_t GetVoxelWithNeighbors(int x, int y, int z) const;
+    uint8_t GetLODVoxelWithNeighbors(int x, int y, int z) const;
     void    BuildGreedyLayer(VoxelMeshBuilder& builder, int axis, int layer, int dir);
 };
@@ -3,6 +3,8 @@
 #include "frustum.hpp"
 #include "renderer.hpp"
 #include <glm/vec3.hpp>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 class Application;
@@ -11,6 +13,19 @@ class PhysicsServer;
 class Mesh;
 class Material;
 
+struct VoxelRay {
+    glm::vec3 origin;
+    glm::vec3 direction;   // need not be normalized
+    float     maxDistance;
+};
+
+struct VoxelRaycastHit {
+    glm::ivec3 voxel;      // world coordinate of the hit voxel
+    glm::ivec3 normal;     // face entered through; zero if the ray starts inside
+    float      distance;
+    uint8_t    type;       // 0 means no hit (batched queries)
+};
+
 class VoxelWorld {
 public:
     static constexpr int WORLD_X = 25;
@@ -22,18 +37,100 @@ public:
 
     // Creates GameObjects with VoxelChunkComponents via the Application.
     void Init(Application* app, int seed = 42);
+    // Creates and generates the same chunk grid without an Application, for
+    // tests, benchmarks and tools: the world owns its chunks and meshes them
+    // on Update() without uploading anything.  `parallel` = false generates
+    // every column on the calling thread, which must give the same voxels.
+    void InitHeadless(int seed = 42, bool parallel = true);
     void Update(float dt, const glm::vec3& cameraPos);
 
     // Submit visible chunk render commands to the renderer opaque queue.
     void SubmitRenderCommands(Renderer* renderer, const glm::mat4& viewProj,
                               const glm::vec3& cameraPos);
 
+    // World-space voxel access; any int coordinate is valid, voxels in
+    // chunks that don't exist read as air and ignore writes.
+    // Not thread-safe: consecutive calls reuse a cached chunk lookup.
     uint8_t GetVoxel(int wx, int wy, int wz) const;
     void    SetVoxel(int wx, int wy, int wz, uint8_t type);
 
+    // Queue an edit for the next Update().  Repeated edits to the same voxel
+    // within a frame coalesce (last write wins).
+    void QueueEdit(int wx, int wy, int wz, uint8_t type);
+
+    // Wall-clock budget for chunk remeshing per Update(); dirty chunks are
+    // rebuilt nearest-to-camera first and the rest carry over to later frames.
+    // At least one chunk is always rebuilt so progress is guaranteed.
+    float remeshBudgetMs = 4.0f;
+
+    // Bulk access over the half-open box [min, max), walked chunk by chunk.
+    // ReadRegion writes x-major (x, then y, then z) into `out`, resized to fit.
+    void FillRegion(const glm::ivec3& min, const glm::ivec3& max, uint8_t type);
+    void ReadRegion(const glm::ivec3& min, const glm::ivec3& max,
+                    std::vector<uint8_t>& out) const;
+
+    // Amanatides–Woo DDA through the voxel grid, crossing chunk borders.
+    // The ray is clipped to the box of loaded chunks, so maxDistance may be
+    // infinite.
+    bool Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance,
+                 VoxelRaycastHit& hit) const;
+    // Casts `count` rays split across JobSystem workers; misses leave
+    // hits[i].type == 0.  Returns the number of hits.
+    size_t RaycastBatch(const VoxelRay* rays, VoxelRaycastHit* hits, size_t count) const;
+
+    // True if any solid voxel intersects the shape.
+    bool OverlapBox(const glm::vec3& min, const glm::vec3& max) const;
+    bool OverlapSphere(const glm::vec3& center, float radius) const;
+
+    // Per-query chunk cache, so queries don't share _lastChunk and can run
+    // on worker threads.  Keep one cursor per thread and pass it to
+    // SampleVoxel for spatially coherent lookups.
+    struct ChunkCursor {
+        glm::ivec3                 pos { INT32_MIN };
+        const VoxelChunkComponent* chunk = nullptr;
+    };
+    uint8_t SampleVoxel(const glm::ivec3& w, ChunkCursor& cursor) const;
+
+    // Adds an empty chunk at a chunk coordinate, which may lie outside the
+    // generated WORLD_X/Y/Z box.  Returns the existing chunk if present.
+    // Horizontal neighbours already loaded are marked dirty: the faces they
+    // culled or walled off against the missing chunk must be remeshed.
+    VoxelChunkComponent* CreateChunk(const glm::ivec3& chunkPos);
+
+    // Surface height (in voxels) of the generated terrain column at (wx, wz),
+    // read from the heightmap cache filled by GenerateTerrain().
+    int GetTerrainHeight(int wx, int wz) const;
+
+    // Camera distance (world units) beyond which LOD n+1 is used.  Switching
+    // is damped by LOD_HYSTERESIS so a chunk on a boundary does not flicker.
+    static constexpr float LOD_DISTANCES[VoxelChunkComponent::MAX_LOD] = { 192.0f, 320.0f, 512.0f };
+    static constexpr float LOD_HYSTERESIS = 16.0f;
+
+    // Pure LOD selection: returns the LOD a chunk currently at `currentLod`
+    // should use at `distance`.
+    static int SelectLOD(int currentLod, float distance);
+
 private:
-    // Raw pointers — lifetime managed by the Application's entity list.
+    // Hash of a full integer coordinate: keys built from it never alias, no
+    // matter how far from the origin the world extends.
+    struct CoordHash {
+        size_t operator()(const glm::ivec3& p) const {
+            uint64_t h = (uint32_t)p.x * 0x9E3779B97F4A7C15ull;
+            h = (h ^ (h >> 29) ^ (uint32_t)p.y) * 0xBF58476D1CE4E5B9ull;
+            h = (h ^ (h >> 32) ^ (uint32_t)p.z) * 0x94D049BB133111EBull;
+            return (size_t)(h ^ (h >> 31));
+        }
+    };
+
+    // Raw pointers — lifetime managed by the Application's entity list, or
+    // by _ownedChunks in a headless world.
     std::vector<VoxelChunkComponent*> _chunks;
+    std::vector<std::unique_ptr<VoxelChunkComponent>> _ownedChunks;
+    std::unordered_map<glm::ivec3, VoxelChunkComponent*, CoordHash> _chunkMap;
+    // Inclusive box around every chunk, in chunk coordinates
+    glm::ivec3 _chunkMin { INT32_MAX };
+    glm::ivec3 _chunkMax { INT32_MIN };
+    Application*    _app        = nullptr;
     GraphicsServer* _gfx        = nullptr;
     int             _seed       = 42;
     Mesh*           _waterMesh  = nullptr;
@@ -41,10 +138,38 @@ private:
 
     static constexpr float WATER_LINE = 32.0f; // matches VX WATER_LINE
 
+    // Heightmap of one chunk column, shared by all vertical chunks in it.
+    // `generated` is set once the column's voxels are written; GenerateTerrain
+    // skips such columns, so it only fills columns that are still new.
+    struct TerrainColumn {
+        bool    generated = false;
+        int16_t height[VoxelChunkComponent::SIZE][VoxelChunkComponent::SIZE];
+    };
+    std::vector<TerrainColumn> _columns; // [cx * WORLD_Z + cz]
+
+    // Last chunk hit by GetVoxel/SetVoxel; coherent access skips the hash lookup
+    mutable glm::ivec3           _lastChunkPos { INT32_MIN };
+    mutable VoxelChunkComponent* _lastChunk = nullptr;
+
+    // Pending edits keyed by world coordinate
+    std::unordered_map<glm::ivec3, uint8_t, CoordHash> _pendingEdits;
+    glm::vec3 _cameraPos { 0.0f };
+
+    // Applies a voxel write and dirties the neighbours whose mesh samples it.
+    void WriteVoxel(int wx, int wy, int wz, uint8_t type);
+    // Dirties the horizontal neighbours of chunk (cx, cy, cz) whose boundary
+    // cells overlap the local box [lo, hi): a neighbour at LOD n reads the
+    // 2^n voxels nearest their shared face.
+    void DirtyNeighbours(int cx, int cy, int cz, const glm::ivec3& lo, const glm::ivec3& hi);
+    void ApplyPendingEdits();
+
+    // Safe to call concurrently (read-only map lookup, no cache).
     VoxelChunkComponent* GetChunk(int cx, int cy, int cz) const;
-    int                  ChunkIndex(int cx, int cy, int cz) const;
+    VoxelChunkComponent* GetChunkCached(int cx, int cy, int cz) const;
 
-    void GenerateTerrain();
-    void LinkNeighbors();
-    void RebuildDirtyChunks();
+    void CreateChunkGrid();
+    void GenerateTerrain(bool parallel = true);
+    void GenerateColumn(int cx, int cz);
+    void UpdateLODs(const glm::vec3& cameraPos);
+    void RebuildDirtyChunks(float budgetMs);
 };
@@ -12,6 +12,8 @@
 #include "rigidbody_component.hpp"
 #include "rmlui_manager.hpp"
 #include "scene.hpp"
+#include "scene_bake.hpp"
+#include "scene_props.hpp"
 #include "scene_transition.hpp"
 #include "shape_renderer_component.hpp"
 #include "sprite_3d_component.hpp"
@@ -20,7 +22,6 @@
 #include "action_manager.hpp"
 #include "action.hpp"
 #include "file_system.hpp"
-#include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
 #include "terrain_component.hpp"
 #include "transform_component.hpp"
@@ -116,8 +117,9 @@ Application::~Application() {
     ENGINE_LOG("Exiting...");
     _window->DeinitImGui();
 
-    for (const auto& go : _entities)
-        delete go;
+    for (const auto& go : _entities) {
+        if (!_sceneArena.Owns(go)) delete go;
+    }
 
     for (auto* layer : _layers) {
         layer->OnDetach();
@@ -135,12 +137,19 @@ void Application::Run() {
     audio.Init(this);
     graphics.Init(this);
     physics.Init(this);// Note that physics debug drawer is dependent on graphics server
+    physics2D.SetWorkerCount(_config.physics2DWorkers);
     physics2D.Init(this);
     for (auto& subsystem : _subsystems) {
         subsystem->Init(this);
     }
     ENGINE_LOG("Subsystems initialized.");
 
+    TexturePipelineConfig textureConfig;
+    textureConfig.blockCompress = _config.compressTextures;
+    textureConfig.diskCacheDir  = _config.textureCacheDir;
+    AssetManager::Get().SetTexturePipelineConfig(textureConfig);
+    if (_config.hotReload) AssetManager::Get().EnableHotReload();
+
     auto windowSize = _window->GetFramebufferSize();
     RmlUiManager::Get()->Initialize(windowSize.width, windowSize.height, graphics.renderer);
 
@@ -151,6 +160,12 @@ void Application::Run() {
 #ifdef TRACY_ENABLE
         FrameMark;
 #endif
+        // Streamed file completions (scene loads included) and texture mip
+        // uploads run here, on the main thread and within budget, before
+        // update and render split up
+        FileSystem::Get().PumpCompletions(_config.fileCallbackBudget);
+        AssetManager::Get().PumpTextureUploads(_config.textureUploadBudget);
+        if (_config.hotReload) ReloadChangedAssets();
 #if SINGLE_THREAD || defined(__EMSCRIPTEN__)
         // Emscripten: no pthreads in this build — update and render serially.
         Update(currFrame);
@@ -163,6 +178,7 @@ void Application::Run() {
         _clock++;
     });
 
+    if (!_config.assetStatsFile.empty()) AssetManager::Get().GetLoadStats().Write(_config.assetStatsFile);
     RmlUiManager::Get()->Shutdown();
 }
 
@@ -217,421 +233,148 @@ void Application::LoadScene(const SceneDef& scene) {
     _currentSceneDef = scene;
 }
 
-static glm::vec3 ParseVec3(const nlohmann::json& val, const glm::vec3& defaultValue) {
-    if (val.is_array() && !val.empty()) {
-        float x = val[0].get<float>();
-        float y = val.size() >= 2 ? val[1].get<float>() : defaultValue.y;
-        float z = val.size() >= 3 ? val[2].get<float>() : defaultValue.z;
-        return glm::vec3(x, y, z);
+// ─────────────────────────────────────────────────────────────────────────────
+// JSON and baked scenes both arrive as SceneProps (scene_props.hpp); this is
+// the one place they become game objects
+// ─────────────────────────────────────────────────────────────────────────────
+static GLuint ResolveSceneTexture(const std::string& texPath) {
+    GLuint texID = AssetManager::Get().GetTexture(texPath);
+    if (texID == 0) {
+        try {
+            texID = AssetManager::Get().CreateTexture(texPath);
+        } catch (const std::exception& e) {
+            spdlog::warn("Application::LoadScene: Failed to load texture '{}': {}", texPath, e.what());
+        }
     }
-    return defaultValue;
+    return texID;
 }
 
-static glm::vec2 ParseVec2(const nlohmann::json& val, const glm::vec2& defaultValue) {
-    if (val.is_array() && !val.empty()) {
-        float x = val[0].get<float>();
-        float y = val.size() >= 2 ? val[1].get<float>() : defaultValue.y;
-        return glm::vec2(x, y);
+// The readers only produce trees that build, so the casts always succeed
+static Action* BuildAction(const SceneActionProps& props) {
+    ActionInterval* action = nullptr;
+    switch (props.type) {
+        case SceneActionType::MoveTo: action = new MoveTo(props.duration, glm::vec3(props.value)); break;
+        case SceneActionType::MoveBy: action = new MoveBy(props.duration, glm::vec3(props.value)); break;
+        case SceneActionType::RotateTo: action = new RotateTo(props.duration, glm::vec3(props.value)); break;
+        case SceneActionType::RotateBy: action = new RotateBy(props.duration, glm::vec3(props.value)); break;
+        case SceneActionType::ScaleTo: action = new ScaleTo(props.duration, glm::vec3(props.value)); break;
+        case SceneActionType::ColorTo: action = new ColorTo(props.duration, props.value); break;
+        case SceneActionType::FadeTo: action = new FadeTo(props.duration, props.value.x); break;
+        case SceneActionType::Sequence: {
+            std::vector<FiniteTimeAction*> steps;
+            for (const auto& child : props.children) steps.push_back(static_cast<FiniteTimeAction*>(BuildAction(child)));
+            return new Sequence(steps);
+        }
+        case SceneActionType::RepeatForever:
+            return new RepeatForever(static_cast<ActionInterval*>(BuildAction(props.children.front())));
     }
-    return defaultValue;
+    action->SetEasing(props.easing);
+    return action;
 }
 
-static glm::vec4 ParseVec4(const nlohmann::json& val, const glm::vec4& defaultValue) {
-    if (val.is_array() && !val.empty()) {
-        float r = val[0].get<float>();
-        float g = val.size() >= 2 ? val[1].get<float>() : defaultValue.g;
-        float b = val.size() >= 3 ? val[2].get<float>() : defaultValue.b;
-        float a = val.size() >= 4 ? val[3].get<float>() : defaultValue.a;
-        return glm::vec4(r, g, b, a);
-    }
-    return defaultValue;
-}
-
-static EasingType ParseEasingType(const std::string& easingStr) {
-    if (easingStr == "Linear") return EasingType::Linear;
-    if (easingStr == "SineIn") return EasingType::SineIn;
-    if (easingStr == "SineOut") return EasingType::SineOut;
-    if (easingStr == "SineInOut") return EasingType::SineInOut;
-    if (easingStr == "QuadIn") return EasingType::QuadIn;
-    if (easingStr == "QuadOut") return EasingType::QuadOut;
-    if (easingStr == "QuadInOut") return EasingType::QuadInOut;
-    if (easingStr == "CubicIn") return EasingType::CubicIn;
-    if (easingStr == "CubicOut") return EasingType::CubicOut;
-    if (easingStr == "CubicInOut") return EasingType::CubicInOut;
-    if (easingStr == "QuartIn") return EasingType::QuartIn;
-    if (easingStr == "QuartOut") return EasingType::QuartOut;
-    if (easingStr == "QuartInOut") return EasingType::QuartInOut;
-    if (easingStr == "QuintIn") return EasingType::QuintIn;
-    if (easingStr == "QuintOut") return EasingType::QuintOut;
-    if (easingStr == "QuintInOut") return EasingType::QuintInOut;
-    if (easingStr == "ExpoIn") return EasingType::ExpoIn;
-    if (easingStr == "ExpoOut") return EasingType::ExpoOut;
-    if (easingStr == "ExpoInOut") return EasingType::ExpoInOut;
-    if (easingStr == "CircIn") return EasingType::CircIn;
-    if (easingStr == "CircOut") return EasingType::CircOut;
-    if (easingStr == "CircInOut") return EasingType::CircInOut;
-    if (easingStr == "BackIn") return EasingType::BackIn;
-    if (easingStr == "BackOut") return EasingType::BackOut;
-    if (easingStr == "BackInOut") return EasingType::BackInOut;
-    if (easingStr == "ElasticIn") return EasingType::ElasticIn;
-    if (easingStr == "ElasticOut") return EasingType::ElasticOut;
-    if (easingStr == "ElasticInOut") return EasingType::ElasticInOut;
-    if (easingStr == "BounceIn") return EasingType::BounceIn;
-    if (easingStr == "BounceOut") return EasingType::BounceOut;
-    if (easingStr == "BounceInOut") return EasingType::BounceInOut;
-    return EasingType::Linear;
-}
-
-static Action* ParseAction(const nlohmann::json& val) {
-    if (!val.is_object()) return nullptr;
-
-    std::string type = val.value("type", "");
-    float duration = val.value("duration", 0.0f);
-    std::string easingStr = val.value("easing", "Linear");
-    EasingType easing = ParseEasingType(easingStr);
-
-    if (type == "MoveTo") {
-        glm::vec3 pos = ParseVec3(val.value("position", nlohmann::json::array()), glm::vec3(0.0f));
-        auto* action = new MoveTo(duration, pos);
-        action->SetEasing(easing);
-        return action;
+static void AddSceneComponent(GameObject* go, const SceneComponentProps& component) {
+    if (const auto* sprite = std::get_if<SceneSpriteProps>(&component)) {
+        SpriteProps props = sprite->props;
+        if (!sprite->texture.empty()) props.textureID = static_cast<int>(ResolveSceneTexture(sprite->texture));
+        go->AddComponent<SpriteComponent>(props);
+    } else if (const auto* text = std::get_if<TextProps>(&component)) {
+        go->AddComponent<TextComponent>(*text);
+    } else if (const auto* camera = std::get_if<CameraProps>(&component)) {
+        go->AddComponent<CameraComponent>(*camera);
+    } else if (const auto* light = std::get_if<LightProps>(&component)) {
+        go->AddComponent<LightComponent>(*light);
+    } else if (const auto* animatorProps = std::get_if<SceneAnimatorProps>(&component)) {
+        auto* animator = new Animator2D(go);
+        go->AddComponent(animator);
+        for (const auto& clip : animatorProps->clips) animator->AddAnimation(clip.name, clip);
+        if (!animatorProps->autoPlay.empty()) animator->Play(animatorProps->autoPlay);
+    } else if (const auto* actions = std::get_if<SceneActionsProps>(&component)) {
+        auto* actionManager = new ActionManager(go);
+        go->AddComponent(actionManager);
+        for (const auto& action : actions->actions) actionManager->RunAction(BuildAction(action));
     }
-    else if (type == "MoveBy") {
-        glm::vec3 delta = ParseVec3(val.value("deltaPosition", nlohmann::json::array()), glm::vec3(0.0f));
-        auto* action = new MoveBy(duration, delta);
-        action->SetEasing(easing);
-        return action;
-    }
-    else if (type == "RotateTo") {
-        glm::vec3 rot(0.0f);
-        if (val.contains("rotation") && val["rotation"].is_array() && !val["rotation"].empty()) {
-            rot.x = glm::radians(val["rotation"][0].get<float>());
-            rot.y = val["rotation"].size() >= 2 ? glm::radians(val["rotation"][1].get<float>()) : 0.0f;
-            rot.z = val["rotation"].size() >= 3 ? glm::radians(val["rotation"][2].get<float>()) : 0.0f;
+}
+
+void Application::LoadScene(const SceneProps& scene) {
+    // Load textures
+    std::vector<std::string> texturesToLoad;
+    for (const auto& texPath : scene.textures) {
+        if (AssetManager::Get().GetTexture(texPath) == 0) {
+            texturesToLoad.push_back(texPath);
         }
-        auto* action = new RotateTo(duration, rot);
-        action->SetEasing(easing);
-        return action;
     }
-    else if (type == "RotateBy") {
-        glm::vec3 delta(0.0f);
-        if (val.contains("deltaRotation") && val["deltaRotation"].is_array() && !val["deltaRotation"].empty()) {
-            delta.x = glm::radians(val["deltaRotation"][0].get<float>());
-            delta.y = val["deltaRotation"].size() >= 2 ? glm::radians(val["deltaRotation"][1].get<float>()) : 0.0f;
-            delta.z = val["deltaRotation"].size() >= 3 ? glm::radians(val["deltaRotation"][2].get<float>()) : 0.0f;
+    if (!texturesToLoad.empty()) {
+        if (_config.useDefaultTextures) {
+            AssetManager::Get().LoadDefaultTextures();
         }
-        auto* action = new RotateBy(duration, delta);
-        action->SetEasing(easing);
-        return action;
+        AssetManager::Get().LoadTextures(texturesToLoad);
+        ENGINE_LOG("Scene textures created.");
     }
-    else if (type == "ScaleTo") {
-        glm::vec3 scale = ParseVec3(val.value("scale", nlohmann::json::array()), glm::vec3(1.0f));
-        auto* action = new ScaleTo(duration, scale);
-        action->SetEasing(easing);
-        return action;
-    }
-    else if (type == "ColorTo") {
-        glm::vec4 color = ParseVec4(val.value("color", nlohmann::json::array()), glm::vec4(1.0f));
-        auto* action = new ColorTo(duration, color);
-        action->SetEasing(easing);
-        return action;
-    }
-    else if (type == "FadeTo") {
-        float alpha = val.value("alpha", 1.0f);
-        auto* action = new FadeTo(duration, alpha);
-        action->SetEasing(easing);
-        return action;
-    }
-    else if (type == "Sequence") {
-        std::vector<FiniteTimeAction*> seqActions;
-        if (val.contains("actions") && val["actions"].is_array()) {
-            for (const auto& actVal : val["actions"]) {
-                Action* parsed = ParseAction(actVal);
-                if (parsed) {
-                    FiniteTimeAction* fta = dynamic_cast<FiniteTimeAction*>(parsed);
-                    if (fta) {
-                        seqActions.push_back(fta);
-                    } else {
-                        spdlog::warn("ParseAction: Sequence only supports FiniteTimeActions. Action ignored.");
-                        delete parsed;
-                    }
-                }
-            }
-        }
-        if (!seqActions.empty()) {
-            return new Sequence(seqActions);
+
+    // Load shaders
+    std::unordered_map<std::string, ShaderProgramProps> shadersToLoad;
+    for (const auto& [name, props] : scene.shaders) {
+        if (AssetManager::Get().GetShader(name) == nullptr) {
+            shadersToLoad[name] = props;
         }
     }
-    else if (type == "RepeatForever") {
-        if (val.contains("action")) {
-            Action* parsed = ParseAction(val["action"]);
-            if (parsed) {
-                ActionInterval* interval = dynamic_cast<ActionInterval*>(parsed);
-                if (interval) {
-                    return new RepeatForever(interval);
-                } else {
-                    spdlog::warn("ParseAction: RepeatForever only supports ActionIntervals. Action ignored.");
-                    delete parsed;
-                }
-            }
+    if (!shadersToLoad.empty()) {
+        if (_config.useDefaultShaders) {
+            AssetManager::Get().LoadDefaultShaders();
         }
-    }
-    return nullptr;
-}
-
-static void ParseEntity(Application* app, const nlohmann::json& entityVal, GameObject* parent) {
-    std::string name = entityVal.value("name", "Entity");
-    glm::vec3 position = ParseVec3(entityVal.value("position", nlohmann::json::array()), glm::vec3(0.0f));
-    glm::vec3 rotationDegrees = ParseVec3(entityVal.value("rotation", nlohmann::json::array()), glm::vec3(0.0f));
-    glm::vec3 rotation = glm::radians(rotationDegrees);
-    glm::vec3 scale = ParseVec3(entityVal.value("scale", nlohmann::json::array()), glm::vec3(1.0f));
-    bool active = entityVal.value("active", true);
-
-    auto* go = app->CreateGameObject(position, rotation, scale);
-    go->SetName(name);
-    go->SetActive(active);
-    if (parent) {
-        go->parent = parent;
+        AssetManager::Get().LoadShaders(shadersToLoad);
+        ENGINE_LOG("Scene shaders created.");
     }
 
-    if (entityVal.contains("components") && entityVal["components"].is_array()) {
-        for (const auto& compVal : entityVal["components"]) {
-            std::string type = compVal.value("type", "");
-            if (type == "SpriteComponent") {
-                SpriteProps props;
-                props.size = ParseVec2(compVal.value("size", nlohmann::json::array()), glm::vec2(100.0f, 100.0f));
-                props.pivot = ParseVec2(compVal.value("pivot", nlohmann::json::array()), glm::vec2(0.5f, 0.5f));
-                props.color = ParseVec4(compVal.value("color", nlohmann::json::array()), glm::vec4(1.0f));
-                
-                if (compVal.contains("texture")) {
-                    std::string texPath = compVal["texture"].get<std::string>();
-                    if (!texPath.empty()) {
-                        GLuint texID = AssetManager::Get().GetTexture(texPath);
-                        if (texID == 0) {
-                            try {
-                                texID = AssetManager::Get().CreateTexture(texPath);
-                            } catch (const std::exception& e) {
-                                spdlog::warn("Application::LoadScene: Failed to load texture '{}': {}", texPath, e.what());
-                            }
-                        }
-                        props.textureID = static_cast<int>(texID);
-                    }
-                }
-
-                if (compVal.contains("layer")) {
-                    std::string layerStr = compVal["layer"].get<std::string>();
-                    if (layerStr == "LAYER_BACKGROUND") props.layer = CanvasLayer::LAYER_BACKGROUND;
-                    else if (layerStr == "LAYER_WORLD_BACK") props.layer = CanvasLayer::LAYER_WORLD_BACK;
-                    else if (layerStr == "LAYER_WORLD") props.layer = CanvasLayer::LAYER_WORLD;
-                    else if (layerStr == "LAYER_WORLD_FRONT") props.layer = CanvasLayer::LAYER_WORLD_FRONT;
-                    else if (layerStr == "LAYER_EFFECTS") props.layer = CanvasLayer::LAYER_EFFECTS;
-                    else if (layerStr == "LAYER_WORLD_2D") props.layer = CanvasLayer::LAYER_WORLD_2D;
-                    else if (layerStr == "LAYER_UI_BACK") props.layer = CanvasLayer::LAYER_UI_BACK;
-                    else if (layerStr == "LAYER_UI") props.layer = CanvasLayer::LAYER_UI;
-                    else if (layerStr == "LAYER_UI_FRONT") props.layer = CanvasLayer::LAYER_UI_FRONT;
-                    else if (layerStr == "LAYER_OVERLAY") props.layer = CanvasLayer::LAYER_OVERLAY;
-                }
-
-                props.flipX = compVal.value("flipX", false);
-                props.flipY = compVal.value("flipY", false);
-                props.zOrder = compVal.value("zOrder", 0);
-
-                go->AddComponent<SpriteComponent>(props);
-            }
-            else if (type == "TextComponent") {
-                TextProps props;
-                props.text = compVal.value("text", "");
-                props.fontPath = compVal.value("fontPath", "");
-                props.fontSize = compVal.value("fontSize", 24.0f);
-                props.size = ParseVec2(compVal.value("size", nlohmann::json::array()), glm::vec2(100.0f, 100.0f));
-                props.pivot = ParseVec2(compVal.value("pivot", nlohmann::json::array()), glm::vec2(0.0f, 0.0f));
-                props.color = ParseVec4(compVal.value("color", nlohmann::json::array()), glm::vec4(1.0f));
-
-                std::string hAlignStr = compVal.value("hAlign", "Left");
-                if (hAlignStr == "Center") props.hAlign = TextHAlignment::Center;
-                else if (hAlignStr == "Right") props.hAlign = TextHAlignment::Right;
-                else props.hAlign = TextHAlignment::Left;
-
-                std::string vAlignStr = compVal.value("vAlign", "Top");
-                if (vAlignStr == "Center") props.vAlign = TextVAlignment::Center;
-                else if (vAlignStr == "Bottom") props.vAlign = TextVAlignment::Bottom;
-                else props.vAlign = TextVAlignment::Top;
-
-                if (compVal.contains("layer")) {
-                    std::string layerStr = compVal["layer"].get<std::string>();
-                    if (layerStr == "LAYER_BACKGROUND") props.layer = CanvasLayer::LAYER_BACKGROUND;
-                    else if (layerStr == "LAYER_WORLD") props.layer = CanvasLayer::LAYER_WORLD;
-                    else if (layerStr == "LAYER_UI") props.layer = CanvasLayer::LAYER_UI;
-                    else if (layerStr == "LAYER_OVERLAY") props.layer = CanvasLayer::LAYER_OVERLAY;
-                }
-
-                props.zOrder = compVal.value("zOrder", 0);
-
-                go->AddComponent<TextComponent>(props);
-            }
-            else if (type == "CameraComponent") {
-                CameraProps props;
-                props.isOrthographic = compVal.value("orthographic", false);
-                if (props.isOrthographic) {
-                    props.orthographic.width = compVal.value("width", 500.0f);
-                    props.orthographic.height = compVal.value("height", 500.0f);
-                    props.orthographic.nearClip = compVal.value("nearClip", -1.0f);
-                    props.orthographic.farClip = compVal.value("farClip", 1.0f);
-                } else {
-                    props.perspective.fieldOfView = compVal.value("fieldOfView", 45.0f);
-                    props.perspective.aspectRatio = compVal.value("aspectRatio", 1.333f);
-                    props.perspective.nearClip = compVal.value("nearClip", 0.1f);
-                    props.perspective.farClip = compVal.value("farClip", 500.0f);
-                }
-                props.verticalAngle = compVal.value("verticalAngle", 0.0f);
-                props.horizontalAngle = compVal.value("horizontalAngle", 0.0f);
-                props.eyeOffset = ParseVec3(compVal.value("eyeOffset", nlohmann::json::array()), glm::vec3(0.0f));
-
-                go->AddComponent<CameraComponent>(props);
-            }
-            else if (type == "LightComponent") {
-                LightProps props;
-                std::string lightTypeStr = compVal.value("lightType", "Directional");
-                if (lightTypeStr == "Directional") props.type = LightType::Directional;
-                else if (lightTypeStr == "Point") props.type = LightType::Point;
-                else if (lightTypeStr == "Spot") props.type = LightType::Spot;
-                else if (lightTypeStr == "Area") props.type = LightType::Area;
-
-                props.ambient = ParseVec3(compVal.value("ambient", nlohmann::json::array()), glm::vec3(0.1f));
-                props.diffuse = ParseVec3(compVal.value("diffuse", nlohmann::json::array()), glm::vec3(1.0f));
-                props.specular = ParseVec3(compVal.value("specular", nlohmann::json::array()), glm::vec3(1.0f));
-                props.direction = ParseVec3(compVal.value("direction", nlohmann::json::array()), glm::vec3(0.0f, -1.0f, 0.0f));
-                props.attenuation = ParseVec3(compVal.value("attenuation", nlohmann::json::array()), glm::vec3(1.0f, 0.0f, 0.0f));
-                props.intensity = compVal.value("intensity", 1.0f);
-                props.castShadow = compVal.value("castShadow", false);
-
-                go->AddComponent<LightComponent>(props);
-            }
-            else if (type == "Animator2D") {
-                auto* animator = new Animator2D(go);
-                go->AddComponent(animator);
-
-                if (compVal.contains("animations") && compVal["animations"].is_array()) {
-                    for (const auto& animVal : compVal["animations"]) {
-                        AnimationClip clip;
-                        clip.name = animVal.value("name", "");
-                        clip.loop = animVal.value("loop", true);
-                        if (animVal.contains("frames") && animVal["frames"].is_array()) {
-                            for (const auto& frameVal : animVal["frames"]) {
-                                AnimationFrame frameObj;
-                                frameObj.duration = frameVal.value("duration", 0.1f);
-                                frameObj.uvMin = ParseVec2(frameVal.value("uvMin", nlohmann::json::array()), glm::vec2(0.0f, 0.0f));
-                                frameObj.uvMax = ParseVec2(frameVal.value("uvMax", nlohmann::json::array()), glm::vec2(1.0f, 1.0f));
-                                clip.frames.push_back(frameObj);
-                            }
-                        }
-                        animator->AddAnimation(clip.name, clip);
-                    }
-                }
-
-                if (compVal.contains("autoPlay")) {
-                    std::string autoPlayClip = compVal["autoPlay"].get<std::string>();
-                    if (!autoPlayClip.empty()) {
-                        animator->Play(autoPlayClip);
-                    }
-                }
-            }
-            else if (type == "ActionManager") {
-                auto* actionManager = new ActionManager(go);
-                go->AddComponent(actionManager);
-
-                if (compVal.contains("actions") && compVal["actions"].is_array()) {
-                    for (const auto& actionVal : compVal["actions"]) {
-                        Action* action = ParseAction(actionVal);
-                        if (action) {
-                            actionManager->RunAction(action);
-                        }
-                    }
-                }
-            }
+    // Entities are stored parents-first, so one linear pass builds the tree
+    std::vector<GameObject*> created;
+    created.reserve(scene.entities.size());
+    for (const auto& entity : scene.entities) {
+        auto* go = CreateGameObject(entity.position, entity.rotation, entity.scale);
+        go->SetName(entity.name);
+        go->SetActive(entity.active);
+        if (entity.parent >= 0) {
+            go->parent = created[entity.parent];
         }
+        for (const auto& component : entity.components) AddSceneComponent(go, component);
+        created.push_back(go);
     }
+    if (!created.empty()) ENGINE_LOG("Scene game objects created.");
 
-    if (entityVal.contains("children") && entityVal["children"].is_array()) {
-        for (const auto& childVal : entityVal["children"]) {
-            ParseEntity(app, childVal, go);
-        }
-    }
+    mainCamera = graphics.GetMainCamera();
+    mainLight = graphics.GetMainLight();
 }
 
 void Application::LoadScene(const std::string& jsonContent) {
-    nlohmann::json j;
-    try {
-        j = nlohmann::json::parse(jsonContent);
-    } catch (const std::exception& e) {
-        spdlog::error("Application::LoadScene: JSON parse error: {}", e.what());
+    SceneProps scene;
+    std::string error;
+    if (!ReadSceneJSON(jsonContent, scene, &error)) {
+        spdlog::error("Application::LoadScene: JSON parse error: {}", error);
         return;
     }
+    ENGINE_LOG("Loading scene '{}' from JSON...", scene.name);
+    LoadScene(scene);
+}
 
-    std::string sceneName = j.value("name", "Unnamed");
-    ENGINE_LOG("Loading scene '{}' from JSON...", sceneName);
-
-    // Load textures
-    if (j.contains("textures") && j["textures"].is_array()) {
-        std::vector<std::string> texturesToLoad;
-        for (const auto& tex : j["textures"]) {
-            std::string texPath = tex.get<std::string>();
-            if (AssetManager::Get().GetTexture(texPath) == 0) {
-                texturesToLoad.push_back(texPath);
-            }
-        }
-        if (!texturesToLoad.empty()) {
-            if (_config.useDefaultTextures) {
-                AssetManager::Get().LoadDefaultTextures();
-            }
-            AssetManager::Get().LoadTextures(texturesToLoad);
-            ENGINE_LOG("JSON Textures created.");
-        }
-    }
-
-    // Load shaders
-    if (j.contains("shaders") && j["shaders"].is_object()) {
-        std::unordered_map<std::string, ShaderProgramProps> shadersToLoad;
-        for (auto& [name, shaderVal] : j["shaders"].items()) {
-            if (AssetManager::Get().GetShader(name) != nullptr) {
-                continue;
-            }
-            ShaderProgramProps props;
-            props.vert = shaderVal.value("vert", "");
-            props.frag = shaderVal.value("frag", "");
-            if (shaderVal.contains("tesc")) {
-                props.tesc = shaderVal["tesc"].get<std::string>();
-            }
-            if (shaderVal.contains("tese")) {
-                props.tese = shaderVal["tese"].get<std::string>();
-            }
-            shadersToLoad[name] = props;
-        }
-        if (!shadersToLoad.empty()) {
-            if (_config.useDefaultShaders) {
-                AssetManager::Get().LoadDefaultShaders();
-            }
-            AssetManager::Get().LoadShaders(shadersToLoad);
-            ENGINE_LOG("JSON Shaders created.");
-        }
-    }
-
-    // Load entities recursively
-    if (j.contains("entities") && j["entities"].is_array()) {
-        for (const auto& entityVal : j["entities"]) {
-            ParseEntity(this, entityVal, nullptr);
-        }
-        ENGINE_LOG("JSON Game objects created.");
+bool Application::LoadBakedScene(std::span<const uint8_t> bytes) {
+#ifdef TRACY_ENABLE
+    ZoneScopedN("Application::LoadBakedScene");
+#endif
+    SceneProps scene;
+    if (!ReadBakedScene(bytes, scene)) {
+        spdlog::error("Application::LoadBakedScene: not a valid baked scene");
+        return false;
     }
-
-    mainCamera = graphics.GetMainCamera();
-    mainLight = graphics.GetMainLight();
+    ENGINE_LOG("Loading scene '{}' from baked scene...", scene.name);
+    LoadScene(scene);
+    return true;
 }
 
 void Application::GoScene(const std::string& sceneName, std::function<void()> onReady)
 {
     _sceneReady = false;
     SceneTransition::Go(sceneName, [this, sceneName, onReady]{
+        ReleaseSceneArena();
         for (auto* e : _entities) {
             if (e != _defaultGameObject) delete e;
         }
@@ -651,15 +394,23 @@ void Application::GoScene(const std::string& sceneName, std::function<void()> on
 
         _currentSceneName = sceneName;
 
-        // Load scene.json!
+        // The baked scene (tools/scene_baker) unless it is missing or stale
+        std::string scenePath = SceneTransition::ResolveScenePath(sceneName);
         std::string manifestPath = "assets/scenes/" + sceneName + ".json";
         ENGINE_LOG("GoScene: Transitioning to scene '{}'...", sceneName);
-        auto bytes = FileSystem::Get().ReadSync(manifestPath);
-        if (!bytes.empty()) {
-            ENGINE_LOG("GoScene: Found scene JSON file '{}', loading...", manifestPath);
-            LoadScene(std::string(bytes.begin(), bytes.end()));
-        } else {
-            ENGINE_LOG("GoScene: Scene JSON file '{}' is empty or not found. Skipping JSON scene loading.", manifestPath);
+        bool loadedBaked = false;
+        if (scenePath != manifestPath) {
+            auto view = FileSystem::Get().ReadView(scenePath);
+            loadedBaked = view.empty() ? LoadBakedScene(FileSystem::Get().ReadSync(scenePath)) : LoadBakedScene(view);
+        }
+        if (!loadedBaked) {
+            auto bytes = FileSystem::Get().ReadSync(manifestPath);
+            if (!bytes.empty()) {
+                ENGINE_LOG("GoScene: Found scene JSON file '{}', loading...", manifestPath);
+                LoadScene(std::string(bytes.begin(), bytes.end()));
+            } else {
+                ENGINE_LOG("GoScene: Scene JSON file '{}' is empty or not found. Skipping JSON scene loading.", manifestPath);
+            }
         }
 
         if (onReady) onReady();
@@ -672,6 +423,17 @@ void Application::ReloadScene() {
     SceneTransition::Go(_currentSceneName, [this]{ OnLoad(); });
 }
 
+void Application::ReloadChangedAssets() {
+    auto& assets = AssetManager::Get();
+    for (AssetHandle handle : assets.PollHotReload()) {
+        if (_sceneReady && assets.GetAssetGraph().GetKind(handle) == AssetKind::Scene &&
+            assets.GetAssetGraph().GetName(handle) == _currentSceneName) {
+            GoScene(_currentSceneName, [this] { OnLoad(); });
+            break;
+        }
+    }
+}
+
 void Application::Quit() {
     ENGINE_LOG("Requested to quit.");
     _window->Close();
@@ -708,12 +470,7 @@ void Application::Update(const FrameData& props) {
 
     float time = GetWindowTime();
 
-    for (auto go : _entities) {
-        auto impostor = go->GetComponent<RigidbodyComponent>();
-        if (impostor == nullptr) continue;
-        if (impostor->IsKinematic()) continue;
-        go->SyncObjectTransform(impostor->GetWorldTransform());
-    }
+    SyncTransformWithPhysics();
 }
 
 void Application::Render(const FrameData& props) {
@@ -733,6 +490,7 @@ void Application::Render(const FrameData& props) {
 }
 
 void Application::SyncTransformWithPhysics() {
+    physics.SyncTransforms();
 }
 
 uint64_t Application::GetClock() {
@@ -766,6 +524,23 @@ GameObject* Application::CreateGameObject(glm::vec3 position, glm::vec3 rotation
     return e;
 }
 
+GameObject* Application::CreateGameObject(SceneArena& arena, glm::vec3 position, glm::vec3 rotation, glm::vec3 scale) {
+    auto e = arena.New<GameObject>(this, position, rotation, scale);
+    e->SetName(fmt::format("entity #{}", _nextEntityID++));
+    _entities.push_back(e);
+    return e;
+}
+
+void Application::ReleaseSceneArena() {
+    auto owned = [this](const void* p) { return _sceneArena.Owns(p); };
+    std::erase_if(_entities, owned);
+    // Arena components are destroyed with their game objects, so they must
+    // not stay registered with the renderer
+    std::erase_if(graphics.canvasDrawables, owned);
+    if (owned(_selectedEntity)) _selectedEntity = nullptr;
+    _sceneArena.Release();
+}
+
 GameObject* Application::CreateGameObject(glm::vec2 position, float angle) {
     auto e =
       new GameObject(this, glm::vec3(position.x, position.y, 0.0f), glm::vec3(0.0f, 0.0f, angle), glm::vec3(1.0f));
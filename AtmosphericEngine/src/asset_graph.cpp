@@ -0,0 +1,187 @@
+#include "asset_graph.hpp"
+
+#include <algorithm>
+
+namespace {
+    void Unlink(std::vector<uint32_t>& list, uint32_t index) {
+        auto it = std::find(list.begin(), list.end(), index);
+        if (it != list.end()) {
+            *it = list.back();
+            list.pop_back();
+        }
+    }
+}// namespace
+
+AssetHandle AssetGraph::Register(AssetKind kind, const std::string& name) {
+    auto& byName = _byName[size_t(kind)];
+    auto it = byName.find(name);
+    if (it != byName.end()) return HandleOf(it->second);
+
+    uint32_t index;
+    if (!_free.empty()) {
+        index = _free.back();
+        _free.pop_back();
+    } else {
+        index = static_cast<uint32_t>(_nodes.size());
+        _nodes.emplace_back();
+    }
+    Node& node = _nodes[index];
+    node.name = name;
+    node.kind = kind;
+    node.version = 0;
+    node.refs = 0;
+    node.alive = true;
+    byName.emplace(name, index);
+    return HandleOf(index);
+}
+
+AssetHandle AssetGraph::Find(AssetKind kind, const std::string& name) const {
+    const auto& byName = _byName[size_t(kind)];
+    auto it = byName.find(name);
+    return it != byName.end() ? HandleOf(it->second) : AssetHandle{};
+}
+
+void AssetGraph::Remove(AssetHandle handle) {
+    if (!Lookup(handle)) return;
+    Node& node = _nodes[handle.index];
+    for (uint32_t dependency : node.dependencies) Unlink(_nodes[dependency].dependents, handle.index);
+    for (uint32_t dependent : node.dependents) Unlink(_nodes[dependent].dependencies, handle.index);
+    _byName[size_t(node.kind)].erase(node.name);
+
+    node.name.clear();
+    node.dependencies.clear();
+    node.dependents.clear();
+    node.alive = false;
+    if (++node.generation == 0) node.generation = 1;
+    _free.push_back(handle.index);
+}
+
+void AssetGraph::Clear() {
+    for (uint32_t i = 0; i < _nodes.size(); ++i) {
+        if (_nodes[i].alive) Remove(HandleOf(i));
+    }
+}
+
+const AssetGraph::Node* AssetGraph::Lookup(AssetHandle handle) const {
+    if (handle.index >= _nodes.size()) return nullptr;
+    const Node& node = _nodes[handle.index];
+    return node.alive && node.generation == handle.generation ? &node : nullptr;
+}
+
+bool AssetGraph::IsAlive(AssetHandle handle) const {
+    return Lookup(handle) != nullptr;
+}
+
+AssetKind AssetGraph::GetKind(AssetHandle handle) const {
+    const Node* node = Lookup(handle);
+    return node ? node->kind : AssetKind::Count;
+}
+
+const std::string& AssetGraph::GetName(AssetHandle handle) const {
+    static const std::string empty;
+    const Node* node = Lookup(handle);
+    return node ? node->name : empty;
+}
+
+uint32_t AssetGraph::GetVersion(AssetHandle handle) const {
+    const Node* node = Lookup(handle);
+    return node ? node->version : 0;
+}
+
+void AssetGraph::AddDependency(AssetHandle dependent, AssetHandle dependency) {
+    if (!Lookup(dependent) || !Lookup(dependency) || dependent == dependency) return;
+    auto& dependencies = _nodes[dependent.index].dependencies;
+    if (std::find(dependencies.begin(), dependencies.end(), dependency.index) != dependencies.end()) return;
+    dependencies.push_back(dependency.index);
+    _nodes[dependency.index].dependents.push_back(dependent.index);
+}
+
+void AssetGraph::RemoveDependencies(AssetHandle dependent) {
+    if (!Lookup(dependent)) return;
+    Node& node = _nodes[dependent.index];
+    for (uint32_t dependency : node.dependencies) Unlink(_nodes[dependency].dependents, dependent.index);
+    node.dependencies.clear();
+}
+
+std::vector<AssetHandle> AssetGraph::GetDependencies(AssetHandle handle) const {
+    std::vector<AssetHandle> out;
+    if (const Node* node = Lookup(handle)) {
+        for (uint32_t index : node->dependencies) out.push_back(HandleOf(index));
+    }
+    return out;
+}
+
+std::vector<AssetHandle> AssetGraph::GetDependents(AssetHandle handle) const {
+    std::vector<AssetHandle> out;
+    if (const Node* node = Lookup(handle)) {
+        for (uint32_t index : node->dependents) out.push_back(HandleOf(index));
+    }
+    return out;
+}
+
+void AssetGraph::AddRef(AssetHandle handle) {
+    if (Lookup(handle)) ++_nodes[handle.index].refs;
+}
+
+void AssetGraph::Release(AssetHandle handle) {
+    if (Lookup(handle) && _nodes[handle.index].refs > 0) --_nodes[handle.index].refs;
+}
+
+uint32_t AssetGraph::GetRefCount(AssetHandle handle) const {
+    const Node* node = Lookup(handle);
+    return node ? node->refs + static_cast<uint32_t>(node->dependents.size()) : 0;
+}
+
+std::vector<AssetHandle> AssetGraph::Invalidate(AssetHandle handle) {
+    std::vector<AssetHandle> order;
+    if (!Lookup(handle)) return order;
+
+    if (_stamp.size() < _nodes.size()) {
+        _stamp.resize(_nodes.size(), 0);
+        _pending.resize(_nodes.size(), 0);
+    }
+    if (++_epoch == 0) {
+        std::fill(_stamp.begin(), _stamp.end(), 0);
+        _epoch = 1;
+    }
+
+    // Everything reachable through dependents edges
+    std::vector<uint32_t> affected{ handle.index };
+    _stamp[handle.index] = _epoch;
+    for (size_t i = 0; i < affected.size(); ++i) {
+        for (uint32_t dependent : _nodes[affected[i]].dependents) {
+            if (_stamp[dependent] == _epoch) continue;
+            _stamp[dependent] = _epoch;
+            affected.push_back(dependent);
+        }
+    }
+
+    // Kahn's algorithm over the affected subgraph, starting at `handle`
+    for (uint32_t index : affected) {
+        _pending[index] = 0;
+        for (uint32_t dependency : _nodes[index].dependencies) {
+            if (_stamp[dependency] == _epoch) ++_pending[index];
+        }
+    }
+    _pending[handle.index] = 0;
+    order.reserve(affected.size());
+    order.push_back(handle);
+    for (size_t i = 0; i < order.size(); ++i) {
+        for (uint32_t dependent : _nodes[order[i].index].dependents) {
+            if (_pending[dependent] > 0 && --_pending[dependent] == 0) order.push_back(HandleOf(dependent));
+        }
+    }
+    // A dependency cycle leaves nodes waiting on each other; emit them anyway
+    if (order.size() < affected.size()) {
+        for (uint32_t index : affected) {
+            if (_pending[index] > 0) order.push_back(HandleOf(index));
+        }
+    }
+
+    for (AssetHandle h : order) ++_nodes[h.index].version;
+    return order;
+}
+
+void AssetGraph::ForEach(AssetKind kind, const std::function<void(AssetHandle, const std::string&)>& fn) const {
+    for (const auto& [name, index] : _byName[size_t(kind)]) fn(HandleOf(index), name);
+}
@@ -0,0 +1,143 @@
+#include "asset_load_stats.hpp"
+
+#include <algorithm>
+#include <fmt/core.h>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#ifdef TRACY_ENABLE
+#include <tracy/Tracy.hpp>
+#endif
+
+namespace {
+    const char* KindName(AssetKind kind) {
+        switch (kind) {
+        case AssetKind::File:     return "file";
+        case AssetKind::Texture:  return "texture";
+        case AssetKind::Shader:   return "shader";
+        case AssetKind::Material: return "material";
+        case AssetKind::Mesh:     return "mesh";
+        case AssetKind::Scene:    return "scene";
+        default:                  return "unknown";
+        }
+    }
+
+    const char* CacheName(AssetCacheStatus cache) {
+        switch (cache) {
+        case AssetCacheStatus::Memory: return "memory";
+        case AssetCacheStatus::Dedup:  return "dedup";
+        case AssetCacheStatus::Disk:   return "disk";
+        default:                       return "miss";
+        }
+    }
+
+    // RFC 4180: quote fields holding a separator, quote or line break
+    std::string CSVField(const std::string& text) {
+        if (text.find_first_of(",\"\r\n") == std::string::npos) return text;
+        std::string out = "\"";
+        for (char c : text) {
+            if (c == '"') out += '"';
+            out += c;
+        }
+        return out + '"';
+    }
+}// namespace
+
+void AssetLoadStats::Record(AssetLoadRecord record) {
+    auto& latest = _latest[size_t(record.kind)];
+    if (record.cache == AssetCacheStatus::Memory) {
+        auto it = latest.find(record.name);
+        if (it != latest.end()) {
+            ++_records[it->second].memoryHits;
+            return;
+        }
+        // Loaded before the stats were cleared; this record collects its hits
+        record.memoryHits = 1;
+    }
+    if (record.cache == AssetCacheStatus::Dedup) _dedupedBytes += record.bytes;
+#ifdef TRACY_ENABLE
+    TracyPlot("Assets/read ms", record.readMs);
+    TracyPlot("Assets/decode ms", record.decodeMs);
+    TracyPlot("Assets/upload ms", record.uploadMs);
+    TracyPlot("Assets/bytes", static_cast<int64_t>(record.bytes));
+    std::string message = fmt::format(
+      "{} {} ({}): {:.2f} ms", KindName(record.kind), record.name, CacheName(record.cache), record.GetTotalMs()
+    );
+    TracyMessage(message.data(), message.size());
+#endif
+    if (_records.size() >= MAX_RECORDS) {
+        ++_dropped;
+        return;
+    }
+    latest[record.name] = _records.size();
+    _records.push_back(std::move(record));
+}
+
+void AssetLoadStats::Clear() {
+    _records.clear();
+    for (auto& latest : _latest) latest.clear();
+    _dedupedBytes = 0;
+    _dropped      = 0;
+}
+
+std::vector<AssetLoadRecord> AssetLoadStats::GetSlowest(size_t count) const {
+    std::vector<AssetLoadRecord> slowest(_records);
+    auto slower = [](const AssetLoadRecord& a, const AssetLoadRecord& b) { return a.GetTotalMs() > b.GetTotalMs(); };
+    count = std::min(count, slowest.size());
+    std::partial_sort(slowest.begin(), slowest.begin() + count, slowest.end(), slower);
+    slowest.resize(count);
+    return slowest;
+}
+
+std::string AssetLoadStats::ToCSV() const {
+    std::string out = "name,kind,cache,bytes,content_hash,read_ms,decode_ms,upload_ms,total_ms,memory_hits\n";
+    for (const auto& r : _records) {
+        out += fmt::format(
+          "{},{},{},{},{:016x},{:.3f},{:.3f},{:.3f},{:.3f},{}\n",
+          CSVField(r.name),
+          KindName(r.kind),
+          CacheName(r.cache),
+          r.bytes,
+          r.contentHash,
+          r.readMs,
+          r.decodeMs,
+          r.uploadMs,
+          r.GetTotalMs(),
+          r.memoryHits
+        );
+    }
+    return out;
+}
+
+std::string AssetLoadStats::ToJSON() const {
+    nlohmann::json assets = nlohmann::json::array();
+    for (const auto& r : _records) {
+        assets.push_back({
+          { "name", r.name },
+          { "kind", KindName(r.kind) },
+          { "cache", CacheName(r.cache) },
+          { "bytes", r.bytes },
+          { "contentHash", fmt::format("{:016x}", r.contentHash) },
+          { "readMs", r.readMs },
+          { "decodeMs", r.decodeMs },
+          { "uploadMs", r.uploadMs },
+          { "totalMs", r.GetTotalMs() },
+          { "memoryHits", r.memoryHits },
+        });
+    }
+    nlohmann::json root = {
+        { "dedupedBytes", _dedupedBytes }, { "droppedRecords", _dropped }, { "assets", std::move(assets) }
+    };
+    return root.dump(2);
+}
+
+bool AssetLoadStats::Write(const std::string& path) const {
+    bool json = path.size() >= 5 && path.compare(path.size() - 5, 5, ".json") == 0;
+    std::ofstream file(path, std::ios::binary);
+    if (file) file << (json ? ToJSON() : ToCSV());
+    if (!file) {
+        spdlog::warn("AssetLoadStats: cannot write '{}'", path);
+        return false;
+    }
+    return true;
+}
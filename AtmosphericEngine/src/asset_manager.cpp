@@ -1,30 +1,31 @@
 #include "asset_manager.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <unordered_set>
 #include <spdlog/spdlog.h>
 #include "console.hpp"
 #include "file_system.hpp"
-#include "job_system.hpp"
+#include "file_watcher.hpp"
 #include "material.hpp"
 #include "mesh.hpp"
 #include "mesh_builder.hpp"
+#include "mesh_format.hpp"
 #include "shader.hpp"
+#include "texture_pipeline.hpp"
 
 #include "fmt/core.h"
 
-// TODO: enable SIMD again after fixing build issues on Windows and Linux (ref:
-// https://facebook.github.io/facebook360_dep/source/html/stb__image_8h_source.html)
+// SSE2 / NEON decode paths are on for native builds: x86-64 and arm64 have
+// them as baseline, so the 32-bit GCC -msse2 pitfall stb_image warns about
+// doesn't apply.  Wasm builds keep the scalar decoder (no -msimd128 here).
+#ifdef __EMSCRIPTEN__
 #define STBI_NO_SIMD
+#endif
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
-// #define TINYOBJLOADER_IMPLEMENTATION
-// #include "tiny_obj_loader.h"
-
-#ifdef AE_USE_BASIS_UNIVERSAL
-// Basis Universal transcoder — KTX2 / BasisLZ / UASTC → GPU compressed texture
-// Only the transcoder is compiled; no encoder dependency.
-#include "basisu_transcoder.h"
-
 // ── ETC2 constants (part of GLES3 core; defined in GLES3/gl3.h for Emscripten,
 //    and available on desktop via GL_ARB_ES3_compatibility / OpenGL 4.3+).
 #ifndef GL_COMPRESSED_RGB8_ETC2
@@ -43,9 +44,10 @@
 
 namespace {
 // Returns true if the named GL/WebGL extension is exposed by the current context.
+// Walks the indexed list on every platform: glGetString(GL_EXTENSIONS) is
+// deprecated in WebGL2 and returns NULL (GL_INVALID_ENUM) on the desktop
+// core-profile context.
 bool HasGLExtension(const char* name) {
-#ifdef __EMSCRIPTEN__
-    // In WebGL2 (GLES3) glGetString(GL_EXTENSIONS) is deprecated; use glGetStringi.
     GLint numExt = 0;
     glGetIntegerv(GL_NUM_EXTENSIONS, &numExt);
     for (GLint i = 0; i < numExt; ++i) {
@@ -53,12 +55,15 @@ bool HasGLExtension(const char* name) {
         if (ext && strcmp(ext, name) == 0) return true;
     }
     return false;
-#else
-    const char* exts = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
-    return exts && (strstr(exts, name) != nullptr);
-#endif
 }
+} // anonymous namespace
 
+#ifdef AE_USE_BASIS_UNIVERSAL
+// Basis Universal transcoder — KTX2 / BasisLZ / UASTC → GPU compressed texture
+// Only the transcoder is compiled; no encoder dependency.
+#include "basisu_transcoder.h"
+
+namespace {
 // Returns bytes per block for the chosen basisu target format.
 uint32_t BasisBytesPerBlock(basist::transcoder_texture_format fmt) {
     switch (fmt) {
@@ -86,6 +91,101 @@ GLenum BasisToGLFormat(basist::transcoder_texture_format fmt) {
 } // anonymous namespace
 #endif // AE_USE_BASIS_UNIVERSAL
 
+namespace {
+float MillisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Uploads TexturePipeline output to GL textures and records the final sizes.
+class GLTextureSink : public TextureUploadSink {
+public:
+    GLTextureSink(std::unordered_map<std::string, Texture2D>& cache, AssetLoadStats& stats)
+      : _cache(cache), _stats(stats) {
+    }
+
+    TextureHandle CreatePlaceholder() override {
+        static const uint8_t grey[4] = { 128, 128, 128, 255 };
+        GLuint texID = 0;
+        glGenTextures(1, &texID);
+        glBindTexture(GL_TEXTURE_2D, texID);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,     GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,     GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL,  0);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, grey);
+        return texID;
+    }
+
+    void UploadLevel(TextureHandle handle, const TexturePayload& payload, uint32_t level) override {
+        const TextureMip& mip = payload.mips[level];
+        glBindTexture(GL_TEXTURE_2D, handle);
+        // Mips of odd width have unpadded rows
+        GLint alignment = 4;
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        switch (payload.format) {
+        case TexturePixelFormat::R8:
+            glTexImage2D(GL_TEXTURE_2D, level, GL_R8, mip.width, mip.height, 0,
+                         GL_RED, GL_UNSIGNED_BYTE, mip.data.data());
+            break;
+        case TexturePixelFormat::RGBA8:
+            glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA, mip.width, mip.height, 0,
+                         GL_RGBA, GL_UNSIGNED_BYTE, mip.data.data());
+            break;
+        case TexturePixelFormat::BC1:
+        case TexturePixelFormat::BC3:
+        case TexturePixelFormat::ETC1:
+        case TexturePixelFormat::ETC2_RGBA:
+            glCompressedTexImage2D(GL_TEXTURE_2D, level, CompressedFormat(payload.format), mip.width, mip.height, 0,
+                                   (GLsizei)mip.data.size(), mip.data.data());
+            break;
+        default:
+            break;
+        }
+        glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+        // Sample only what has arrived so far
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, (GLint)level);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL,  (GLint)payload.mips.size() - 1);
+    }
+
+    void OnComplete(
+      TextureHandle handle, const std::string& path, const TexturePayload& payload, const TextureLoadTimes& times
+    ) override {
+        AssetLoadRecord record{ path, AssetKind::Texture, times.diskCacheHit ? AssetCacheStatus::Disk : AssetCacheStatus::Miss };
+        record.bytes       = times.fileBytes;
+        record.contentHash = times.contentHash;
+        record.readMs      = times.readMs;
+        record.decodeMs    = times.decodeMs;
+        record.uploadMs    = times.uploadMs;
+        _stats.Record(std::move(record));
+
+        auto it = _cache.find(path);
+        if (it == _cache.end() || it->second.glID != handle) return;
+        it->second.width  = payload.mips[0].width;
+        it->second.height = payload.mips[0].height;
+        it->second.bytes  = payload.GetByteSize();
+    }
+
+    void OnFailed(TextureHandle /*handle*/, const std::string& path) override {
+        spdlog::warn("Failed to load texture at '{}', keeping the placeholder.", path);
+    }
+
+private:
+    static GLenum CompressedFormat(TexturePixelFormat format) {
+        switch (format) {
+        case TexturePixelFormat::BC1:  return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        case TexturePixelFormat::BC3:  return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case TexturePixelFormat::ETC1: return GL_COMPRESSED_RGB8_ETC2;// ETC1 ⊂ ETC2
+        default:                       return GL_COMPRESSED_RGBA8_ETC2_EAC;
+        }
+    }
+
+    std::unordered_map<std::string, Texture2D>& _cache;
+    AssetLoadStats& _stats;
+};
+} // anonymous namespace
 
 AssetManager* AssetManager::instance = nullptr;
 
@@ -117,7 +217,8 @@ void AssetManager::Shutdown() {
 }
 
 void AssetManager::Clear() {
-    // Clean up textures
+    // Clean up textures; dropping the pipeline discards pending loads before their names are deleted
+    _texturePipeline.reset();
     if (!textures.empty()) {
         glDeleteTextures(textures.size(), textures.data());
         textures.clear();
@@ -127,6 +228,7 @@ void AssetManager::Clear() {
         defaultTextures.clear();
     }
     _textureCache.clear();
+    _textureAliasSlots.clear();
     _nextTextureID = 0;
 
     // Clean up shaders
@@ -154,30 +256,82 @@ void AssetManager::Clear() {
 
     // Clear CPU cache
     _imageCache.clear();
+
+    _imageContent.Clear();
+    _textureContent.Clear();
+    _meshContent.Clear();
+    _shaderProps.clear();
+    if (_watcher) {
+        _graph.ForEach(AssetKind::File, [this](AssetHandle, const std::string& path) { _watcher->Unwatch(path); });
+    }
+    _graph.Clear();
 }
 
 void AssetManager::ClearSceneAssets() {
-    // Textures: clear scene textures, keep defaultTextures untouched.
-    if (!textures.empty()) {
-        glDeleteTextures(textures.size(), textures.data());
-        textures.clear();
-    }
-    // Remove scene texture cache entries (keep default texture entries by glID).
-    std::unordered_set<GLuint> defaultIDs(defaultTextures.begin(), defaultTextures.end());
+    // Scenes, materials and meshes go first so the only references left on
+    // textures are the ones taken with Acquire
+    auto removeAll = [this](AssetKind kind) {
+        std::vector<AssetHandle> handles;
+        _graph.ForEach(kind, [&](AssetHandle handle, const std::string&) { handles.push_back(handle); });
+        for (AssetHandle handle : handles) _graph.Remove(handle);
+    };
+    removeAll(AssetKind::Scene);
+    removeAll(AssetKind::Material);
+    removeAll(AssetKind::Mesh);
+
+    // Textures: clear scene textures, keep defaultTextures and acquired ones.
+    std::unordered_set<GLuint> keep(defaultTextures.begin(), defaultTextures.end());
     for (auto it = _textureCache.begin(); it != _textureCache.end(); ) {
-        if (defaultIDs.count(it->second.glID))
+        AssetHandle handle = _graph.Find(AssetKind::Texture, it->first);
+        if (keep.count(it->second.glID) || _graph.GetRefCount(handle) > 0) {
+            keep.insert(it->second.glID);
             ++it;
-        else
+        } else {
+            _graph.Remove(handle);
+            _textureContent.Erase(it->first);
             it = _textureCache.erase(it);
+        }
+    }
+    if (!textures.empty()) {
+        std::vector<GLuint> released;
+        std::vector<size_t> moved(textures.size(), SIZE_MAX);// old slot → new slot
+        size_t kept = 0;
+        for (size_t i = 0; i < textures.size(); ++i) {
+            if (keep.count(textures[i])) {
+                moved[i] = kept++;
+                continue;
+            }
+            if (_texturePipeline) _texturePipeline->Cancel(textures[i]);
+            released.push_back(textures[i]);
+        }
+        std::erase_if(textures, [&](GLuint id) { return !keep.count(id); });
+        if (!released.empty()) glDeleteTextures(released.size(), released.data());
+
+        for (auto it = _textureAliasSlots.begin(); it != _textureAliasSlots.end(); ) {
+            if (!_textureCache.count(it->first)) {
+                it = _textureAliasSlots.erase(it);
+                continue;
+            }
+            for (size_t& slot : it->second) slot = slot < moved.size() ? moved[slot] : SIZE_MAX;
+            std::erase(it->second, SIZE_MAX);
+            ++it;
+        }
     }
 
     // Shaders: delete only scene shaders (indices >= _defaultShaderCount).
     for (uint32_t i = _defaultShaderCount; i < (uint32_t)shaders.size(); ++i)
         delete shaders[i];
     shaders.resize(_defaultShaderCount);
+    _shaderProps.resize(std::min<size_t>(_shaderProps.size(), _defaultShaderCount));
     // Rebuild shader cache to only contain default shaders.
-    for (auto it = _shaderCache.begin(); it != _shaderCache.end(); )
-        it = (it->second < _defaultShaderCount) ? std::next(it) : _shaderCache.erase(it);
+    for (auto it = _shaderCache.begin(); it != _shaderCache.end(); ) {
+        if (it->second < _defaultShaderCount) {
+            ++it;
+        } else {
+            _graph.Remove(_graph.Find(AssetKind::Shader, it->first));
+            it = _shaderCache.erase(it);
+        }
+    }
     _nextShaderID = _defaultShaderCount;
 
     // Materials and meshes are always scene-specific.
@@ -189,8 +343,20 @@ void AssetManager::ClearSceneAssets() {
     for (auto* m : meshes) delete m;
     meshes.clear();
     _meshCache.clear();
+    _meshContent.Clear();
 
     _imageCache.clear();
+    _imageContent.Clear();
+
+    // Source files nothing refers to any more
+    std::vector<AssetHandle> orphans;
+    _graph.ForEach(AssetKind::File, [&](AssetHandle handle, const std::string&) {
+        if (_graph.GetRefCount(handle) == 0) orphans.push_back(handle);
+    });
+    for (AssetHandle handle : orphans) {
+        if (_watcher) _watcher->Unwatch(_graph.GetName(handle));
+        _graph.Remove(handle);
+    }
 }
 
 // ============================================================================
@@ -204,13 +370,29 @@ std::shared_ptr<Image> AssetManager::LoadImage(const std::string& path) {
         return it->second;
     }
 
-    // Read raw bytes via FileSystem to support transparent web prefetching
-    FileSystem::Bytes fileData = FileSystem::Get().ReadSync(path);
+    // Mounted packs are decoded straight from the mapping; otherwise read raw
+    // bytes via FileSystem to support transparent web prefetching
+    FileSystem::SharedBytes shared;
+    std::span<const uint8_t> fileData = FileSystem::Get().ReadView(path);
+    if (fileData.empty() && (shared = FileSystem::Get().ReadShared(path))) {
+        fileData = *shared;
+    }
     if (fileData.empty()) {
         spdlog::warn("AssetManager::LoadImage: Failed to read file bytes via FileSystem at '{}'", path);
         return nullptr;
     }
 
+    // Identical bytes under another path are decoded once
+    uint64_t hash = HashContent(fileData);
+    if (const std::string* holder = _imageContent.Find(hash)) {
+        auto same = _imageCache.find(*holder);
+        if (same != _imageCache.end()) {
+            auto image = same->second;
+            _imageCache[path] = image;
+            return image;
+        }
+    }
+
     int width, height, numChannels;
     if (!stbi_info_from_memory(fileData.data(), (int)fileData.size(), &width, &height, &numChannels)) {
         spdlog::warn("stbi_info_from_memory: Failed to read image metadata at '{}'", path);
@@ -238,6 +420,7 @@ std::shared_ptr<Image> AssetManager::LoadImage(const std::string& path) {
         auto image = std::make_shared<Image>(width, height, desiredChannels, data);
         stbi_image_free(data);
         _imageCache[path] = image;
+        _imageContent.Insert(hash, path);
         return image;
     } else {
         return nullptr;
@@ -313,10 +496,23 @@ ShaderProgram* AssetManager::CreateShader(const std::string& name, const ShaderP
         return shaders[it->second];
     }
 
+    auto start = std::chrono::steady_clock::now();
     auto* shader = new ShaderProgram(props);
+    AssetLoadRecord record{ name, AssetKind::Shader };
+    record.decodeMs = MillisecondsSince(start);// stage reads, compile and link
+    _loadStats.Record(std::move(record));
     shaders.push_back(shader);
+    _shaderProps.push_back(props);
     _shaderCache[name] = _nextShaderID++;
 
+    AssetHandle handle = _graph.Register(AssetKind::Shader, name);
+    for (const std::string* stage : { &props.vert, &props.frag }) {
+        if (!stage->empty()) _graph.AddDependency(handle, TrackSource(*stage));
+    }
+    for (const auto* stage : { &props.tesc, &props.tese }) {
+        if (stage->has_value() && !stage->value().empty()) _graph.AddDependency(handle, TrackSource(stage->value()));
+    }
+
     ENGINE_LOG("Shader '{}' loaded", name);
     return shader;
 }
@@ -337,8 +533,10 @@ ShaderProgram* AssetManager::GetShaderByID(uint32_t id) const {
 }
 
 void AssetManager::ReloadShaders() {
-    // TODO: Implement shader hot reloading
-    ENGINE_LOG("Shader reloading not yet implemented");
+    for (const auto& [name, id] : _shaderCache) {
+        ReloadAsset(_graph.Find(AssetKind::Shader, name));
+    }
+    ENGINE_LOG("{} shaders reloaded", _shaderCache.size());
 }
 
 // ============================================================================
@@ -362,14 +560,16 @@ Material* AssetManager::CreateMaterial(const std::string& name, const MaterialPr
     auto* material = new Material(props);
     materials.push_back(material);
     _materialCache[name] = _nextMaterialID++;
+
+    AssetHandle handle = _graph.Register(AssetKind::Material, name);
+    for (int map : { props.baseMap, props.normalMap, props.aoMap, props.roughnessMap, props.metallicMap, props.heightMap }) {
+        _graph.AddDependency(handle, TextureAtIndex(map));
+    }
     return material;
 }
 
 Material* AssetManager::CreateMaterial(const MaterialProps& props) {
-    auto* material = new Material(props);
-    materials.push_back(material);
-    _materialCache["unnamed_" + std::to_string(_nextMaterialID++)] = _nextMaterialID;
-    return material;
+    return CreateMaterial("unnamed_" + std::to_string(_nextMaterialID), props);
 }
 
 Material* AssetManager::GetMaterial(const std::string& name) const {
@@ -391,6 +591,34 @@ Material* AssetManager::GetMaterialByID(uint32_t id) const {
 // GPU Texture Management
 // ============================================================================
 
+#if defined(AE_USE_BASIS_UNIVERSAL) && defined(__EMSCRIPTEN__)
+// Helper to swap standard image extensions to .ktx2 under WebAssembly
+static std::string RedirectToKTX2(const std::string& path) {
+    // Normalize leading "./" so cache keys are consistent with FileSystem
+    std::string p = (path.size() >= 2 && path[0] == '.' && path[1] == '/') ? path.substr(2) : path;
+    if (p.find("aim.png") != std::string::npos || p.find("heightmap") != std::string::npos) {
+        return p;
+    }
+    size_t extPos = p.find_last_of('.');
+    if (extPos != std::string::npos) {
+        std::string ext = p.substr(extPos);
+        if (ext == ".jpg" || ext == ".jpeg" || ext == ".png") {
+            return p.substr(0, extPos) + ".ktx2";
+        }
+    }
+    return p;
+}
+#endif
+
+// Texture cache key for `path`: no leading "./", and the KTX2 variant on web
+static std::string NormalizeTexturePath(const std::string& path) {
+#if defined(AE_USE_BASIS_UNIVERSAL) && defined(__EMSCRIPTEN__)
+    return RedirectToKTX2(path);// also normalizes "./" internally
+#else
+    return (path.size() >= 2 && path[0] == '.' && path[1] == '/') ? path.substr(2) : path;
+#endif
+}
+
 void AssetManager::LoadDefaultTextures() {
 #if defined(AE_USE_BASIS_UNIVERSAL) && defined(__EMSCRIPTEN__)
     // Web build: use pre-compressed KTX2 variants to avoid CPU-side JPEG decode
@@ -413,27 +641,9 @@ void AssetManager::LoadDefaultTextures() {
     // Store as default textures
     defaultTextures = textures;
     textures.clear();
+    _textureAliasSlots.clear();
 }
 
-#if defined(AE_USE_BASIS_UNIVERSAL) && defined(__EMSCRIPTEN__)
-// Helper to swap standard image extensions to .ktx2 under WebAssembly
-static std::string RedirectToKTX2(const std::string& path) {
-    // Normalize leading "./" so cache keys are consistent with FileSystem
-    std::string p = (path.size() >= 2 && path[0] == '.' && path[1] == '/') ? path.substr(2) : path;
-    if (p.find("aim.png") != std::string::npos || p.find("heightmap") != std::string::npos) {
-        return p;
-    }
-    size_t extPos = p.find_last_of('.');
-    if (extPos != std::string::npos) {
-        std::string ext = p.substr(extPos);
-        if (ext == ".jpg" || ext == ".jpeg" || ext == ".png") {
-            return p.substr(0, extPos) + ".ktx2";
-        }
-    }
-    return p;
-}
-#endif
-
 void AssetManager::LoadTextures(const std::vector<std::string>& paths) {
     int oldCount = (int)textures.size();
     int newCount = (int)paths.size();
@@ -441,128 +651,168 @@ void AssetManager::LoadTextures(const std::vector<std::string>& paths) {
     // Reserve final slots so ordering matches input path ordering.
     textures.resize(oldCount + newCount, 0u);
 
-    // ── Pass 1: KTX2 files (GPU-compressed; must be transcoded on the main
-    //           thread because we make GL calls inside LoadKTX2Texture).
-    // ── Pass 2: Regular images (parallel CPU load → batch GPU upload).
-    std::vector<int>         regularIndices;
-    std::vector<std::string> regularPaths;
+    EnsureTexturePipeline();
 
+    // Decode, KTX2 transcode and mip generation run on the pipeline's workers;
+    // each slot gets a placeholder now and real levels from PumpTextureUploads().
     for (int i = 0; i < newCount; i++) {
-        std::string path = paths[i];
-        if (path.size() >= 2 && path[0] == '.' && path[1] == '/') path = path.substr(2);
-#if defined(AE_USE_BASIS_UNIVERSAL) && defined(__EMSCRIPTEN__)
-        path = RedirectToKTX2(path);
-#endif
-        if (path.size() >= 5 && path.compare(path.size() - 5, 5, ".ktx2") == 0) {
-#ifdef AE_USE_BASIS_UNIVERSAL
-            auto cached = _textureCache.find(path);
-            if (cached != _textureCache.end()) {
-                textures[oldCount + i] = cached->second.glID;
-            } else {
-                Texture2D tex2d;
-                GLuint texID = LoadKTX2Texture(path, &tex2d);
-                textures[oldCount + i] = texID;
-                _textureCache[path] = tex2d;
-            }
-#else
+        std::string path = NormalizeTexturePath(paths[i]);
+#ifndef AE_USE_BASIS_UNIVERSAL
+        if (path.size() >= 5 && path.compare(path.size() - 5, 5, ".ktx2") == 0)
             throw std::runtime_error(
                 fmt::format("KTX2 texture requested but AE_USE_BASIS_UNIVERSAL is disabled: {}", path));
 #endif
-        } else {
-            regularIndices.push_back(i);
-            regularPaths.push_back(path);
+        auto cached = _textureCache.find(path);
+        if (cached != _textureCache.end()) {
+            textures[oldCount + i] = cached->second.glID;
+            if (auto alias = _textureAliasSlots.find(path); alias != _textureAliasSlots.end())
+                alias->second.push_back(oldCount + i);
+            _loadStats.Record({ path, AssetKind::Texture, AssetCacheStatus::Memory });
+            continue;
         }
-    }
-
-    if (regularPaths.empty()) return;
-
-    // ── Parallel CPU image decode for regular (non-KTX2) textures
-    std::vector<std::shared_ptr<Image>> images(regularPaths.size());
-    for (int j = 0; j < (int)regularPaths.size(); j++) {
-        auto path  = regularPaths[j];
-        auto image = &images[j];
-        JobSystem::Get()->Execute([this, path, image](int /*threadID*/) { *image = LoadImage(path); });
-    }
-    JobSystem::Get()->Wait();
-
-    // ── Batch generate GL texture objects for regular images
-    std::vector<GLuint> regularTexIDs(regularPaths.size());
-    glGenTextures((GLsizei)regularPaths.size(), regularTexIDs.data());
-
-    for (int j = 0; j < (int)regularPaths.size(); j++) {
-        int i      = regularIndices[j];
-        auto& img  = images[j];
-        GLuint texID = regularTexIDs[j];
-
-        if (!img) {
-            spdlog::warn("Failed to load texture at '{}', using default fallback texture.", regularPaths[j]);
-            // Re-use the default texture (defaultTextures[0]) as a safe fallback
-            textures[oldCount + i] = defaultTextures.empty() ? 0u : defaultTextures[0];
-            _textureCache[regularPaths[j]] = { textures[oldCount + i], 0, 0, 0 };
+        // Prefetched bytes are hashed here; anything else is left to the workers
+        AssetLoadRecord record{ path, AssetKind::Texture };
+        record.contentHash = HashSource(path, true, &record.bytes);
+        if (GLuint texID = ShareTexture(path, record)) {
+            textures[oldCount + i] = texID;
+            _textureAliasSlots[path].push_back(oldCount + i);
             continue;
         }
-
+        GLuint texID = _texturePipeline->Request(path);
         textures[oldCount + i] = texID;
+        _textureCache[path] = { texID, 0, 0, 0 };
+        if (record.contentHash) _textureContent.Insert(record.contentHash, path);
+        TrackTexture(path);
+    }
+}
 
-        glBindTexture(GL_TEXTURE_2D, texID);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,       GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,       GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,   GL_LINEAR_MIPMAP_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,   GL_LINEAR);
-
-        switch (img->channelCount) {
-        case 1:
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_R8,   img->width, img->height, 0,
-                         GL_RED,  GL_UNSIGNED_BYTE, img->byteArray.data());
-            break;
-        case 3:
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB,  img->width, img->height, 0,
-                         GL_RGB,  GL_UNSIGNED_BYTE, img->byteArray.data());
-            break;
-        case 4:
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, img->width, img->height, 0,
-                         GL_RGBA, GL_UNSIGNED_BYTE, img->byteArray.data());
-            break;
-        default:
-            throw std::runtime_error(fmt::format("Unknown texture format at {}\n", regularPaths[j]));
-        }
-        glGenerateMipmap(GL_TEXTURE_2D);
-        _textureCache[regularPaths[j]] = { texID, (uint32_t)img->width, (uint32_t)img->height,
-                                           (size_t)img->width * img->height * img->channelCount };
+void AssetManager::EnsureTexturePipeline() {
+    if (_texturePipeline) return;
+    TexturePipelineConfig config = _texturePipelineConfig;
+    config.preferS3TC            = HasGLExtension("GL_EXT_texture_compression_s3tc");
+    _textureSink     = std::make_unique<GLTextureSink>(_textureCache, _loadStats);
+    _texturePipeline = std::make_unique<TexturePipeline>(*_textureSink, config);
+}
+
+void AssetManager::SetTexturePipelineConfig(const TexturePipelineConfig& config) {
+    _texturePipelineConfig = config;
+    // The pipeline is rebuilt on the next LoadTextures; one with loads in flight is kept
+    if (_texturePipeline && _texturePipeline->GetPendingCount() == 0) {
+        _texturePipeline.reset();
+    } else if (_texturePipeline) {
+        spdlog::warn("Texture pipeline busy; new settings apply after a Clear()");
     }
 }
 
+void AssetManager::PumpTextureUploads(size_t byteBudget) {
+    if (_texturePipeline) _texturePipeline->Pump(byteBudget);
+}
+
 GLuint AssetManager::CreateTexture(const std::string& path) {
-    std::string redirectedPath = path;
-    if (redirectedPath.size() >= 2 && redirectedPath[0] == '.' && redirectedPath[1] == '/')
-        redirectedPath = redirectedPath.substr(2);
-#if defined(AE_USE_BASIS_UNIVERSAL) && defined(__EMSCRIPTEN__)
-    redirectedPath = RedirectToKTX2(redirectedPath); // also normalizes "./" internally
-#endif
+    std::string redirectedPath = NormalizeTexturePath(path);
 
     // Return cached texture (GLuint) if already uploaded.
     auto it = _textureCache.find(redirectedPath);
     if (it != _textureCache.end()) {
+        _loadStats.Record({ redirectedPath, AssetKind::Texture, AssetCacheStatus::Memory });
         return it->second.glID;
     }
 
+    // The read lands in the file cache, where the loaders below find it
+    auto start = std::chrono::steady_clock::now();
+    AssetLoadRecord record{ redirectedPath, AssetKind::Texture };
+    record.contentHash = HashSource(redirectedPath, false, &record.bytes);
+    record.readMs      = MillisecondsSince(start);
+    if (GLuint texID = ShareTexture(redirectedPath, record)) {
+        _textureAliasSlots[redirectedPath].push_back(textures.size());
+        textures.push_back(texID);
+        return texID;
+    }
+
+    GLuint texID = 0;
 #ifdef AE_USE_BASIS_UNIVERSAL
     // Route .ktx2 files to the GPU-compressed loader.
     if (redirectedPath.size() >= 5 && redirectedPath.compare(redirectedPath.size() - 5, 5, ".ktx2") == 0) {
+        auto decode = std::chrono::steady_clock::now();
         Texture2D tex2d;
-        GLuint texID = LoadKTX2Texture(redirectedPath, &tex2d);
+        texID = LoadKTX2Texture(redirectedPath, &tex2d);
+        record.decodeMs = MillisecondsSince(decode);// transcode and upload
         textures.push_back(texID);
         _textureCache[redirectedPath] = tex2d;
-        return texID;
-    }
+    } else
 #endif
+    {
+        // Regular image (PNG / JPG / etc.) via stb_image, cached under its path
+        auto decode = std::chrono::steady_clock::now();
+        auto image = LoadImage(redirectedPath);
+        auto upload = std::chrono::steady_clock::now();
+        record.decodeMs = std::chrono::duration<float, std::milli>(upload - decode).count();
+        texID = CreateTextureFromImage(image, redirectedPath);
+        record.uploadMs = MillisecondsSince(upload);
+    }
+    if (record.contentHash) _textureContent.Insert(record.contentHash, redirectedPath);
+    TrackTexture(redirectedPath);
+    _loadStats.Record(std::move(record));
+    return texID;
+}
+
+GLuint AssetManager::ShareTexture(const std::string& path, AssetLoadRecord record) {
+    const std::string* holder = record.contentHash ? _textureContent.Find(record.contentHash) : nullptr;
+    if (!holder) return 0;
+    auto it = _textureCache.find(*holder);
+    if (it == _textureCache.end()) return 0;
+
+    // Same GL name under both paths; sizes follow the holder once it finishes streaming
+    Texture2D shared    = it->second;
+    _textureCache[path] = shared;
+    TrackTexture(path);
+    record.cache = AssetCacheStatus::Dedup;
+    _loadStats.Record(std::move(record));
+    return shared.glID;
+}
+
+void AssetManager::DetachTexture(const std::string& path, GLuint shared) {
+    std::vector<size_t> slots;
+    if (auto alias = _textureAliasSlots.find(path); alias != _textureAliasSlots.end()) {
+        slots = std::move(alias->second);
+        _textureAliasSlots.erase(alias);
+    } else {
+        // The path loaded first: every slot holding the name that no alias took
+        std::unordered_set<size_t> taken;
+        for (const auto& [other, otherSlots] : _textureAliasSlots) taken.insert(otherSlots.begin(), otherSlots.end());
+        for (size_t i = 0; i < textures.size(); ++i)
+            if (textures[i] == shared && !taken.count(i)) slots.push_back(i);
+    }
+
+    GLuint texID = _texturePipeline->Request(path);
+    _textureCache[path] = { texID, 0, 0, 0 };
+    size_t moved = 0;
+    for (size_t slot : slots) {
+        if (slot >= textures.size() || textures[slot] != shared) continue;
+        textures[slot] = texID;
+        ++moved;
+    }
+    if (moved == 0) textures.push_back(texID);// owned there, so Clear deletes it
+}
 
-    // Regular image (PNG / JPG / etc.) via stb_image.
-    auto image = LoadImage(redirectedPath);
-    return CreateTextureFromImage(image);
+uint64_t AssetManager::HashSource(const std::string& path, bool cachedOnly, uint64_t* bytes) {
+    FileSystem::SharedBytes shared;
+    std::span<const uint8_t> data = FileSystem::Get().ReadView(path);
+    if (data.empty() && (!cachedOnly || FileSystem::Get().IsCached(path))) {
+        if ((shared = FileSystem::Get().ReadShared(path))) data = *shared;
+    }
+    if (bytes) *bytes = data.size();
+    return data.empty() ? 0 : HashContent(data);
 }
 
 GLuint AssetManager::CreateTextureFromImage(const std::shared_ptr<Image>& image) {
+    std::string key = "unnamed_" + std::to_string(_nextTextureID++);
+    GLuint texID = CreateTextureFromImage(image, key);
+    _graph.Register(AssetKind::Texture, key);
+    return texID;
+}
+
+GLuint AssetManager::CreateTextureFromImage(const std::shared_ptr<Image>& image, const std::string& key) {
     if (!image) {
         throw std::runtime_error("Cannot create texture from null image");
     }
@@ -595,7 +845,7 @@ GLuint AssetManager::CreateTextureFromImage(const std::shared_ptr<Image>& image)
     glGenerateMipmap(GL_TEXTURE_2D);
 
     size_t bytes = (size_t)image->width * image->height * image->channelCount;
-    _textureCache["unnamed_" + std::to_string(_nextTextureID++)] = { texID, (uint32_t)image->width, (uint32_t)image->height, bytes };
+    _textureCache[key] = { texID, (uint32_t)image->width, (uint32_t)image->height, bytes };
     textures.push_back(texID);
     return texID;
 }
@@ -624,12 +874,15 @@ std::string AssetManager::GetTexturePath(GLuint id) const {
 
 
 size_t AssetManager::getTotalTextureBytes() const {
-    std::unordered_set<GLuint> seen;
-    size_t total = 0;
+    // Deduplicated paths share a GL name; an alias taken mid-stream has stale sizes
+    std::unordered_map<GLuint, size_t> sizes;
     for (auto& kv : _textureCache) {
-        if (kv.second.glID != 0 && seen.insert(kv.second.glID).second)
-            total += kv.second.bytes;
+        if (kv.second.glID == 0) continue;
+        size_t& bytes = sizes[kv.second.glID];
+        bytes         = std::max(bytes, kv.second.bytes);
     }
+    size_t total = 0;
+    for (auto& [id, bytes] : sizes) total += bytes;
     return total;
 }
 
@@ -784,6 +1037,7 @@ Mesh* AssetManager::CreateMesh(const std::string& name, Mesh* mesh) {
     }
     meshes.push_back(mesh);
     _meshCache[name] = mesh;
+    _graph.Register(AssetKind::Mesh, name);
     return mesh;
 }
 
@@ -877,37 +1131,249 @@ Mesh* AssetManager::GetMesh(const std::string& name) const {
     throw std::runtime_error(fmt::format("Mesh '{}' not found", name));
 }
 
-std::shared_ptr<Mesh> AssetManager::LoadOBJ(const std::string& path) {
-    std::vector<Vertex> vertices;
-    std::vector<uint16_t> indices;
-
-    // tinyobj::attrib_t attrib;
-    // std::vector<tinyobj::shape_t> shapes;
-    // std::vector<tinyobj::material_t> materials;
-    // std::string err;
-
-    // if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &err, path.c_str())) {
-    //     throw std::runtime_error(fmt::format("Failed to load model: {}", err));
-    // }
-
-    // for (const auto& shape : shapes) {
-    //     for (const auto& index : shape.mesh.indices) {
-    //         Vertex vert = {};
-    //         vert.position = { attrib.vertices[3 * index.vertex_index + 0],
-    //                           attrib.vertices[3 * index.vertex_index + 1],
-    //                           attrib.vertices[3 * index.vertex_index + 2] };
-    //         vert.normal = { attrib.normals[3 * index.normal_index + 0],
-    //                         attrib.normals[3 * index.normal_index + 1],
-    //                         attrib.normals[3 * index.normal_index + 2] };
-    //         vert.uv = { attrib.texcoords[2 * index.texcoord_index + 0],
-    //                     1.0 - attrib.texcoords[2 * index.texcoord_index + 1] };
-    //         vertices.push_back(vert);
-    //         indices.push_back(indices.size());
-    //     }
-    // }
+// Source formats are imported offline by tools/mesh_cooker; at runtime the
+// cooked sibling ("model.obj" → "model.aemesh") is what gets loaded.
+static std::string CookedMeshPath(const std::string& path) {
+    size_t dot = path.find_last_of('.');
+    size_t slash = path.find_last_of('/');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) return path + ".aemesh";
+    return path.substr(0, dot) + ".aemesh";
+}
+
+static void InitializeCookedMesh(Mesh& mesh, const std::string& path, AssetLoadRecord* record = nullptr) {
+    // Pack entries are uploaded straight from the mapping; loose files pass
+    // through the cache once
+    std::span<const uint8_t> bytes = FileSystem::Get().ReadView(path);
+    FileSystem::SharedBytes shared;
+    if (bytes.empty() && (shared = FileSystem::Get().ReadShared(path))) bytes = *shared;
+    if (bytes.empty()) throw std::runtime_error(fmt::format("Failed to read mesh: {}", path));
+
+    auto decode = std::chrono::steady_clock::now();
+    MeshView view;
+    std::string error;
+    if (!ParseMeshFile(bytes, view, &error))
+        throw std::runtime_error(fmt::format("Invalid cooked mesh '{}': {}", path, error));
+    auto upload = std::chrono::steady_clock::now();
+    mesh.Initialize(view);
+    if (record) {
+        record->decodeMs = std::chrono::duration<float, std::milli>(upload - decode).count();
+        record->uploadMs = MillisecondsSince(upload);
+    }
+    if (shared) FileSystem::Get().EvictCache(path);// the GPU holds the only copy needed
+}
 
+Mesh* AssetManager::LoadMesh(const std::string& path) {
+    auto it = _meshCache.find(path);
+    if (it != _meshCache.end()) {
+        _loadStats.Record({ path, AssetKind::Mesh, AssetCacheStatus::Memory });
+        return it->second;
+    }
+
+    // The read lands in the file cache, where InitializeCookedMesh finds it
+    auto start = std::chrono::steady_clock::now();
+    AssetLoadRecord record{ path, AssetKind::Mesh };
+    record.contentHash = HashSource(path, false, &record.bytes);
+    record.readMs      = MillisecondsSince(start);
+
+    // A mesh cooked to the same bytes under another path is shared.  It
+    // stays out of `meshes`, which owns each mesh once.
+    const std::string* holder = record.contentHash ? _meshContent.Find(record.contentHash) : nullptr;
+    auto same = holder ? _meshCache.find(*holder) : _meshCache.end();
+    if (same != _meshCache.end()) {
+        Mesh* mesh = same->second;
+        _meshCache[path] = mesh;
+        AssetHandle handle = _graph.Register(AssetKind::Mesh, path);
+        _graph.AddDependency(handle, TrackSource(path));
+        FileSystem::Get().EvictCache(path);
+        record.cache = AssetCacheStatus::Dedup;
+        _loadStats.Record(std::move(record));
+        return mesh;
+    }
+
+    auto mesh = new Mesh(MeshType::PRIM);
+    try {
+        InitializeCookedMesh(*mesh, path, &record);
+    } catch (...) {
+        delete mesh;
+        throw;
+    }
+    if (record.contentHash) _meshContent.Insert(record.contentHash, path);
+    _loadStats.Record(std::move(record));
+    if (_materialCache.find("Default") != _materialCache.end()) {
+        mesh->SetMaterial(GetMaterial("Default"));
+    }
+    CreateMesh(path, mesh);
+
+    AssetHandle handle = _graph.Find(AssetKind::Mesh, path);
+    _graph.AddDependency(handle, TrackSource(path));
+    _graph.AddDependency(handle, _graph.Find(AssetKind::Material, "Default"));
+    return mesh;
+}
+
+std::shared_ptr<Mesh> AssetManager::LoadOBJ(const std::string& path) {
     auto mesh = std::make_shared<Mesh>(MeshType::PRIM);
-    mesh->Initialize(vertices, indices);
+    InitializeCookedMesh(*mesh, CookedMeshPath(path));
+    return mesh;
+}
 
+std::shared_ptr<Mesh> AssetManager::LoadGLTF(const std::string& path) {
+    auto mesh = std::make_shared<Mesh>(MeshType::PRIM);
+    InitializeCookedMesh(*mesh, CookedMeshPath(path));
     return mesh;
 }
+
+// ============================================================================
+// Dependencies & Hot Reload
+// ============================================================================
+
+AssetHandle AssetManager::TrackSource(const std::string& path) {
+    bool known = _graph.Find(AssetKind::File, path).IsValid();
+    AssetHandle handle = _graph.Register(AssetKind::File, path);
+    if (!known && _watcher) _watcher->Watch(path);
+    return handle;
+}
+
+AssetHandle AssetManager::TrackTexture(const std::string& path) {
+    AssetHandle handle = _graph.Register(AssetKind::Texture, path);
+    _graph.AddDependency(handle, TrackSource(path));
+    return handle;
+}
+
+AssetHandle AssetManager::TextureAtIndex(int index) const {
+    if (index < 0 || index >= (int)textures.size()) return {};
+    return _graph.Find(AssetKind::Texture, GetTexturePath(textures[index]));
+}
+
+void AssetManager::Acquire(AssetHandle handle) {
+    _graph.AddRef(handle);
+}
+
+void AssetManager::Release(AssetHandle handle) {
+    _graph.Release(handle);
+}
+
+AssetHandle AssetManager::TrackScene(
+  const std::string& name,
+  const std::vector<std::string>& sourcePaths,
+  const std::vector<std::string>& texturePaths,
+  const std::vector<std::string>& shaderNames
+) {
+    AssetHandle handle = _graph.Register(AssetKind::Scene, name);
+    _graph.RemoveDependencies(handle);
+    for (const auto& path : sourcePaths)
+        _graph.AddDependency(handle, TrackSource(path));
+    for (const auto& path : texturePaths)
+        _graph.AddDependency(handle, _graph.Find(AssetKind::Texture, NormalizeTexturePath(path)));
+    for (const auto& shader : shaderNames)
+        _graph.AddDependency(handle, _graph.Find(AssetKind::Shader, shader));
+    return handle;
+}
+
+void AssetManager::EnableHotReload() {
+    if (_watcher) return;
+    _watcher = std::make_unique<FileWatcher>();
+    if (!_watcher->IsSupported()) {
+        spdlog::warn("Hot reload is not supported on this platform");
+        return;
+    }
+    size_t count = 0;
+    _graph.ForEach(AssetKind::File, [&](AssetHandle, const std::string& path) {
+        _watcher->Watch(path);
+        ++count;
+    });
+    ENGINE_LOG("Hot reload enabled, watching {} files", count);
+}
+
+void AssetManager::ReloadAsset(AssetHandle handle) {
+    const std::string& name = _graph.GetName(handle);
+    switch (_graph.GetKind(handle)) {
+    case AssetKind::Texture: {
+        auto it = _textureCache.find(name);
+        if (it == _textureCache.end()) break;
+        EnsureTexturePipeline();
+        _imageCache.erase(name);
+        _imageContent.Erase(name);
+        _textureContent.Erase(name);
+        GLuint glID = it->second.glID;
+        bool shared = std::any_of(_textureCache.begin(), _textureCache.end(), [&](const auto& entry) {
+            return entry.second.glID == glID && entry.first != name;
+        });
+        if (shared) {
+            // Deduplicated: the other paths' files didn't change, so they keep the old name
+            DetachTexture(name, glID);
+        } else {
+            // Same GL name: materials holding it see the new levels as they arrive
+            _texturePipeline->Reload(glID, name);
+        }
+        break;
+    }
+    case AssetKind::Shader: {
+        auto it = _shaderCache.find(name);
+        if (it == _shaderCache.end() || it->second >= _shaderProps.size()) break;
+        try {
+            ShaderProgram fresh(_shaderProps[it->second]);
+            ShaderProgram* shader = shaders[it->second];
+            glDeleteProgram(shader->GetProgramID());
+            *shader = std::move(fresh);
+        } catch (const std::exception& e) {
+            spdlog::warn("Keeping the old '{}' shader: {}", name, e.what());
+        }
+        break;
+    }
+    case AssetKind::Mesh: {
+        auto it = _meshCache.find(name);
+        if (it == _meshCache.end()) break;
+        _meshContent.Erase(name);
+        Mesh* mesh = it->second;
+        bool shared = std::any_of(_meshCache.begin(), _meshCache.end(), [&](const auto& entry) {
+            return entry.second == mesh && entry.first != name;
+        });
+        try {
+            if (!shared) {
+                InitializeCookedMesh(*mesh, name);
+            } else {
+                // Deduplicated: the other paths keep the old mesh and this one
+                // gets its own, which components see once they fetch it again
+                auto fresh = std::make_unique<Mesh>(MeshType::PRIM);
+                InitializeCookedMesh(*fresh, name);
+                fresh->SetMaterial(mesh->GetMaterial());
+                meshes.push_back(fresh.get());
+                it->second = fresh.release();
+            }
+        } catch (const std::exception& e) {
+            spdlog::warn("Keeping the old '{}' mesh: {}", name, e.what());
+        }
+        break;
+    }
+    default:
+        break;// materials and scenes hold no file data of their own
+    }
+}
+
+std::vector<AssetHandle> AssetManager::ReloadSource(const std::string& path) {
+    AssetHandle file = _graph.Find(AssetKind::File, path);
+    if (!file.IsValid()) return {};
+    FileSystem::Get().EvictCache(path);
+
+    std::vector<AssetHandle> direct = _graph.GetDependents(file);
+    std::vector<AssetHandle> invalidated = _graph.Invalidate(file);
+    // Invalidate's order puts a shader before a scene that uses it
+    std::vector<AssetHandle> reloaded;
+    for (AssetHandle handle : invalidated) {
+        if (std::find(direct.begin(), direct.end(), handle) == direct.end()) continue;
+        ReloadAsset(handle);
+        reloaded.push_back(handle);
+    }
+    ENGINE_LOG("Reloaded '{}': {} assets, {} invalidated", path, reloaded.size(), invalidated.size() - 1);
+    return reloaded;
+}
+
+std::vector<AssetHandle> AssetManager::PollHotReload() {
+    std::vector<AssetHandle> reloaded;
+    if (!_watcher) return reloaded;
+    for (const auto& path : _watcher->Poll()) {
+        auto assets = ReloadSource(path);
+        reloaded.insert(reloaded.end(), assets.begin(), assets.end());
+    }
+    return reloaded;
+}
@@ -0,0 +1,317 @@
+// asset_pack.cpp — Asset pack reader (mmap) and writer.
+//
+// Kept free of engine dependencies so tools/asset_packer can compile it
+// directly without linking the whole engine.
+
+#include "asset_pack.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+
+#if !defined(__EMSCRIPTEN__) && (defined(__unix__) || defined(__APPLE__))
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define AE_ASSET_PACK_MMAP 1
+#endif
+
+#ifdef AE_USE_LZ4
+#include <lz4.h>
+#endif
+#ifdef AE_USE_ZSTD
+#include <zstd.h>
+#endif
+
+uint64_t HashAssetPath(std::string_view path) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : path) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+bool IsCompressionAvailable(AssetPackCompression compression) {
+    switch (compression) {
+    case AssetPackCompression::None:
+        return true;
+    case AssetPackCompression::LZ4:
+#ifdef AE_USE_LZ4
+        return true;
+#else
+        return false;
+#endif
+    case AssetPackCompression::Zstd:
+#ifdef AE_USE_ZSTD
+        return true;
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Codecs
+// ─────────────────────────────────────────────────────────────────────────────
+static bool Compress(AssetPackCompression compression, const std::vector<uint8_t>& raw, std::vector<uint8_t>& out) {
+    switch (compression) {
+#ifdef AE_USE_LZ4
+    case AssetPackCompression::LZ4: {
+        if (raw.size() > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) return false;
+        out.resize(static_cast<size_t>(LZ4_compressBound(static_cast<int>(raw.size()))));
+        int n = LZ4_compress_default(reinterpret_cast<const char*>(raw.data()), reinterpret_cast<char*>(out.data()),
+                                     static_cast<int>(raw.size()), static_cast<int>(out.size()));
+        if (n <= 0) return false;
+        out.resize(static_cast<size_t>(n));
+        return true;
+    }
+#endif
+#ifdef AE_USE_ZSTD
+    case AssetPackCompression::Zstd: {
+        out.resize(ZSTD_compressBound(raw.size()));
+        size_t n = ZSTD_compress(out.data(), out.size(), raw.data(), raw.size(), 19);
+        if (ZSTD_isError(n)) return false;
+        out.resize(n);
+        return true;
+    }
+#endif
+    default:
+        (void)raw;
+        (void)out;
+        return false;
+    }
+}
+
+static bool Decompress(AssetPackCompression compression, std::span<const uint8_t> stored, std::vector<uint8_t>& out) {
+    switch (compression) {
+#ifdef AE_USE_LZ4
+    case AssetPackCompression::LZ4: {
+        int n = LZ4_decompress_safe(reinterpret_cast<const char*>(stored.data()), reinterpret_cast<char*>(out.data()),
+                                    static_cast<int>(stored.size()), static_cast<int>(out.size()));
+        return n >= 0 && static_cast<size_t>(n) == out.size();
+    }
+#endif
+#ifdef AE_USE_ZSTD
+    case AssetPackCompression::Zstd: {
+        size_t n = ZSTD_decompress(out.data(), out.size(), stored.data(), stored.size());
+        return !ZSTD_isError(n) && n == out.size();
+    }
+#endif
+    default:
+        (void)stored;
+        (void)out;
+        return false;
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Reader
+// ─────────────────────────────────────────────────────────────────────────────
+AssetPack::~AssetPack() {
+    Close();
+}
+
+static bool Fail(std::string* error, std::string message) {
+    if (error) *error = std::move(message);
+    return false;
+}
+
+bool AssetPack::Open(const std::string& path, std::string* error) {
+    Close();
+
+#ifdef AE_ASSET_PACK_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return Fail(error, "cannot open '" + path + "'");
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        ::close(fd);
+        return Fail(error, "cannot stat '" + path + "'");
+    }
+    void* mapping = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);// the mapping keeps the file alive
+    if (mapping == MAP_FAILED) return Fail(error, "cannot mmap '" + path + "'");
+    _data   = static_cast<const uint8_t*>(mapping);
+    _size   = static_cast<size_t>(st.st_size);
+    _mapped = true;
+#else
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return Fail(error, "cannot open '" + path + "'");
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    rewind(f);
+    if (len > 0) {
+        _buffer.resize(static_cast<size_t>(len));
+        if (fread(_buffer.data(), 1, _buffer.size(), f) != _buffer.size()) _buffer.clear();
+    }
+    fclose(f);
+    if (_buffer.empty()) return Fail(error, "cannot read '" + path + "'");
+    _data = _buffer.data();
+    _size = _buffer.size();
+#endif
+
+    // ── Validate before trusting any offset ──────────────────────────────────
+    AssetPackHeader header;
+    if (_size < sizeof(header)) {
+        Close();
+        return Fail(error, "'" + path + "' is truncated");
+    }
+    std::memcpy(&header, _data, sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+        Close();
+        return Fail(error, "'" + path + "' is not a version " + std::to_string(VERSION) + " asset pack");
+    }
+    uint64_t tableEnd = sizeof(header) + static_cast<uint64_t>(header.entryCount) * sizeof(AssetPackEntry);
+    if (tableEnd > _size || header.pathTableOffset > _size || header.pathTableSize > _size - header.pathTableOffset) {
+        Close();
+        return Fail(error, "'" + path + "' has a corrupt table");
+    }
+
+    _entries = { reinterpret_cast<const AssetPackEntry*>(_data + sizeof(header)), header.entryCount };
+    _paths   = { reinterpret_cast<const char*>(_data + header.pathTableOffset), static_cast<size_t>(header.pathTableSize) };
+    for (size_t i = 0; i < _entries.size(); ++i) {
+        const AssetPackEntry& e = _entries[i];
+        auto compression = static_cast<AssetPackCompression>(e.compression);
+        bool ok = e.offset <= _size && e.size <= _size - e.offset &&
+                  static_cast<uint64_t>(e.pathOffset) + e.pathLength <= _paths.size() &&
+                  (i == 0 || _entries[i - 1].pathHash <= e.pathHash) &&
+                  e.compression <= static_cast<uint32_t>(AssetPackCompression::Zstd) &&
+                  (compression == AssetPackCompression::None
+                     ? e.size == e.rawSize
+                     : e.rawSize <= MAX_RAW_SIZE && e.rawSize / MaxInflateRatio(compression) <= e.size);
+        if (!ok) {
+            Close();
+            return Fail(error, "'" + path + "' has a corrupt entry");
+        }
+    }
+    return true;
+}
+
+void AssetPack::Close() {
+#ifdef AE_ASSET_PACK_MMAP
+    if (_mapped) munmap(const_cast<uint8_t*>(_data), _size);
+#endif
+    _data    = nullptr;
+    _size    = 0;
+    _mapped  = false;
+    _entries = {};
+    _paths   = {};
+    _buffer.clear();
+    _buffer.shrink_to_fit();
+    std::lock_guard<std::mutex> lk(_inflateMutex);
+    _inflated.clear();
+}
+
+const AssetPackEntry* AssetPack::Find(std::string_view path) const {
+    uint64_t hash = HashAssetPath(path);
+    auto it = std::lower_bound(_entries.begin(), _entries.end(), hash,
+                               [](const AssetPackEntry& e, uint64_t h) { return e.pathHash < h; });
+    for (; it != _entries.end() && it->pathHash == hash; ++it) {
+        if (GetPath(*it) == path) return &*it;
+    }
+    return nullptr;
+}
+
+std::string_view AssetPack::GetPath(const AssetPackEntry& entry) const {
+    return _paths.substr(entry.pathOffset, entry.pathLength);
+}
+
+std::span<const uint8_t> AssetPack::Stored(const AssetPackEntry& entry) const {
+    return { _data + entry.offset, static_cast<size_t>(entry.size) };
+}
+
+std::span<const uint8_t> AssetPack::View(const AssetPackEntry& entry) {
+    auto compression = static_cast<AssetPackCompression>(entry.compression);
+    if (compression == AssetPackCompression::None) return Stored(entry);
+
+    {
+        std::lock_guard<std::mutex> lk(_inflateMutex);
+        auto it = _inflated.find(entry.offset);
+        if (it != _inflated.end()) return *it->second;
+    }
+
+    // Inflate unlocked so other entries aren't held up; if two threads race
+    // on the same entry the first insert wins and the other copy is dropped
+    auto raw = std::make_unique<std::vector<uint8_t>>(static_cast<size_t>(entry.rawSize));
+    if (!Decompress(compression, Stored(entry), *raw)) return {};
+    std::lock_guard<std::mutex> lk(_inflateMutex);
+    auto it = _inflated.try_emplace(entry.offset, std::move(raw)).first;
+    return *it->second;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Writer
+// ─────────────────────────────────────────────────────────────────────────────
+void AssetPackWriter::Add(std::string path, std::vector<uint8_t> bytes, AssetPackCompression compression) {
+    Item item{ std::move(path), {}, bytes.size(), AssetPackCompression::None };
+    std::vector<uint8_t> packed;
+    // Keep the compressed form only if it saves at least 1/8th
+    if (compression != AssetPackCompression::None && IsCompressionAvailable(compression) &&
+        bytes.size() <= AssetPack::MAX_RAW_SIZE && Compress(compression, bytes, packed) &&
+        packed.size() < bytes.size() - bytes.size() / 8) {
+        item.stored      = std::move(packed);
+        item.compression = compression;
+    } else {
+        item.stored = std::move(bytes);
+    }
+    _items.push_back(std::move(item));
+}
+
+bool AssetPackWriter::Write(const std::string& outPath, std::string* error) const {
+    std::vector<size_t> order(_items.size());
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        uint64_t ha = HashAssetPath(_items[a].path), hb = HashAssetPath(_items[b].path);
+        return ha != hb ? ha < hb : _items[a].path < _items[b].path;
+    });
+
+    auto align = [](uint64_t v) { return (v + AssetPack::ALIGNMENT - 1) / AssetPack::ALIGNMENT * AssetPack::ALIGNMENT; };
+
+    AssetPackHeader header{};
+    std::memcpy(header.magic, AssetPack::MAGIC, sizeof(header.magic));
+    header.version         = AssetPack::VERSION;
+    header.entryCount      = static_cast<uint32_t>(_items.size());
+    header.alignment       = AssetPack::ALIGNMENT;
+    header.pathTableOffset = sizeof(AssetPackHeader) + _items.size() * sizeof(AssetPackEntry);
+
+    std::string paths;
+    std::vector<AssetPackEntry> entries(_items.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        const Item& item = _items[order[i]];
+        AssetPackEntry& e = entries[i];
+        e.pathHash    = HashAssetPath(item.path);
+        e.size        = item.stored.size();
+        e.rawSize     = item.rawSize;
+        e.pathOffset  = static_cast<uint32_t>(paths.size());
+        e.pathLength  = static_cast<uint32_t>(item.path.size());
+        e.compression = static_cast<uint32_t>(item.compression);
+        paths += item.path;
+    }
+    header.pathTableSize = paths.size();
+
+    uint64_t cursor = align(header.pathTableOffset + header.pathTableSize);
+    for (auto& e : entries) {
+        e.offset = cursor;
+        cursor   = align(cursor + e.size);
+    }
+
+    FILE* f = fopen(outPath.c_str(), "wb");
+    if (!f) return Fail(error, "cannot create '" + outPath + "'");
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+    ok = ok && (entries.empty() || fwrite(entries.data(), sizeof(AssetPackEntry), entries.size(), f) == entries.size());
+    ok = ok && fwrite(paths.data(), 1, paths.size(), f) == paths.size();
+    uint64_t written = header.pathTableOffset + header.pathTableSize;
+    static const uint8_t zeros[AssetPack::ALIGNMENT] = {};
+    for (size_t i = 0; ok && i < order.size(); ++i) {
+        const auto& stored = _items[order[i]].stored;
+        size_t pad = static_cast<size_t>(entries[i].offset - written);
+        ok = fwrite(zeros, 1, pad, f) == pad &&
+             (stored.empty() || fwrite(stored.data(), 1, stored.size(), f) == stored.size());
+        written = entries[i].offset + stored.size();
+    }
+    ok = (fclose(f) == 0) && ok;
+    return ok ? true : Fail(error, "failed writing '" + outPath + "'");
+}
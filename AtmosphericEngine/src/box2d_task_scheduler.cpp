@@ -0,0 +1,56 @@
+#include "box2d_task_scheduler.hpp"
+#include "pch.hpp"
+
+#include <algorithm>
+
+Box2DTaskScheduler::Box2DTaskScheduler(JobSystem& jobSystem, int workerCount) : _jobSystem(jobSystem) {
+    // Box2D's solver runs workerCount tasks that spin on each other, so every
+    // one of them needs a thread: never ask for more than the JobSystem has.
+    int maxWorkers = std::min<int>(jobSystem.GetThreadCount(), MAX_WORKERS);
+    _workerCount = workerCount <= 0 ? maxWorkers : std::clamp(workerCount, 1, maxWorkers);
+}
+
+void Box2DTaskScheduler::Configure(b2WorldDef& def) {
+    def.workerCount = _workerCount;
+    def.enqueueTask = &Box2DTaskScheduler::EnqueueTask;
+    def.finishTask = &Box2DTaskScheduler::FinishTask;
+    def.userTaskContext = this;
+}
+
+void* Box2DTaskScheduler::EnqueueTask(
+  b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext
+) {
+    auto* self = static_cast<Box2DTaskScheduler*>(userContext);
+    if (self->_taskCount == MAX_TASKS) {
+        // Out of records: run inline, Box2D treats nullptr as already done
+        task(0, itemCount, 0, taskContext);
+        return nullptr;
+    }
+
+    JobCounter& counter = self->_tasks[self->_taskCount++];
+    // Chunk index doubles as Box2D's worker index: chunks of one task run
+    // concurrently and each needs its own per-worker scratch slot.
+    int chunkCount = std::clamp(itemCount / std::max(minRange, 1), 1, self->_workerCount);
+    int chunkSize = std::max((itemCount + chunkCount - 1) / chunkCount, 1);
+    chunkCount = (itemCount + chunkSize - 1) / chunkSize;
+
+    for (int i = 0; i < chunkCount; ++i) {
+        int start = i * chunkSize;
+        int end = std::min(start + chunkSize, itemCount);
+        self->_jobSystem.Execute(
+          [task, taskContext, start, end, i](int) {
+#ifdef TRACY_ENABLE
+              ZoneScopedN("Box2DTask");
+#endif
+              task(start, end, static_cast<uint32_t>(i), taskContext);
+          },
+          counter
+        );
+    }
+    return &counter;
+}
+
+void Box2DTaskScheduler::FinishTask(void* userTask, void* userContext) {
+    auto* self = static_cast<Box2DTaskScheduler*>(userContext);
+    self->_jobSystem.Wait(*static_cast<JobCounter*>(userTask));
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "job_system.hpp"
+#include <array>
+#include <box2d/box2d.h>
+
+// Bridges Box2D v3's enqueueTask/finishTask interface onto the JobSystem.
+// Each enqueued task is split into at most workerCount jobs counted in a
+// JobCounter of its own, so finishTask never waits on unrelated jobs.
+class Box2DTaskScheduler {
+public:
+    static constexpr int MAX_TASKS = 256;// per world step
+    static constexpr int MAX_WORKERS = 64;// Box2D's internal worker limit
+
+    Box2DTaskScheduler(JobSystem& jobSystem, int workerCount);
+
+    int GetWorkerCount() const {
+        return _workerCount;
+    }
+
+    // Fills the task callbacks and worker count of a world definition
+    void Configure(b2WorldDef& def);
+    // Recycles the task records; call after every b2World_Step
+    void EndStep() {
+        _taskCount = 0;
+    }
+
+private:
+    static void* EnqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext);
+    static void FinishTask(void* userTask, void* userContext);
+
+    JobSystem& _jobSystem;
+    int _workerCount;
+    std::array<JobCounter, MAX_TASKS> _tasks;
+    int _taskCount = 0;
+};
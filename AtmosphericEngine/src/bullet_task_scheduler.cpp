@@ -15,6 +15,7 @@ void BulletTaskScheduler::parallelFor(int iBegin, int iEnd, int grainSize, const
         return;
     }
 
+    JobCounter tasks;
     for (int i = 0; i < numTasks; ++i) {
         const int start = iBegin + i * grainSize;
         const int end = (i == numTasks - 1) ? iEnd : start + grainSize;
@@ -26,8 +27,8 @@ void BulletTaskScheduler::parallelFor(int iBegin, int iEnd, int grainSize, const
             // Debug logging to verify multithreading
             // spdlog::info("Bullet Task on Thread: {}", std::this_thread::get_id());
             body.forLoop(start, end);
-        });
+        }, tasks);
     }
 
-    m_jobSystem.Wait();
+    m_jobSystem.Wait(tasks);
 }
@@ -0,0 +1,118 @@
+#include "contact_tracker.hpp"
+#include <algorithm>
+#include <iterator>
+
+bool ContactFilter::Matches(const ContactEvent& e) const {
+    if (!(e.layerA & layerMask) && !(e.layerB & layerMask)) return false;
+    if (predicate && !predicate(e.a) && !predicate(e.b)) return false;
+    return true;
+}
+
+void ContactTracker::AddContact(const void* bodyA, const void* bodyB, const ContactEvent& contact) {
+    if (bodyA < bodyB) {
+        _curr.push_back({ bodyA, bodyB, contact });
+    } else {
+        _curr.push_back({ bodyB, bodyA, contact });
+    }
+}
+
+void ContactTracker::Update() {
+    ZoneScoped;
+    _events.Clear();
+    std::sort(_curr.begin(), _curr.end());
+
+    // A pair can span several manifolds (compound shapes): fold them
+    // together, keeping the deepest point and its normal
+    size_t n = 0;
+    for (size_t k = 0; k < _curr.size(); ++k) {
+        if (n > 0 && !(_curr[n - 1] < _curr[k])) {
+            ContactEvent& kept = _curr[n - 1].event;
+            const ContactEvent& next = _curr[k].event;
+            kept.impulse += next.impulse;
+            if (next.depth > kept.depth) {
+                kept.point  = next.point;
+                kept.normal = next.a == kept.a ? next.normal : -next.normal;// on the kept event's B
+                kept.depth  = next.depth;
+            }
+        } else {
+            _curr[n++] = _curr[k];
+        }
+    }
+    _curr.resize(n);
+
+    // Both sets are sorted: a single merge walk classifies every pair
+    size_t i = 0, j = 0;
+    while (i < _prev.size() || j < _curr.size()) {
+        if (j == _curr.size() || (i < _prev.size() && _prev[i] < _curr[j])) {
+            _events.end.push_back(_prev[i++].event);
+        } else if (i == _prev.size() || _curr[j] < _prev[i]) {
+            _events.begin.push_back(_curr[j++].event);
+        } else {
+            _events.stay.push_back(_curr[j].event);
+            ++i;
+            ++j;
+        }
+    }
+
+    std::swap(_prev, _curr);
+    _curr.clear();
+}
+
+void ContactTracker::RemoveBody(const void* body) {
+    auto touches = [body](const Pair& p) { return p.lo == body || p.hi == body; };
+    _prev.erase(std::remove_if(_prev.begin(), _prev.end(), touches), _prev.end());
+    _curr.erase(std::remove_if(_curr.begin(), _curr.end(), touches), _curr.end());
+}
+
+void ContactTracker::Clear() {
+    _prev.clear();
+    _curr.clear();
+    _events.Clear();
+}
+
+ContactSubscriberID ContactTracker::Subscribe(const ContactFilter& filter, ContactListener listener) {
+    ContactSubscriberID id = _nextSubscriberID++;
+    // Appending mid-dispatch could reallocate the listener being called
+    (_dispatching ? _added : _subscribers).push_back({ id, filter, std::move(listener) });
+    return id;
+}
+
+void ContactTracker::Unsubscribe(ContactSubscriberID id) {
+    auto matches = [id](const Subscriber& s) { return s.id == id; };
+    if (!_dispatching) {
+        std::erase_if(_subscribers, matches);
+        return;
+    }
+    // Mid-dispatch: mark now, erase once every listener has returned
+    for (auto& sub : _subscribers)
+        if (matches(sub)) sub.removed = true;
+    std::erase_if(_added, matches);
+}
+
+void ContactTracker::Dispatch() {
+    if (_events.begin.empty() && _events.stay.empty() && _events.end.empty()) return;
+    ZoneScoped;
+
+    _dispatching = true;
+    for (const auto& sub : _subscribers) {
+        if (sub.removed) continue;
+        if (sub.filter.layerMask == -1 && !sub.filter.predicate) {
+            sub.listener(_events);
+            continue;
+        }
+        _filtered.Clear();
+        auto filter = [&sub](const std::vector<ContactEvent>& src, std::vector<ContactEvent>& dst) {
+            for (const auto& e : src)
+                if (sub.filter.Matches(e)) dst.push_back(e);
+        };
+        filter(_events.begin, _filtered.begin);
+        filter(_events.stay, _filtered.stay);
+        filter(_events.end, _filtered.end);
+        sub.listener(_filtered);
+    }
+    _dispatching = false;
+
+    std::erase_if(_subscribers, [](const Subscriber& s) { return s.removed; });
+    std::move(_added.begin(), _added.end(), std::back_inserter(_subscribers));
+    _added.clear();
+}
@@ -0,0 +1,37 @@
+#include "content_hash.hpp"
+
+#include <xxhash.h>
+
+uint64_t HashContent(std::span<const uint8_t> bytes) {
+    return XXH3_64bits(bytes.data(), bytes.size());
+}
+
+const std::string* ContentIndex::Find(uint64_t hash) const {
+    auto it = _byHash.find(hash);
+    return it != _byHash.end() ? &it->second : nullptr;
+}
+
+const std::string& ContentIndex::Insert(uint64_t hash, const std::string& name) {
+    auto [it, inserted] = _byHash.try_emplace(hash, name);
+    if (inserted) {
+        // A name re-inserted with new contents gives up its old hash
+        auto [old, fresh] = _byName.try_emplace(name, hash);
+        if (!fresh) {
+            _byHash.erase(old->second);
+            old->second = hash;
+        }
+    }
+    return it->second;
+}
+
+void ContentIndex::Erase(const std::string& name) {
+    auto it = _byName.find(name);
+    if (it == _byName.end()) return;
+    _byHash.erase(it->second);
+    _byName.erase(it);
+}
+
+void ContentIndex::Clear() {
+    _byHash.clear();
+    _byName.clear();
+}
@@ -0,0 +1,82 @@
+#include "depth_sort.hpp"
+#include "globals.hpp"
+#include <array>
+#include <numeric>
+
+const std::vector<uint32_t>& DepthSorter::Sort(const uint32_t* keys, uint32_t count) {
+    ZoneScoped;
+    bool history = _order.size() == count;
+    if (!history) {
+        // Element set changed: the identity order says nothing about the
+        // keys, so don't spend the insertion budget finding that out
+        _order.resize(count);
+        std::iota(_order.begin(), _order.end(), 0u);
+    }
+    _usedInsertion = history && InsertionSort(keys);
+    if (!_usedInsertion) {
+        RadixSort(keys);
+    }
+    return _order;
+}
+
+bool DepthSorter::InsertionSort(const uint32_t* keys) {
+    uint64_t budget = static_cast<uint64_t>(_order.size()) * MAX_MOVES_PER_ELEMENT;
+    uint32_t* order = _order.data();
+    for (size_t i = 1; i < _order.size(); ++i) {
+        uint32_t idx = order[i];
+        uint32_t key = keys[idx];
+        size_t j = i;
+        while (j > 0 && keys[order[j - 1]] > key) {
+            order[j] = order[j - 1];
+            --j;
+            // Too far from sorted: the partial result is still a valid
+            // permutation, hand it over to the radix sort
+            if (--budget == 0) {
+                order[j] = idx;
+                return false;
+            }
+        }
+        order[j] = idx;
+    }
+    return true;
+}
+
+void DepthSorter::RadixSort(const uint32_t* keys) {
+    // LSD radix, 8 bits per pass; passes where every key shares the digit
+    // (e.g. the high byte of 16-bit keys) are skipped.
+    const size_t n = _order.size();
+    if (n < 2) return;
+    _scratch.resize(n);
+    uint32_t* src = _order.data();
+    uint32_t* dst = _scratch.data();
+
+    std::array<std::array<uint32_t, 256>, 4> histograms{};
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t key = keys[src[i]];
+        for (int pass = 0; pass < 4; ++pass) {
+            ++histograms[pass][(key >> (pass * 8)) & 0xFF];
+        }
+    }
+
+    for (int pass = 0; pass < 4; ++pass) {
+        auto& histogram = histograms[pass];
+        int shift = pass * 8;
+        if (histogram[(keys[src[0]] >> shift) & 0xFF] == n) continue;
+
+        uint32_t offset = 0;
+        for (auto& bucket : histogram) {
+            uint32_t c = bucket;
+            bucket = offset;
+            offset += c;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t idx = src[i];
+            dst[histogram[(keys[idx] >> shift) & 0xFF]++] = idx;
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != _order.data()) {
+        std::copy(src, src + n, _order.data());
+    }
+}
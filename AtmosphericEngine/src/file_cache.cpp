@@ -0,0 +1,132 @@
+#include "file_cache.hpp"
+
+#include <functional>
+
+FileCache::Shard& FileCache::ShardFor(const std::string& key) {
+    return _shards[std::hash<std::string>{}(key) % SHARD_COUNT];
+}
+
+const FileCache::Shard& FileCache::ShardFor(const std::string& key) const {
+    return _shards[std::hash<std::string>{}(key) % SHARD_COUNT];
+}
+
+void FileCache::RemoveLocked(Shard& shard, std::list<Node>::iterator it) {
+    size_t size = it->bytes->size();
+    shard.bytes -= size;
+    _totalBytes.fetch_sub(size, std::memory_order_relaxed);
+    shard.index.erase(it->key);
+    shard.lru.erase(it);
+}
+
+FileSystem::SharedBytes FileCache::Find(const std::string& key) {
+    Shard& shard = ShardFor(key);
+    std::lock_guard<std::mutex> lk(shard.mutex);
+    auto found = shard.index.find(key);
+    if (found == shard.index.end()) {
+        ++shard.misses;
+        return nullptr;
+    }
+    ++shard.hits;
+    shard.lru.splice(shard.lru.begin(), shard.lru, found->second);
+    return found->second->bytes;
+}
+
+bool FileCache::Contains(const std::string& key) const {
+    const Shard& shard = ShardFor(key);
+    std::lock_guard<std::mutex> lk(shard.mutex);
+    return shard.index.count(key) != 0;
+}
+
+FileSystem::SharedBytes FileCache::Insert(const std::string& key, FileSystem::Bytes bytes) {
+    size_t index = std::hash<std::string>{}(key) % SHARD_COUNT;
+    Shard& shard = _shards[index];
+    auto buffer = std::make_shared<FileSystem::Bytes>(std::move(bytes));
+    {
+        std::lock_guard<std::mutex> lk(shard.mutex);
+        auto found = shard.index.find(key);
+        if (found != shard.index.end()) RemoveLocked(shard, found->second);
+        shard.lru.push_front(Node{ key, buffer });
+        shard.index.emplace(key, shard.lru.begin());
+        shard.bytes += buffer->size();
+    }
+    if (_totalBytes.fetch_add(buffer->size(), std::memory_order_relaxed) + buffer->size() > GetBudget()) {
+        EvictToBudget(index, buffer.get());
+    }
+    return buffer;
+}
+
+FileSystem::Bytes FileCache::Take(const std::string& key, bool& found) {
+    Shard& shard = ShardFor(key);
+    std::shared_ptr<FileSystem::Bytes> buffer;
+    {
+        std::lock_guard<std::mutex> lk(shard.mutex);
+        auto it = shard.index.find(key);
+        found = it != shard.index.end();
+        if (!found) {
+            ++shard.misses;
+            return {};
+        }
+        ++shard.hits;
+        buffer = it->second->bytes;
+        RemoveLocked(shard, it->second);
+    }
+    // Sole owner → hand the storage over; otherwise a reader still holds it
+    if (buffer.use_count() == 1) return std::move(*buffer);
+    return *buffer;
+}
+
+void FileCache::Erase(const std::string& key) {
+    Shard& shard = ShardFor(key);
+    std::lock_guard<std::mutex> lk(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) RemoveLocked(shard, it->second);
+}
+
+void FileCache::Clear() {
+    for (Shard& shard : _shards) {
+        std::lock_guard<std::mutex> lk(shard.mutex);
+        _totalBytes.fetch_sub(shard.bytes, std::memory_order_relaxed);
+        shard.lru.clear();
+        shard.index.clear();
+        shard.bytes = 0;
+    }
+}
+
+void FileCache::SetBudget(size_t bytes) {
+    _budget.store(bytes, std::memory_order_relaxed);
+    if (_totalBytes.load(std::memory_order_relaxed) > bytes) EvictToBudget(0, nullptr);
+}
+
+void FileCache::EvictToBudget(size_t startShard, const FileSystem::Bytes* keep) {
+    for (size_t n = 0; n < SHARD_COUNT; ++n) {
+        if (_totalBytes.load(std::memory_order_relaxed) <= GetBudget()) return;
+        Shard& shard = _shards[(startShard + n) % SHARD_COUNT];
+        std::lock_guard<std::mutex> lk(shard.mutex);
+        for (auto it = shard.lru.end(); it != shard.lru.begin();) {
+            if (_totalBytes.load(std::memory_order_relaxed) <= GetBudget()) break;
+            --it;
+            // Pinned: a reader still holds the buffer
+            if (it->bytes.get() == keep || it->bytes.use_count() > 1) continue;
+            auto victim = it++;
+            RemoveLocked(shard, victim);
+            ++shard.evictions;
+        }
+    }
+}
+
+FileSystem::CacheStats FileCache::GetStats() const {
+    FileSystem::CacheStats stats;
+    stats.budget = GetBudget();
+    for (const Shard& shard : _shards) {
+        std::lock_guard<std::mutex> lk(shard.mutex);
+        stats.hits      += shard.hits;
+        stats.misses    += shard.misses;
+        stats.evictions += shard.evictions;
+        stats.bytes     += shard.bytes;
+        stats.entries   += shard.index.size();
+        for (const Node& node : shard.lru) {
+            if (node.bytes.use_count() > 1) stats.pinnedBytes += node.bytes->size();
+        }
+    }
+    return stats;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "file_system.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// FileCache
+//
+// FileSystem's in-process byte cache.  Keys are spread over SHARD_COUNT
+// independently locked LRU lists so JobSystem workers prefetching different
+// files rarely touch the same mutex.  The byte budget is global: an insert
+// that pushes the total over budget evicts least-recently-used entries,
+// starting with its own shard and sweeping the others one lock at a time.
+//
+// Buffers are handed out as shared_ptr; an entry whose buffer is still held
+// outside the cache is pinned and skipped by eviction.  The newest entry is
+// never evicted by its own insert, so a single file larger than the budget
+// still round-trips through Prefetch → ReadSync.
+// ─────────────────────────────────────────────────────────────────────────────
+class FileCache {
+public:
+    static constexpr size_t SHARD_COUNT = 16;
+
+    // Counts a hit or miss and marks the entry most recently used
+    FileSystem::SharedBytes Find(const std::string& key);
+    // Presence test that leaves the stats and LRU order alone
+    bool Contains(const std::string& key) const;
+    // Inserts or replaces the entry, then evicts down to the budget
+    FileSystem::SharedBytes Insert(const std::string& key, FileSystem::Bytes bytes);
+    // Removes the entry and returns its bytes; moves them out when unshared
+    FileSystem::Bytes Take(const std::string& key, bool& found);
+
+    void Erase(const std::string& key);
+    void Clear();
+
+    void SetBudget(size_t bytes);
+    size_t GetBudget() const { return _budget.load(std::memory_order_relaxed); }
+    FileSystem::CacheStats GetStats() const;
+
+private:
+    struct Node {
+        std::string                            key;
+        std::shared_ptr<FileSystem::Bytes>     bytes;
+    };
+    struct Shard {
+        mutable std::mutex                                            mutex;
+        std::list<Node>                                               lru;  // front = most recent
+        std::unordered_map<std::string, std::list<Node>::iterator>    index;
+        size_t                                                        bytes = 0;
+        uint64_t                                                      hits = 0;
+        uint64_t                                                      misses = 0;
+        uint64_t                                                      evictions = 0;
+    };
+
+    Shard& ShardFor(const std::string& key);
+    const Shard& ShardFor(const std::string& key) const;
+    void RemoveLocked(Shard& shard, std::list<Node>::iterator it);
+    // Evicts unpinned entries until under budget; `keep` is never evicted
+    void EvictToBudget(size_t startShard, const FileSystem::Bytes* keep);
+
+    std::array<Shard, SHARD_COUNT> _shards;
+    std::atomic<size_t>            _totalBytes{0};
+#ifdef __EMSCRIPTEN__
+    // On web the cache is the only copy of prefetched files; never evict by default
+    std::atomic<size_t>            _budget{SIZE_MAX};
+#else
+    std::atomic<size_t>            _budget{size_t(512) << 20};
+#endif
+};
@@ -0,0 +1,108 @@
+#include "file_stream_queue.hpp"
+
+#include <algorithm>
+
+// Taking the JobSystem here constructs it first, so it outlives even a
+// static queue and the destructor can wait on it
+FileStreamQueue::FileStreamQueue(ReadFn read, int maxReads)
+    : _read(std::move(read)), _maxReads(std::max(1, maxReads)), _jobs(JobSystem::Get()) {
+}
+
+FileStreamQueue::~FileStreamQueue() {
+    {
+        std::lock_guard<std::mutex> lk(_mutex);
+        _stopping = true;
+    }
+    _jobs->Wait(_readJobs);
+}
+
+FileSystem::RequestID FileStreamQueue::Submit(const std::string& path, FileSystem::Priority priority, float deadline,
+                                              FileSystem::ReadCallback cb, bool deliverBytes) {
+    Clock::time_point due = deadline > 0.0f
+        ? Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(deadline))
+        : Clock::time_point::max();
+    FileSystem::RequestID id;
+    bool startRead;
+    {
+        std::lock_guard<std::mutex> lk(_mutex);
+        id = _nextID++;
+        _requests.emplace(id, Request{ path, std::move(cb), deliverBytes });
+        _queue.push(Ticket{ static_cast<int>(priority), due, id });
+        startRead = _reading < _maxReads;
+        if (startRead) ++_reading;
+    }
+    if (startRead) _jobs->Execute([this](int) { ReadNext(); }, _readJobs);
+    return id;
+}
+
+bool FileStreamQueue::Cancel(FileSystem::RequestID id) {
+    // The ticket (or in-flight read) stays behind; it finds no request and is dropped
+    std::lock_guard<std::mutex> lk(_mutex);
+    return _requests.erase(id) != 0;
+}
+
+size_t FileStreamQueue::GetPendingCount() const {
+    std::lock_guard<std::mutex> lk(_mutex);
+    return _requests.size();
+}
+
+void FileStreamQueue::ReadNext() {
+    std::string path;
+    FileSystem::RequestID id;
+    bool deliverBytes;
+    {
+        std::lock_guard<std::mutex> lk(_mutex);
+        for (;;) {
+            if (_stopping || _queue.empty()) {
+                --_reading;
+                return;
+            }
+            id = _queue.top().id;
+            _queue.pop();
+            auto it = _requests.find(id);
+            if (it == _requests.end()) continue;// cancelled while queued
+            path         = it->second.path;
+            deliverBytes = it->second.deliverBytes;
+            break;
+        }
+    }
+
+    FileSystem::Bytes bytes = _read(path);
+    bool ok = !bytes.empty();
+    if (!deliverBytes) bytes = {};
+
+    bool more;
+    {
+        std::lock_guard<std::mutex> lk(_mutex);
+        if (_requests.count(id)) _completions.push_back(Completion{ id, std::move(bytes), ok });
+        more = !_stopping && !_queue.empty();
+        if (!more) --_reading;
+    }
+    // A fresh job per read lets other work run on this worker in between;
+    // it is counted before this one finishes, so the destructor's wait
+    // can't see zero while the chain goes on
+    if (more) _jobs->Execute([this](int) { ReadNext(); }, _readJobs);
+}
+
+size_t FileStreamQueue::Pump(float budgetSeconds) {
+    auto start = Clock::now();
+    size_t ran = 0;
+    for (;;) {
+        Completion done;
+        FileSystem::ReadCallback cb;
+        {
+            std::lock_guard<std::mutex> lk(_mutex);
+            if (_completions.empty()) break;
+            done = std::move(_completions.front());
+            _completions.pop_front();
+            auto it = _requests.find(done.id);
+            if (it == _requests.end()) continue;// cancelled after the read finished
+            cb = std::move(it->second.cb);
+            _requests.erase(it);
+        }
+        if (cb) cb(std::move(done.bytes), done.ok);
+        ++ran;
+        if (std::chrono::duration<float>(Clock::now() - start).count() >= budgetSeconds) break;
+    }
+    return ran;
+}
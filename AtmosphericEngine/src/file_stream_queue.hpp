@@ -0,0 +1,92 @@
+#pragma once
+#include "file_system.hpp"
+#include "job_system.hpp"
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// FileStreamQueue
+//
+// Native backend of FileSystem::Stream.  Reads run as JobSystem jobs, at
+// most `maxReads` at once so blocking I/O never ties up more than that many
+// workers; each job reads the request that comes first by (priority,
+// deadline, submission order) and, while any are queued, submits the next.
+// Finished reads queue up until the main thread drains them with
+// Pump(budget), so callbacks never run on workers and never cost a frame
+// more than its budget.
+//
+// The read function is injected so a throttled fake disk can stand in for
+// the real one.
+// ─────────────────────────────────────────────────────────────────────────────
+class FileStreamQueue {
+public:
+    using Clock  = std::chrono::steady_clock;
+    using ReadFn = std::function<FileSystem::Bytes(const std::string& path)>;
+
+    explicit FileStreamQueue(ReadFn read, int maxReads = 2);
+    // Waits for reads in progress; queued ones are dropped
+    ~FileStreamQueue();
+    FileStreamQueue(const FileStreamQueue&)            = delete;
+    FileStreamQueue& operator=(const FileStreamQueue&) = delete;
+
+    // deadline <= 0 means none.  `deliverBytes` = false hands the callback
+    // an empty buffer (prefetches only need the success flag).
+    FileSystem::RequestID Submit(const std::string& path, FileSystem::Priority priority, float deadline,
+                                 FileSystem::ReadCallback cb, bool deliverBytes = true);
+
+    // Drops a request that hasn't been delivered yet; its callback never runs
+    bool Cancel(FileSystem::RequestID id);
+
+    // Runs completion callbacks until `budgetSeconds` is spent (at least one
+    // if any is ready).  Main thread only.  Returns how many ran.
+    size_t Pump(float budgetSeconds);
+
+    // Requests submitted but not yet delivered
+    size_t GetPendingCount() const;
+
+private:
+    struct Request {
+        std::string              path;
+        FileSystem::ReadCallback cb;
+        bool                     deliverBytes;
+    };
+    struct Ticket {
+        int                   priority;
+        Clock::time_point     deadline;
+        FileSystem::RequestID id;
+
+        // std::priority_queue pops the "largest": highest priority, then
+        // earliest deadline, then first submitted
+        bool operator<(const Ticket& o) const {
+            if (priority != o.priority) return priority < o.priority;
+            if (deadline != o.deadline) return deadline > o.deadline;
+            return id > o.id;
+        }
+    };
+    struct Completion {
+        FileSystem::RequestID id;
+        FileSystem::Bytes     bytes;
+        bool                  ok;
+    };
+
+    void ReadNext();
+
+    ReadFn     _read;
+    int        _maxReads;
+    JobSystem* _jobs;
+    JobCounter _readJobs;
+    int        _reading  = 0;       // read jobs submitted, not finished
+    bool       _stopping = false;
+
+    mutable std::mutex                                  _mutex;
+    std::priority_queue<Ticket>                         _queue;
+    std::unordered_map<FileSystem::RequestID, Request>  _requests;   // queued, reading or done
+    std::deque<Completion>                              _completions;
+    FileSystem::RequestID                               _nextID = 1;
+};
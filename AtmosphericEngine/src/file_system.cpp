@@ -8,31 +8,45 @@
 //         FetchCtx::done guards against double-processing.
 //
 // Native (Linux / macOS / Windows)
-//   ReadAsync  : synchronous fread; callback fires before ReadAsync returns.
+//   ReadAsync  : prioritized read through the FileStreamQueue's JobSystem
+//                jobs; the callback fires from PumpCompletions on the main
+//                thread.
 //   Prefetch   : parallel fread via JobSystem; onDone fires before Prefetch
 //                returns (synchronous completion on native).
 //
 // The in-process cache (g_cache) is a file-scope global so it is reachable
 // from C-style callbacks (Emscripten) and JobSystem lambdas without needing
-// a captured 'this' pointer.
+// a captured 'this' pointer.  It is a sharded, byte-budgeted LRU
+// (file_cache.hpp) that hands out shared buffers.
+//
+// Mounted asset packs (g_packs) are consulted before g_cache on every read;
+// pack bytes are never copied into the cache.
 
 #include "file_system.hpp"
+#include "asset_pack.hpp"
 #include "console.hpp"
+#include "file_cache.hpp"
 
 #include <filesystem>
+#include <memory>
 #include <mutex>
-#include <unordered_map>
 #include <cstdio>
 #include <cstring>
 
 // ─────────────────────────────────────────────────────────────────────────────
 // In-process cache
 // ─────────────────────────────────────────────────────────────────────────────
-static std::unordered_map<std::string, FileSystem::Bytes> g_cache;
-// Protects g_cache on native builds where JobSystem worker threads write it.
-// On Emscripten (single-threaded), the mutex is a no-op but keeps the code
-// correct if pthreads are ever enabled.
-static std::mutex g_cacheMutex;
+// Locked per shard, so JobSystem workers filling it during Prefetch rarely
+// contend.  On Emscripten (single-threaded) the locks are uncontended but
+// keep the code correct if pthreads are ever enabled.
+static FileCache g_cache;
+
+// Mounted packs, searched newest first.  Mounting normally happens once at
+// startup, so a plain mutex is cheap enough for the lookups; it is never held
+// while an entry inflates.  Shared so a read in flight keeps its pack alive
+// through an UnmountPacks().
+static std::vector<std::shared_ptr<AssetPack>> g_packs;
+static std::mutex g_packMutex;
 
 // ─────────────────────────────────────────────────────────────────────────────
 // Singleton
@@ -70,39 +84,100 @@ static std::string NormalizePath(const std::string& path) {
     return path;
 }
 
+// Returns the path's bytes from the newest mounted pack holding it, or an
+// empty span.
+static std::span<const uint8_t> ReadFromPacks(const std::string& normPath) {
+    std::shared_ptr<AssetPack> pack;
+    AssetPackEntry entry;
+    {
+        std::lock_guard<std::mutex> lk(g_packMutex);
+        for (auto it = g_packs.rbegin(); it != g_packs.rend() && !pack; ++it) {
+            if (const AssetPackEntry* found = (*it)->Find(normPath)) {
+                pack = *it;
+                entry = *found;
+            }
+        }
+    }
+    if (!pack) return {};
+    auto view = pack->View(entry);
+    if (view.empty() && entry.rawSize > 0)
+        ENGINE_LOG("[FileSystem] Failed to inflate '{}' from pack", normPath);
+    return view;
+}
+
+static bool IsInPacks(const std::string& normPath) {
+    std::lock_guard<std::mutex> lk(g_packMutex);
+    for (const auto& pack : g_packs) {
+        if (pack->Find(normPath)) return true;
+    }
+    return false;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Asset packs — identical on all platforms
+// ─────────────────────────────────────────────────────────────────────────────
+bool FileSystem::MountPack(const std::string& packPath) {
+    auto pack = std::make_shared<AssetPack>();
+    std::string error;
+    if (!pack->Open(NormalizePath(packPath), &error)) {
+        Console::Get()->Error(fmt::format("[FileSystem] MountPack: {}", error));
+        return false;
+    }
+    ENGINE_LOG("[FileSystem] Mounted pack '{}' ({} entries)", packPath, pack->GetEntries().size());
+    std::lock_guard<std::mutex> lk(g_packMutex);
+    g_packs.push_back(std::move(pack));
+    return true;
+}
+
+void FileSystem::UnmountPacks() {
+    std::lock_guard<std::mutex> lk(g_packMutex);
+    g_packs.clear();
+}
+
+std::span<const uint8_t> FileSystem::ReadView(const std::string& path) {
+    return ReadFromPacks(NormalizePath(path));
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // Cache helpers — identical on all platforms
 // ─────────────────────────────────────────────────────────────────────────────
 bool FileSystem::IsCached(const std::string& path) const {
     std::string normPath = NormalizePath(path);
-    std::lock_guard<std::mutex> lk(g_cacheMutex);
-    return g_cache.count(normPath) != 0;
+    return g_cache.Contains(normPath);
 }
 
 void FileSystem::EvictCache(const std::string& path) {
     std::string normPath = NormalizePath(path);
-    std::lock_guard<std::mutex> lk(g_cacheMutex);
-    g_cache.erase(normPath);
+    g_cache.Erase(normPath);
 }
 
 void FileSystem::ClearCache() {
-    std::lock_guard<std::mutex> lk(g_cacheMutex);
-    g_cache.clear();
+    g_cache.Clear();
+}
+
+void FileSystem::SetCacheBudget(size_t bytes) {
+    g_cache.SetBudget(bytes);
+}
+
+size_t FileSystem::GetCacheBudget() const {
+    return g_cache.GetBudget();
+}
+
+FileSystem::CacheStats FileSystem::GetCacheStats() const {
+    return g_cache.GetStats();
 }
 
 bool FileSystem::Exists(const std::string& path) const {
     std::string normPath = NormalizePath(path);
-    if (IsCached(normPath)) return true;
+    if (IsCached(normPath) || IsInPacks(normPath)) return true;
     return std::filesystem::exists(normPath);
 }
 
 FileSystem::Bytes FileSystem::ReadSync(const std::string& path) {
     std::string normPath = NormalizePath(path);
-    {
-        std::lock_guard<std::mutex> lk(g_cacheMutex);
-        auto it = g_cache.find(normPath);
-        if (it != g_cache.end()) return it->second; // copy from cache
-    }
+    auto view = ReadFromPacks(normPath);
+    if (!view.empty()) return Bytes(view.begin(), view.end());
+    if (auto cached = g_cache.Find(normPath)) return *cached; // copy from cache
 #ifdef __EMSCRIPTEN__
     // On web a cache-miss means Prefetch was not called — log and fail.
     ENGINE_LOG("[FileSystem] ReadSync cache miss on web: '{}' — call Prefetch first", normPath);
@@ -115,17 +190,32 @@ FileSystem::Bytes FileSystem::ReadSync(const std::string& path) {
 #endif
 }
 
-FileSystem::Bytes FileSystem::ConsumeSync(const std::string& path) {
+FileSystem::SharedBytes FileSystem::ReadShared(const std::string& path) {
     std::string normPath = NormalizePath(path);
-    {
-        std::lock_guard<std::mutex> lk(g_cacheMutex);
-        auto it = g_cache.find(normPath);
-        if (it != g_cache.end()) {
-            FileSystem::Bytes result = std::move(it->second);
-            g_cache.erase(it);
-            return result;
-        }
+    auto view = ReadFromPacks(normPath);
+    if (!view.empty()) return std::make_shared<const Bytes>(view.begin(), view.end());
+    if (auto cached = g_cache.Find(normPath)) return cached;
+#ifdef __EMSCRIPTEN__
+    ENGINE_LOG("[FileSystem] ReadShared cache miss on web: '{}' — call Prefetch first", normPath);
+    return nullptr;
+#else
+    auto bytes = ReadFromDisk(normPath);
+    if (bytes.empty()) {
+        ENGINE_LOG("[FileSystem] ReadShared: failed to read '{}'", normPath);
+        return nullptr;
     }
+    return g_cache.Insert(normPath, std::move(bytes));
+#endif
+}
+
+FileSystem::Bytes FileSystem::ConsumeSync(const std::string& path) {
+    std::string normPath = NormalizePath(path);
+    // Pack entries are not consumed; the mapping owns them
+    auto view = ReadFromPacks(normPath);
+    if (!view.empty()) return Bytes(view.begin(), view.end());
+    bool found = false;
+    FileSystem::Bytes result = g_cache.Take(normPath, found);
+    if (found) return result;
 #ifndef __EMSCRIPTEN__
     // Native: fall back to disk read on cache miss.
     return ReadFromDisk(normPath);
@@ -256,10 +346,7 @@ void EM_OnSuccess(emscripten_fetch_t* f) {
             ENGINE_LOG("[FileSystem] Cached: '{}' ({} bytes)", ctx->path, f->numBytes);
         }
         // Store in in-process cache
-        {
-            std::lock_guard<std::mutex> lk(g_cacheMutex);
-            g_cache[ctx->path] = bytes;
-        }
+        g_cache.Insert(ctx->path, bytes);
     }
 
     // Fire single-read callback (ReadAsync path) — outside the lock
@@ -317,12 +404,10 @@ void LaunchFetch(const std::string& path, FetchCtx* ctx) {
 
 void FileSystem::ReadAsync(const std::string& path, ReadCallback cb) {
     std::string normPath = NormalizePath(path);
-    // Cache hit → immediate
-    {
-        std::lock_guard<std::mutex> lk(g_cacheMutex);
-        auto it = g_cache.find(normPath);
-        if (it != g_cache.end()) { cb(it->second, true); return; }
-    }
+    // Pack or cache hit → immediate
+    auto view = ReadFromPacks(normPath);
+    if (!view.empty()) { cb(Bytes(view.begin(), view.end()), true); return; }
+    if (auto cached = g_cache.Find(normPath)) { cb(*cached, true); return; }
     // Cache miss → fetch asynchronously; callback fires in the browser event loop
     auto* ctx = new FetchCtx{normPath, NeedsMemFS(normPath), std::move(cb), nullptr, nullptr};
     LaunchFetch(normPath, ctx);
@@ -334,12 +419,9 @@ void FileSystem::Prefetch(const std::vector<std::string>& paths,
 
     // Skip paths that are already in cache
     std::vector<std::string> pending;
-    {
-        std::lock_guard<std::mutex> lk(g_cacheMutex);
-        for (const auto& p : paths) {
-            std::string normPath = NormalizePath(p);
-            if (!g_cache.count(normPath)) pending.push_back(normPath);
-        }
+    for (const auto& p : paths) {
+        std::string normPath = NormalizePath(p);
+        if (!g_cache.Contains(normPath) && !IsInPacks(normPath)) pending.push_back(normPath);
     }
     if (pending.empty()) { if (onDone) onDone(); return; }
 
@@ -368,30 +450,96 @@ void FileSystem::Prefetch(const std::vector<std::string>& paths,
     // Returns immediately; onDone fires asynchronously via the browser event loop
 }
 
+FileSystem::RequestID FileSystem::Stream(const std::string& path, ReadCallback cb,
+                                         Priority /*priority*/, float /*deadline*/) {
+    ReadAsync(path, std::move(cb));
+    return 0;
+}
+
+bool FileSystem::Cancel(RequestID /*id*/) {
+    return false;
+}
+
+size_t FileSystem::PumpCompletions(float /*budgetSeconds*/) {
+    return 0; // fetch callbacks already run on the browser event loop
+}
+
+size_t FileSystem::GetPendingCount() const {
+    return 0;
+}
+
+void FileSystem::PrefetchAsync(const std::vector<std::string>& paths, CompletionCallback onDone,
+                               Priority /*priority*/) {
+    Prefetch(paths, std::move(onDone));
+}
+
 #else
 // ─────────────────────────────────────────────────────────────────────────────
 // Native implementation (Linux / macOS / Windows)
 // ─────────────────────────────────────────────────────────────────────────────
+#include "file_stream_queue.hpp"
 #include "job_system.hpp"
 
+// Streamed reads go straight into the cache.  Built on first use, so it is
+// destroyed (and its reads finished) before g_cache, and after the
+// JobSystem its constructor brings up.
+static FileStreamQueue& StreamQueue() {
+    static FileStreamQueue queue([](const std::string& path) {
+        auto bytes = ReadFromDisk(path);
+        if (!bytes.empty()) {
+            g_cache.Insert(path, bytes);
+        } else {
+            ENGINE_LOG("[FileSystem] Stream: failed to read '{}'", path);
+        }
+        return bytes;
+    });
+    return queue;
+}
+
 void FileSystem::ReadAsync(const std::string& path, ReadCallback cb) {
+    Stream(path, std::move(cb));
+}
+
+FileSystem::RequestID FileSystem::Stream(const std::string& path, ReadCallback cb,
+                                         Priority priority, float deadline) {
     std::string normPath = NormalizePath(path);
-    // Cache hit → immediate
-    {
-        std::lock_guard<std::mutex> lk(g_cacheMutex);
-        auto it = g_cache.find(normPath);
-        if (it != g_cache.end()) { cb(it->second, true); return; }
+    // Pack or cache hit → immediate
+    auto view = ReadFromPacks(normPath);
+    if (!view.empty()) { cb(Bytes(view.begin(), view.end()), true); return 0; }
+    if (auto cached = g_cache.Find(normPath)) { cb(*cached, true); return 0; }
+    // Cache miss → read job; callback fires from PumpCompletions
+    return StreamQueue().Submit(normPath, priority, deadline, std::move(cb));
+}
+
+bool FileSystem::Cancel(RequestID id) {
+    return id != 0 && StreamQueue().Cancel(id);
+}
+
+size_t FileSystem::PumpCompletions(float budgetSeconds) {
+    return StreamQueue().Pump(budgetSeconds);
+}
+
+size_t FileSystem::GetPendingCount() const {
+    return StreamQueue().GetPendingCount();
+}
+
+void FileSystem::PrefetchAsync(const std::vector<std::string>& paths, CompletionCallback onDone,
+                               Priority priority) {
+    std::vector<std::string> pending;
+    for (const auto& p : paths) {
+        std::string normPath = NormalizePath(p);
+        if (!IsCached(normPath) && !IsInPacks(normPath)) pending.push_back(normPath);
     }
-    // Native: synchronous disk read; callback fires before ReadAsync returns
-    auto bytes = ReadFromDisk(normPath);
-    bool ok    = !bytes.empty();
-    if (ok) {
-        std::lock_guard<std::mutex> lk(g_cacheMutex);
-        g_cache[normPath] = bytes;
-    } else {
-        ENGINE_LOG("[FileSystem] ReadAsync: failed to read '{}'", normPath);
+    if (pending.empty()) { if (onDone) onDone(); return; }
+
+    // Completions all run on the main thread, so a plain counter suffices
+    auto remaining = std::make_shared<size_t>(pending.size());
+    auto done      = std::make_shared<CompletionCallback>(std::move(onDone));
+    for (const auto& p : pending) {
+        StreamQueue().Submit(p, priority, 0.0f, [remaining, done](Bytes, bool) {
+            if (--*remaining == 0 && *done) (*done)();
+        }, false);
     }
-    cb(std::move(bytes), ok);
 }
 
 void FileSystem::Prefetch(const std::vector<std::string>& paths,
@@ -399,21 +547,21 @@ void FileSystem::Prefetch(const std::vector<std::string>& paths,
     if (paths.empty()) { if (onDone) onDone(); return; }
 
     // Parallel disk reads via JobSystem worker threads
+    JobCounter reads;
     for (const auto& p : paths) {
         std::string normPath = NormalizePath(p);
-        if (IsCached(normPath)) continue; // already cached, skip
+        if (IsCached(normPath) || IsInPacks(normPath)) continue; // already resident, skip
         auto pathCopy = normPath;
         JobSystem::Get()->Execute([pathCopy](int /*threadID*/) {
             auto bytes = ReadFromDisk(pathCopy);
             if (!bytes.empty()) {
-                std::lock_guard<std::mutex> lk(g_cacheMutex);
-                g_cache[pathCopy] = std::move(bytes);
+                g_cache.Insert(pathCopy, std::move(bytes));
             } else {
                 ENGINE_LOG("[FileSystem] Prefetch: failed to read '{}'", pathCopy);
             }
-        });
+        }, reads);
     }
-    JobSystem::Get()->Wait(); // blocks until all reads complete
+    JobSystem::Get()->Wait(reads); // blocks until these reads complete
 
     // onDone fires synchronously on native (before Prefetch returns)
     if (onDone) onDone();
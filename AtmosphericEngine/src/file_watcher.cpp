@@ -0,0 +1,147 @@
+#include "file_watcher.hpp"
+
+#include <spdlog/spdlog.h>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+#ifdef __linux__
+// ── inotify ──────────────────────────────────────────────────────────────────
+
+FileWatcher::FileWatcher() {
+    _fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (_fd < 0) spdlog::warn("FileWatcher: inotify unavailable ({})", std::strerror(errno));
+}
+
+FileWatcher::~FileWatcher() {
+    if (_fd >= 0) close(_fd);
+}
+
+bool FileWatcher::IsSupported() const {
+    return _fd >= 0;
+}
+
+void FileWatcher::Watch(const std::string& path) {
+    if (_fd < 0 || !_files.insert(path).second) return;
+
+    std::string directory = fs::path(path).parent_path().string();
+    auto it = _watches.find(directory);
+    if (it != _watches.end()) {
+        ++it->second.files;
+        return;
+    }
+    int wd = inotify_add_watch(_fd, directory.empty() ? "." : directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (wd < 0) {
+        spdlog::warn("FileWatcher: cannot watch '{}' ({})", directory.empty() ? "." : directory, std::strerror(errno));
+        _files.erase(path);
+        return;
+    }
+    _watches[directory] = { wd, 1 };
+    _directories[wd] = directory;
+}
+
+void FileWatcher::Unwatch(const std::string& path) {
+    if (!_files.erase(path)) return;
+
+    auto it = _watches.find(fs::path(path).parent_path().string());
+    if (it == _watches.end() || --it->second.files > 0) return;
+    inotify_rm_watch(_fd, it->second.wd);
+    _directories.erase(it->second.wd);
+    _watches.erase(it);
+}
+
+std::vector<std::string> FileWatcher::Poll() {
+    std::vector<std::string> changed;
+    if (_fd < 0) return changed;
+
+    alignas(inotify_event) char buffer[4096];
+    std::unordered_set<std::string> seen;
+    bool overflowed = false;
+    for (;;) {
+        ssize_t length = read(_fd, buffer, sizeof(buffer));
+        if (length <= 0) break;// EAGAIN: drained
+        for (char* p = buffer; p < buffer + length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(p);
+            p += sizeof(inotify_event) + event->len;
+            if (event->mask & IN_Q_OVERFLOW) overflowed = true;
+            if (event->len == 0) continue;
+            auto dir = _directories.find(event->wd);
+            if (dir == _directories.end()) continue;
+            std::string path = dir->second.empty() ? event->name : dir->second + "/" + event->name;
+            if (_files.count(path) && seen.insert(path).second) changed.push_back(std::move(path));
+        }
+    }
+    if (overflowed) {
+        spdlog::warn("FileWatcher: inotify queue overflowed, reloading all {} watched files", _files.size());
+        for (const auto& path : _files) {
+            if (seen.insert(path).second) changed.push_back(path);
+        }
+    }
+    return changed;
+}
+
+#elif !defined(__EMSCRIPTEN__)
+// ── Modification times ───────────────────────────────────────────────────────
+
+FileWatcher::FileWatcher() = default;
+FileWatcher::~FileWatcher() = default;
+
+bool FileWatcher::IsSupported() const {
+    return true;
+}
+
+void FileWatcher::Watch(const std::string& path) {
+    if (!_files.insert(path).second) return;
+    std::error_code error;
+    _modified[path] = fs::last_write_time(path, error);
+}
+
+void FileWatcher::Unwatch(const std::string& path) {
+    _files.erase(path);
+    _modified.erase(path);
+}
+
+std::vector<std::string> FileWatcher::Poll() {
+    std::vector<std::string> changed;
+    auto now = std::chrono::steady_clock::now();
+    if (now - _lastPoll < POLL_INTERVAL) return changed;
+    _lastPoll = now;
+
+    for (auto& [path, modified] : _modified) {
+        std::error_code error;
+        auto time = fs::last_write_time(path, error);
+        if (error || time == modified) continue;// missing mid-save: try again next poll
+        modified = time;
+        changed.push_back(path);
+    }
+    return changed;
+}
+
+#else
+// ── Web: nothing to watch ────────────────────────────────────────────────────
+
+FileWatcher::FileWatcher() = default;
+FileWatcher::~FileWatcher() = default;
+
+bool FileWatcher::IsSupported() const {
+    return false;
+}
+
+void FileWatcher::Watch(const std::string& path) {
+    _files.insert(path);
+}
+
+void FileWatcher::Unwatch(const std::string& path) {
+    _files.erase(path);
+}
+
+std::vector<std::string> FileWatcher::Poll() {
+    return {};
+}
+#endif
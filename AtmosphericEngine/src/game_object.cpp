@@ -223,4 +223,10 @@ void GameObject::OnCollision(GameObject* other) {
     if (_collisionCallback) {
         _collisionCallback(other);
     }
+}
+
+void GameObject::OnCollisionEnter(GameObject* other) {
+    if (_collisionEnterCallback) {
+        _collisionEnterCallback(other);
+    }
 }
\ No newline at end of file
@@ -128,6 +128,14 @@ void JobSystem::Execute(const Job& job) {
 #endif
 }
 
+void JobSystem::Execute(const Job& job, JobCounter& counter) {
+    counter.pending.fetch_add(1, std::memory_order_relaxed);
+    Execute([job, &counter](int threadID) {
+        job(threadID);
+        counter.pending.fetch_sub(1, std::memory_order_release);
+    });
+}
+
 bool JobSystem::IsBusy() {
 #ifdef __EMSCRIPTEN__
     return false;
@@ -155,4 +163,14 @@ void JobSystem::Wait() {
     FrameMark;// Explicitly mark frame boundary if waiting for jobs concludes a logical frame
 #endif
 #endif
-}
\ No newline at end of file
+}
+
+void JobSystem::Wait(const JobCounter& counter) {
+#ifdef TRACY_ENABLE
+    ZoneScoped;
+#endif
+    // Jobs run inline on Emscripten, so the count is already zero there
+    while (counter.pending.load(std::memory_order_acquire) > 0) {
+        std::this_thread::yield();
+    }
+}
@@ -14,6 +14,13 @@ extern thread_local int G_WORKER_THREAD_INDEX;
 
 using Job = std::function<void(int)>;
 
+// Completion count of one batch of jobs.  Waiting on it waits for that batch
+// only; JobSystem::Wait() waits until every queue is drained, including jobs
+// other systems submitted meanwhile.
+struct JobCounter {
+    std::atomic<uint32_t> pending { 0 };
+};
+
 class JobSystem {
 public:
     static JobSystem* Get() {
@@ -26,8 +33,12 @@ public:
 
     void Init();
     void Execute(const Job& job);
+    // Counts `job` in `counter` until it has run
+    void Execute(const Job& job, JobCounter& counter);
     bool IsBusy();
     void Wait();
+    // Blocks until every job submitted with `counter` has finished
+    void Wait(const JobCounter& counter);
 
     uint32_t GetThreadCount() const { return _numThreads; }
 
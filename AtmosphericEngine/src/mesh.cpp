@@ -2,6 +2,8 @@
 #include "asset_manager.hpp"
 #include "config.hpp"
 #include "graphics_server.hpp"
+#include "mesh_format.hpp"
+#include <cstddef>
 
 void PrintVertex(const Vertex& v) {
     fmt::print(
@@ -113,6 +115,50 @@ void Mesh::Initialize(const std::vector<Vertex>& verts, const std::vector<uint16
     this->initialized = true;
 }
 
+void Mesh::Initialize(const MeshView& cooked) {
+    const MeshFileHeader& header = *cooked.header;
+    vertCount  = header.vertexCount;
+    triCount   = header.indexCount / 3;
+    _indexType = cooked.Is32BitIndices() ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+
+    const float* lo = header.boundsMin;
+    const float* hi = header.boundsMax;
+    for (int i = 0; i < 8; ++i) {
+        _bounds[i] = glm::vec3((i & 1) ? hi[0] : lo[0], (i & 2) ? hi[1] : lo[1], (i & 4) ? hi[2] : lo[2]);
+    }
+
+    glBindVertexArray(vao);
+
+    // Same locations as Vertex; half-float UVs and 10:10:10:2 normals are
+    // widened to float by the fetch, so the shaders don't change
+    constexpr GLsizei stride = sizeof(PackedVertex);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, cooked.vertices.size_bytes(), cooked.vertices.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(PackedVertex, position));
+    glVertexAttribPointer(1, 2, GL_HALF_FLOAT, GL_FALSE, stride, (void*)offsetof(PackedVertex, uv));
+    glVertexAttribPointer(2, 4, GL_INT_2_10_10_10_REV, GL_TRUE, stride, (void*)offsetof(PackedVertex, normal));
+    glVertexAttribPointer(3, 4, GL_INT_2_10_10_10_REV, GL_TRUE, stride, (void*)offsetof(PackedVertex, tangent));
+    glVertexAttribPointer(4, 4, GL_INT_2_10_10_10_REV, GL_TRUE, stride, (void*)offsetof(PackedVertex, bitangent));
+    for (GLuint location = 0; location <= 4; ++location) glEnableVertexAttribArray(location);
+#ifndef __EMSCRIPTEN__
+    glBindBuffer(GL_ARRAY_BUFFER, ibo);
+    InstanceData dummyData{ glm::mat4(1.0f) };
+    glBufferData(GL_ARRAY_BUFFER, sizeof(InstanceData), &dummyData, GL_DYNAMIC_DRAW);
+    for (GLuint i = 0; i < 4; ++i) {
+        glVertexAttribPointer(5 + i, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(glm::vec4), (void*)(i * 4 * sizeof(float)));
+        glEnableVertexAttribArray(5 + i);
+        glVertexAttribDivisor(5 + i, 1);
+    }
+#endif
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, cooked.indices.size(), cooked.indices.data(), GL_STATIC_DRAW);
+
+    glBindVertexArray(0);
+
+    this->initialized = true;
+}
+
 void Mesh::SetShapeLocalScaling(glm::vec3 localScaling) {
     _shape->setLocalScaling(btVector3(localScaling.x, localScaling.y, localScaling.z));
 }
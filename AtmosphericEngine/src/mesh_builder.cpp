@@ -440,6 +440,15 @@ void VoxelMeshBuilder::PushGreedyFace(glm::ivec3 pos, FaceDir dir, uint8_t voxel
     _vertices.push_back(v2); _vertices.push_back(v3); _vertices.push_back(v0);
 }
 
+void VoxelMeshBuilder::Scale(int factor) {
+    if (factor == 1) return;
+    for (auto& v : _vertices) {
+        v.x = static_cast<uint8_t>(v.x * factor);
+        v.y = static_cast<uint8_t>(v.y * factor);
+        v.z = static_cast<uint8_t>(v.z * factor);
+    }
+}
+
 void VoxelMeshBuilder::Clear() {
     _vertices.clear();
 }
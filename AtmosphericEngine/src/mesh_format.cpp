@@ -0,0 +1,236 @@
+// mesh_format.cpp — Cooked mesh (.aemesh) reader and writer.  No GL here, so
+// tools/mesh_cooker compiles this file directly.
+#include "mesh_format.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Quantisation
+// ─────────────────────────────────────────────────────────────────────────────
+uint16_t FloatToHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, 4);
+    uint32_t sign     = (bits >> 16) & 0x8000u;
+    int32_t  exponent = static_cast<int32_t>((bits >> 23) & 0xFF) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFFu;
+
+    if (((bits >> 23) & 0xFF) == 0xFF) return static_cast<uint16_t>(sign | 0x7C00u | (mantissa ? 0x200u : 0));// inf / nan
+    if (exponent >= 31) return static_cast<uint16_t>(sign | 0x7C00u);// overflow → inf
+    if (exponent <= 0) {
+        if (exponent < -10) return static_cast<uint16_t>(sign);// underflow → ±0
+        // Subnormal: shift the implicit 1 in, round to nearest even
+        mantissa |= 0x800000u;
+        uint32_t shift   = static_cast<uint32_t>(14 - exponent);
+        uint32_t half    = mantissa >> shift;
+        uint32_t rest    = mantissa & ((1u << shift) - 1);
+        uint32_t halfway = 1u << (shift - 1);
+        if (rest > halfway || (rest == halfway && (half & 1))) ++half;
+        return static_cast<uint16_t>(sign | half);
+    }
+    uint32_t half = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+    uint32_t rest = mantissa & 0x1FFFu;
+    if (rest > 0x1000u || (rest == 0x1000u && (half & 1))) ++half;// may carry into the exponent, which is correct
+    return static_cast<uint16_t>(half);
+}
+
+float HalfToFloat(uint16_t half) {
+    uint32_t sign     = static_cast<uint32_t>(half & 0x8000u) << 16;
+    uint32_t exponent = (half >> 10) & 0x1F;
+    uint32_t mantissa = half & 0x3FFu;
+    uint32_t bits;
+    if (exponent == 0x1F) {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    } else if (exponent != 0) {
+        bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+    } else if (mantissa == 0) {
+        bits = sign;
+    } else {
+        // Subnormal half → normal float
+        int e = -1;
+        do {
+            ++e;
+            mantissa <<= 1;
+        } while (!(mantissa & 0x400u));
+        bits = sign | (static_cast<uint32_t>(127 - 15 - e) << 23) | ((mantissa & 0x3FFu) << 13);
+    }
+    float value;
+    std::memcpy(&value, &bits, 4);
+    return value;
+}
+
+uint32_t PackSnorm1010102(float x, float y, float z) {
+    auto pack = [](float v) {
+        int32_t q = static_cast<int32_t>(std::lround(std::clamp(v, -1.0f, 1.0f) * 511.0f));
+        return static_cast<uint32_t>(q) & 0x3FFu;
+    };
+    return pack(x) | (pack(y) << 10) | (pack(z) << 20);
+}
+
+void UnpackSnorm1010102(uint32_t packed, float out[3]) {
+    for (int i = 0; i < 3; ++i) {
+        int32_t q = static_cast<int32_t>((packed >> (10 * i)) & 0x3FFu);
+        if (q & 0x200) q -= 0x400;// sign-extend
+        out[i] = std::max(static_cast<float>(q) / 511.0f, -1.0f);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Reader
+// ─────────────────────────────────────────────────────────────────────────────
+uint32_t MeshView::GetIndex(size_t i) const {
+    if (Is32BitIndices()) {
+        uint32_t index;
+        std::memcpy(&index, indices.data() + i * 4, 4);
+        return index;
+    }
+    uint16_t index;
+    std::memcpy(&index, indices.data() + i * 2, 2);
+    return index;
+}
+
+static bool Fail(std::string* error, const char* message) {
+    if (error) *error = message;
+    return false;
+}
+
+bool ParseMeshFile(std::span<const uint8_t> file, MeshView& out, std::string* error) {
+    out = {};
+    if (file.size() < sizeof(MeshFileHeader)) return Fail(error, "file too small");
+    if (reinterpret_cast<uintptr_t>(file.data()) % alignof(MeshFileHeader) != 0) return Fail(error, "misaligned buffer");
+
+    const auto* header = reinterpret_cast<const MeshFileHeader*>(file.data());
+    if (std::memcmp(header->magic, MESH_FILE_MAGIC, 4) != 0) return Fail(error, "not a cooked mesh");
+    if (header->version != MESH_FILE_VERSION) return Fail(error, "unsupported mesh version");
+    if (header->vertexStride != sizeof(PackedVertex)) return Fail(error, "unexpected vertex stride");
+    if (header->indexCount % 3 != 0) return Fail(error, "index count is not a triangle list");
+
+    size_t indexSize    = (header->flags & MESH_FILE_INDEX32) ? 4 : 2;
+    uint64_t vertexBytes = uint64_t(header->vertexCount) * sizeof(PackedVertex);
+    uint64_t indexBytes  = uint64_t(header->indexCount) * indexSize;
+    // Offsets come from the file: subtract from the size rather than add to
+    // them, so huge values can't wrap around and pass
+    uint64_t size = file.size();
+    if (header->vertexOffset % MESH_FILE_ALIGNMENT || header->indexOffset % MESH_FILE_ALIGNMENT ||
+        header->vertexOffset < sizeof(MeshFileHeader) || header->vertexOffset > size ||
+        vertexBytes > size - header->vertexOffset || header->indexOffset > size ||
+        indexBytes > size - header->indexOffset || header->indexOffset < header->vertexOffset + vertexBytes) {
+        return Fail(error, "sections out of range");
+    }
+
+    // The index buffer goes to glDrawElements unchecked, so every index must
+    // name a vertex.  One pass over the indices; it vectorises.
+    uint32_t maxIndex = 0;
+    if (indexSize == 4) {
+        const auto* indices = reinterpret_cast<const uint32_t*>(file.data() + header->indexOffset);
+        for (uint32_t i = 0; i < header->indexCount; ++i) maxIndex = std::max(maxIndex, indices[i]);
+    } else {
+        const auto* indices = reinterpret_cast<const uint16_t*>(file.data() + header->indexOffset);
+        for (uint32_t i = 0; i < header->indexCount; ++i) maxIndex = std::max<uint32_t>(maxIndex, indices[i]);
+    }
+    if (header->indexCount > 0 && maxIndex >= header->vertexCount) return Fail(error, "index out of range");
+
+    out.header   = header;
+    out.vertices = { reinterpret_cast<const PackedVertex*>(file.data() + header->vertexOffset), header->vertexCount };
+    out.indices  = file.subspan(header->indexOffset, indexBytes);
+    return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Writer
+// ─────────────────────────────────────────────────────────────────────────────
+namespace {
+    size_t AlignUp(size_t value) {
+        return (value + MESH_FILE_ALIGNMENT - 1) & ~size_t(MESH_FILE_ALIGNMENT - 1);
+    }
+
+    float Distance(const float* a, const float* b) {
+        float dx = a[0] - b[0], dy = a[1] - b[1], dz = a[2] - b[2];
+        return std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+    // Ritter's sphere: start from the two far-apart points found from an
+    // arbitrary one, then grow to take in any point left outside
+    void BoundingSphere(const std::vector<float>& positions, float center[3], float& radius) {
+        size_t count = positions.size() / 3;
+        auto farthest = [&](const float* from) {
+            size_t best = 0;
+            float bestDist = -1.0f;
+            for (size_t i = 0; i < count; ++i) {
+                float d = Distance(from, &positions[i * 3]);
+                if (d > bestDist) bestDist = d, best = i;
+            }
+            return &positions[best * 3];
+        };
+        const float* a = farthest(&positions[0]);
+        const float* b = farthest(a);
+        for (int k = 0; k < 3; ++k) center[k] = (a[k] + b[k]) * 0.5f;
+        radius = Distance(a, b) * 0.5f;
+        for (size_t i = 0; i < count; ++i) {
+            const float* p = &positions[i * 3];
+            float d = Distance(center, p);
+            if (d <= radius) continue;
+            float grown = (radius + d) * 0.5f;
+            for (int k = 0; k < 3; ++k) center[k] += (p[k] - center[k]) * (grown - radius) / d;
+            radius = grown;
+        }
+    }
+}// namespace
+
+std::vector<uint8_t> WriteMeshFile(const MeshSource& mesh) {
+    size_t vertexCount = mesh.GetVertexCount();
+    bool   index32     = vertexCount > 65536;
+    size_t indexSize   = index32 ? 4 : 2;
+
+    MeshFileHeader header{};
+    std::memcpy(header.magic, MESH_FILE_MAGIC, 4);
+    header.version      = MESH_FILE_VERSION;
+    header.flags        = index32 ? uint32_t(MESH_FILE_INDEX32) : 0u;
+    header.vertexCount  = static_cast<uint32_t>(vertexCount);
+    header.indexCount   = static_cast<uint32_t>(mesh.indices.size());
+    header.vertexStride = sizeof(PackedVertex);
+    header.vertexOffset = AlignUp(sizeof(MeshFileHeader));
+    header.indexOffset  = AlignUp(header.vertexOffset + vertexCount * sizeof(PackedVertex));
+
+    if (vertexCount > 0) {
+        for (int k = 0; k < 3; ++k) header.boundsMin[k] = header.boundsMax[k] = mesh.positions[k];
+        for (size_t i = 0; i < vertexCount; ++i) {
+            for (int k = 0; k < 3; ++k) {
+                header.boundsMin[k] = std::min(header.boundsMin[k], mesh.positions[i * 3 + k]);
+                header.boundsMax[k] = std::max(header.boundsMax[k], mesh.positions[i * 3 + k]);
+            }
+        }
+        BoundingSphere(mesh.positions, header.sphereCenter, header.sphereRadius);
+    }
+
+    std::vector<uint8_t> out(header.indexOffset + mesh.indices.size() * indexSize, 0);
+    std::memcpy(out.data(), &header, sizeof(header));
+
+    auto* vertices = reinterpret_cast<PackedVertex*>(out.data() + header.vertexOffset);
+    for (size_t i = 0; i < vertexCount; ++i) {
+        PackedVertex& v = vertices[i];
+        std::memcpy(v.position, &mesh.positions[i * 3], sizeof(v.position));
+        float uv[2] = { 0.0f, 0.0f }, n[3] = { 0.0f, 0.0f, 0.0f }, t[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+        if (mesh.uvs.size() >= (i + 1) * 2) std::memcpy(uv, &mesh.uvs[i * 2], sizeof(uv));
+        if (mesh.normals.size() >= (i + 1) * 3) std::memcpy(n, &mesh.normals[i * 3], sizeof(n));
+        if (mesh.tangents.size() >= (i + 1) * 4) std::memcpy(t, &mesh.tangents[i * 4], sizeof(t));
+        float b[3] = { (n[1] * t[2] - n[2] * t[1]) * t[3], (n[2] * t[0] - n[0] * t[2]) * t[3], (n[0] * t[1] - n[1] * t[0]) * t[3] };
+        v.uv[0]     = FloatToHalf(uv[0]);
+        v.uv[1]     = FloatToHalf(uv[1]);
+        v.normal    = PackSnorm1010102(n[0], n[1], n[2]);
+        v.tangent   = PackSnorm1010102(t[0], t[1], t[2]);
+        v.bitangent = PackSnorm1010102(b[0], b[1], b[2]);
+    }
+
+    uint8_t* indices = out.data() + header.indexOffset;
+    for (size_t i = 0; i < mesh.indices.size(); ++i) {
+        if (index32) {
+            std::memcpy(indices + i * 4, &mesh.indices[i], 4);
+        } else {
+            uint16_t index = static_cast<uint16_t>(mesh.indices[i]);
+            std::memcpy(indices + i * 2, &index, 2);
+        }
+    }
+    return out;
+}
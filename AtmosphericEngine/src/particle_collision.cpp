@@ -0,0 +1,206 @@
+#include "particle_collision.hpp"
+#include "game_object.hpp"
+#include "terrain_component.hpp"
+#include "voxel_world.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Atmospheric {
+
+    ParticleHeightfieldCollider ParticleHeightfieldCollider::FromTerrain(const TerrainComponent& terrain) {
+        ParticleHeightfieldCollider hf;
+        hf.heights = terrain.GetHeightData().data();
+        hf.width = terrain.GetHeightmapWidth();
+        hf.depth = terrain.GetHeightmapDepth();
+        if (hf.width < 2 || hf.depth < 2) return ParticleHeightfieldCollider();
+
+        glm::vec3 center = terrain.gameObject ? terrain.gameObject->GetPosition() : glm::vec3(0.0f);
+        hf.cellSize = terrain.GetWorldSize() / static_cast<float>(hf.width - 1);
+        hf.origin = center - glm::vec3(terrain.GetWorldSize() * 0.5f, 0.0f, terrain.GetWorldSize() * 0.5f);
+        return hf;
+    }
+
+    namespace {
+        struct Resolver {
+            ParticleStorage& s;
+            const ParticleCollisionParams& params;
+
+            // Pushes particle i out along n by `depth` and applies the response
+            void Resolve(uint32_t i, const glm::vec3& n, float depth) const {
+                if (params.response == ParticleCollisionResponse::Kill) {
+                    s.life[i] = 0.0f;
+                    return;
+                }
+                s.px[i] += n.x * depth;
+                s.py[i] += n.y * depth;
+                s.pz[i] += n.z * depth;
+
+                glm::vec3 v(s.vx[i], s.vy[i], s.vz[i]);
+                float vn = glm::dot(v, n);
+                if (vn >= 0.0f) return;// already separating
+                glm::vec3 vt = v - n * vn;
+                v = vt * (1.0f - params.friction) - n * (vn * params.restitution);
+                s.vx[i] = v.x;
+                s.vy[i] = v.y;
+                s.vz[i] = v.z;
+            }
+        };
+
+        // Branch-free over the SoA arrays so the compiler can vectorize it;
+        // planes are the common case (floors, walls).
+        void CollidePlane(
+          ParticleStorage& s, uint32_t begin, uint32_t end, const ParticlePlaneCollider& plane,
+          const ParticleCollisionParams& params
+        ) {
+            const float nx = plane.normal.x, ny = plane.normal.y, nz = plane.normal.z;
+            const float offset = plane.distance + params.radius;
+            const float bounce = params.response == ParticleCollisionResponse::Bounce ? 1.0f : 0.0f;
+            const float kill = 1.0f - bounce;
+            const float e = params.restitution;
+            const float f = params.friction;
+            float* __restrict px = s.px.data();
+            float* __restrict py = s.py.data();
+            float* __restrict pz = s.pz.data();
+            float* __restrict vx = s.vx.data();
+            float* __restrict vy = s.vy.data();
+            float* __restrict vz = s.vz.data();
+            float* __restrict life = s.life.data();
+
+            for (uint32_t i = begin; i < end; ++i) {
+                float d = nx * px[i] + ny * py[i] + nz * pz[i] - offset;
+                float hit = d < 0.0f ? 1.0f : 0.0f;
+                float push = -std::min(d, 0.0f) * bounce;
+                px[i] += nx * push;
+                py[i] += ny * push;
+                pz[i] += nz * push;
+
+                float vn = nx * vx[i] + ny * vy[i] + nz * vz[i];
+                float approaching = vn < 0.0f ? hit * bounce : 0.0f;
+                // v' = vt * (1 - f) - n * vn * e, blended in only on contact
+                float tx = vx[i] - nx * vn, ty = vy[i] - ny * vn, tz = vz[i] - nz * vn;
+                vx[i] += approaching * (tx * (1.0f - f) - nx * vn * e - vx[i]);
+                vy[i] += approaching * (ty * (1.0f - f) - ny * vn * e - vy[i]);
+                vz[i] += approaching * (tz * (1.0f - f) - nz * vn * e - vz[i]);
+
+                life[i] *= 1.0f - hit * kill;
+            }
+        }
+
+        void CollideSphere(const Resolver& r, uint32_t begin, uint32_t end, const ParticleSphereCollider& sphere) {
+            const float reach = sphere.radius + r.params.radius;
+            for (uint32_t i = begin; i < end; ++i) {
+                glm::vec3 delta(r.s.px[i] - sphere.center.x, r.s.py[i] - sphere.center.y, r.s.pz[i] - sphere.center.z);
+                float dist2 = glm::dot(delta, delta);
+                if (dist2 >= reach * reach) continue;
+                float dist = std::sqrt(dist2);
+                glm::vec3 n = dist > 1e-6f ? delta / dist : glm::vec3(0.0f, 1.0f, 0.0f);
+                r.Resolve(i, n, reach - dist);
+            }
+        }
+
+        void CollideBox(const Resolver& r, uint32_t begin, uint32_t end, const ParticleBoxCollider& box) {
+            const glm::vec3 lo = box.min - glm::vec3(r.params.radius);
+            const glm::vec3 hi = box.max + glm::vec3(r.params.radius);
+            for (uint32_t i = begin; i < end; ++i) {
+                glm::vec3 p(r.s.px[i], r.s.py[i], r.s.pz[i]);
+                if (p.x <= lo.x || p.y <= lo.y || p.z <= lo.z || p.x >= hi.x || p.y >= hi.y || p.z >= hi.z) continue;
+                // Exit through the nearest face
+                float depths[6] = { p.x - lo.x, hi.x - p.x, p.y - lo.y, hi.y - p.y, p.z - lo.z, hi.z - p.z };
+                int face = static_cast<int>(std::min_element(depths, depths + 6) - depths);
+                glm::vec3 n(0.0f);
+                n[face / 2] = (face & 1) ? 1.0f : -1.0f;
+                r.Resolve(i, n, depths[face]);
+            }
+        }
+
+        float SampleHeight(const ParticleHeightfieldCollider& hf, int x, int z) {
+            x = std::clamp(x, 0, hf.width - 1);
+            z = std::clamp(z, 0, hf.depth - 1);
+            return hf.heights[z * hf.width + x];
+        }
+
+        void CollideHeightfield(
+          const Resolver& r, uint32_t begin, uint32_t end, const ParticleHeightfieldCollider& hf
+        ) {
+            if (!hf.heights) return;
+            const float inv = 1.0f / hf.cellSize;
+            for (uint32_t i = begin; i < end; ++i) {
+                float gx = (r.s.px[i] - hf.origin.x) * inv;
+                float gz = (r.s.pz[i] - hf.origin.z) * inv;
+                if (gx < 0.0f || gz < 0.0f || gx >= hf.width - 1 || gz >= hf.depth - 1) continue;
+
+                int x = static_cast<int>(gx), z = static_cast<int>(gz);
+                float fx = gx - x, fz = gz - z;
+                float h00 = SampleHeight(hf, x, z), h10 = SampleHeight(hf, x + 1, z);
+                float h01 = SampleHeight(hf, x, z + 1), h11 = SampleHeight(hf, x + 1, z + 1);
+                float h = glm::mix(glm::mix(h00, h10, fx), glm::mix(h01, h11, fx), fz) + hf.origin.y;
+
+                float depth = h + r.params.radius - r.s.py[i];
+                if (depth <= 0.0f) continue;
+                // Normal from the cell's height gradient
+                float dhdx = glm::mix(h10 - h00, h11 - h01, fz) * inv;
+                float dhdz = glm::mix(h01 - h00, h11 - h10, fx) * inv;
+                glm::vec3 n = glm::normalize(glm::vec3(-dhdx, 1.0f, -dhdz));
+                // Vertical push, expressed along n
+                r.Resolve(i, n, depth * n.y);
+            }
+        }
+
+        void CollideVoxels(const Resolver& r, uint32_t begin, uint32_t end, const VoxelWorld& world) {
+            VoxelWorld::ChunkCursor cursor;
+            auto solid = [&](const glm::ivec3& c) { return world.SampleVoxel(c, cursor) != 0; };
+            for (uint32_t i = begin; i < end; ++i) {
+                glm::vec3 p(r.s.px[i], r.s.py[i], r.s.pz[i]);
+                glm::ivec3 cell = glm::ivec3(glm::floor(p));
+                if (!solid(cell)) continue;
+
+                // Find the face crossed this step: revert one axis at a time
+                glm::vec3 v(r.s.vx[i], r.s.vy[i], r.s.vz[i]);
+                glm::ivec3 prev = glm::ivec3(glm::floor(p - v * r.params.dt));
+                int axis = -1;
+                for (int a = 0; a < 3 && axis < 0; ++a) {
+                    if (prev[a] == cell[a]) continue;
+                    glm::ivec3 back = cell;
+                    back[a] = prev[a];
+                    if (!solid(back)) axis = a;
+                }
+
+                glm::vec3 n(0.0f, 1.0f, 0.0f);
+                float depth = static_cast<float>(cell.y + 1) - p.y;// no face found: eject upwards
+                if (axis >= 0) {
+                    float side = prev[axis] < cell[axis] ? -1.0f : 1.0f;
+                    n = glm::vec3(0.0f);
+                    n[axis] = side;
+                    float face = side < 0.0f ? static_cast<float>(cell[axis]) : static_cast<float>(cell[axis] + 1);
+                    depth = std::abs(face - p[axis]) + 1e-3f;
+                }
+                r.Resolve(i, n, depth);
+            }
+        }
+    }// namespace
+
+    void CollideParticles(
+      ParticleStorage& s,
+      uint32_t begin,
+      uint32_t end,
+      const ParticleColliders& colliders,
+      const ParticleCollisionParams& params
+    ) {
+        for (const auto& plane : colliders.planes) {
+            CollidePlane(s, begin, end, plane, params);
+        }
+        Resolver resolver{ s, params };
+        for (const auto& sphere : colliders.spheres) {
+            CollideSphere(resolver, begin, end, sphere);
+        }
+        for (const auto& box : colliders.boxes) {
+            CollideBox(resolver, begin, end, box);
+        }
+        for (const auto& hf : colliders.heightfields) {
+            CollideHeightfield(resolver, begin, end, hf);
+        }
+        if (colliders.voxels) {
+            CollideVoxels(resolver, begin, end, *colliders.voxels);
+        }
+    }
+}// namespace Atmospheric
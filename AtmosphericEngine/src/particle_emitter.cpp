@@ -1,9 +1,14 @@
 #include "particle_emitter.hpp"
+#include "particle_pool.hpp"
 #include "particle_server.hpp"
+#include "rng.hpp"
+#include <atomic>
 
 namespace Atmospheric {
     ParticleEmitterComponent::ParticleEmitterComponent(const ParticleEmitterProps& def, uint32_t maxParticles)
-      : server(ParticleServer::GetInstance()), max_particles(maxParticles) {
+      : server(ParticleServer::GetInstance()), props(def), max_particles(maxParticles) {
+        static std::atomic<uint32_t> nextSeed{ 1 };
+        seed = props.seed != 0 ? props.seed : HashRandom(0x9E3779B9u, nextSeed.fetch_add(1));
     }
 
     ParticleEmitterComponent::~ParticleEmitterComponent() {
@@ -19,6 +24,12 @@ namespace Atmospheric {
     void ParticleEmitterComponent::OnDetach() {
         server.Unregister(this);
         server.ReleaseEmitterResources(this);
+        if (IsCPU()) {
+            ParticlePool::Get().Release(storage);
+            instances.clear();
+            instances.shrink_to_fit();
+            vbo_capacity = 0;
+        }
     }
 
     GLuint ParticleEmitterComponent::GetCurrentSourceVBO() const {
@@ -0,0 +1,59 @@
+#include "particle_pool.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace Atmospheric {
+
+    void ParticlePool::SetBudget(uint32_t maxParticles) {
+        std::lock_guard<std::mutex> lock(mutex);
+        // Emitters already above the new budget keep their memory until released
+        budget = maxParticles;
+    }
+
+    uint32_t ParticlePool::Grow(ParticleStorage& storage, uint32_t wanted, uint32_t limit) {
+        if (wanted <= storage.capacity) return storage.capacity;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        uint32_t target = std::min(std::bit_ceil(std::max(wanted, MIN_CAPACITY)), limit);
+        uint32_t available = budget > in_use ? budget - in_use : 0;
+        target = std::min(target, storage.capacity + available);
+        if (target <= storage.capacity) return storage.capacity;
+
+        ParticleStorage grown;
+        auto it = std::find_if(recycled.begin(), recycled.end(), [target](const ParticleStorage& s) {
+            return s.capacity == target;
+        });
+        if (it != recycled.end()) {
+            grown = std::move(*it);
+            recycled.erase(it);
+            grown.count = 0;
+        } else {
+            grown.Allocate(target);
+        }
+        grown.CopyFrom(storage);
+
+        in_use += target - storage.capacity;
+        std::swap(storage, grown);
+        if (grown.capacity > 0 && recycled.size() < MAX_RECYCLED) {
+            grown.count = 0;
+            recycled.push_back(std::move(grown));
+        }
+        return storage.capacity;
+    }
+
+    void ParticlePool::Release(ParticleStorage& storage) {
+        std::lock_guard<std::mutex> lock(mutex);
+        in_use -= std::min(in_use, storage.capacity);
+        if (storage.capacity > 0 && recycled.size() < MAX_RECYCLED) {
+            storage.count = 0;
+            recycled.push_back(std::move(storage));
+        }
+        storage = ParticleStorage();
+    }
+
+    void ParticlePool::Trim() {
+        std::lock_guard<std::mutex> lock(mutex);
+        recycled.clear();
+        recycled.shrink_to_fit();
+    }
+}// namespace Atmospheric
@@ -2,14 +2,18 @@
 
 #include "asset_manager.hpp"
 #include "console.hpp"
+#include "game_object.hpp"
 #include "graphics_server.hpp"
+#include "job_system.hpp"
 #include "particle_emitter.hpp"
+#include "particle_pool.hpp"
 #include "renderer.hpp"
 #include "rng.hpp"
 #include "vertex.hpp"
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstring>
 #include <stdexcept>
 
 namespace Atmospheric {
@@ -112,14 +116,20 @@ namespace Atmospheric {
     }
 
     void ParticleServer::CreateEmitterResources(ParticleEmitterComponent* emitter) {
+        // Headless: CPU emitters simulate without any GL objects
+        if (renderer == nullptr) return;
+
         // 1. Create VAO for simulation pass
         glGenVertexArrays(1, &emitter->vao);
 
         // 2. Create two VBOs for ping-ponging
         glGenBuffers(2, emitter->particle_vbos);
 
+        // CPU emitters size their buffers on upload, as the pool grows them
+        if (emitter->IsCPU()) return;
+
         // 3. Populate with initial data
-        RNG rng;
+        CounterRNG rng{ emitter->seed };
         std::vector<Particle> initial_particles(emitter->GetMaxParticles());
         for (auto& p : initial_particles) {
             float r = sqrt(rng.RandomFloat()) * 0.1f;
@@ -172,12 +182,20 @@ namespace Atmospheric {
     };
 
     void ParticleServer::Simulate(float deltaTime) {
-        if (emitters.empty() || !simulation_shader) return;
+        if (emitters.empty()) return;
+        SimulateCPU(deltaTime);
+        SimulateGPU(deltaTime);
+    }
+
+    void ParticleServer::SimulateGPU(float deltaTime) {
+        bool any = std::any_of(emitters.begin(), emitters.end(), [](auto* e) { return !e->IsCPU(); });
+        if (!any || !simulation_shader) return;
 
         simulation_shader->Activate();
         renderer->BeginTransformFeedbackPass();
 
         for (auto* emitter : emitters) {
+            if (emitter->IsCPU()) continue;
             SimUniforms uniforms = { .attractorPos = emitter->attractor, .deltaTime = deltaTime };
             // A bit of a hack to set uniforms without a proper UBO system
             simulation_shader->SetUniform("attractorPos", uniforms.attractorPos);
@@ -195,7 +213,204 @@ namespace Atmospheric {
         simulation_shader->Deactivate();
     }
 
+    void ParticleServer::EmitParticles(ParticleEmitterComponent* emitter) {
+        const auto& props = emitter->props;
+        auto& s = emitter->storage;
+
+        uint32_t toSpawn = emitter->spawn_allowance;
+        if (toSpawn == 0) return;
+        ParticlePool::Get().Grow(s, s.count + toSpawn, emitter->max_particles);
+        if (emitter->instances.size() < s.capacity) emitter->instances.resize(s.capacity);
+        toSpawn = std::min(toSpawn, s.capacity - s.count);
+
+        glm::vec3 origin = emitter->gameObject ? emitter->gameObject->GetPosition() : glm::vec3(0.0f);
+        glm::vec3 axis = glm::length(props.direction) > 0.0f ? glm::normalize(props.direction) : glm::vec3(0, 1, 0);
+        uint32_t first = s.count;
+        for (uint32_t n = 0; n < toSpawn; ++n) {
+            // Every particle draws from its own counter range, so the result
+            // depends only on the seed and spawn index, not on scheduling
+            CounterRNG rng{ emitter->seed, (emitter->spawn_counter + n) * 8 };
+
+            // Uniform direction on the sphere, blended towards the emit axis
+            float z = rng.RandomFloatInRange(-1.0f, 1.0f);
+            float theta = rng.RandomFloat() * 2.0f * 3.14159f;
+            float r = std::sqrt(1.0f - z * z);
+            glm::vec3 random(r * std::cos(theta), r * std::sin(theta), z);
+            glm::vec3 dir = glm::mix(axis, random, props.spread);
+            float len = glm::length(dir);
+            dir = len > 1e-4f ? dir / len : axis;
+
+            glm::vec3 pos = origin + random * (props.spawnRadius * std::cbrt(rng.RandomFloat()));
+            glm::vec3 vel = dir * rng.RandomFloatInRange(props.speedMin, props.speedMax);
+            float life = rng.RandomFloatInRange(props.lifetimeMin, props.lifetimeMax);
+
+            uint32_t i = first + n;
+            s.px[i] = pos.x;
+            s.py[i] = pos.y;
+            s.pz[i] = pos.z;
+            s.vx[i] = vel.x;
+            s.vy[i] = vel.y;
+            s.vz[i] = vel.z;
+            s.life[i] = life;
+            s.SetLifetime(i, life);
+            s.SetSize(i, rng.RandomFloatInRange(props.sizeMin, props.sizeMax));
+        }
+        s.count += toSpawn;
+        emitter->spawn_counter += toSpawn;
+    }
+
+    void ParticleServer::AllocateSpawns(const std::vector<ParticleEmitterComponent*>& cpuEmitters, float deltaTime) {
+        struct Request {
+            ParticleEmitterComponent* emitter;
+            uint32_t wanted;
+            float distance;
+        };
+        std::vector<Request> requests;
+        requests.reserve(cpuEmitters.size());
+
+        for (auto* emitter : cpuEmitters) {
+            const auto& props = emitter->props;
+            glm::vec3 origin = emitter->gameObject ? emitter->gameObject->GetPosition() : glm::vec3(0.0f);
+            float distance = glm::distance(origin, viewer_position);
+            float rate = props.emissionRate;
+            if (props.throttleDistance > 0.0f) {
+                rate *= glm::clamp(1.0f - distance / props.throttleDistance, 0.0f, 1.0f);
+            }
+            emitter->emission_accumulator += rate * deltaTime;
+            auto wanted = static_cast<uint32_t>(emitter->emission_accumulator);
+            emitter->emission_accumulator -= static_cast<float>(wanted);
+            requests.push_back({ emitter, wanted, distance });
+        }
+
+        std::sort(requests.begin(), requests.end(), [](const Request& a, const Request& b) {
+            if (a.emitter->props.priority != b.emitter->props.priority) {
+                return a.emitter->props.priority > b.emitter->props.priority;
+            }
+            return a.distance < b.distance;
+        });
+
+        // Spawns denied by the budget are dropped, not deferred, so a busy
+        // frame doesn't turn into a burst on the next one
+        uint32_t remaining = spawn_budget;
+        spawns_denied = 0;
+        for (auto& request : requests) {
+            uint32_t granted = std::min(request.wanted, remaining);
+            request.emitter->spawn_allowance = granted;
+            remaining -= granted;
+            spawns_denied += request.wanted - granted;
+        }
+    }
+
+    void ParticleServer::SimulateCPU(float deltaTime) {
+        ZoneScoped;
+        std::vector<ParticleEmitterComponent*> cpuEmitters;
+        for (auto* emitter : emitters) {
+            if (emitter->IsCPU() && emitter->enabled) cpuEmitters.push_back(emitter);
+        }
+        if (cpuEmitters.empty()) return;
+
+        auto* jobs = JobSystem::Get();
+        JobCounter pass;
+
+        AllocateSpawns(cpuEmitters, deltaTime);
+
+        // 1. Per emitter: drop particles that died last step, spawn new ones
+        for (auto* emitter : cpuEmitters) {
+            jobs->Execute([emitter](int) {
+                CompactParticles(emitter->storage);
+                EmitParticles(emitter);
+            }, pass);
+        }
+        jobs->Wait(pass);
+
+        // 2. Integrate and write instance records in LANES-aligned slices
+        for (auto* emitter : cpuEmitters) {
+            const auto& props = emitter->props;
+            ParticleIntegrateParams params = {
+                .gravity = props.gravity,
+                .damping = std::max(0.0f, 1.0f - props.drag * deltaTime),
+                .dt = deltaTime,
+            };
+            ParticleCollisionParams collision = {
+                .response = props.collisionResponse,
+                .restitution = props.restitution,
+                .friction = props.friction,
+                .radius = props.collisionRadius,
+                .dt = deltaTime,
+            };
+            bool collide = props.collide && !colliders.IsEmpty();
+            uint32_t count = emitter->storage.count;
+            for (uint32_t begin = 0; begin < count; begin += CPU_GRAIN) {
+                uint32_t end = std::min(begin + CPU_GRAIN, count);
+                jobs->Execute([this, emitter, params, collision, collide, begin, end](int) {
+                    IntegrateParticles(emitter->storage, begin, end, params);
+                    if (collide) CollideParticles(emitter->storage, begin, end, colliders, collision);
+                    WriteParticleInstances(
+                      emitter->storage,
+                      begin,
+                      end,
+                      emitter->props.colorStart,
+                      emitter->props.colorEnd,
+                      emitter->instances.data()
+                    );
+                }, pass);
+            }
+        }
+        jobs->Wait(pass);
+
+        // 3. Back-to-front order for emitters that blend with alpha.  Spawns,
+        // deaths and swap-removal move particles between slots every frame,
+        // so the sorter has no history to reuse here and radix sorts.
+        for (auto* emitter : cpuEmitters) {
+            if (!emitter->props.sortByDepth) continue;
+            jobs->Execute([this, emitter](int) {
+                uint32_t count = emitter->storage.count;
+                const auto& s = emitter->storage;
+                emitter->sort_keys.resize(count);
+                for (uint32_t i = 0; i < count; ++i) {
+                    glm::vec3 d = glm::vec3(s.px[i], s.py[i], s.pz[i]) - viewer_position;
+                    emitter->sort_keys[i] = 0x7FFFFFFFu - QuantizeDepth(glm::dot(d, d), 31);
+                }
+                const auto& order = emitter->sorter.Sort(emitter->sort_keys.data(), count);
+                emitter->sorted_instances.resize(count);
+                for (uint32_t i = 0; i < count; ++i) {
+                    emitter->sorted_instances[i] = emitter->instances[order[i]];
+                }
+            }, pass);
+        }
+        jobs->Wait(pass);
+
+        // 4. Stream into the buffer Draw() reads next
+        if (renderer == nullptr) return;
+        for (auto* emitter : cpuEmitters) {
+            uint32_t count = emitter->storage.count;
+            if (count == 0 || emitter->GetCurrentDestinationVBO() == 0) continue;
+            if (emitter->vbo_capacity < emitter->storage.capacity) {
+                emitter->vbo_capacity = emitter->storage.capacity;
+                for (GLuint vbo : emitter->particle_vbos) {
+                    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+                    glBufferData(GL_ARRAY_BUFFER, sizeof(Particle) * emitter->vbo_capacity, nullptr, GL_STREAM_DRAW);
+                }
+            }
+            glBindBuffer(GL_ARRAY_BUFFER, emitter->GetCurrentDestinationVBO());
+            // Invalidate lets the driver hand out fresh storage instead of
+            // staging a copy or waiting for a draw still reading the old one;
+            // nothing else touches the range, so it needs no sync either
+            const GLsizeiptr bytes = sizeof(Particle) * count;
+            void* mapped = glMapBufferRange(
+              GL_ARRAY_BUFFER, 0, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT
+            );
+            if (mapped) std::memcpy(mapped, emitter->GetInstances().data(), bytes);
+            // Unmapping fails if the store was lost meanwhile (e.g. a mode switch)
+            if (!mapped || glUnmapBuffer(GL_ARRAY_BUFFER) == GL_FALSE) {
+                glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, emitter->GetInstances().data());
+            }
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
     void ParticleServer::Draw(const CameraInfo& camInfo) {
+        viewer_position = camInfo.position;
         if (emitters.empty() || !drawing_shader) return;
 
         drawing_shader->Activate();
@@ -210,6 +425,13 @@ namespace Atmospheric {
         glBindVertexArray(quad_mesh->vao);
 
         for (auto* emitter : emitters) {
+            if (emitter->GetDrawCount() == 0) continue;
+            // Sorted emitters blend with alpha, the rest stay additive
+            if (emitter->props.sortByDepth) {
+                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            } else {
+                glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+            }
             // Bind the buffer with the latest particle data as a storage buffer
             // This requires GL 4.3+, let's use vertex attributes for broader compatibility.
             // We'll bind the particle VBO and use instanced rendering.
@@ -231,7 +453,7 @@ namespace Atmospheric {
             glVertexAttribDivisor(4, 1);
 
             glDrawElementsInstanced(
-              GL_TRIANGLES, quad_mesh->triCount * 3, GL_UNSIGNED_SHORT, 0, emitter->GetMaxParticles()
+              GL_TRIANGLES, quad_mesh->triCount * 3, GL_UNSIGNED_SHORT, 0, emitter->GetDrawCount()
             );
 
             // Reset divisors
@@ -0,0 +1,145 @@
+#include "particle_storage.hpp"
+#include "particle_emitter.hpp"
+#include <algorithm>
+#include <glm/gtc/packing.hpp>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define ATMOSPHERIC_PARTICLE_SSE 1
+#endif
+
+namespace Atmospheric {
+
+    void ParticleStorage::Allocate(uint32_t maxParticles) {
+        uint32_t padded = (maxParticles + LANES - 1) / LANES * LANES;
+        for (auto* a : { &px, &py, &pz, &vx, &vy, &vz, &life }) {
+            a->assign(padded, 0.0f);
+        }
+        lifetime.assign(padded, 0);
+        size.assign(padded, 0);
+        capacity = maxParticles;
+        count = 0;
+    }
+
+    void ParticleStorage::CopyFrom(const ParticleStorage& other) {
+        count = std::min(other.count, capacity);
+        auto copy = [this](const auto& src, auto& dst) { std::copy_n(src.begin(), count, dst.begin()); };
+        copy(other.px, px);
+        copy(other.py, py);
+        copy(other.pz, pz);
+        copy(other.vx, vx);
+        copy(other.vy, vy);
+        copy(other.vz, vz);
+        copy(other.life, life);
+        copy(other.lifetime, lifetime);
+        copy(other.size, size);
+    }
+
+    void ParticleStorage::SetLifetime(uint32_t i, float seconds) {
+        float ticks = std::clamp(seconds * LIFETIME_TICKS + 0.5f, 1.0f, 65535.0f);
+        lifetime[i] = static_cast<uint16_t>(ticks);
+    }
+
+    float ParticleStorage::GetLifetime(uint32_t i) const {
+        return static_cast<float>(lifetime[i]) * (1.0f / LIFETIME_TICKS);
+    }
+
+    void ParticleStorage::SetSize(uint32_t i, float value) {
+        size[i] = glm::packHalf1x16(value);
+    }
+
+    float ParticleStorage::GetSize(uint32_t i) const {
+        return glm::unpackHalf1x16(size[i]);
+    }
+
+    void ParticleStorage::Kill(uint32_t i) {
+        uint32_t last = --count;
+        px[i] = px[last];
+        py[i] = py[last];
+        pz[i] = pz[last];
+        vx[i] = vx[last];
+        vy[i] = vy[last];
+        vz[i] = vz[last];
+        life[i] = life[last];
+        lifetime[i] = lifetime[last];
+        size[i] = size[last];
+    }
+
+    void IntegrateParticles(ParticleStorage& s, uint32_t begin, uint32_t end, const ParticleIntegrateParams& params) {
+        // Padding lanes past count are simulated too; they are never drawn
+        end = (end + ParticleStorage::LANES - 1) / ParticleStorage::LANES * ParticleStorage::LANES;
+        float* __restrict px = s.px.data();
+        float* __restrict py = s.py.data();
+        float* __restrict pz = s.pz.data();
+        float* __restrict vx = s.vx.data();
+        float* __restrict vy = s.vy.data();
+        float* __restrict vz = s.vz.data();
+        float* __restrict life = s.life.data();
+
+#ifdef ATMOSPHERIC_PARTICLE_SSE
+        const __m128 dt = _mm_set1_ps(params.dt);
+        const __m128 damping = _mm_set1_ps(params.damping);
+        const __m128 gx = _mm_set1_ps(params.gravity.x * params.dt);
+        const __m128 gy = _mm_set1_ps(params.gravity.y * params.dt);
+        const __m128 gz = _mm_set1_ps(params.gravity.z * params.dt);
+        for (uint32_t i = begin; i < end; i += ParticleStorage::LANES) {
+            __m128 x = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(vx + i), gx), damping);
+            __m128 y = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(vy + i), gy), damping);
+            __m128 z = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(vz + i), gz), damping);
+            _mm_storeu_ps(vx + i, x);
+            _mm_storeu_ps(vy + i, y);
+            _mm_storeu_ps(vz + i, z);
+            _mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(x, dt)));
+            _mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(y, dt)));
+            _mm_storeu_ps(pz + i, _mm_add_ps(_mm_loadu_ps(pz + i), _mm_mul_ps(z, dt)));
+            _mm_storeu_ps(life + i, _mm_sub_ps(_mm_loadu_ps(life + i), dt));
+        }
+#else
+        // Plain SoA loop; compilers vectorize this for NEON/wasm SIMD
+        const glm::vec3 g = params.gravity * params.dt;
+        for (uint32_t i = begin; i < end; ++i) {
+            vx[i] = (vx[i] + g.x) * params.damping;
+            vy[i] = (vy[i] + g.y) * params.damping;
+            vz[i] = (vz[i] + g.z) * params.damping;
+            px[i] += vx[i] * params.dt;
+            py[i] += vy[i] * params.dt;
+            pz[i] += vz[i] * params.dt;
+            life[i] -= params.dt;
+        }
+#endif
+    }
+
+    uint32_t CompactParticles(ParticleStorage& s) {
+        uint32_t dead = 0;
+        for (uint32_t i = 0; i < s.count;) {
+            if (s.life[i] > 0.0f) {
+                ++i;
+                continue;
+            }
+            // Re-test slot i: it now holds the particle moved from the end
+            s.Kill(i);
+            ++dead;
+        }
+        return dead;
+    }
+
+    void WriteParticleInstances(
+      const ParticleStorage& s,
+      uint32_t begin,
+      uint32_t end,
+      const glm::vec4& colorStart,
+      const glm::vec4& colorEnd,
+      Particle* out
+    ) {
+        for (uint32_t i = begin; i < end; ++i) {
+            float t = glm::clamp(s.life[i] / s.GetLifetime(i), 0.0f, 1.0f);
+            Particle& p = out[i];
+            p.position = glm::vec3(s.px[i], s.py[i], s.pz[i]);
+            p.velocity = glm::vec3(s.vx[i], s.vy[i], s.vz[i]);
+            p.color = glm::mix(colorEnd, colorStart, t);
+            p.life = s.life[i];
+            // Particles that expired this step stay until the next compaction
+            p.size = s.life[i] > 0.0f ? s.GetSize(i) : 0.0f;
+        }
+    }
+}// namespace Atmospheric
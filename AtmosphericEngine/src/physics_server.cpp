@@ -1,6 +1,7 @@
 #include "physics_server.hpp"
 #include "LinearMath/btThreads.h"
 #include "bullet_task_scheduler.hpp"
+#include "console.hpp"
 #include "game_object.hpp"
 #include "job_system.hpp"
 #include "physics_debug_drawer.hpp"
@@ -48,6 +49,8 @@ PhysicsServer::~PhysicsServer() {
     delete _broadphase;
     delete _dispatcher;
     delete _config;
+
+    _instance = nullptr;
 }
 
 void PhysicsServer::Init(Application* app) {
@@ -76,45 +79,259 @@ void PhysicsServer::Init(Application* app) {
     _world->setDebugDrawer(_debugDrawer);
     _debugDrawer->setDebugMode(1);
 
-    _timeAccum = 0.0f;
+    _clock.step = FIXED_TIME_STEP;
+    _clock.Reset();
 }
 
 void PhysicsServer::Process(float dt) {
 #ifdef TRACY_ENABLE
     ZoneScopedN("PhysicsServer::Process");
 #endif
-    _timeAccum += dt;
-    while (_timeAccum >= FIXED_TIME_STEP) {
-        _world->stepSimulation(FIXED_TIME_STEP, 0);
-        _timeAccum -= FIXED_TIME_STEP;
+    _lastStepCount = _clock.Advance(dt);
+    StepSimulation(_lastStepCount);
+
+    CollectContacts();
+    _contacts.Dispatch();
+
+    // Per-object callbacks: OnCollisionEnter once when a pair starts
+    // touching, OnCollision every frame it touches as before.  Listeners that
+    // need end events subscribe instead.
+    for (const auto& e : _contacts.GetEvents().begin) {
+        e.a->OnCollisionEnter(e.b);
+        e.b->OnCollisionEnter(e.a);
+    }
+    for (const auto* events : { &_contacts.GetEvents().begin, &_contacts.GetEvents().stay }) {
+        for (const auto& e : *events) {
+            e.a->OnCollision(e.b);
+            e.b->OnCollision(e.a);
+        }
     }
 
+    if (_debugUIEnabled) {
+        _world->debugDrawWorld();// TODO: check if this cost performance when debug mode is NoDebug
+    }
+}
+
+void PhysicsServer::StepSimulation(int steps, const std::function<void(int)>& beforeStep) {
+    if (steps <= 0) return;
+    // Motion-state callbacks during the steps refill _moved
+    std::swap(_moved, _movedLastFrame);
+    _moved.clear();
+    ++_frame;
+    for (int i = 0; i < steps; ++i) {
+        if (beforeStep) beforeStep(i);
+        _world->stepSimulation(_clock.step, 0);
+    }
+}
+
+static constexpr uint32_t SNAPSHOT_MAGIC = 0x33535041;// "APS3"
+static constexpr uint32_t SNAPSHOT_VERSION = 2;
+
+// Bullet vectors carry an unused fourth lane; only x/y/z (and quaternion
+// x/y/z/w) go into the snapshot so hashes never see padding.
+static void WriteVector(SnapshotWriter& out, const btVector3& v) {
+    out.Write(v.x());
+    out.Write(v.y());
+    out.Write(v.z());
+}
+
+static bool ReadVector(SnapshotReader& in, btVector3& v) {
+    btScalar x, y, z;
+    if (!in.Read(x) || !in.Read(y) || !in.Read(z)) return false;
+    v.setValue(x, y, z);
+    return true;
+}
+
+static void WriteQuaternion(SnapshotWriter& out, const btQuaternion& q) {
+    out.Write(q.x());
+    out.Write(q.y());
+    out.Write(q.z());
+    out.Write(q.w());
+}
+
+static bool ReadQuaternion(SnapshotReader& in, btQuaternion& q) {
+    btScalar x, y, z, w;
+    if (!in.Read(x) || !in.Read(y) || !in.Read(z) || !in.Read(w)) return false;
+    q.setValue(x, y, z, w);
+    return true;
+}
+
+void PhysicsServer::SaveSnapshot(PhysicsSnapshot& snapshot) const {
+    ZoneScoped;
+    SnapshotWriter out(snapshot);
+    out.Write(SNAPSHOT_MAGIC);
+    out.Write(SNAPSHOT_VERSION);
+    out.Write(static_cast<uint32_t>(_impostors.size()));
+    out.Write(_clock.accumulator);
+    // unsigned long is 32 bits on Windows, 64 elsewhere; keep the layout fixed
+    out.Write(static_cast<uint64_t>(static_cast<btSequentialImpulseConstraintSolver*>(_solver)->getRandSeed()));
+
+    for (auto* impostor : _impostors) {
+        const btRigidBody* body = impostor->_rigidbody;
+        const btTransform& t = body->getWorldTransform();
+        WriteVector(out, t.getOrigin());
+        WriteQuaternion(out, t.getRotation());
+        WriteVector(out, body->getLinearVelocity());
+        WriteVector(out, body->getAngularVelocity());
+        out.Write(body->getActivationState());
+        out.Write(body->getDeactivationTime());
+    }
+}
+
+bool PhysicsServer::LoadSnapshot(const PhysicsSnapshot& snapshot) {
+    ZoneScoped;
+    SnapshotReader in(snapshot);
+    uint32_t magic = 0, version = 0, count = 0;
+    float accumulator = 0.0f;
+    uint64_t seed = 0;
+    if (!in.Read(magic) || magic != SNAPSHOT_MAGIC || !in.Read(version) || version != SNAPSHOT_VERSION) {
+        Console::Get()->Error("PhysicsServer: not a physics snapshot");
+        return false;
+    }
+    if (!in.Read(count) || count != _impostors.size()) {
+        Console::Get()->Error("PhysicsServer: snapshot body count does not match the world");
+        return false;
+    }
+
+    // Parse everything before touching the world, so a bad snapshot leaves
+    // it as it was
+    struct BodyState {
+        btTransform transform;
+        btVector3 linearVelocity, angularVelocity;
+        int activationState = 0;
+        btScalar deactivationTime = 0;
+    };
+    std::vector<BodyState> states(count);
+    bool complete = in.Read(accumulator) && in.Read(seed);
+    for (auto& state : states) {
+        if (!complete) break;
+        btVector3 origin;
+        btQuaternion rotation;
+        complete = ReadVector(in, origin) && ReadQuaternion(in, rotation) && ReadVector(in, state.linearVelocity)
+                   && ReadVector(in, state.angularVelocity) && in.Read(state.activationState)
+                   && in.Read(state.deactivationTime);
+        state.transform = btTransform(rotation, origin);
+    }
+    if (!complete || !in.AtEnd()) {
+        Console::Get()->Error("PhysicsServer: truncated physics snapshot");
+        return false;
+    }
+
+    for (size_t i = 0; i < states.size(); ++i) {
+        const BodyState& state = states[i];
+        RigidbodyComponent* impostor = _impostors[i];
+        btRigidBody* body = impostor->_rigidbody;
+        body->setWorldTransform(state.transform);
+        body->setInterpolationWorldTransform(state.transform);
+        body->setLinearVelocity(state.linearVelocity);
+        body->setAngularVelocity(state.angularVelocity);
+        body->setInterpolationLinearVelocity(state.linearVelocity);
+        body->setInterpolationAngularVelocity(state.angularVelocity);
+        body->clearForces();
+        body->forceActivationState(state.activationState);
+        body->setDeactivationTime(state.deactivationTime);
+        // Drop cached manifolds so the next step rebuilds them from scratch
+        if (body->getBroadphaseHandle()) {
+            _broadphase->getOverlappingPairCache()->cleanProxyFromPairs(body->getBroadphaseHandle(), _dispatcher);
+        }
+        // Teleport: the motion state marks the body moved, no interpolation
+        body->getMotionState()->setWorldTransform(state.transform);
+        impostor->StorePreviousTransform();
+    }
+
+    _clock.accumulator = accumulator;
+    static_cast<btSequentialImpulseConstraintSolver*>(_solver)->setRandSeed(static_cast<unsigned long>(seed));
+    return true;
+}
+
+uint64_t PhysicsServer::ComputeStateHash() const {
+    PhysicsSnapshot snapshot;
+    SaveSnapshot(snapshot);
+    return HashSnapshot(snapshot);
+}
+
+bool PhysicsServer::Resimulate(
+  const PhysicsSnapshot& snapshot, int steps, const std::function<void(int)>& applyInput
+) {
+    ZoneScoped;
+    if (!LoadSnapshot(snapshot)) return false;
+    StepSimulation(steps, applyInput);
+    return true;
+}
+
+void PhysicsServer::MarkMoved(RigidbodyComponent* rb) {
+    if (rb->_lastMovedFrame == _frame) return;
+    rb->_lastMovedFrame = _frame;
+    _moved.push_back(rb);
+}
+
+void PhysicsServer::SyncTransforms() {
+    ZoneScoped;
+    float alpha = _clock.GetAlpha();
+    for (auto* rb : _moved) {
+        if (rb->IsKinematic()) continue;
+        rb->gameObject->SyncObjectTransform(rb->GetInterpolatedTransform(alpha));
+    }
+    // Stopped (or fell asleep) last frame: snap to the final pose once
+    for (auto* rb : _movedLastFrame) {
+        if (rb->_lastMovedFrame == _frame || rb->IsKinematic()) continue;
+        rb->StorePreviousTransform();
+        rb->gameObject->SyncObjectTransform(rb->GetInterpolatedTransform(1.0f));
+    }
+    _movedLastFrame.clear();
+}
+
+void PhysicsServer::CollectContacts() {
+    ZoneScoped;
     int numManifolds = _dispatcher->getNumManifolds();
     for (int i = 0; i < numManifolds; i++) {
         btPersistentManifold* contactManifold = _dispatcher->getManifoldByIndexInternal(i);
+        int numContacts = contactManifold->getNumContacts();
+        if (numContacts == 0) continue;
 
-        btCollisionObject* objA = const_cast<btCollisionObject*>(contactManifold->getBody0());
-        btCollisionObject* objB = const_cast<btCollisionObject*>(contactManifold->getBody1());
+        const btCollisionObject* objA = contactManifold->getBody0();
+        const btCollisionObject* objB = contactManifold->getBody1();
 
         GameObject* gameObjA = static_cast<GameObject*>(objA->getUserPointer());
         GameObject* gameObjB = static_cast<GameObject*>(objB->getUserPointer());
-
-        if (gameObjA && gameObjB) {
-            if (contactManifold->getNumContacts() > 0) {
-                gameObjA->OnCollision(gameObjB);
-                gameObjB->OnCollision(gameObjA);
-            }
+        if (!gameObjA || !gameObjB) continue;
+
+        // Report the deepest point: an average of the corners of a resting
+        // face lies inside the face, but its normal is one point's anyway
+        int deepest = 0;
+        float impulse = 0.0f;
+        for (int j = 0; j < numContacts; j++) {
+            const btManifoldPoint& pt = contactManifold->getContactPoint(j);
+            if (pt.getDistance() < contactManifold->getContactPoint(deepest).getDistance()) deepest = j;
+            impulse += pt.getAppliedImpulse();
         }
+        const btManifoldPoint& pt = contactManifold->getContactPoint(deepest);
+        const btVector3& point = pt.getPositionWorldOnB();
+        const btVector3& normal = pt.m_normalWorldOnB;
+
+        const btBroadphaseProxy* proxyA = objA->getBroadphaseHandle();
+        const btBroadphaseProxy* proxyB = objB->getBroadphaseHandle();
+        _contacts.AddContact(objA, objB, ContactEvent{
+            .a = gameObjA,
+            .b = gameObjB,
+            .layerA = proxyA ? proxyA->m_collisionFilterGroup : 0,
+            .layerB = proxyB ? proxyB->m_collisionFilterGroup : 0,
+            .point = glm::vec3(point.x(), point.y(), point.z()),
+            .normal = glm::vec3(normal.x(), normal.y(), normal.z()),
+            .impulse = impulse,
+            .depth = -pt.getDistance(),
+        });
     }
-
-    if (_debugUIEnabled) {
-        _world->debugDrawWorld();// TODO: check if this cost performance when debug mode is NoDebug
-    }
+    _contacts.Update();
 }
 
 void PhysicsServer::DrawImGui(float dt) {
     if (ImGui::CollapsingHeader("Physics", ImGuiTreeNodeFlags_DefaultOpen)) {
         ImGui::Text("Number of manifolds: %d", _dispatcher->getNumManifolds());
+        ImGui::Text("Steps this frame: %d (alpha %.2f)", _lastStepCount, _clock.GetAlpha());
+        ImGui::SliderInt("Max Sub Steps", &_clock.maxSubSteps, 1, 10);
+        const ContactEvents& contacts = _contacts.GetEvents();
+        ImGui::Text("Contacts: %zu begin, %zu stay, %zu end", contacts.begin.size(), contacts.stay.size(), contacts.end.size());
         if (ImGui::Button("Debug UI")) {
             EnableDebugUI(!_debugUIEnabled);
         }
@@ -136,6 +353,9 @@ void PhysicsServer::Reset() {
         delete impostor;
     }
     _impostors.clear();
+    _moved.clear();
+    _movedLastFrame.clear();
+    _contacts.Clear();
 }
 
 void PhysicsServer::AddRigidbody(RigidbodyComponent* impostor) {
@@ -145,6 +365,10 @@ void PhysicsServer::AddRigidbody(RigidbodyComponent* impostor) {
 
 void PhysicsServer::RemoveRigidbody(RigidbodyComponent* impostor) {
     _world->removeRigidBody(impostor->_rigidbody);
+    std::erase(_impostors, impostor);
+    _contacts.RemoveBody(impostor->_rigidbody);
+    std::erase(_moved, impostor);
+    std::erase(_movedLastFrame, impostor);
 }
 
 ColliderID PhysicsServer::CreateCollider(const Shape& shape) {
@@ -201,6 +425,202 @@ bool PhysicsServer::Raycast(const glm::vec3& from, const glm::vec3& to, RaycastH
     }
 }
 
+// Rays per job; RaycastAllBatch keeps one hit list per slice of this size
+static constexpr size_t QUERY_GRAIN = 128;
+
+void PhysicsServer::ParallelQuery(size_t count, const std::function<void(size_t, size_t)>& fn) {
+    if (count <= QUERY_GRAIN) {
+        fn(0, count);
+        return;
+    }
+    JobCounter batch;
+    for (size_t begin = 0; begin < count; begin += QUERY_GRAIN) {
+        size_t end = std::min(count, begin + QUERY_GRAIN);
+        JobSystem::Get()->Execute([&fn, begin, end](int) { fn(begin, end); }, batch);
+    }
+    JobSystem::Get()->Wait(batch);
+}
+
+static RaycastHit MakeMiss() {
+    return RaycastHit{ .point = glm::vec3(0.0f), .normal = glm::vec3(0.0f), .gameObject = nullptr, .hitDistance = 0.0f, .hitFraction = 1.0f };
+}
+
+static RaycastHit MakeHit(
+  const btVector3& point, const btVector3& normal, const btCollisionObject* obj, float fraction, float length
+) {
+    return RaycastHit{
+        .point = glm::vec3(point.x(), point.y(), point.z()),
+        .normal = glm::vec3(normal.x(), normal.y(), normal.z()),
+        .gameObject = static_cast<GameObject*>(obj->getUserPointer()),
+        .hitDistance = fraction * length,
+        .hitFraction = fraction,
+    };
+}
+
+size_t PhysicsServer::RaycastBatch(const RayQuery* rays, size_t count, RaycastHit* hits) {
+    ZoneScoped;
+    std::atomic<size_t> numHits{ 0 };
+    ParallelQuery(count, [&](size_t begin, size_t end) {
+        size_t local = 0;
+        for (size_t i = begin; i < end; ++i) {
+            btVector3 from(rays[i].from.x, rays[i].from.y, rays[i].from.z);
+            btVector3 to(rays[i].to.x, rays[i].to.y, rays[i].to.z);
+            btCollisionWorld::ClosestRayResultCallback callback(from, to);
+            _world->rayTest(from, to, callback);
+            if (callback.hasHit()) {
+                hits[i] = MakeHit(
+                  callback.m_hitPointWorld, callback.m_hitNormalWorld, callback.m_collisionObject,
+                  callback.m_closestHitFraction, from.distance(to)
+                );
+                ++local;
+            } else {
+                hits[i] = MakeMiss();
+            }
+        }
+        numHits += local;
+    });
+    return numHits;
+}
+
+size_t PhysicsServer::RaycastAllBatch(
+  const RayQuery* rays, size_t count, RaycastHit* hits, size_t maxHits, uint32_t* offsets
+) {
+    ZoneScoped;
+    // Workers append to one list per slice and leave each ray's hit count in
+    // offsets[i + 1]; packing the lists afterwards is a serial prefix sum.
+    std::vector<std::vector<RaycastHit>> slices((count + QUERY_GRAIN - 1) / QUERY_GRAIN);
+    std::atomic<size_t> numHits{ 0 };
+    ParallelQuery(count, [&](size_t begin, size_t end) {
+        std::vector<RaycastHit>& slice = slices[begin / QUERY_GRAIN];
+        size_t local = 0;
+        for (size_t i = begin; i < end; ++i) {
+            btVector3 from(rays[i].from.x, rays[i].from.y, rays[i].from.z);
+            btVector3 to(rays[i].to.x, rays[i].to.y, rays[i].to.z);
+            btCollisionWorld::AllHitsRayResultCallback callback(from, to);
+            _world->rayTest(from, to, callback);
+
+            // Bullet reports hits in traversal order
+            int n = callback.m_collisionObjects.size();
+            size_t first = slice.size();
+            float length = from.distance(to);
+            for (int k = 0; k < n; ++k) {
+                slice.push_back(MakeHit(
+                  callback.m_hitPointWorld[k], callback.m_hitNormalWorld[k], callback.m_collisionObjects[k],
+                  callback.m_hitFractions[k], length
+                ));
+            }
+            std::sort(slice.begin() + first, slice.end(), [](const RaycastHit& a, const RaycastHit& b) {
+                return a.hitFraction < b.hitFraction;
+            });
+            offsets[i + 1] = (uint32_t)n;
+            local += (n > 0);
+        }
+        numHits += local;
+    });
+
+    offsets[0] = 0;
+    size_t written = 0;
+    for (size_t s = 0; s < slices.size(); ++s) {
+        const RaycastHit* src = slices[s].data();
+        for (size_t i = s * QUERY_GRAIN; i < std::min(count, (s + 1) * QUERY_GRAIN); ++i) {
+            size_t found = offsets[i + 1];
+            size_t kept = std::min(found, maxHits - written);
+            std::copy_n(src, kept, hits + written);
+            src += found;
+            written += kept;
+            offsets[i + 1] = (uint32_t)written;
+        }
+    }
+    return numHits;
+}
+
+size_t PhysicsServer::SweepBatch(const SweepQuery* sweeps, size_t count, RaycastHit* hits) {
+    ZoneScoped;
+    std::atomic<size_t> numHits{ 0 };
+    ParallelQuery(count, [&](size_t begin, size_t end) {
+        size_t local = 0;
+        for (size_t i = begin; i < end; ++i) {
+            hits[i] = MakeMiss();
+            auto it = _colliders.find(sweeps[i].shape);
+            if (it == _colliders.end() || !it->second->isConvex()) continue;
+            auto* shape = static_cast<btConvexShape*>(it->second);
+
+            btVector3 from(sweeps[i].from.x, sweeps[i].from.y, sweeps[i].from.z);
+            btVector3 to(sweeps[i].to.x, sweeps[i].to.y, sweeps[i].to.z);
+            btTransform tFrom, tTo;
+            tFrom.setIdentity();
+            tFrom.setOrigin(from);
+            tTo.setIdentity();
+            tTo.setOrigin(to);
+
+            btCollisionWorld::ClosestConvexResultCallback callback(from, to);
+            _world->convexSweepTest(shape, tFrom, tTo, callback);
+            if (callback.hasHit()) {
+                hits[i] = MakeHit(
+                  callback.m_hitPointWorld, callback.m_hitNormalWorld, callback.m_hitCollisionObject,
+                  callback.m_closestHitFraction, from.distance(to)
+                );
+                ++local;
+            }
+        }
+        numHits += local;
+    });
+    return numHits;
+}
+
+namespace {
+// Collects distinct GameObjects touching the query object, up to a cap
+struct OverlapCallback : public btCollisionWorld::ContactResultCallback {
+    GameObject** out;
+    uint32_t capacity;
+    uint32_t count = 0;
+
+    OverlapCallback(GameObject** out, uint32_t capacity) : out(out), capacity(capacity) {}
+
+    btScalar addSingleResult(
+      btManifoldPoint&, const btCollisionObjectWrapper* a, int, int, const btCollisionObjectWrapper* b, int, int
+    ) override {
+        // The query object has no user pointer; the other one is the hit
+        auto* go = static_cast<GameObject*>(a->getCollisionObject()->getUserPointer());
+        if (!go) go = static_cast<GameObject*>(b->getCollisionObject()->getUserPointer());
+        if (!go || count >= capacity) return 0;
+        for (uint32_t k = 0; k < count; ++k)
+            if (out[k] == go) return 0;
+        out[count++] = go;
+        return 0;
+    }
+};
+}// namespace
+
+size_t PhysicsServer::OverlapBatch(
+  const OverlapQuery* queries, size_t count, GameObject** results, size_t maxResultsPerQuery, uint32_t* resultCounts
+) {
+    ZoneScoped;
+    std::atomic<size_t> numHits{ 0 };
+    ParallelQuery(count, [&](size_t begin, size_t end) {
+        size_t local = 0;
+        for (size_t i = begin; i < end; ++i) {
+            resultCounts[i] = 0;
+            auto it = _colliders.find(queries[i].shape);
+            if (it == _colliders.end()) continue;
+
+            btCollisionObject probe;
+            probe.setCollisionShape(it->second);
+            btTransform t;
+            t.setIdentity();
+            t.setOrigin(btVector3(queries[i].position.x, queries[i].position.y, queries[i].position.z));
+            probe.setWorldTransform(t);
+
+            OverlapCallback callback(results + i * maxResultsPerQuery, (uint32_t)maxResultsPerQuery);
+            _world->contactTest(&probe, callback);
+            resultCounts[i] = callback.count;
+            local += (callback.count > 0);
+        }
+        numHits += local;
+    });
+    return numHits;
+}
+
 void PhysicsServer::SetGravity(const glm::vec3& acc) {
     _world->setGravity(btVector3(acc.x, acc.y, acc.z));
 }
@@ -1,5 +1,6 @@
 #include "physics_server_2d.hpp"
 #include "batch_renderer_2d.hpp"
+#include "box2d_task_scheduler.hpp"
 #include "console.hpp"
 #include "game_object.hpp"
 #include "renderer.hpp"
@@ -49,6 +50,7 @@ Physics2DServer::~Physics2DServer() {
     if (b2World_IsValid(_worldId)) {
         b2DestroyWorld(_worldId);
     }
+    _taskScheduler.reset();
     if (_instance == this) {
         _instance = nullptr;
     }
@@ -60,21 +62,22 @@ void Physics2DServer::Init(Application* app) {
     // Create Box2D world
     b2WorldDef worldDef = b2DefaultWorldDef();
     worldDef.gravity = { 0.0f, 9.8f };
+    _taskScheduler = std::make_unique<Box2DTaskScheduler>(*JobSystem::Get(), _workerCount);
+    if (_taskScheduler->GetWorkerCount() > 1) {
+        _taskScheduler->Configure(worldDef);
+    }
     _worldId = b2CreateWorld(&worldDef);
 
-    Console::Get()->Info("Physics2DServer initialized with Box2D v3");
+    Console::Get()->Info(
+      fmt::format("Physics2DServer initialized with Box2D v3 ({} workers)", _taskScheduler->GetWorkerCount())
+    );
 }
 
 void Physics2DServer::Process(float dt) {
     if (!b2World_IsValid(_worldId)) return;
 
-    _accumulator += dt;
-    if (_accumulator > 0.2f) _accumulator = 0.2f;// Prevent spiral of death
-
-    while (_accumulator >= _fixedTimeStep) {
-        b2World_Step(_worldId, _fixedTimeStep, _subSteps);
-        _accumulator -= _fixedTimeStep;
-    }
+    _lastStepCount = _clock.Advance(dt);
+    StepSimulation(_lastStepCount);
 
     // Process Contact Events
     b2ContactEvents contactEvents = b2World_GetContactEvents(_worldId);
@@ -103,15 +106,166 @@ void Physics2DServer::Process(float dt) {
         }
     }
 
-    // Sync transforms
+    SyncMovedBodies();
+}
+
+void Physics2DServer::StepSimulation(int steps, const std::function<void(int)>& beforeStep) {
+    if (steps <= 0) return;
+    std::swap(_moved, _movedLastFrame);
+    _moved.clear();
+    ++_frame;
+    for (int i = 0; i < steps; ++i) {
+        if (beforeStep) beforeStep(i);
+        b2World_Step(_worldId, _clock.step, _subSteps);
+        _taskScheduler->EndStep();
+        // Move events only cover the latest step
+        CollectMovedBodies();
+    }
+}
+
+static constexpr uint32_t SNAPSHOT_MAGIC = 0x32535041;// "APS2"
+static constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+void Physics2DServer::SaveSnapshot(PhysicsSnapshot& snapshot) const {
+    SnapshotWriter out(snapshot);
+    out.Write(SNAPSHOT_MAGIC);
+    out.Write(SNAPSHOT_VERSION);
+    out.Write(static_cast<uint32_t>(_rigidbodies.size()));
+    out.Write(_clock.accumulator);
+
     for (auto* rb : _rigidbodies) {
-        rb->SyncToTransform(dt);
+        b2BodyId id = rb->GetBodyId();
+        bool valid = b2Body_IsValid(id);
+        b2Transform t = valid ? b2Body_GetTransform(id) : b2Transform_identity;
+        b2Vec2 v = valid ? b2Body_GetLinearVelocity(id) : b2Vec2_zero;
+        float w = valid ? b2Body_GetAngularVelocity(id) : 0.0f;
+        uint8_t awake = valid && b2Body_IsAwake(id) ? 1 : 0;
+        out.Write(t.p.x);
+        out.Write(t.p.y);
+        out.Write(t.q.c);
+        out.Write(t.q.s);
+        out.Write(v.x);
+        out.Write(v.y);
+        out.Write(w);
+        out.Write(awake);
     }
 }
 
+bool Physics2DServer::LoadSnapshot(const PhysicsSnapshot& snapshot) {
+    SnapshotReader in(snapshot);
+    uint32_t magic = 0, version = 0, count = 0;
+    float accumulator = 0.0f;
+    if (!in.Read(magic) || magic != SNAPSHOT_MAGIC || !in.Read(version) || version != SNAPSHOT_VERSION) {
+        Console::Get()->Error("Physics2DServer: not a 2D physics snapshot");
+        return false;
+    }
+    if (!in.Read(count) || count != _rigidbodies.size()) {
+        Console::Get()->Error("Physics2DServer: snapshot body count does not match the world");
+        return false;
+    }
+
+    // Parse everything before touching the world, so a bad snapshot leaves
+    // it as it was
+    struct BodyState {
+        b2Transform transform;
+        b2Vec2 linearVelocity;
+        float angularVelocity = 0.0f;
+        uint8_t awake = 0;
+    };
+    std::vector<BodyState> states(count);
+    bool complete = in.Read(accumulator);
+    for (auto& state : states) {
+        if (!complete) break;
+        b2Transform& t = state.transform;
+        complete = in.Read(t.p.x) && in.Read(t.p.y) && in.Read(t.q.c) && in.Read(t.q.s)
+                   && in.Read(state.linearVelocity.x) && in.Read(state.linearVelocity.y)
+                   && in.Read(state.angularVelocity) && in.Read(state.awake);
+    }
+    if (!complete || !in.AtEnd()) {
+        Console::Get()->Error("Physics2DServer: truncated 2D physics snapshot");
+        return false;
+    }
+
+    // Disabling a body destroys its contacts, so warm starting from the
+    // pre-rollback contacts can't leak into the restored state; the next
+    // step rebuilds them, like the 3D server's dropped manifolds
+    std::vector<b2BodyId> enabled;
+    enabled.reserve(_rigidbodies.size());
+    for (auto* rb : _rigidbodies) {
+        b2BodyId id = rb->GetBodyId();
+        if (!b2Body_IsValid(id) || !b2Body_IsEnabled(id)) continue;
+        b2Body_Disable(id);
+        enabled.push_back(id);
+    }
+    for (b2BodyId id : enabled)
+        b2Body_Enable(id);
+
+    for (size_t i = 0; i < states.size(); ++i) {
+        const BodyState& state = states[i];
+        Rigidbody2DComponent* rb = _rigidbodies[i];
+        b2BodyId id = rb->GetBodyId();
+        if (!b2Body_IsValid(id)) continue;
+        b2Body_SetTransform(id, state.transform.p, state.transform.q);
+        b2Body_SetLinearVelocity(id, state.linearVelocity);
+        b2Body_SetAngularVelocity(id, state.angularVelocity);
+        // Velocity setters may wake the body, so restore the flag last
+        b2Body_SetAwake(id, state.awake != 0);
+        // Teleport: no interpolation from the pre-rollback pose
+        rb->_currTransform = state.transform;
+        rb->_prevTransform = state.transform;
+        rb->SyncToTransform(1.0f);
+    }
+
+    _clock.accumulator = accumulator;
+    return true;
+}
+
+uint64_t Physics2DServer::ComputeStateHash() const {
+    PhysicsSnapshot snapshot;
+    SaveSnapshot(snapshot);
+    return HashSnapshot(snapshot);
+}
+
+bool Physics2DServer::Resimulate(
+  const PhysicsSnapshot& snapshot, int steps, const std::function<void(int)>& applyInput
+) {
+    if (!LoadSnapshot(snapshot)) return false;
+    StepSimulation(steps, applyInput);
+    return true;
+}
+
+void Physics2DServer::CollectMovedBodies() {
+    b2BodyEvents events = b2World_GetBodyEvents(_worldId);
+    for (int i = 0; i < events.moveCount; ++i) {
+        const b2BodyMoveEvent& event = events.moveEvents[i];
+        auto* rb = static_cast<Rigidbody2DComponent*>(event.userData);
+        if (!rb) continue;
+        rb->OnStepTransform(event.transform);
+        if (rb->_lastMovedFrame != _frame) {
+            rb->_lastMovedFrame = _frame;
+            _moved.push_back(rb);
+        }
+    }
+}
+
+void Physics2DServer::SyncMovedBodies() {
+    float alpha = _clock.GetAlpha();
+    for (auto* rb : _moved) {
+        rb->SyncToTransform(alpha);
+    }
+    // Bodies that stopped (or fell asleep) last frame get one final snap
+    for (auto* rb : _movedLastFrame) {
+        if (rb->_lastMovedFrame == _frame) continue;
+        rb->_prevTransform = rb->_currTransform;
+        rb->SyncToTransform(1.0f);
+    }
+    _movedLastFrame.clear();
+}
+
 void Physics2DServer::DrawImGui(float dt) {
     if (ImGui::CollapsingHeader("Physics 2D")) {
         ImGui::Text("Bodies: %d", (int)_rigidbodies.size());
+        ImGui::Text("Workers: %d", GetWorkerCount());
         ImGui::Checkbox("Debug Draw", &_debugDrawEnabled);
 
         glm::vec2 gravity = GetGravity();
@@ -120,9 +274,15 @@ void Physics2DServer::DrawImGui(float dt) {
         }
 
         ImGui::SliderInt("Sub Steps", &_subSteps, 0, 10);
+        ImGui::SliderInt("Max Steps / Frame", &_clock.maxSubSteps, 1, 10);
+        ImGui::Text("Steps this frame: %d (alpha %.2f)", _lastStepCount, _clock.GetAlpha());
     }
 }
 
+int Physics2DServer::GetWorkerCount() const {
+    return _taskScheduler ? _taskScheduler->GetWorkerCount() : 1;
+}
+
 void Physics2DServer::SetGravity(const glm::vec2& gravity) {
     if (b2World_IsValid(_worldId)) {
         b2World_SetGravity(_worldId, { gravity.x, gravity.y });
@@ -161,6 +321,8 @@ void Physics2DServer::UnregisterRigidbody2D(Rigidbody2DComponent* rb) {
     auto it = std::find(_rigidbodies.begin(), _rigidbodies.end(), rb);
     if (it != _rigidbodies.end()) {
         _rigidbodies.erase(it);
+        std::erase(_moved, rb);
+        std::erase(_movedLastFrame, rb);
     }
 }
 
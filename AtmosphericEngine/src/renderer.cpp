@@ -577,7 +577,7 @@ void ShadowPass::Execute(GraphicsServer* ctx, Renderer& renderer, CommandEncoder
             for (const auto& inst : instances) {
                 depthShader->SetUniform(std::string("World"), inst.modelMatrix);
                 glDrawElements(
-                  mesh->GetMaterial()->primitiveType, mesh->triCount * 3, GL_UNSIGNED_SHORT, 0
+                  mesh->GetMaterial()->primitiveType, mesh->triCount * 3, mesh->GetIndexType(), 0
                 );
             }
 #else
@@ -587,7 +587,7 @@ void ShadowPass::Execute(GraphicsServer* ctx, Renderer& renderer, CommandEncoder
 
             // Instanced Draw
             glDrawElementsInstanced(
-              mesh->GetMaterial()->primitiveType, mesh->triCount * 3, GL_UNSIGNED_SHORT, 0, instances.size()
+              mesh->GetMaterial()->primitiveType, mesh->triCount * 3, mesh->GetIndexType(), 0, instances.size()
             );
 #endif
         }
@@ -644,7 +644,7 @@ void ShadowPass::Execute(GraphicsServer* ctx, Renderer& renderer, CommandEncoder
                     for (const auto& inst : instances) {
                         depthCubemapShader->SetUniform(std::string("World"), inst.modelMatrix);
                         glDrawElements(
-                          mesh->GetMaterial()->primitiveType, mesh->triCount * 3, GL_UNSIGNED_SHORT, 0
+                          mesh->GetMaterial()->primitiveType, mesh->triCount * 3, mesh->GetIndexType(), 0
                         );
                     }
 #else
@@ -656,7 +656,7 @@ void ShadowPass::Execute(GraphicsServer* ctx, Renderer& renderer, CommandEncoder
 
                     // Instanced Draw
                     glDrawElementsInstanced(
-                      mesh->GetMaterial()->primitiveType, mesh->triCount * 3, GL_UNSIGNED_SHORT, 0, instances.size()
+                      mesh->GetMaterial()->primitiveType, mesh->triCount * 3, mesh->GetIndexType(), 0, instances.size()
                     );
 #endif
                 }
@@ -899,7 +899,7 @@ void ForwardOpaquePass::Execute(GraphicsServer* ctx, Renderer& renderer, Command
             for (const auto& inst : instances) {
                 colorShader->SetUniform(std::string("World"), inst.modelMatrix);
                 glDrawElements(
-                  mesh->GetMaterial()->primitiveType, mesh->triCount * 3, GL_UNSIGNED_SHORT, 0
+                  mesh->GetMaterial()->primitiveType, mesh->triCount * 3, mesh->GetIndexType(), 0
                 );
             }
 #else
@@ -909,7 +909,7 @@ void ForwardOpaquePass::Execute(GraphicsServer* ctx, Renderer& renderer, Command
                   GL_ARRAY_BUFFER, instances.size() * sizeof(InstanceData), instances.data(), GL_DYNAMIC_DRAW
                 );
                 glDrawElementsInstanced(
-                  mesh->GetMaterial()->primitiveType, mesh->triCount * 3, GL_UNSIGNED_SHORT, 0, instances.size()
+                  mesh->GetMaterial()->primitiveType, mesh->triCount * 3, mesh->GetIndexType(), 0, instances.size()
                 );
             }
 #endif
@@ -1060,7 +1060,7 @@ void DeferredGeometryPass::Execute(GraphicsServer* ctx, Renderer& renderer, Comm
                   GL_ARRAY_BUFFER, instances.size() * sizeof(InstanceData), instances.data(), GL_DYNAMIC_DRAW
                 );
                 glDrawElementsInstanced(
-                  mesh->GetMaterial()->primitiveType, mesh->triCount * 3, GL_UNSIGNED_SHORT, 0, instances.size()
+                  mesh->GetMaterial()->primitiveType, mesh->triCount * 3, mesh->GetIndexType(), 0, instances.size()
                 );
             }
             glBindVertexArray(0);
@@ -1184,20 +1184,20 @@ void WorldCanvasPass::Execute(GraphicsServer* ctx, Renderer& renderer, CommandEn
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 #endif
 
-    // Sort by layer first, then by distance (back to front for transparency)
+    // Sort by layer first, then by distance (back to front for transparency).
+    // Key: [9 bits layer][23 bits inverted squared distance]
     glm::vec3 camPos = camera->GetEyePosition();
-    std::sort(worldDrawables.begin(), worldDrawables.end(), [&camPos](CanvasDrawable* a, CanvasDrawable* b) {
-        if (a->GetLayer() != b->GetLayer()) {
-            return a->GetLayer() < b->GetLayer();
-        }
-        float distA = glm::length(a->gameObject->GetPosition() - camPos);
-        float distB = glm::length(b->gameObject->GetPosition() - camPos);
-        return distA > distB;// Back to front
-    });
+    _keys.resize(worldDrawables.size());
+    for (size_t i = 0; i < worldDrawables.size(); ++i) {
+        glm::vec3 d = worldDrawables[i]->gameObject->GetPosition() - camPos;
+        uint32_t far = 0x7FFFFFu - QuantizeDepth(glm::dot(d, d), 23);
+        _keys[i] = (static_cast<uint32_t>(worldDrawables[i]->GetLayer()) << 23) | far;
+    }
+    const auto& order = _sorter.Sort(_keys.data(), static_cast<uint32_t>(_keys.size()));
 
     renderer.GetBatchRenderer()->BeginBatch(viewProj);
-    for (auto* drawable : worldDrawables) {
-        drawable->Draw(renderer.GetBatchRenderer());
+    for (uint32_t i : order) {
+        worldDrawables[i]->Draw(renderer.GetBatchRenderer());
     }
     renderer.GetBatchRenderer()->EndBatch();
 
@@ -1213,23 +1213,26 @@ void WorldCanvasPass::Execute(GraphicsServer* ctx, Renderer& renderer, CommandEn
 void CanvasPass::Execute(GraphicsServer* ctx, Renderer& renderer, CommandEncoder* enc) {
     ZoneScopedN("CanvasPass");
 
-    std::vector<CanvasDrawable*> drawables2D;
+    _drawables.clear();
     for (auto* drawable : ctx->canvasDrawables) {
         if (!drawable->gameObject->isActive) continue;
         if (drawable->GetLayer() < CanvasLayer::LAYER_UI_BACK) {
-            drawables2D.push_back(drawable);
+            _drawables.push_back(drawable);
         }
     }
 
-    // Sort 2D drawables by layer first, then by z-order
-    std::sort(drawables2D.begin(), drawables2D.end(), [](CanvasDrawable* a, CanvasDrawable* b) {
-        if (a->GetLayer() != b->GetLayer()) {
-            return a->GetLayer() < b->GetLayer();
-        }
-        return a->GetZOrder() < b->GetZOrder();
-    });
+    // Sort 2D drawables by layer first, then by z-order.
+    // Key: [16 bits layer][16 bits biased z-order]
+    _keys.resize(_drawables.size());
+    for (size_t i = 0; i < _drawables.size(); ++i) {
+        uint32_t z = static_cast<uint32_t>(std::clamp(_drawables[i]->GetZOrder() + 0x8000, 0, 0xFFFF));
+        _keys[i] = (static_cast<uint32_t>(_drawables[i]->GetLayer()) << 16) | z;
+    }
+    const auto& order = _sorter.Sort(_keys.data(), static_cast<uint32_t>(_keys.size()));
+    _sorted.resize(order.size());
+    for (size_t i = 0; i < order.size(); ++i) _sorted[i] = _drawables[order[i]];
 
-    if (drawables2D.empty() && renderer.GetCanvasQueue().empty()) return;
+    if (_sorted.empty() && renderer.GetCanvasQueue().empty()) return;
 
     auto [width, height] = Window::Get()->GetFramebufferSize();
     glViewport(0, 0, width, height);
@@ -1257,7 +1260,7 @@ void CanvasPass::Execute(GraphicsServer* ctx, Renderer& renderer, CommandEncoder
     }
 
     renderer.GetBatchRenderer()->BeginBatch(worldViewProj);
-    for (auto drawable : drawables2D) {
+    for (auto drawable : _sorted) {
         if (!drawable->gameObject->isActive) continue;
         drawable->Draw(renderer.GetBatchRenderer());
     }
@@ -72,6 +72,8 @@ void Rigidbody2DComponent::CreateBody() {
 
     if (b2Body_IsValid(_bodyId)) {
         CreateShape();
+        StoreCurrentTransform();
+        StorePreviousTransform();
     }
 }
 
@@ -126,19 +128,27 @@ void Rigidbody2DComponent::DestroyBody() {
     }
 }
 
-void Rigidbody2DComponent::SyncToTransform(float dt) {
+void Rigidbody2DComponent::StorePreviousTransform() {
+    if (b2Body_IsValid(_bodyId)) _prevTransform = b2Body_GetTransform(_bodyId);
+}
+
+void Rigidbody2DComponent::StoreCurrentTransform() {
+    if (b2Body_IsValid(_bodyId)) _currTransform = b2Body_GetTransform(_bodyId);
+}
+
+void Rigidbody2DComponent::SyncToTransform(float alpha) {
     if (!b2Body_IsValid(_bodyId) || !gameObject) return;
 
     // Sync Box2D body position/rotation to GameObject transform
     auto* transform = gameObject->GetComponent<TransformComponent>();
     if (transform) {
-        b2Vec2 pos = b2Body_GetPosition(_bodyId);
+        b2Vec2 pos = b2Lerp(_prevTransform.p, _currTransform.p, alpha);
         glm::vec2 posPixels = Physics2DServer::MetersToPixels(glm::vec2(pos.x, pos.y));
 
         glm::vec3 newPos(posPixels.x, posPixels.y, transform->GetPosition().z);
         transform->SetPosition(newPos);
 
-        b2Rot rotation = b2Body_GetRotation(_bodyId);
+        b2Rot rotation = b2NLerp(_prevTransform.q, _currTransform.q, alpha);
         float angle = b2Rot_GetAngle(rotation);
 
         glm::vec3 rot = transform->GetRotation();
@@ -160,6 +170,10 @@ void Rigidbody2DComponent::SetPosition(const glm::vec2& position) {
         glm::vec2 posM = Physics2DServer::PixelsToMeters(position);
         b2Rot rot = b2Body_GetRotation(_bodyId);
         b2Body_SetTransform(_bodyId, { posM.x, posM.y }, rot);
+        StoreCurrentTransform();
+        StorePreviousTransform();
+        // A sleeping body reports no move event, so push the teleport now
+        SyncToTransform(1.0f);
     }
 }
 
@@ -175,6 +189,9 @@ void Rigidbody2DComponent::SetAngle(float angle) {
     if (b2Body_IsValid(_bodyId)) {
         b2Vec2 pos = b2Body_GetPosition(_bodyId);
         b2Body_SetTransform(_bodyId, pos, b2MakeRot(angle));
+        StoreCurrentTransform();
+        StorePreviousTransform();
+        SyncToTransform(1.0f);
     }
 }
 
@@ -2,6 +2,7 @@
 #include "application.hpp"
 #include "bullet_linear_math.hpp"
 #include "game_object.hpp"
+#include "physics_server.hpp"
 
 static glm::mat4 convertToGLMatrix(const btTransform& trans) {
     btScalar mat[16] = { 0.0f };
@@ -27,6 +28,21 @@ static glm::mat4 convertToGLMatrix(const btTransform& trans) {
     );
 }
 
+// Bullet only synchronizes motion states of active bodies, so this callback
+// fires exactly for the bodies that moved in a step; sleeping bodies cost nothing.
+class RigidbodyMotionState : public btDefaultMotionState {
+public:
+    RigidbodyMotionState(RigidbodyComponent* owner, const btTransform& t) : btDefaultMotionState(t), _owner(owner) {}
+
+    void setWorldTransform(const btTransform& t) override {
+        btDefaultMotionState::setWorldTransform(t);
+        _owner->OnStepTransform(t);
+    }
+
+private:
+    RigidbodyComponent* _owner;
+};
+
 RigidbodyComponent::RigidbodyComponent(
   GameObject* gameObject, btCollisionShape* shape, float mass, glm::vec3 linearFactor, glm::vec3 angularFactor
 ) {
@@ -38,7 +54,7 @@ RigidbodyComponent::RigidbodyComponent(
     t.setOrigin(btVector3(position.x, position.y, position.z));
     t.setRotation(btQuaternion(rotation.x, rotation.y, rotation.z, 1.0f));
 
-    auto motionState = new btDefaultMotionState(t);
+    auto motionState = new RigidbodyMotionState(this, t);
     _rigidbody = new btRigidBody(btScalar(mass), motionState, shape, btVector3(1, 1, 1));
     _rigidbody->setLinearFactor(btVector3(linearFactor.x, linearFactor.y, linearFactor.z));
     _rigidbody->setAngularFactor(btVector3(angularFactor.x, angularFactor.y, angularFactor.z));
@@ -48,6 +64,8 @@ RigidbodyComponent::RigidbodyComponent(
     // _rigidbody->setCollisionFlags(_rigidbody->getCollisionFlags() |
     //     btCollisionObject::CF_NO_CONTACT_RESPONSE);
     _rigidbody->setUserPointer(gameObject);
+    StoreCurrentTransform();
+    StorePreviousTransform();
 };
 
 RigidbodyComponent::RigidbodyComponent(GameObject* gameObject, const RigidbodyProps& props) {
@@ -59,7 +77,7 @@ RigidbodyComponent::RigidbodyComponent(GameObject* gameObject, const RigidbodyPr
     t.setOrigin(btVector3(position.x, position.y, position.z));
     t.setRotation(btQuaternion(rotation.x, rotation.y, rotation.z, 1.0f));
 
-    auto motionState = new btDefaultMotionState(t);
+    auto motionState = new RigidbodyMotionState(this, t);
     _rigidbody = new btRigidBody(btScalar(props.mass), motionState, props.shape, btVector3(1, 1, 1));
     _rigidbody->setLinearFactor(btVector3(props.linearFactor.x, props.linearFactor.y, props.linearFactor.z));
     _rigidbody->setAngularFactor(btVector3(props.angularFactor.x, props.angularFactor.y, props.angularFactor.z));
@@ -78,6 +96,8 @@ RigidbodyComponent::RigidbodyComponent(GameObject* gameObject, const RigidbodyPr
     // _rigidbody->setCollisionFlags(_rigidbody->getCollisionFlags() |
     //     btCollisionObject::CF_NO_CONTACT_RESPONSE);
     _rigidbody->setUserPointer(gameObject);
+    StoreCurrentTransform();
+    StorePreviousTransform();
 }
 
 RigidbodyComponent::~RigidbodyComponent(){
@@ -122,6 +142,42 @@ void RigidbodyComponent::SetWorldTransform(const glm::vec3& position, const glm:
     t.setRotation(btQuaternion(rotation.x, rotation.y, rotation.z, 1.0f));
     _rigidbody->setWorldTransform(t);
     _rigidbody->getMotionState()->setWorldTransform(t);
+    // Teleport: don't interpolate from the old position
+    StoreCurrentTransform();
+    StorePreviousTransform();
+}
+
+void RigidbodyComponent::OnStepTransform(const btTransform& t) {
+    const btVector3& p = t.getOrigin();
+    const btQuaternion q = t.getRotation();
+    _prevPosition = _currPosition;
+    _prevRotation = _currRotation;
+    _currPosition = glm::vec3(p.x(), p.y(), p.z());
+    _currRotation = glm::quat(q.w(), q.x(), q.y(), q.z());
+
+    if (auto* physics = PhysicsServer::Get()) physics->MarkMoved(this);
+}
+
+void RigidbodyComponent::StorePreviousTransform() {
+    const btTransform& t = _rigidbody->getWorldTransform();
+    const btVector3& p = t.getOrigin();
+    const btQuaternion q = t.getRotation();
+    _prevPosition = glm::vec3(p.x(), p.y(), p.z());
+    _prevRotation = glm::quat(q.w(), q.x(), q.y(), q.z());
+}
+
+void RigidbodyComponent::StoreCurrentTransform() {
+    const btTransform& t = _rigidbody->getWorldTransform();
+    const btVector3& p = t.getOrigin();
+    const btQuaternion q = t.getRotation();
+    _currPosition = glm::vec3(p.x(), p.y(), p.z());
+    _currRotation = glm::quat(q.w(), q.x(), q.y(), q.z());
+}
+
+glm::mat4 RigidbodyComponent::GetInterpolatedTransform(float alpha) const {
+    glm::vec3 position = glm::mix(_prevPosition, _currPosition, alpha);
+    glm::quat rotation = glm::slerp(_prevRotation, _currRotation, alpha);
+    return glm::translate(glm::mat4(1.0f), position) * glm::mat4_cast(rotation);
 }
 
 void RigidbodyComponent::WakeUp() {
@@ -0,0 +1,67 @@
+#include "scene_arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+void SceneArena::AddBlock(size_t minSize) {
+    Block block;
+    block.size = std::max(DEFAULT_BLOCK_SIZE, minSize);
+    block.data.reset(new std::byte[block.size]);
+    _blocks.push_back(std::move(block));
+    _offset = 0;
+    ++_blockAllocations;
+}
+
+void SceneArena::Reserve(size_t bytes) {
+    if (_blocks.empty() || _blocks.back().size - _offset < bytes) AddBlock(bytes);
+}
+
+void* SceneArena::Allocate(size_t size, size_t alignment) {
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        if (!_blocks.empty()) {
+            const Block& block = _blocks.back();
+            auto base = reinterpret_cast<uintptr_t>(block.data.get());
+            uintptr_t start = (base + _offset + alignment - 1) & ~uintptr_t(alignment - 1);
+            if (start + size <= base + block.size) {
+                _bytesUsed += start + size - (base + _offset);
+                _offset = start + size - base;
+                return reinterpret_cast<void*>(start);
+            }
+        }
+        AddBlock(size + alignment - 1);
+    }
+    throw std::bad_alloc();// unreachable: the new block always fits
+}
+
+std::string_view SceneArena::CopyString(std::string_view text) {
+    if (text.empty()) return {};
+    auto* chars = static_cast<char*>(Allocate(text.size(), 1));
+    std::memcpy(chars, text.data(), text.size());
+    return { chars, text.size() };
+}
+
+void SceneArena::Release() {
+    for (Finalizer* node = _finalizers; node; node = node->next) node->destroy(node->object);
+    _finalizers = nullptr;
+
+    if (_blocks.size() > 1) {
+        auto largest = std::max_element(_blocks.begin(), _blocks.end(), [](const Block& a, const Block& b) {
+            return a.size < b.size;
+        });
+        std::swap(_blocks.front(), *largest);
+        _blocks.resize(1);
+    }
+    _offset = 0;
+    _bytesUsed = 0;
+}
+
+bool SceneArena::Owns(const void* p) const {
+    auto address = reinterpret_cast<uintptr_t>(p);
+    for (size_t i = 0; i < _blocks.size(); ++i) {
+        auto base = reinterpret_cast<uintptr_t>(_blocks[i].data.get());
+        size_t used = i + 1 == _blocks.size() ? _offset : _blocks[i].size;
+        if (address >= base && address < base + used) return true;
+    }
+    return false;
+}
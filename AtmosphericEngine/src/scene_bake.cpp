@@ -0,0 +1,410 @@
+// scene_bake.cpp — everything that knows the BakedScene schema.  Baking packs
+// what ReadSceneJSON (scene_props.cpp) read, the same reader the runtime's
+// JSON path uses, and ReadBakedScene unpacks it again, so a baked scene
+// instantiates exactly what its JSON would.
+#include "scene_bake.hpp"
+
+#include "BakedScene_generated.h"
+#include "content_hash.hpp"
+#include "scene_props.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+static_assert(int(baked::Easing_BounceInOut) == int(EasingType::BounceInOut), "baked::Easing must mirror EasingType");
+static_assert(int(baked::LightType_Area) == int(LightType::Area), "baked::LightType must mirror LightType");
+static_assert(int(baked::HAlign_Right) == int(TextHAlignment::Right), "baked::HAlign must mirror TextHAlignment");
+static_assert(int(baked::VAlign_Bottom) == int(TextVAlignment::Bottom), "baked::VAlign must mirror TextVAlignment");
+static_assert(
+  int(baked::CanvasLayer_LAYER_WORLD_2D) == int(CanvasLayer::LAYER_WORLD_2D) &&
+    int(baked::CanvasLayer_LAYER_OVERLAY) == int(CanvasLayer::LAYER_OVERLAY),
+  "baked::CanvasLayer must mirror CanvasLayer"
+);
+static_assert(
+  int(baked::ActionType_RepeatForever) == int(SceneActionType::RepeatForever), "baked::ActionType must mirror SceneActionType"
+);
+
+namespace {
+    baked::Vec2 ToBaked(const glm::vec2& v) {
+        return baked::Vec2(v.x, v.y);
+    }
+
+    baked::Vec3 ToBaked(const glm::vec3& v) {
+        return baked::Vec3(v.x, v.y, v.z);
+    }
+
+    baked::Vec4 ToBaked(const glm::vec4& v) {
+        return baked::Vec4(v.x, v.y, v.z, v.w);
+    }
+
+    class Baker {
+    public:
+        Baker() {
+            Intern("");
+        }
+
+        std::vector<uint8_t> Bake(const SceneProps& scene, uint64_t sourceHash) {
+            uint32_t name = Intern(scene.name);
+
+            std::vector<uint32_t> textures;
+            for (const auto& texture : scene.textures) textures.push_back(Intern(texture));
+
+            std::vector<flatbuffers::Offset<baked::Shader>> shaders;
+            for (const auto& [shaderName, props] : scene.shaders) {
+                shaders.push_back(baked::CreateShader(
+                  _fbb, Intern(shaderName), Intern(props.vert), Intern(props.frag), Intern(props.tesc.value_or("")),
+                  Intern(props.tese.value_or(""))
+                ));
+            }
+
+            for (const auto& entity : scene.entities) BakeEntity(entity);
+
+            // Strings last: by now every one has been interned
+            std::vector<flatbuffers::Offset<flatbuffers::String>> strings;
+            strings.reserve(_strings.size());
+            for (const std::string& s : _strings) strings.push_back(_fbb.CreateString(s));
+
+            auto root = baked::CreateBakedScene(
+              _fbb, name, _fbb.CreateVector(strings), _fbb.CreateVector(textures), _fbb.CreateVector(shaders),
+              _fbb.CreateVector(_entities), _fbb.CreateVector(_actions), sourceHash
+            );
+            baked::FinishBakedSceneBuffer(_fbb, root);
+            return std::vector<uint8_t>(_fbb.GetBufferPointer(), _fbb.GetBufferPointer() + _fbb.GetSize());
+        }
+
+    private:
+        uint32_t Intern(const std::string& s) {
+            auto [it, inserted] = _stringIds.try_emplace(s, static_cast<uint32_t>(_strings.size()));
+            if (inserted) _strings.push_back(s);
+            return it->second;
+        }
+
+        // SceneProps is already pre-order with parents first, as the schema wants
+        void BakeEntity(const SceneEntityProps& entity) {
+            std::vector<uint8_t> types;
+            std::vector<flatbuffers::Offset<void>> components;
+            for (const auto& component : entity.components) {
+                baked::Component type = baked::Component_NONE;
+                flatbuffers::Offset<void> offset = BakeComponent(component, type);
+                types.push_back(type);
+                components.push_back(offset);
+            }
+
+            baked::Vec3 position = ToBaked(entity.position), rotation = ToBaked(entity.rotation), scale = ToBaked(entity.scale);
+            _entities.push_back(baked::CreateEntity(
+              _fbb, Intern(entity.name), entity.parent, entity.active, &position, &rotation, &scale, _fbb.CreateVector(types),
+              _fbb.CreateVector(components)
+            ));
+        }
+
+        flatbuffers::Offset<void> BakeComponent(const SceneComponentProps& component, baked::Component& type) {
+            if (const auto* sprite = std::get_if<SceneSpriteProps>(&component)) {
+                const SpriteProps& props = sprite->props;
+                baked::Vec2 size = ToBaked(props.size), pivot = ToBaked(props.pivot);
+                baked::Vec4 color = ToBaked(props.color);
+                type = baked::Component_Sprite;
+                return baked::CreateSprite(
+                         _fbb, &size, &pivot, &color, Intern(sprite->texture), static_cast<baked::CanvasLayer>(props.layer),
+                         props.flipX, props.flipY, props.zOrder
+                )
+                  .Union();
+            }
+            if (const auto* text = std::get_if<TextProps>(&component)) {
+                baked::Vec2 size = ToBaked(text->size), pivot = ToBaked(text->pivot);
+                baked::Vec4 color = ToBaked(text->color);
+                type = baked::Component_Text;
+                return baked::CreateText(
+                         _fbb, Intern(text->text), Intern(text->fontPath), text->fontSize, &size, &pivot, &color,
+                         static_cast<baked::HAlign>(text->hAlign), static_cast<baked::VAlign>(text->vAlign),
+                         static_cast<baked::CanvasLayer>(text->layer), text->zOrder
+                )
+                  .Union();
+            }
+            if (const auto* camera = std::get_if<CameraProps>(&component)) {
+                // Only the projection in use is meaningful; the other keeps
+                // the schema default
+                bool ortho = camera->isOrthographic;
+                baked::Vec3 eyeOffset = ToBaked(camera->eyeOffset);
+                type = baked::Component_Camera;
+                return baked::CreateCamera(
+                         _fbb, ortho, ortho ? 45.0f : camera->perspective.fieldOfView,
+                         ortho ? 1.333f : camera->perspective.aspectRatio, ortho ? camera->orthographic.width : 500.0f,
+                         ortho ? camera->orthographic.height : 500.0f,
+                         ortho ? camera->orthographic.nearClip : camera->perspective.nearClip,
+                         ortho ? camera->orthographic.farClip : camera->perspective.farClip, camera->verticalAngle,
+                         camera->horizontalAngle, &eyeOffset
+                )
+                  .Union();
+            }
+            if (const auto* light = std::get_if<LightProps>(&component)) {
+                baked::Vec3 ambient = ToBaked(light->ambient), diffuse = ToBaked(light->diffuse),
+                            specular = ToBaked(light->specular), direction = ToBaked(light->direction),
+                            attenuation = ToBaked(light->attenuation);
+                type = baked::Component_Light;
+                return baked::CreateLight(
+                         _fbb, static_cast<baked::LightType>(light->type), &ambient, &diffuse, &specular, &direction,
+                         &attenuation, light->intensity, light->castShadow
+                )
+                  .Union();
+            }
+            if (const auto* animator = std::get_if<SceneAnimatorProps>(&component)) {
+                std::vector<flatbuffers::Offset<baked::AnimationClip>> clips;
+                for (const auto& clip : animator->clips) {
+                    std::vector<baked::AnimationFrame> frames;
+                    for (const auto& frame : clip.frames) frames.emplace_back(frame.duration, ToBaked(frame.uvMin), ToBaked(frame.uvMax));
+                    clips.push_back(baked::CreateAnimationClip(_fbb, Intern(clip.name), clip.loop, _fbb.CreateVectorOfStructs(frames)));
+                }
+                type = baked::Component_Animator;
+                return baked::CreateAnimator(_fbb, _fbb.CreateVector(clips), Intern(animator->autoPlay)).Union();
+            }
+            const auto& actions = std::get<SceneActionsProps>(component);
+            std::vector<uint32_t> roots;
+            for (const auto& action : actions.actions) roots.push_back(BakeAction(action));
+            type = baked::Component_Actions;
+            return baked::CreateActions(_fbb, _fbb.CreateVector(roots)).Union();
+        }
+
+        // Children first, so each node's children sit below it in _actions
+        uint32_t BakeAction(const SceneActionProps& action) {
+            std::vector<uint32_t> children;
+            for (const auto& child : action.children) children.push_back(BakeAction(child));
+            baked::Vec4 value = ToBaked(action.value);
+            _actions.push_back(baked::CreateActionNode(
+              _fbb, static_cast<baked::ActionType>(action.type), action.duration, static_cast<baked::Easing>(action.easing),
+              &value, _fbb.CreateVector(children)
+            ));
+            return static_cast<uint32_t>(_actions.size() - 1);
+        }
+
+        flatbuffers::FlatBufferBuilder _fbb;
+        std::vector<std::string> _strings;
+        std::unordered_map<std::string, uint32_t> _stringIds;
+        std::vector<flatbuffers::Offset<baked::Entity>> _entities;
+        std::vector<flatbuffers::Offset<baked::ActionNode>> _actions;
+    };
+
+    glm::vec2 ToGlm(const baked::Vec2* v, const glm::vec2& defaultValue) {
+        return v ? glm::vec2(v->x(), v->y()) : defaultValue;
+    }
+
+    glm::vec3 ToGlm(const baked::Vec3* v, const glm::vec3& defaultValue) {
+        return v ? glm::vec3(v->x(), v->y(), v->z()) : defaultValue;
+    }
+
+    glm::vec4 ToGlm(const baked::Vec4* v, const glm::vec4& defaultValue) {
+        return v ? glm::vec4(v->x(), v->y(), v->z(), v->w()) : defaultValue;
+    }
+
+    // Interned string lookup; out-of-range ids read as "" (absent)
+    struct BakedStrings {
+        const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>* strings;
+
+        std::string operator()(uint32_t id) const {
+            return strings && id < strings->size() ? strings->Get(id)->str() : std::string();
+        }
+    };
+
+    // Children always precede their parent in the action array, so requiring
+    // child < index rules out cycles in a malformed file.  The nesting rules
+    // are ReadSceneJSON's, re-checked for the same reason.
+    bool ReadBakedAction(const baked::BakedScene* scene, uint32_t index, SceneActionProps& out) {
+        const auto* actions = scene->actions();
+        if (!actions || index >= actions->size()) return false;
+        const baked::ActionNode* node = actions->Get(index);
+        if (node->type() > baked::ActionType_MAX) return false;
+        out.type = static_cast<SceneActionType>(node->type());
+        out.duration = node->duration();
+        out.easing = static_cast<EasingType>(node->easing());
+        out.value = ToGlm(node->value(), glm::vec4(0.0f));
+
+        if (out.type != SceneActionType::Sequence && out.type != SceneActionType::RepeatForever) return true;
+        if (node->children()) {
+            for (uint32_t child : *node->children()) {
+                SceneActionProps step;
+                if (child >= index || !ReadBakedAction(scene, child, step)) continue;
+                if (step.type == SceneActionType::RepeatForever) continue;
+                out.children.push_back(std::move(step));
+            }
+        }
+        return out.type == SceneActionType::Sequence ? !out.children.empty() : out.children.size() == 1;
+    }
+
+    bool ReadBakedComponent(
+      const baked::BakedScene* scene, baked::Component type, const void* data, const BakedStrings& str, SceneComponentProps& out
+    ) {
+        switch (type) {
+            case baked::Component_Sprite: {
+                const auto* sprite = static_cast<const baked::Sprite*>(data);
+                SceneSpriteProps props;
+                props.props.size = ToGlm(sprite->size(), glm::vec2(100.0f, 100.0f));
+                props.props.pivot = ToGlm(sprite->pivot(), glm::vec2(0.5f, 0.5f));
+                props.props.color = ToGlm(sprite->color(), glm::vec4(1.0f));
+                props.props.layer = static_cast<CanvasLayer>(sprite->layer());
+                props.props.flipX = sprite->flipX();
+                props.props.flipY = sprite->flipY();
+                props.props.zOrder = sprite->zOrder();
+                props.texture = str(sprite->texture());
+                out = std::move(props);
+                return true;
+            }
+            case baked::Component_Text: {
+                const auto* text = static_cast<const baked::Text*>(data);
+                TextProps props;
+                props.text = str(text->text());
+                props.fontPath = str(text->fontPath());
+                props.fontSize = text->fontSize();
+                props.size = ToGlm(text->size(), glm::vec2(100.0f, 100.0f));
+                props.pivot = ToGlm(text->pivot(), glm::vec2(0.0f, 0.0f));
+                props.color = ToGlm(text->color(), glm::vec4(1.0f));
+                props.hAlign = static_cast<TextHAlignment>(text->hAlign());
+                props.vAlign = static_cast<TextVAlignment>(text->vAlign());
+                props.layer = static_cast<CanvasLayer>(text->layer());
+                props.zOrder = text->zOrder();
+                out = std::move(props);
+                return true;
+            }
+            case baked::Component_Camera: {
+                const auto* camera = static_cast<const baked::Camera*>(data);
+                CameraProps props;
+                props.isOrthographic = camera->orthographic();
+                if (props.isOrthographic) {
+                    props.orthographic.width = camera->width();
+                    props.orthographic.height = camera->height();
+                    props.orthographic.nearClip = camera->nearClip();
+                    props.orthographic.farClip = camera->farClip();
+                } else {
+                    props.perspective.fieldOfView = camera->fieldOfView();
+                    props.perspective.aspectRatio = camera->aspectRatio();
+                    props.perspective.nearClip = camera->nearClip();
+                    props.perspective.farClip = camera->farClip();
+                }
+                props.verticalAngle = camera->verticalAngle();
+                props.horizontalAngle = camera->horizontalAngle();
+                props.eyeOffset = ToGlm(camera->eyeOffset(), glm::vec3(0.0f));
+                out = props;
+                return true;
+            }
+            case baked::Component_Light: {
+                const auto* light = static_cast<const baked::Light*>(data);
+                LightProps props;
+                props.type = static_cast<LightType>(light->type());
+                props.ambient = ToGlm(light->ambient(), glm::vec3(0.1f));
+                props.diffuse = ToGlm(light->diffuse(), glm::vec3(1.0f));
+                props.specular = ToGlm(light->specular(), glm::vec3(1.0f));
+                props.direction = ToGlm(light->direction(), glm::vec3(0.0f, -1.0f, 0.0f));
+                props.attenuation = ToGlm(light->attenuation(), glm::vec3(1.0f, 0.0f, 0.0f));
+                props.intensity = light->intensity();
+                props.castShadow = light->castShadow();
+                out = props;
+                return true;
+            }
+            case baked::Component_Animator: {
+                const auto* animatorData = static_cast<const baked::Animator*>(data);
+                SceneAnimatorProps animator;
+                if (animatorData->animations()) {
+                    for (const auto* anim : *animatorData->animations()) {
+                        AnimationClip clip;
+                        clip.name = str(anim->name());
+                        clip.loop = anim->loop();
+                        if (anim->frames()) {
+                            clip.frames.reserve(anim->frames()->size());
+                            for (const auto* frameData : *anim->frames()) {
+                                AnimationFrame frame;
+                                frame.duration = frameData->duration();
+                                frame.uvMin = ToGlm(&frameData->uvMin(), glm::vec2(0.0f));
+                                frame.uvMax = ToGlm(&frameData->uvMax(), glm::vec2(1.0f));
+                                clip.frames.push_back(frame);
+                            }
+                        }
+                        animator.clips.push_back(std::move(clip));
+                    }
+                }
+                animator.autoPlay = str(animatorData->autoPlay());
+                out = std::move(animator);
+                return true;
+            }
+            case baked::Component_Actions: {
+                const auto* actionsData = static_cast<const baked::Actions*>(data);
+                SceneActionsProps actions;
+                if (actionsData->roots()) {
+                    for (uint32_t root : *actionsData->roots()) {
+                        SceneActionProps action;
+                        if (ReadBakedAction(scene, root, action)) actions.actions.push_back(std::move(action));
+                    }
+                }
+                out = std::move(actions);
+                return true;
+            }
+            default: return false;
+        }
+    }
+}// namespace
+
+bool BakeScene(std::string_view json, std::vector<uint8_t>& out, std::string* error) {
+    out.clear();
+    SceneProps scene;
+    if (!ReadSceneJSON(json, scene, error)) return false;
+    out = Baker().Bake(scene, HashSceneSource(json));
+    return true;
+}
+
+uint64_t HashSceneSource(std::string_view json) {
+    return HashContent({ reinterpret_cast<const uint8_t*>(json.data()), json.size() });
+}
+
+bool GetBakedSceneSourceHash(std::span<const uint8_t> bytes, uint64_t& sourceHash) {
+    flatbuffers::Verifier verifier(bytes.data(), bytes.size());
+    if (!baked::VerifyBakedSceneBuffer(verifier)) return false;
+    sourceHash = baked::GetBakedScene(bytes.data())->sourceHash();
+    return true;
+}
+
+bool ReadBakedScene(std::span<const uint8_t> bytes, SceneProps& out) {
+    out = {};
+    flatbuffers::Verifier verifier(bytes.data(), bytes.size());
+    if (!baked::VerifyBakedSceneBuffer(verifier)) return false;
+
+    const baked::BakedScene* scene = baked::GetBakedScene(bytes.data());
+    BakedStrings str{ scene->strings() };
+    out.name = str(scene->name());
+    out.sourceHash = scene->sourceHash();
+    if (scene->textures()) {
+        for (uint32_t id : *scene->textures()) out.textures.push_back(str(id));
+    }
+    if (scene->shaders()) {
+        for (const auto* shader : *scene->shaders()) {
+            ShaderProgramProps props;
+            props.vert = str(shader->vert());
+            props.frag = str(shader->frag());
+            if (shader->tesc()) props.tesc = str(shader->tesc());
+            if (shader->tese()) props.tese = str(shader->tese());
+            out.shaders[str(shader->name())] = props;
+        }
+    }
+    if (const auto* entities = scene->entities()) {
+        out.entities.reserve(entities->size());
+        for (const auto* entityData : *entities) {
+            SceneEntityProps entity;
+            entity.name = str(entityData->name());
+            int parent = entityData->parent();
+            entity.parent = parent >= 0 && static_cast<size_t>(parent) < out.entities.size() ? parent : -1;
+            entity.active = entityData->active();
+            entity.position = ToGlm(entityData->position(), glm::vec3(0.0f));
+            entity.rotation = ToGlm(entityData->rotation(), glm::vec3(0.0f));
+            entity.scale = ToGlm(entityData->scale(), glm::vec3(1.0f));
+
+            const auto* types = entityData->components_type();
+            const auto* components = entityData->components();
+            if (types && components) {
+                for (flatbuffers::uoffset_t i = 0; i < std::min(types->size(), components->size()); ++i) {
+                    SceneComponentProps component;
+                    if (ReadBakedComponent(scene, static_cast<baked::Component>(types->Get(i)), components->Get(i), str, component)) {
+                        entity.components.push_back(std::move(component));
+                    }
+                }
+            }
+            out.entities.push_back(std::move(entity));
+        }
+    }
+    return true;
+}
@@ -4,6 +4,7 @@
 #include "application.hpp"
 #include "asset_manager.hpp"
 #include "game_object.hpp"
+#include "scene_arena.hpp"
 #include "sprite_component.hpp"
 #include "text_component.hpp"
 
@@ -12,6 +13,7 @@
 #ifndef __EMSCRIPTEN__
 #include <SDL3/SDL_filesystem.h>
 #endif
+#include <algorithm>
 #include <fstream>
 #include <spdlog/spdlog.h>
 
@@ -27,6 +29,22 @@ static EasingType GetEasingType(int csbType) {
     return EasingType::Linear;
 }
 
+// Last entry with `key` in a table stable-sorted by key
+template<typename Table, typename Key> static GameObject* FindLast(const Table& table, const Key& key) {
+    auto it = std::upper_bound(table.begin(), table.end(), key, [](const Key& k, const auto& entry) {
+        return k < entry.first;
+    });
+    return it != table.begin() && std::prev(it)->first == key ? std::prev(it)->second : nullptr;
+}
+
+GameObject* SceneLoadResult::FindByActionTag(int actionTag) const {
+    return FindLast(nodesByActionTag, actionTag);
+}
+
+GameObject* SceneLoadResult::FindByName(std::string_view name) const {
+    return FindLast(nodesByName, name);
+}
+
 SceneLoader::SceneLoader(Application* app) : _app(app) {
 }
 
@@ -137,11 +155,17 @@ SceneLoadResult SceneLoader::LoadFromBuffer(const uint8_t* buffer, size_t size,
         }
     }
 
+    ReserveFor(csb, result);
+
     // Parse node tree
     if (csb->nodeTree()) {
         result.root = ParseNodeTree(csb->nodeTree(), config, result, nullptr);
         result.success = (result.root != nullptr);
 
+        auto byKey = [](const auto& a, const auto& b) { return a.first < b.first; };
+        std::stable_sort(result.nodesByActionTag.begin(), result.nodesByActionTag.end(), byKey);
+        std::stable_sort(result.nodesByName.begin(), result.nodesByName.end(), byKey);
+
         // Apply root position override if requested
         if (result.success && config.overrideRootPosition) {
             result.root->SetPosition(config.rootPosition);
@@ -159,7 +183,43 @@ SceneLoadResult SceneLoader::LoadFromBuffer(const uint8_t* buffer, size_t size,
     return result;
 }
 
-// ... existing ParseNodeTree ...
+void SceneLoader::ReserveFor(const flatbuffers::CSParseBinary* csb, SceneLoadResult& result) {
+    size_t nodes = 0, tagged = 0, named = 0, nameBytes = 0;
+    std::vector<const flatbuffers::NodeTree*> stack;
+    if (csb->nodeTree()) stack.push_back(csb->nodeTree());
+    while (!stack.empty()) {
+        const flatbuffers::NodeTree* nodeTree = stack.back();
+        stack.pop_back();
+        if (!nodeTree) continue;
+        ++nodes;
+        if (nodeTree->options() && nodeTree->options()->data()) {
+            const flatbuffers::WidgetOptions* options = nodeTree->options()->data();
+            if (options->actionTag() != 0) ++tagged;
+            if (options->name()) {
+                ++named;
+                nameBytes += options->name()->size();
+            }
+        }
+        if (nodeTree->children()) {
+            for (auto child : *nodeTree->children()) stack.push_back(child);
+        }
+    }
+    size_t timelines = csb->action() && csb->action()->timeLines() ? csb->action()->timeLines()->size() : 0;
+
+    // Every node is a GameObject plus at most one sprite or text component;
+    // timelines add at most one ActionManager each
+    constexpr size_t perNode = SceneArena::SizeFor<GameObject>()
+                             + std::max(SceneArena::SizeFor<SpriteComponent>(), SceneArena::SizeFor<TextComponent>());
+    _app->GetSceneArena().Reserve(nodes * perNode + nameBytes + timelines * SceneArena::SizeFor<ActionManager>());
+
+    result.allNodes.reserve(nodes);
+    result.nodesByActionTag.reserve(tagged);
+    result.nodesByName.reserve(named);
+}
+
+GameObject* SceneLoader::NewNode(glm::vec3 position, glm::vec3 rotation, glm::vec3 scale) {
+    return _app->CreateGameObject(_app->GetSceneArena(), position, rotation, scale);
+}
 
 void SceneLoader::ParseAnimations(
   const flatbuffers::NodeAction* actions, SceneLoadResult& result, const SceneLoadConfig& config
@@ -199,23 +259,20 @@ void SceneLoader::ParseAnimations(
           "SceneLoader: Processing timeline for ActionTag {} Property {}", actionTag, timeline->property()->c_str()
         );
 
-        auto it = result.nodesByActionTag.find(actionTag);
-        if (it == result.nodesByActionTag.end()) {
+        GameObject* target = result.FindByActionTag(actionTag);
+        if (!target) {
             spdlog::warn(
-              "SceneLoader: ActionTag {} not found in scene nodes (Map size: {}).",
+              "SceneLoader: ActionTag {} not found in scene nodes (Table size: {}).",
               actionTag,
               result.nodesByActionTag.size()
             );
             continue;
         }
 
-        GameObject* target = it->second;
-        if (!target) continue;
-
         // Ensure ActionManager exists
         ActionManager* actionManager = target->GetComponent<ActionManager>();
         if (!actionManager) {
-            actionManager = new ActionManager(target);
+            actionManager = _app->GetSceneArena().New<ActionManager>(target);
             target->AddComponent(actionManager);
             spdlog::debug("SceneLoader: Added ActionManager to node '{}'", target->GetName());
         }
@@ -403,7 +460,7 @@ GameObject* SceneLoader::ParseNodeTree(
 
             // Apply sprite component
             if (go) {
-                go->AddComponent<SpriteComponent>(props);
+                go->AddComponent(_app->GetSceneArena().New<SpriteComponent>(go, props));
             }
         }
     } else if (classname == "ImageView") {
@@ -428,12 +485,14 @@ GameObject* SceneLoader::ParseNodeTree(
             props.flipX = widgetOptions->flipX();
             props.flipY = widgetOptions->flipY();
             props.zOrder = widgetOptions->zOrder();
-            go->AddComponent<SpriteComponent>(props);
+            go->AddComponent(_app->GetSceneArena().New<SpriteComponent>(go, props));
         }
     } else if (classname == "Text") {
         go = CreateNode(widgetOptions, config);
         if (go) {
-            go->AddComponent<TextComponent>(CreateTextProps(nodeTree, widgetOptions, config));
+            go->AddComponent(
+              _app->GetSceneArena().New<TextComponent>(go, CreateTextProps(nodeTree, widgetOptions, config))
+            );
             spdlog::debug(
               "SceneLoader: Created Text node '{}'",
               widgetOptions && widgetOptions->name() ? widgetOptions->name()->c_str() : "Text"
@@ -466,10 +525,11 @@ GameObject* SceneLoader::ParseNodeTree(
     result.allNodes.push_back(go);
     if (widgetOptions) {
         if (widgetOptions->actionTag() != 0) {
-            result.nodesByActionTag[widgetOptions->actionTag()] = go;
+            result.nodesByActionTag.emplace_back(widgetOptions->actionTag(), go);
         }
         if (widgetOptions->name()) {
-            result.nodesByName[widgetOptions->name()->c_str()] = go;
+            std::string_view name(widgetOptions->name()->c_str(), widgetOptions->name()->size());
+            result.nodesByName.emplace_back(_app->GetSceneArena().CopyString(name), go);
         }
     }
 
@@ -502,11 +562,11 @@ GameObject* SceneLoader::CreateNode(const flatbuffers::WidgetOptions* options, c
         }
     }
 
-    return _app->CreateGameObject(position, rotation, scale);
+    return NewNode(position, rotation, scale);
 }
 
 GameObject* SceneLoader::CreateSprite(const flatbuffers::SpriteOptions* options, const SceneLoadConfig& config) {
-    auto go = _app->CreateGameObject();
+    auto go = NewNode(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
     if (!go || !options) return go;
 
     SpriteProps props;
@@ -541,13 +601,13 @@ GameObject* SceneLoader::CreateSprite(const flatbuffers::SpriteOptions* options,
     }
 
     props.layer = config.defaultLayer;
-    go->AddComponent<SpriteComponent>(props);
+    go->AddComponent(_app->GetSceneArena().New<SpriteComponent>(go, props));
 
     return go;
 }
 
 GameObject* SceneLoader::CreateImageView(const flatbuffers::ImageViewOptions* options, const SceneLoadConfig& config) {
-    auto go = _app->CreateGameObject();
+    auto go = NewNode(glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f));
     if (!go || !options) return go;
 
     SpriteProps props;
@@ -581,7 +641,7 @@ GameObject* SceneLoader::CreateImageView(const flatbuffers::ImageViewOptions* op
     }
 
     props.layer = config.defaultLayer;
-    go->AddComponent<SpriteComponent>(props);
+    go->AddComponent(_app->GetSceneArena().New<SpriteComponent>(go, props));
 
     return go;
 }
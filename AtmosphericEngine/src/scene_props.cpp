@@ -0,0 +1,343 @@
+// scene_props.cpp — the JSON scene reader.  Every rule the JSON loader has
+// (defaults, enum names, degrees → radians, which actions may nest) lives
+// here; baking goes through it too (scene_bake.cpp), so a baked scene only
+// stores what this decided.
+#include "scene_props.hpp"
+
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+namespace {
+    using json = nlohmann::json;
+
+    // An empty or missing array gives the default, a short one keeps the
+    // default's tail
+    glm::vec2 ParseVec2(const json& val, const glm::vec2& defaultValue) {
+        if (val.is_array() && !val.empty()) {
+            float x = val[0].get<float>();
+            float y = val.size() >= 2 ? val[1].get<float>() : defaultValue.y;
+            return glm::vec2(x, y);
+        }
+        return defaultValue;
+    }
+
+    glm::vec3 ParseVec3(const json& val, const glm::vec3& defaultValue) {
+        if (val.is_array() && !val.empty()) {
+            float x = val[0].get<float>();
+            float y = val.size() >= 2 ? val[1].get<float>() : defaultValue.y;
+            float z = val.size() >= 3 ? val[2].get<float>() : defaultValue.z;
+            return glm::vec3(x, y, z);
+        }
+        return defaultValue;
+    }
+
+    glm::vec4 ParseVec4(const json& val, const glm::vec4& defaultValue) {
+        if (val.is_array() && !val.empty()) {
+            float r = val[0].get<float>();
+            float g = val.size() >= 2 ? val[1].get<float>() : defaultValue.g;
+            float b = val.size() >= 3 ? val[2].get<float>() : defaultValue.b;
+            float a = val.size() >= 4 ? val[3].get<float>() : defaultValue.a;
+            return glm::vec4(r, g, b, a);
+        }
+        return defaultValue;
+    }
+
+    json Field(const json& obj, const char* key) {
+        return obj.value(key, json::array());
+    }
+
+    EasingType ParseEasingType(const std::string& easingStr) {
+        if (easingStr == "Linear") return EasingType::Linear;
+        if (easingStr == "SineIn") return EasingType::SineIn;
+        if (easingStr == "SineOut") return EasingType::SineOut;
+        if (easingStr == "SineInOut") return EasingType::SineInOut;
+        if (easingStr == "QuadIn") return EasingType::QuadIn;
+        if (easingStr == "QuadOut") return EasingType::QuadOut;
+        if (easingStr == "QuadInOut") return EasingType::QuadInOut;
+        if (easingStr == "CubicIn") return EasingType::CubicIn;
+        if (easingStr == "CubicOut") return EasingType::CubicOut;
+        if (easingStr == "CubicInOut") return EasingType::CubicInOut;
+        if (easingStr == "QuartIn") return EasingType::QuartIn;
+        if (easingStr == "QuartOut") return EasingType::QuartOut;
+        if (easingStr == "QuartInOut") return EasingType::QuartInOut;
+        if (easingStr == "QuintIn") return EasingType::QuintIn;
+        if (easingStr == "QuintOut") return EasingType::QuintOut;
+        if (easingStr == "QuintInOut") return EasingType::QuintInOut;
+        if (easingStr == "ExpoIn") return EasingType::ExpoIn;
+        if (easingStr == "ExpoOut") return EasingType::ExpoOut;
+        if (easingStr == "ExpoInOut") return EasingType::ExpoInOut;
+        if (easingStr == "CircIn") return EasingType::CircIn;
+        if (easingStr == "CircOut") return EasingType::CircOut;
+        if (easingStr == "CircInOut") return EasingType::CircInOut;
+        if (easingStr == "BackIn") return EasingType::BackIn;
+        if (easingStr == "BackOut") return EasingType::BackOut;
+        if (easingStr == "BackInOut") return EasingType::BackInOut;
+        if (easingStr == "ElasticIn") return EasingType::ElasticIn;
+        if (easingStr == "ElasticOut") return EasingType::ElasticOut;
+        if (easingStr == "ElasticInOut") return EasingType::ElasticInOut;
+        if (easingStr == "BounceIn") return EasingType::BounceIn;
+        if (easingStr == "BounceOut") return EasingType::BounceOut;
+        if (easingStr == "BounceInOut") return EasingType::BounceInOut;
+        return EasingType::Linear;
+    }
+
+    void ParseSpriteLayer(const std::string& layerStr, CanvasLayer& layer) {
+        if (layerStr == "LAYER_BACKGROUND") layer = CanvasLayer::LAYER_BACKGROUND;
+        else if (layerStr == "LAYER_WORLD_BACK") layer = CanvasLayer::LAYER_WORLD_BACK;
+        else if (layerStr == "LAYER_WORLD") layer = CanvasLayer::LAYER_WORLD;
+        else if (layerStr == "LAYER_WORLD_FRONT") layer = CanvasLayer::LAYER_WORLD_FRONT;
+        else if (layerStr == "LAYER_EFFECTS") layer = CanvasLayer::LAYER_EFFECTS;
+        else if (layerStr == "LAYER_WORLD_2D") layer = CanvasLayer::LAYER_WORLD_2D;
+        else if (layerStr == "LAYER_UI_BACK") layer = CanvasLayer::LAYER_UI_BACK;
+        else if (layerStr == "LAYER_UI") layer = CanvasLayer::LAYER_UI;
+        else if (layerStr == "LAYER_UI_FRONT") layer = CanvasLayer::LAYER_UI_FRONT;
+        else if (layerStr == "LAYER_OVERLAY") layer = CanvasLayer::LAYER_OVERLAY;
+    }
+
+    // Text has only ever recognised four layers
+    void ParseTextLayer(const std::string& layerStr, CanvasLayer& layer) {
+        if (layerStr == "LAYER_BACKGROUND") layer = CanvasLayer::LAYER_BACKGROUND;
+        else if (layerStr == "LAYER_WORLD") layer = CanvasLayer::LAYER_WORLD;
+        else if (layerStr == "LAYER_UI") layer = CanvasLayer::LAYER_UI;
+        else if (layerStr == "LAYER_OVERLAY") layer = CanvasLayer::LAYER_OVERLAY;
+    }
+
+    // Empty stage paths mean "no stage", as they do once baked
+    std::optional<std::string> ParseStage(const json& shaderVal, const char* key) {
+        if (!shaderVal.contains(key)) return std::nullopt;
+        std::string path = shaderVal[key].get<std::string>();
+        return path.empty() ? std::nullopt : std::optional<std::string>(std::move(path));
+    }
+
+    // False where the action can't be built: unknown types, empty sequences,
+    // and RepeatForever anywhere but at the top of a tree
+    bool ReadJsonAction(const json& val, SceneActionProps& out) {
+        if (!val.is_object()) return false;
+
+        std::string type = val.value("type", "");
+        out.duration = val.value("duration", 0.0f);
+        out.easing = ParseEasingType(val.value("easing", "Linear"));
+
+        if (type == "MoveTo") {
+            out.type = SceneActionType::MoveTo;
+            out.value = glm::vec4(ParseVec3(Field(val, "position"), glm::vec3(0.0f)), 0.0f);
+            return true;
+        }
+        if (type == "MoveBy") {
+            out.type = SceneActionType::MoveBy;
+            out.value = glm::vec4(ParseVec3(Field(val, "deltaPosition"), glm::vec3(0.0f)), 0.0f);
+            return true;
+        }
+        if (type == "RotateTo") {
+            out.type = SceneActionType::RotateTo;
+            out.value = glm::vec4(glm::radians(ParseVec3(Field(val, "rotation"), glm::vec3(0.0f))), 0.0f);
+            return true;
+        }
+        if (type == "RotateBy") {
+            out.type = SceneActionType::RotateBy;
+            out.value = glm::vec4(glm::radians(ParseVec3(Field(val, "deltaRotation"), glm::vec3(0.0f))), 0.0f);
+            return true;
+        }
+        if (type == "ScaleTo") {
+            out.type = SceneActionType::ScaleTo;
+            out.value = glm::vec4(ParseVec3(Field(val, "scale"), glm::vec3(1.0f)), 0.0f);
+            return true;
+        }
+        if (type == "ColorTo") {
+            out.type = SceneActionType::ColorTo;
+            out.value = ParseVec4(Field(val, "color"), glm::vec4(1.0f));
+            return true;
+        }
+        if (type == "FadeTo") {
+            out.type = SceneActionType::FadeTo;
+            out.value = glm::vec4(val.value("alpha", 1.0f), 0.0f, 0.0f, 0.0f);
+            return true;
+        }
+        if (type == "Sequence") {
+            out.type = SceneActionType::Sequence;
+            if (val.contains("actions") && val["actions"].is_array()) {
+                for (const auto& stepVal : val["actions"]) {
+                    SceneActionProps step;
+                    if (!ReadJsonAction(stepVal, step)) continue;
+                    if (step.type == SceneActionType::RepeatForever) {
+                        spdlog::warn("ReadSceneJSON: Sequence only supports FiniteTimeActions. Action ignored.");
+                        continue;
+                    }
+                    out.children.push_back(std::move(step));
+                }
+            }
+            return !out.children.empty();
+        }
+        if (type == "RepeatForever" && val.contains("action")) {
+            out.type = SceneActionType::RepeatForever;
+            SceneActionProps inner;
+            if (!ReadJsonAction(val["action"], inner)) return false;
+            if (inner.type == SceneActionType::RepeatForever) {
+                spdlog::warn("ReadSceneJSON: RepeatForever only supports ActionIntervals. Action ignored.");
+                return false;
+            }
+            out.children.push_back(std::move(inner));
+            return true;
+        }
+        return false;
+    }
+
+    bool ReadJsonComponent(const json& compVal, SceneComponentProps& out) {
+        std::string type = compVal.value("type", "");
+        if (type == "SpriteComponent") {
+            SceneSpriteProps sprite;
+            SpriteProps& props = sprite.props;
+            props.size = ParseVec2(Field(compVal, "size"), glm::vec2(100.0f, 100.0f));
+            props.pivot = ParseVec2(Field(compVal, "pivot"), glm::vec2(0.5f, 0.5f));
+            props.color = ParseVec4(Field(compVal, "color"), glm::vec4(1.0f));
+            if (compVal.contains("texture")) sprite.texture = compVal["texture"].get<std::string>();
+            if (compVal.contains("layer")) ParseSpriteLayer(compVal["layer"].get<std::string>(), props.layer);
+            props.flipX = compVal.value("flipX", false);
+            props.flipY = compVal.value("flipY", false);
+            props.zOrder = compVal.value("zOrder", 0);
+            out = std::move(sprite);
+            return true;
+        }
+        if (type == "TextComponent") {
+            TextProps props;
+            props.text = compVal.value("text", "");
+            props.fontPath = compVal.value("fontPath", "");
+            props.fontSize = compVal.value("fontSize", 24.0f);
+            props.size = ParseVec2(Field(compVal, "size"), glm::vec2(100.0f, 100.0f));
+            props.pivot = ParseVec2(Field(compVal, "pivot"), glm::vec2(0.0f, 0.0f));
+            props.color = ParseVec4(Field(compVal, "color"), glm::vec4(1.0f));
+            std::string hAlign = compVal.value("hAlign", "Left");
+            props.hAlign = hAlign == "Center" ? TextHAlignment::Center : hAlign == "Right" ? TextHAlignment::Right : TextHAlignment::Left;
+            std::string vAlign = compVal.value("vAlign", "Top");
+            props.vAlign = vAlign == "Center" ? TextVAlignment::Center : vAlign == "Bottom" ? TextVAlignment::Bottom : TextVAlignment::Top;
+            if (compVal.contains("layer")) ParseTextLayer(compVal["layer"].get<std::string>(), props.layer);
+            props.zOrder = compVal.value("zOrder", 0);
+            out = std::move(props);
+            return true;
+        }
+        if (type == "CameraComponent") {
+            CameraProps props;
+            props.isOrthographic = compVal.value("orthographic", false);
+            if (props.isOrthographic) {
+                props.orthographic.width = compVal.value("width", 500.0f);
+                props.orthographic.height = compVal.value("height", 500.0f);
+                props.orthographic.nearClip = compVal.value("nearClip", -1.0f);
+                props.orthographic.farClip = compVal.value("farClip", 1.0f);
+            } else {
+                props.perspective.fieldOfView = compVal.value("fieldOfView", 45.0f);
+                props.perspective.aspectRatio = compVal.value("aspectRatio", 1.333f);
+                props.perspective.nearClip = compVal.value("nearClip", 0.1f);
+                props.perspective.farClip = compVal.value("farClip", 500.0f);
+            }
+            props.verticalAngle = compVal.value("verticalAngle", 0.0f);
+            props.horizontalAngle = compVal.value("horizontalAngle", 0.0f);
+            props.eyeOffset = ParseVec3(Field(compVal, "eyeOffset"), glm::vec3(0.0f));
+            out = props;
+            return true;
+        }
+        if (type == "LightComponent") {
+            LightProps props;
+            std::string lightTypeStr = compVal.value("lightType", "Directional");
+            if (lightTypeStr == "Point") props.type = LightType::Point;
+            else if (lightTypeStr == "Spot") props.type = LightType::Spot;
+            else if (lightTypeStr == "Area") props.type = LightType::Area;
+            else props.type = LightType::Directional;
+            props.ambient = ParseVec3(Field(compVal, "ambient"), glm::vec3(0.1f));
+            props.diffuse = ParseVec3(Field(compVal, "diffuse"), glm::vec3(1.0f));
+            props.specular = ParseVec3(Field(compVal, "specular"), glm::vec3(1.0f));
+            props.direction = ParseVec3(Field(compVal, "direction"), glm::vec3(0.0f, -1.0f, 0.0f));
+            props.attenuation = ParseVec3(Field(compVal, "attenuation"), glm::vec3(1.0f, 0.0f, 0.0f));
+            props.intensity = compVal.value("intensity", 1.0f);
+            props.castShadow = compVal.value("castShadow", false);
+            out = props;
+            return true;
+        }
+        if (type == "Animator2D") {
+            SceneAnimatorProps animator;
+            if (compVal.contains("animations") && compVal["animations"].is_array()) {
+                for (const auto& animVal : compVal["animations"]) {
+                    AnimationClip clip;
+                    clip.name = animVal.value("name", "");
+                    clip.loop = animVal.value("loop", true);
+                    if (animVal.contains("frames") && animVal["frames"].is_array()) {
+                        for (const auto& frameVal : animVal["frames"]) {
+                            AnimationFrame frame;
+                            frame.duration = frameVal.value("duration", 0.1f);
+                            frame.uvMin = ParseVec2(Field(frameVal, "uvMin"), glm::vec2(0.0f, 0.0f));
+                            frame.uvMax = ParseVec2(Field(frameVal, "uvMax"), glm::vec2(1.0f, 1.0f));
+                            clip.frames.push_back(frame);
+                        }
+                    }
+                    animator.clips.push_back(std::move(clip));
+                }
+            }
+            if (compVal.contains("autoPlay")) animator.autoPlay = compVal["autoPlay"].get<std::string>();
+            out = std::move(animator);
+            return true;
+        }
+        if (type == "ActionManager") {
+            SceneActionsProps actions;
+            if (compVal.contains("actions") && compVal["actions"].is_array()) {
+                for (const auto& actionVal : compVal["actions"]) {
+                    SceneActionProps action;
+                    if (ReadJsonAction(actionVal, action)) actions.actions.push_back(std::move(action));
+                }
+            }
+            out = std::move(actions);
+            return true;
+        }
+        return false;
+    }
+
+    // Pre-order, so a parent's index is always below its children's
+    void ReadJsonEntity(const json& entityVal, int parent, std::vector<SceneEntityProps>& out) {
+        SceneEntityProps entity;
+        entity.name = entityVal.value("name", "Entity");
+        entity.parent = parent;
+        entity.active = entityVal.value("active", true);
+        entity.position = ParseVec3(Field(entityVal, "position"), glm::vec3(0.0f));
+        entity.rotation = glm::radians(ParseVec3(Field(entityVal, "rotation"), glm::vec3(0.0f)));
+        entity.scale = ParseVec3(Field(entityVal, "scale"), glm::vec3(1.0f));
+        if (entityVal.contains("components") && entityVal["components"].is_array()) {
+            for (const auto& compVal : entityVal["components"]) {
+                SceneComponentProps component;
+                if (ReadJsonComponent(compVal, component)) entity.components.push_back(std::move(component));
+            }
+        }
+
+        int index = static_cast<int>(out.size());
+        out.push_back(std::move(entity));
+        if (entityVal.contains("children") && entityVal["children"].is_array()) {
+            for (const auto& childVal : entityVal["children"]) ReadJsonEntity(childVal, index, out);
+        }
+    }
+}// namespace
+
+bool ReadSceneJSON(std::string_view text, SceneProps& out, std::string* error) {
+    out = {};
+    try {
+        json j = json::parse(text);
+        out.name = j.value("name", "Unnamed");
+        if (j.contains("textures") && j["textures"].is_array()) {
+            for (const auto& tex : j["textures"]) out.textures.push_back(tex.get<std::string>());
+        }
+        if (j.contains("shaders") && j["shaders"].is_object()) {
+            for (auto& [name, shaderVal] : j["shaders"].items()) {
+                ShaderProgramProps props;
+                props.vert = shaderVal.value("vert", "");
+                props.frag = shaderVal.value("frag", "");
+                props.tesc = ParseStage(shaderVal, "tesc");
+                props.tese = ParseStage(shaderVal, "tese");
+                out.shaders[name] = props;
+            }
+        }
+        if (j.contains("entities") && j["entities"].is_array()) {
+            for (const auto& entityVal : j["entities"]) ReadJsonEntity(entityVal, -1, out.entities);
+        }
+        return true;
+    } catch (const std::exception& e) {
+        out = {};
+        if (error) *error = e.what();
+        return false;
+    }
+}
@@ -1,48 +1,40 @@
 #include "scene_transition.hpp"
 #include "asset_manager.hpp"
 #include "file_system.hpp"
-#include <nlohmann/json.hpp>
+#include "scene_bake.hpp"
+#include "scene_props.hpp"
 #include <spdlog/spdlog.h>
 
 // ── GameManifest ─────────────────────────────────────────────────────────────
+// Read with the scene readers themselves, so the manifest and the scene it
+// prefetches for can't disagree
 
-static GameManifest ParseJSON(const std::string& json)
+static GameManifest ToManifest(SceneProps&& scene)
 {
     GameManifest manifest;
-    try {
-        auto j = nlohmann::json::parse(json);
-        manifest.name = j.value("name", "");
-
-        if (j.contains("textures"))
-            for (auto& v : j["textures"])
-                manifest.textures.push_back(v.get<std::string>());
-
-        if (j.contains("shaders")) {
-            if (j["shaders"].is_object()) {
-                for (auto& [name, shaderVal] : j["shaders"].items()) {
-                    ShaderProgramProps props;
-                    props.vert = shaderVal.value("vert", "");
-                    props.frag = shaderVal.value("frag", "");
-                    if (shaderVal.contains("tesc")) {
-                        props.tesc = shaderVal["tesc"].get<std::string>();
-                    }
-                    if (shaderVal.contains("tese")) {
-                        props.tese = shaderVal["tese"].get<std::string>();
-                    }
-                    manifest.shaders[name] = props;
-                }
-            }
-        }
-
-    } catch (const std::exception& e) {
-        spdlog::error("GameManifest: JSON parse error: {}", e.what());
-    }
+    manifest.name = std::move(scene.name);
+    manifest.textures = std::move(scene.textures);
+    manifest.shaders = std::move(scene.shaders);
     return manifest;
 }
 
 GameManifest GameManifest::FromJSON(const std::string& json)
 {
-    return ParseJSON(json);
+    SceneProps scene;
+    std::string error;
+    if (!ReadSceneJSON(json, scene, &error)) {
+        spdlog::error("GameManifest: JSON parse error: {}", error);
+        return {};
+    }
+    return ToManifest(std::move(scene));
+}
+
+bool GameManifest::FromBaked(std::span<const uint8_t> bytes, GameManifest& out)
+{
+    SceneProps scene;
+    if (!ReadBakedScene(bytes, scene)) return false;
+    out = ToManifest(std::move(scene));
+    return true;
 }
 
 // ── ClearScene ───────────────────────────────────────────────────────────────
@@ -54,25 +46,63 @@ static void ClearScene()
     AssetManager::Get().ClearSceneAssets();
 }
 
+// ── SceneTransition::ResolveScenePath ────────────────────────────────────────
+
+std::string SceneTransition::ResolveScenePath(const std::string& sceneName)
+{
+    const std::string bakedPath    = std::string(kManifestDir) + sceneName + ".aesb";
+    const std::string manifestPath = std::string(kManifestDir) + sceneName + ".json";
+    if (!FileSystem::Get().Exists(bakedPath)) return manifestPath;
+
+    FileSystem::SharedBytes shared;
+    std::span<const uint8_t> baked = FileSystem::Get().ReadView(bakedPath);
+    if (baked.empty() && (shared = FileSystem::Get().ReadShared(bakedPath))) baked = *shared;
+    uint64_t sourceHash = 0;
+    if (!GetBakedSceneSourceHash(baked, sourceHash)) {
+        spdlog::warn("SceneTransition: '{}' is not a valid baked scene, loading '{}'", bakedPath, manifestPath);
+        return manifestPath;
+    }
+    if (!FileSystem::Get().Exists(manifestPath)) return bakedPath;
+
+    auto json = FileSystem::Get().ReadSync(manifestPath);
+    if (HashSceneSource({ reinterpret_cast<const char*>(json.data()), json.size() }) != sourceHash) {
+        spdlog::warn("SceneTransition: '{}' was not baked from the current '{}', loading the JSON (re-run scene_baker)",
+                     bakedPath, manifestPath);
+        return manifestPath;
+    }
+    return bakedPath;
+}
+
 // ── SceneTransition::Go ──────────────────────────────────────────────────────
 
 void SceneTransition::Go(const std::string& sceneName, OnReadyFn onReady, OnErrorFn onError,
                          const std::string& currentSceneName)
 {
+    const std::string bakedPath    = std::string(kManifestDir) + sceneName + ".aesb";
     const std::string manifestPath = std::string(kManifestDir) + sceneName + ".json";
 
     bool shouldClear = !currentSceneName.empty();
-    FileSystem::Get().Prefetch({ manifestPath }, [sceneName, manifestPath, shouldClear, onReady, onError]() {
-        auto bytes = FileSystem::Get().ReadSync(manifestPath);
-        if (bytes.empty()) {
-            std::string reason = "failed to read manifest: " + manifestPath;
+    // PrefetchAsync never stalls the frame; callbacks arrive via
+    // FileSystem::PumpCompletions on the main thread.  Both manifests go in
+    // one batch — a missing one just isn't cached.
+    FileSystem::Get().PrefetchAsync({ bakedPath, manifestPath },
+                                    [sceneName, bakedPath, manifestPath, shouldClear, onReady, onError]() {
+        GameManifest manifest;
+        const std::string scenePath = ResolveScenePath(sceneName);
+        auto bytes = FileSystem::Get().ReadSync(scenePath);
+        bool read = !bytes.empty();
+        if (read && scenePath == bakedPath) {
+            read = GameManifest::FromBaked(bytes, manifest);
+        } else if (read) {
+            manifest = GameManifest::FromJSON(std::string(bytes.begin(), bytes.end()));
+        }
+        if (!read) {
+            std::string reason = "failed to read manifest: " + scenePath;
             spdlog::error("SceneTransition: {}", reason);
             if (onError) onError(reason);
             return;
         }
 
-        auto manifest = GameManifest::FromJSON(std::string(bytes.begin(), bytes.end()));
-
         std::vector<std::string> allPaths;
         allPaths.insert(allPaths.end(), manifest.textures.begin(), manifest.textures.end());
         for (const auto& [name, props] : manifest.shaders) {
@@ -85,7 +115,13 @@ void SceneTransition::Go(const std::string& sceneName, OnReadyFn onReady, OnErro
         spdlog::info("SceneTransition: prefetching {} asset(s) for '{}'",
                      allPaths.size(), sceneName);
 
-        FileSystem::Get().Prefetch(allPaths, [manifest, sceneName, shouldClear, onReady, onError]() {
+        // The scene's own node in the asset graph depends on both its files:
+        // editing the JSON must reload even while a bake exists
+        std::vector<std::string> sourcePaths;
+        for (const auto* path : { &bakedPath, &manifestPath }) {
+            if (FileSystem::Get().Exists(*path)) sourcePaths.push_back(*path);
+        }
+        FileSystem::Get().PrefetchAsync(allPaths, [manifest, sceneName, sourcePaths, shouldClear, onReady, onError]() {
             spdlog::info("SceneTransition: loading '{}'", sceneName);
 
             if (shouldClear)
@@ -98,6 +134,10 @@ void SceneTransition::Go(const std::string& sceneName, OnReadyFn onReady, OnErro
                 if (!manifest.shaders.empty())
                     AssetManager::Get().LoadShaders(manifest.shaders);
 
+                std::vector<std::string> shaderNames;
+                for (const auto& [name, props] : manifest.shaders) shaderNames.push_back(name);
+                AssetManager::Get().TrackScene(sceneName, sourcePaths, manifest.textures, shaderNames);
+
             } catch (const std::exception& e) {
                 spdlog::error("SceneTransition: load failed: {}", e.what());
                 if (onError) onError(e.what());
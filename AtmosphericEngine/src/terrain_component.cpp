@@ -55,6 +55,9 @@ void TerrainComponent::LoadHeightmap(const std::string& path, const TerrainProps
     // Process heightmap data
     const int terrainDataSize = img->width * img->height;
     _heightData.resize(terrainDataSize);
+    _heightmapWidth = img->width;
+    _heightmapDepth = img->height;
+    _worldSize = props.worldSize;
 
     for (int i = 0; i < terrainDataSize; ++i) {
         _heightData[i] = (static_cast<float>(img->byteArray[i]) / 255.0f) * props.heightScale;
@@ -0,0 +1,138 @@
+#include "texture_disk_cache.hpp"
+#include "content_hash.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <thread>
+
+#include <spdlog/spdlog.h>
+
+namespace {
+    struct MipRecord {
+        uint32_t width;
+        uint32_t height;
+        uint64_t byteSize;
+    };
+    static_assert(sizeof(MipRecord) == 16);
+
+    // Bytes one level of `format` occupies; BC and ETC round up to whole 4×4 blocks
+    uint64_t LevelByteSize(TexturePixelFormat format, uint32_t width, uint32_t height) {
+        uint64_t blocks = uint64_t((width + 3) / 4) * ((height + 3) / 4);
+        switch (format) {
+        case TexturePixelFormat::R8: return uint64_t(width) * height;
+        case TexturePixelFormat::RGBA8: return uint64_t(width) * height * 4;
+        case TexturePixelFormat::BC1:
+        case TexturePixelFormat::ETC1: return blocks * 8;
+        case TexturePixelFormat::BC3:
+        case TexturePixelFormat::ETC2_RGBA: return blocks * 16;
+        }
+        return 0;
+    }
+
+    uint64_t Mix(uint64_t hash, uint64_t value) {
+        hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+}// namespace
+
+TextureDiskCache::TextureDiskCache(std::string directory) : _directory(std::move(directory)) {
+    std::error_code ec;
+    std::filesystem::create_directories(_directory, ec);
+    _ready = !ec && std::filesystem::is_directory(_directory, ec);
+    if (!_ready) spdlog::warn("Texture cache disabled: cannot create '{}'", _directory);
+}
+
+uint64_t TextureDiskCache::HashContents(std::span<const uint8_t> bytes) {
+    return HashContent(bytes);
+}
+
+uint64_t TextureDiskCache::MakeKey(uint64_t contentHash, MipFilter filter, bool blockCompress) {
+    uint64_t key = Mix(contentHash, VERSION);
+    key = Mix(key, static_cast<uint64_t>(filter));
+    return Mix(key, blockCompress ? 1 : 0);
+}
+
+std::string TextureDiskCache::PathFor(uint64_t key) const {
+    char name[24];
+    std::snprintf(name, sizeof(name), "%016llx.aetc", static_cast<unsigned long long>(key));
+    return (std::filesystem::path(_directory) / name).string();
+}
+
+bool TextureDiskCache::Load(uint64_t key, TexturePayload& out) const {
+    if (!_ready) return false;
+    FILE* f = std::fopen(PathFor(key).c_str(), "rb");
+    if (!f) return false;
+
+    bool ok = false;
+    TextureCacheHeader header{};
+    if (std::fread(&header, sizeof(header), 1, f) == 1 && std::memcmp(header.magic, "AETC", 4) == 0 &&
+        header.version == VERSION && header.key == key && header.mipCount > 0 && header.mipCount <= 32 &&
+        header.format <= static_cast<uint32_t>(TexturePixelFormat::ETC2_RGBA)) {
+        out.format = static_cast<TexturePixelFormat>(header.format);
+        out.mips.resize(header.mipCount);
+        ok = true;
+        MipRecord base{};
+        for (uint32_t level = 0; level < header.mipCount; ++level) {
+            TextureMip& mip = out.mips[level];
+            MipRecord record;
+            if (std::fread(&record, sizeof(record), 1, f) != 1) {
+                ok = false;
+                break;
+            }
+            // Every level must be the halving of level 0 and exactly as large as
+            // its format says, or the upload would read past the end of the data
+            if (level == 0) base = record;
+            bool chain = base.width > 0 && base.height > 0 && (base.width | base.height) >> level > 0 &&
+                         record.width == std::max(1u, base.width >> level) &&
+                         record.height == std::max(1u, base.height >> level);
+            if (!chain || record.byteSize != LevelByteSize(out.format, record.width, record.height) ||
+                record.byteSize > (uint64_t(1) << 32)) {
+                ok = false;
+                break;
+            }
+            mip.width  = record.width;
+            mip.height = record.height;
+            mip.data.resize(record.byteSize);
+            if (std::fread(mip.data.data(), 1, mip.data.size(), f) != mip.data.size()) {
+                ok = false;
+                break;
+            }
+        }
+        ok = ok && std::fgetc(f) == EOF;// trailing bytes mean a different writer; don't trust it
+    }
+    std::fclose(f);
+    if (!ok) out.mips.clear();
+    return ok;
+}
+
+void TextureDiskCache::Store(uint64_t key, const TexturePayload& payload) {
+    static std::atomic<bool> warned{ false };
+    if (!_ready || payload.mips.empty()) return;
+
+    std::string path = PathFor(key);
+    std::string temp = path + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+    FILE* f = std::fopen(temp.c_str(), "wb");
+    bool ok = f != nullptr;
+    if (ok) {
+        TextureCacheHeader header{ { 'A', 'E', 'T', 'C' }, VERSION, key, static_cast<uint32_t>(payload.format),
+                                   static_cast<uint32_t>(payload.mips.size()) };
+        ok = std::fwrite(&header, sizeof(header), 1, f) == 1;
+        for (const auto& mip : payload.mips) {
+            if (!ok) break;
+            MipRecord record{ mip.width, mip.height, mip.data.size() };
+            ok = std::fwrite(&record, sizeof(record), 1, f) == 1 &&
+                 std::fwrite(mip.data.data(), 1, mip.data.size(), f) == mip.data.size();
+        }
+        ok = (std::fclose(f) == 0) && ok;
+    }
+
+    std::error_code ec;
+    if (ok) std::filesystem::rename(temp, path, ec);
+    if (!ok || ec) {
+        std::filesystem::remove(temp, ec);
+        if (!warned.exchange(true)) spdlog::warn("Texture cache: cannot write '{}'", path);
+    }
+}
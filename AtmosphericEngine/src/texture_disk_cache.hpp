@@ -0,0 +1,54 @@
+#pragma once
+#include "texture_pipeline.hpp"
+
+#include <cstdint>
+#include <span>
+#include <string>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TextureDiskCache
+//
+// Decoded, mip-generated (and possibly block-compressed) texture payloads on
+// disk, keyed by a hash of the source file's *contents* plus every pipeline
+// setting that changes the output.  A warm launch reads the payload back and
+// skips decode, mip generation and BC encoding; renaming or duplicating a
+// source file still hits, editing it misses.
+//
+// One file per key: <dir>/<key as 16 hex digits>.aetc
+//
+//   TextureCacheHeader
+//   per mip: uint32 width, uint32 height, uint64 byteSize, bytes…
+//
+// Writes go to a unique temp file and are renamed into place, so concurrent
+// workers storing the same key and crashes mid-write never leave a torn
+// entry; a file that fails validation is treated as a miss.
+// ─────────────────────────────────────────────────────────────────────────────
+struct TextureCacheHeader {
+    char     magic[4];  // "AETC"
+    uint32_t version;
+    uint64_t key;
+    uint32_t format;    // TexturePixelFormat
+    uint32_t mipCount;
+};
+static_assert(sizeof(TextureCacheHeader) == 24);
+
+class TextureDiskCache {
+public:
+    static constexpr uint32_t VERSION = 1;
+
+    explicit TextureDiskCache(std::string directory);
+
+    // XXH3 of the source bytes (HashContent); combine with the settings via MakeKey
+    static uint64_t HashContents(std::span<const uint8_t> bytes);
+    static uint64_t MakeKey(uint64_t contentHash, MipFilter filter, bool blockCompress);
+
+    bool Load(uint64_t key, TexturePayload& out) const;
+    // Best effort: failures (read-only disk, full disk) are logged once and ignored
+    void Store(uint64_t key, const TexturePayload& payload);
+
+private:
+    std::string PathFor(uint64_t key) const;
+
+    std::string _directory;
+    bool        _ready = false;
+};
@@ -0,0 +1,514 @@
+#include "texture_pipeline.hpp"
+#include "file_system.hpp"
+#include "job_system.hpp"
+#include "texture_disk_cache.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+#include "stb_image.h"// implementation lives in asset_manager.cpp
+
+#ifdef AE_USE_BASIS_UNIVERSAL
+#include "basisu_transcoder.h"
+#endif
+
+size_t TexturePayload::GetByteSize() const {
+    size_t total = 0;
+    for (const auto& mip : mips) total += mip.data.size();
+    return total;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Decode
+// ─────────────────────────────────────────────────────────────────────────────
+bool DecodeTextureImage(std::span<const uint8_t> file, TexturePayload& out) {
+    int width, height, channels;
+    if (!stbi_info_from_memory(file.data(), (int)file.size(), &width, &height, &channels)) return false;
+    // Same channel policy as AssetManager::LoadImage: grey stays R8, the rest expand to RGBA
+    int desired = channels == 1 ? 1 : 4;
+    uint8_t* pixels = stbi_load_from_memory(file.data(), (int)file.size(), &width, &height, &channels, desired);
+    if (!pixels) return false;
+
+    out.format = desired == 1 ? TexturePixelFormat::R8 : TexturePixelFormat::RGBA8;
+    out.mips.assign(1, TextureMip{ (uint32_t)width, (uint32_t)height, {} });
+    out.mips[0].data.assign(pixels, pixels + (size_t)width * height * desired);
+    stbi_image_free(pixels);
+    return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Mip generation
+// ─────────────────────────────────────────────────────────────────────────────
+namespace {
+    // Averages each 2×2 block; odd edges reuse the last row / column
+    void DownsampleBox(const TextureMip& src, TextureMip& dst, int channels) {
+        for (uint32_t y = 0; y < dst.height; ++y) {
+            uint32_t y0 = std::min(2 * y, src.height - 1), y1 = std::min(2 * y + 1, src.height - 1);
+            for (uint32_t x = 0; x < dst.width; ++x) {
+                uint32_t x0 = std::min(2 * x, src.width - 1), x1 = std::min(2 * x + 1, src.width - 1);
+                for (int c = 0; c < channels; ++c) {
+                    uint32_t sum = src.data[(y0 * src.width + x0) * channels + c] + src.data[(y0 * src.width + x1) * channels + c] +
+                                   src.data[(y1 * src.width + x0) * channels + c] + src.data[(y1 * src.width + x1) * channels + c];
+                    dst.data[(y * dst.width + x) * channels + c] = static_cast<uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+    }
+
+    double BesselI0(double x) {
+        double sum = 1.0, term = 1.0;
+        for (int k = 1; k < 20; ++k) {
+            term *= (x / (2.0 * k)) * (x / (2.0 * k));
+            sum += term;
+        }
+        return sum;
+    }
+
+    // Kaiser-windowed sinc, radius 2 destination texels → 8 source taps.
+    // Tap k weighs source texel 2x + k - 3 for destination texel x.
+    constexpr int KAISER_TAPS = 8;
+    std::array<float, KAISER_TAPS> KaiserWeights() {
+        constexpr double radius = 2.0, alpha = 4.0, pi = 3.14159265358979323846;
+        std::array<float, KAISER_TAPS> w{};
+        double total = 0.0;
+        for (int k = 0; k < KAISER_TAPS; ++k) {
+            double d = (k - 3 - 0.5) / 2.0;// source texel centre relative to the destination centre
+            double sinc = d == 0.0 ? 1.0 : std::sin(pi * d) / (pi * d);
+            double r = d / radius;
+            double window = std::abs(r) < 1.0 ? BesselI0(alpha * std::sqrt(1.0 - r * r)) / BesselI0(alpha) : 0.0;
+            w[k] = static_cast<float>(sinc * window);
+            total += w[k];
+        }
+        for (auto& v : w) v = static_cast<float>(v / total);
+        return w;
+    }
+
+    // Separable: horizontal pass into floats, then vertical pass with clamping
+    // (the sinc lobes can overshoot)
+    void DownsampleKaiser(const TextureMip& src, TextureMip& dst, int channels) {
+        static const std::array<float, KAISER_TAPS> weights = KaiserWeights();
+        std::vector<float> rows((size_t)dst.width * src.height * channels);
+        for (uint32_t y = 0; y < src.height; ++y) {
+            for (uint32_t x = 0; x < dst.width; ++x) {
+                for (int c = 0; c < channels; ++c) {
+                    float acc = 0.0f;
+                    for (int k = 0; k < KAISER_TAPS; ++k) {
+                        int sx = std::clamp(static_cast<int>(2 * x) + k - 3, 0, static_cast<int>(src.width) - 1);
+                        acc += weights[k] * src.data[((size_t)y * src.width + sx) * channels + c];
+                    }
+                    // 1-wide sources collapse to a plain copy
+                    rows[((size_t)y * dst.width + x) * channels + c] = src.width == 1 ? src.data[(size_t)y * channels + c] : acc;
+                }
+            }
+        }
+        for (uint32_t y = 0; y < dst.height; ++y) {
+            for (uint32_t x = 0; x < dst.width; ++x) {
+                for (int c = 0; c < channels; ++c) {
+                    float acc = 0.0f;
+                    for (int k = 0; k < KAISER_TAPS; ++k) {
+                        int sy = std::clamp(static_cast<int>(2 * y) + k - 3, 0, static_cast<int>(src.height) - 1);
+                        acc += weights[k] * rows[((size_t)sy * dst.width + x) * channels + c];
+                    }
+                    if (src.height == 1) acc = rows[(size_t)x * channels + c];
+                    dst.data[((size_t)y * dst.width + x) * channels + c] =
+                      static_cast<uint8_t>(std::clamp(acc + 0.5f, 0.0f, 255.0f));
+                }
+            }
+        }
+    }
+}// namespace
+
+void GenerateMipChain(TexturePayload& payload, MipFilter filter) {
+    if (payload.mips.empty()) return;
+    int channels;
+    switch (payload.format) {
+    case TexturePixelFormat::R8: channels = 1; break;
+    case TexturePixelFormat::RGBA8: channels = 4; break;
+    default: return;// block-compressed payloads carry their own mips
+    }
+    payload.mips.resize(1);
+    while (payload.mips.back().width > 1 || payload.mips.back().height > 1) {
+        const TextureMip& src = payload.mips.back();
+        TextureMip dst{ std::max(1u, src.width / 2), std::max(1u, src.height / 2), {} };
+        dst.data.resize((size_t)dst.width * dst.height * channels);
+        if (filter == MipFilter::Kaiser) {
+            DownsampleKaiser(src, dst, channels);
+        } else {
+            DownsampleBox(src, dst, channels);
+        }
+        payload.mips.push_back(std::move(dst));
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Block compression
+//
+// Range fit: each 4×4 block's endpoints are the corners of its colour
+// bounding box, inset by 1/16 to spend less of the palette on outliers.
+// Lower quality than a PCA / cluster fit, but a few ms per 1024² texture,
+// which is what lets it run at load time on a cache miss.
+// ─────────────────────────────────────────────────────────────────────────────
+namespace {
+    uint16_t To565(int r, int g, int b) {
+        return static_cast<uint16_t>(((r * 31 + 127) / 255) << 11 | ((g * 63 + 127) / 255) << 5 | ((b * 31 + 127) / 255));
+    }
+
+    void From565(uint16_t c, int rgb[3]) {
+        int r = c >> 11, g = (c >> 5) & 63, b = c & 31;
+        rgb[0] = (r << 3) | (r >> 2);
+        rgb[1] = (g << 2) | (g >> 4);
+        rgb[2] = (b << 3) | (b >> 2);
+    }
+
+    // `block` is 16 RGBA texels; writes 8 bytes
+    void EncodeColorBlock(const uint8_t* block, uint8_t* out) {
+        int lo[3] = { 255, 255, 255 }, hi[3] = { 0, 0, 0 };
+        for (int i = 0; i < 16; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                lo[c] = std::min(lo[c], (int)block[i * 4 + c]);
+                hi[c] = std::max(hi[c], (int)block[i * 4 + c]);
+            }
+        }
+        for (int c = 0; c < 3; ++c) {
+            int inset = (hi[c] - lo[c]) / 16;
+            lo[c] += inset;
+            hi[c] -= inset;
+        }
+        uint16_t c0 = To565(hi[0], hi[1], hi[2]), c1 = To565(lo[0], lo[1], lo[2]);
+        uint32_t indices = 0;
+        if (c0 != c1) {
+            // Four-colour mode needs c0 > c1
+            if (c0 < c1) std::swap(c0, c1);
+            int palette[4][3];
+            From565(c0, palette[0]);
+            From565(c1, palette[1]);
+            for (int c = 0; c < 3; ++c) {
+                palette[2][c] = (2 * palette[0][c] + palette[1][c] + 1) / 3;
+                palette[3][c] = (palette[0][c] + 2 * palette[1][c] + 1) / 3;
+            }
+            for (int i = 0; i < 16; ++i) {
+                int best = 0, bestDist = INT32_MAX;
+                for (int p = 0; p < 4; ++p) {
+                    int dr = block[i * 4] - palette[p][0], dg = block[i * 4 + 1] - palette[p][1],
+                        db = block[i * 4 + 2] - palette[p][2];
+                    int dist = dr * dr + dg * dg + db * db;
+                    if (dist < bestDist) bestDist = dist, best = p;
+                }
+                indices |= static_cast<uint32_t>(best) << (2 * i);
+            }
+        }
+        out[0] = c0 & 0xFF;
+        out[1] = c0 >> 8;
+        out[2] = c1 & 0xFF;
+        out[3] = c1 >> 8;
+        for (int k = 0; k < 4; ++k) out[4 + k] = static_cast<uint8_t>(indices >> (8 * k));
+    }
+
+    // BC3 alpha: eight-value mode with a0 = max, a1 = min; writes 8 bytes
+    void EncodeAlphaBlock(const uint8_t* block, uint8_t* out) {
+        int a0 = 0, a1 = 255;
+        for (int i = 0; i < 16; ++i) {
+            a0 = std::max(a0, (int)block[i * 4 + 3]);
+            a1 = std::min(a1, (int)block[i * 4 + 3]);
+        }
+        uint64_t indices = 0;
+        if (a0 != a1) {
+            for (int i = 0; i < 16; ++i) {
+                // Step 0 is a0, step 7 is a1; palette index 0/1 are the
+                // endpoints and 2..7 the interpolants in between
+                int step = ((a0 - block[i * 4 + 3]) * 7 + (a0 - a1) / 2) / (a0 - a1);
+                int index = step == 0 ? 0 : step == 7 ? 1 : step + 1;
+                indices |= static_cast<uint64_t>(index) << (3 * i);
+            }
+        }
+        out[0] = static_cast<uint8_t>(a0);
+        out[1] = static_cast<uint8_t>(a1);
+        for (int k = 0; k < 6; ++k) out[2 + k] = static_cast<uint8_t>(indices >> (8 * k));
+    }
+}// namespace
+
+bool CompressTextureBC(TexturePayload& payload) {
+    if (payload.format != TexturePixelFormat::RGBA8 || payload.mips.empty()) return false;
+    if (payload.mips[0].width % 4 != 0 || payload.mips[0].height % 4 != 0) return false;
+
+    bool opaque = true;
+    for (size_t i = 3; i < payload.mips[0].data.size() && opaque; i += 4) opaque = payload.mips[0].data[i] == 255;
+    size_t blockBytes = opaque ? 8 : 16;
+
+    for (auto& mip : payload.mips) {
+        uint32_t blocksX = (mip.width + 3) / 4, blocksY = (mip.height + 3) / 4;
+        std::vector<uint8_t> encoded((size_t)blocksX * blocksY * blockBytes);
+        uint8_t block[16 * 4];
+        uint8_t* out = encoded.data();
+        for (uint32_t by = 0; by < blocksY; ++by) {
+            for (uint32_t bx = 0; bx < blocksX; ++bx) {
+                // Blocks hanging over the edge of small mips repeat the last texel
+                for (uint32_t y = 0; y < 4; ++y) {
+                    uint32_t sy = std::min(by * 4 + y, mip.height - 1);
+                    for (uint32_t x = 0; x < 4; ++x) {
+                        uint32_t sx = std::min(bx * 4 + x, mip.width - 1);
+                        std::memcpy(block + (y * 4 + x) * 4, mip.data.data() + ((size_t)sy * mip.width + sx) * 4, 4);
+                    }
+                }
+                if (!opaque) {
+                    EncodeAlphaBlock(block, out);
+                    out += 8;
+                }
+                EncodeColorBlock(block, out);
+                out += 8;
+            }
+        }
+        mip.data = std::move(encoded);
+    }
+    payload.format = opaque ? TexturePixelFormat::BC1 : TexturePixelFormat::BC3;
+    return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// KTX2 transcode
+// ─────────────────────────────────────────────────────────────────────────────
+bool TranscodeKTX2(std::span<const uint8_t> file, bool preferS3TC, TexturePayload& out) {
+#ifdef AE_USE_BASIS_UNIVERSAL
+    basist::ktx2_transcoder ktx2;// one per call; transcoders aren't shared across threads
+    if (!ktx2.init(file.data(), (uint32_t)file.size()) || !ktx2.start_transcoding()) return false;
+
+    bool hasAlpha = ktx2.get_has_alpha();
+    basist::transcoder_texture_format target;
+    if (preferS3TC) {
+        target     = hasAlpha ? basist::transcoder_texture_format::cTFBC3_RGBA : basist::transcoder_texture_format::cTFBC1_RGB;
+        out.format = hasAlpha ? TexturePixelFormat::BC3 : TexturePixelFormat::BC1;
+    } else {
+        target     = hasAlpha ? basist::transcoder_texture_format::cTFETC2_RGBA : basist::transcoder_texture_format::cTFETC1_RGB;
+        out.format = hasAlpha ? TexturePixelFormat::ETC2_RGBA : TexturePixelFormat::ETC1;
+    }
+    uint32_t bytesPerBlock = basist::basis_get_bytes_per_block_or_pixel(target);
+
+    uint32_t levels = std::max(1u, ktx2.get_levels());
+    out.mips.resize(levels);
+    for (uint32_t level = 0; level < levels; ++level) {
+        basist::ktx2_image_level_info info;
+        if (!ktx2.get_image_level_info(info, level, 0, 0)) return false;
+        TextureMip& mip = out.mips[level];
+        mip.width  = std::max(1u, ktx2.get_width() >> level);
+        mip.height = std::max(1u, ktx2.get_height() >> level);
+        mip.data.resize((size_t)info.m_total_blocks * bytesPerBlock);
+        if (!ktx2.transcode_image_level(level, 0, 0, mip.data.data(), info.m_total_blocks, target)) return false;
+    }
+    return true;
+#else
+    (void)file;
+    (void)preferS3TC;
+    (void)out;
+    return false;
+#endif
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Pipeline
+// ─────────────────────────────────────────────────────────────────────────────
+TexturePipeline::TexturePipeline(TextureUploadSink& sink, TexturePipelineConfig config)
+    : _sink(sink), _config(config), _jobSystem(JobSystem::Get()), _jobsInFlight(std::make_unique<JobCounter>()) {
+    int count = _config.workerCount;
+#ifdef __EMSCRIPTEN__
+    count = 0;// jobs run inline in the web build anyway
+#endif
+    if (count < 0) count = static_cast<int>(std::max(1u, _jobSystem->GetThreadCount() / 2));
+    _maxJobs = count;
+    FileSystem::Get();// the singleton is created lazily and unguarded; do it before jobs race for it
+#ifndef __EMSCRIPTEN__
+    // The web build has no persistent filesystem to cache into
+    if (!_config.diskCacheDir.empty()) _diskCache = std::make_unique<TextureDiskCache>(_config.diskCacheDir);
+#endif
+}
+
+TexturePipeline::~TexturePipeline() {
+    {
+        std::lock_guard<std::mutex> lk(_mutex);
+        _stopping = true;
+    }
+    // Textures being processed finish; queued ones are dropped
+    _jobSystem->Wait(*_jobsInFlight);
+}
+
+bool TexturePipeline::IsLive(const Job& job) const {
+    auto it = _live.find(job.handle);
+    return it != _live.end() && it->second == job.ticket;
+}
+
+TextureHandle TexturePipeline::Request(const std::string& path) {
+    TextureHandle handle = _sink.CreatePlaceholder();
+    Enqueue(handle, path);
+    return handle;
+}
+
+void TexturePipeline::Reload(TextureHandle handle, const std::string& path) {
+    Enqueue(handle, path);
+}
+
+void TexturePipeline::Enqueue(TextureHandle handle, const std::string& path) {
+    Job job{ handle, 0, path };
+    bool start = false;
+    {
+        std::lock_guard<std::mutex> lk(_mutex);
+        job.ticket       = _nextTicket++;
+        _live[job.handle] = job.ticket;
+        if (_maxJobs > 0) {
+            _jobs.push_back(job);
+            start = _running < _maxJobs;
+            if (start) ++_running;
+        }
+    }
+    if (_maxJobs == 0) {
+        Process(std::move(job));
+    } else if (start) {
+        _jobSystem->Execute([this](int) { ProcessNext(); }, *_jobsInFlight);
+    }
+}
+
+// One texture per job, so decodes interleave with the frame's other jobs.
+// While textures are queued, each job submits the next before it finishes.
+void TexturePipeline::ProcessNext() {
+    Job job;
+    {
+        std::lock_guard<std::mutex> lk(_mutex);
+        for (;;) {
+            if (_stopping || _jobs.empty()) {
+                --_running;
+                return;
+            }
+            job = std::move(_jobs.front());
+            _jobs.pop_front();
+            if (IsLive(job)) break;
+        }
+    }
+    Process(std::move(job));
+
+    bool more;
+    {
+        std::lock_guard<std::mutex> lk(_mutex);
+        more = !_stopping && !_jobs.empty();
+        if (!more) --_running;
+    }
+    if (more) _jobSystem->Execute([this](int) { ProcessNext(); }, *_jobsInFlight);
+}
+
+void TexturePipeline::Process(Job job) {
+    Result result{ std::move(job), {}, {}, false };
+    auto start = std::chrono::steady_clock::now();
+
+    // Packs are decoded in place; loose files come through the shared cache.
+    // Shared rather than consumed, also on web, so a second Request or a
+    // Reload of the same path still finds the prefetched bytes.
+    std::span<const uint8_t> file = FileSystem::Get().ReadView(result.job.path);
+    FileSystem::SharedBytes shared;
+    if (file.empty() && (shared = FileSystem::Get().ReadShared(result.job.path))) file = *shared;
+
+    auto read = std::chrono::steady_clock::now();
+    result.times.fileBytes = file.size();
+    result.times.readMs    = std::chrono::duration<float, std::milli>(read - start).count();
+
+    if (!file.empty()) {
+        const std::string& path = result.job.path;
+        if (path.size() >= 5 && path.compare(path.size() - 5, 5, ".ktx2") == 0) {
+            // Already GPU-ready; transcoding is cheaper than a cache round trip
+            result.ok = TranscodeKTX2(file, _config.preferS3TC, result.payload);
+        } else {
+            bool compress = _config.blockCompress && _config.preferS3TC;
+            uint64_t key  = 0;
+            if (_diskCache) {
+                uint64_t hash = TextureDiskCache::HashContents(file);
+                key       = TextureDiskCache::MakeKey(hash, _config.filter, compress);
+                result.ok = _diskCache->Load(key, result.payload);
+                result.times.contentHash  = hash;
+                result.times.diskCacheHit = result.ok;
+            }
+            if (!result.ok) {
+                result.ok = DecodeTextureImage(file, result.payload);
+                if (result.ok) {
+                    GenerateMipChain(result.payload, _config.filter);
+                    if (compress) CompressTextureBC(result.payload);
+                    if (_diskCache) _diskCache->Store(key, result.payload);
+                }
+            }
+        }
+    }
+    result.times.decodeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - read).count();
+
+    std::lock_guard<std::mutex> lk(_mutex);
+    if (IsLive(result.job)) _results.push_back(std::move(result));
+}
+
+size_t TexturePipeline::Pump(size_t byteBudget) {
+    size_t uploaded = 0;
+    for (;;) {
+        if (!_hasUpload) {
+            std::lock_guard<std::mutex> lk(_mutex);
+            while (!_hasUpload && !_results.empty()) {
+                _uploading = std::move(_results.front());
+                _results.pop_front();
+                _hasUpload = IsLive(_uploading.job);
+            }
+            if (!_hasUpload) return uploaded;
+            if (!_uploading.ok || _uploading.payload.mips.empty()) {
+                _live.erase(_uploading.job.handle);
+            } else {
+                _nextLevel = static_cast<uint32_t>(_uploading.payload.mips.size());
+            }
+        }
+        if (!_uploading.ok || _uploading.payload.mips.empty()) {
+            _hasUpload = false;
+            _sink.OnFailed(_uploading.job.handle, _uploading.job.path);
+            continue;
+        }
+
+        {
+            // Cancelled mid-upload: the handle may already be deleted
+            std::lock_guard<std::mutex> lk(_mutex);
+            if (!IsLive(_uploading.job)) {
+                _hasUpload = false;
+                continue;
+            }
+        }
+        if (uploaded > 0 && uploaded + _uploading.payload.mips[_nextLevel - 1].data.size() > byteBudget) {
+            return uploaded;
+        }
+        --_nextLevel;
+        auto start = std::chrono::steady_clock::now();
+        _sink.UploadLevel(_uploading.job.handle, _uploading.payload, _nextLevel);
+        _uploading.times.uploadMs +=
+          std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        uploaded += _uploading.payload.mips[_nextLevel].data.size();
+
+        if (_nextLevel == 0) {
+            _hasUpload = false;
+            {
+                std::lock_guard<std::mutex> lk(_mutex);
+                _live.erase(_uploading.job.handle);
+            }
+            _sink.OnComplete(_uploading.job.handle, _uploading.job.path, _uploading.payload, _uploading.times);
+            _uploading = Result();
+        }
+        if (uploaded >= byteBudget) return uploaded;
+    }
+}
+
+void TexturePipeline::Cancel(TextureHandle handle) {
+    std::lock_guard<std::mutex> lk(_mutex);
+    _live.erase(handle);
+}
+
+void TexturePipeline::CancelAll() {
+    std::lock_guard<std::mutex> lk(_mutex);
+    _live.clear();
+    _jobs.clear();
+    _results.clear();
+}
+
+size_t TexturePipeline::GetPendingCount() const {
+    std::lock_guard<std::mutex> lk(_mutex);
+    return _live.size();
+}
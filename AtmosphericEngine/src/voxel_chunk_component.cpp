@@ -50,6 +50,36 @@ bool VoxelChunkComponent::IsInBounds(int x, int y, int z) const {
     return x >= 0 && x < SIZE && y >= 0 && y < SIZE && z >= 0 && z < SIZE;
 }
 
+void VoxelChunkComponent::SetLOD(int lod) {
+    lod = std::clamp(lod, 0, MAX_LOD);
+    if (_lod != lod) {
+        _lod   = lod;
+        _dirty = true;
+    }
+}
+
+uint8_t VoxelChunkComponent::GetLODVoxel(int x, int y, int z, int lod) const {
+    if (lod == 0) return GetVoxel(x, y, z);
+
+    const int step = 1 << lod;
+    const int x0 = x << lod, y0 = y << lod, z0 = z << lod;
+    if (!IsInBounds(x0, y0, z0)) return 0;
+
+    int     solid = 0;
+    uint8_t top   = 0;
+    for (int ly = step - 1; ly >= 0; --ly) {
+        for (int lx = 0; lx < step; ++lx) {
+            for (int lz = 0; lz < step; ++lz) {
+                uint8_t v = _voxels[x0 + lx][y0 + ly][z0 + lz];
+                if (v == 0) continue;
+                if (top == 0) top = v;
+                ++solid;
+            }
+        }
+    }
+    return (solid * 2 >= step * step * step) ? top : 0;
+}
+
 void VoxelChunkComponent::SetNeighbor(int dx, int dz, VoxelChunkComponent* neighbor) {
     _neighbors[dx + 1][dz + 1] = neighbor;
 }
@@ -69,7 +99,30 @@ uint8_t VoxelChunkComponent::GetVoxelWithNeighbors(int x, int y, int z) const {
     if (dx == 0 && dz == 0) return _voxels[x][y][z];
 
     VoxelChunkComponent* nb = _neighbors[dx + 1][dz + 1];
-    return nb ? nb->GetVoxel(nx, y, nz) : 0;
+    if (!nb || nb->_lod != _lod) return 0; // LOD transition: emit skirt
+    return nb->GetVoxel(nx, y, nz);
+}
+
+uint8_t VoxelChunkComponent::GetLODVoxelWithNeighbors(int x, int y, int z) const {
+    const int n = SIZE >> _lod;
+    if (y < 0 || y >= n) return 0;
+
+    int dx = 0, dz = 0;
+    int nx = x, nz = z;
+
+    if      (x <  0) { nx = x + n; dx = -1; }
+    else if (x >= n) { nx = x - n; dx =  1; }
+
+    if      (z <  0) { nz = z + n; dz = -1; }
+    else if (z >= n) { nz = z - n; dz =  1; }
+
+    if (dx == 0 && dz == 0) return _lodVoxels[(x * n + y) * n + z];
+
+    // Across a LOD transition the neighbour is treated as air, so both sides
+    // emit a boundary wall (skirt) and no crack can open between them.
+    VoxelChunkComponent* nb = _neighbors[dx + 1][dz + 1];
+    if (!nb || nb->_lod != _lod) return 0;
+    return nb->GetLODVoxel(nx, y, nz, _lod);
 }
 
 glm::vec3 VoxelChunkComponent::GetBoundingSphereCenter() const {
@@ -84,21 +137,19 @@ void VoxelChunkComponent::RebuildMesh() {
     if (!_dirty) return;
 
     VoxelMeshBuilder builder;
-
-    for (int axis = 0; axis < 3; ++axis) {
-        for (int layer = 0; layer < SIZE; ++layer) {
-            BuildGreedyLayer(builder, axis, layer, +1);
-            BuildGreedyLayer(builder, axis, layer, -1);
-        }
-    }
-
+    BuildMesh(builder);
     const auto& verts = builder.Build();
+    _vertexCount = verts.size();
+    _dirty = false;
+    if (!_gfx) return;
 
     if (!_mesh) {
         _mesh = new Mesh(MeshType::VOXEL);
         _mesh->SetMaterial(GetVoxelMaterial());
     }
-    if (!verts.empty()) {
+    // Re-upload when the mesh became empty too (e.g. a thin feature that
+    // disappears at a coarser LOD), otherwise the stale geometry stays.
+    if (!verts.empty() || _mesh->initialized) {
         _mesh->Update(verts);
     }
 
@@ -111,8 +162,26 @@ void VoxelChunkComponent::RebuildMesh() {
         wp + glm::vec3(0, s, s), wp + glm::vec3(s, s, s),
     }};
     _mesh->SetBoundingBox(bounds);
+}
 
-    _dirty = false;
+void VoxelChunkComponent::BuildMesh(VoxelMeshBuilder& builder) {
+    const int n = SIZE >> _lod;
+    if (_lod > 0) {
+        _lodVoxels.resize(n * n * n);
+        for (int x = 0; x < n; ++x)
+            for (int y = 0; y < n; ++y)
+                for (int z = 0; z < n; ++z)
+                    _lodVoxels[(x * n + y) * n + z] = GetLODVoxel(x, y, z, _lod);
+    }
+
+    for (int axis = 0; axis < 3; ++axis) {
+        for (int layer = 0; layer < n; ++layer) {
+            BuildGreedyLayer(builder, axis, layer, +1);
+            BuildGreedyLayer(builder, axis, layer, -1);
+        }
+    }
+    builder.Scale(1 << _lod);
+    _lodVoxels.clear();
 }
 
 void VoxelChunkComponent::BuildGreedyLayer(VoxelMeshBuilder& builder,
@@ -120,13 +189,14 @@ void VoxelChunkComponent::BuildGreedyLayer(VoxelMeshBuilder& builder,
 {
     int u_axis = (axis + 1) % 3;
     int v_axis = (axis + 2) % 3;
+    const int n = SIZE >> _lod;
 
     static uint8_t mask[SIZE][SIZE];
     static bool    done[SIZE][SIZE];
     std::memset(mask, 0, sizeof(mask));
 
-    for (int u = 0; u < SIZE; ++u) {
-        for (int v = 0; v < SIZE; ++v) {
+    for (int u = 0; u < n; ++u) {
+        for (int v = 0; v < n; ++v) {
             glm::ivec3 posA(0), posB(0);
             posA[axis]   = layer;
             posA[u_axis] = u;
@@ -134,8 +204,14 @@ void VoxelChunkComponent::BuildGreedyLayer(VoxelMeshBuilder& builder,
             posB         = posA;
             posB[axis]  += dir;
 
-            uint8_t va = GetVoxelWithNeighbors(posA.x, posA.y, posA.z);
-            uint8_t vb = GetVoxelWithNeighbors(posB.x, posB.y, posB.z);
+            uint8_t va, vb;
+            if (_lod == 0) {
+                va = GetVoxelWithNeighbors(posA.x, posA.y, posA.z);
+                vb = GetVoxelWithNeighbors(posB.x, posB.y, posB.z);
+            } else {
+                va = GetLODVoxelWithNeighbors(posA.x, posA.y, posA.z);
+                vb = GetLODVoxelWithNeighbors(posB.x, posB.y, posB.z);
+            }
 
             mask[u][v] = (va != 0 && vb == 0) ? va : 0;
         }
@@ -148,18 +224,18 @@ void VoxelChunkComponent::BuildGreedyLayer(VoxelMeshBuilder& builder,
 
     std::memset(done, 0, sizeof(done));
 
-    for (int u = 0; u < SIZE; ++u) {
-        for (int v = 0; v < SIZE; ++v) {
+    for (int u = 0; u < n; ++u) {
+        for (int v = 0; v < n; ++v) {
             if (done[u][v] || mask[u][v] == 0) continue;
 
             uint8_t voxelId = mask[u][v];
 
             int w = 1;
-            while (u + w < SIZE && mask[u + w][v] == voxelId && !done[u + w][v])
+            while (u + w < n && mask[u + w][v] == voxelId && !done[u + w][v])
                 ++w;
 
             int h = 1;
-            while (v + h < SIZE) {
+            while (v + h < n) {
                 bool ok = true;
                 for (int k = 0; k < w; ++k) {
                     if (mask[u + k][v + h] != voxelId || done[u + k][v + h]) {
@@ -4,6 +4,7 @@
 #include "game_object.hpp"
 #include "graphics_server.hpp"
 #include "frustum.hpp"
+#include "job_system.hpp"
 #include "light_component.hpp"
 #include "material.hpp"
 #include "sun_component.hpp"
@@ -11,34 +12,18 @@
 #include "FastNoiseLite.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <limits>
 
 void VoxelWorld::Init(Application* app, int seed) {
+    _app  = app;
     _gfx  = app->GetGraphicsServer();
     _seed = seed;
 
-    const int total = WORLD_X * WORLD_Y * WORLD_Z;
-    _chunks.reserve(total);
-
-    for (int cx = 0; cx < WORLD_X; ++cx) {
-        for (int cy = 0; cy < WORLD_Y; ++cy) {
-            for (int cz = 0; cz < WORLD_Z; ++cz) {
-                glm::vec3 worldPos = glm::vec3(cx, cy, cz) *
-                                     static_cast<float>(VoxelChunkComponent::SIZE);
-                GameObject* go = app->CreateGameObject(worldPos);
-                go->SetName("VoxelChunk_" + std::to_string(cx) + "_" +
-                            std::to_string(cy) + "_" + std::to_string(cz));
-
-                auto* comp = new VoxelChunkComponent(go, _gfx, glm::ivec3(cx, cy, cz));
-                go->AddComponent(comp);
-                _chunks.push_back(comp);
-            }
-        }
-    }
-
+    CreateChunkGrid();
     GenerateTerrain();
-    LinkNeighbors();
-    RebuildDirtyChunks();
+    RebuildDirtyChunks(std::numeric_limits<float>::infinity());
 
     // Sun GameObject: owns the directional light + visual billboard params
     GameObject* sunGO = app->CreateGameObject(glm::vec3(0));
@@ -64,8 +49,31 @@ void VoxelWorld::Init(Application* app, int seed) {
     _waterMesh->SetMaterial(_waterMat);
 }
 
-void VoxelWorld::Update(float /*dt*/, const glm::vec3& /*cameraPos*/) {
-    RebuildDirtyChunks();
+void VoxelWorld::InitHeadless(int seed, bool parallel) {
+    _seed = seed;
+    CreateChunkGrid();
+    GenerateTerrain(parallel);
+}
+
+void VoxelWorld::CreateChunkGrid() {
+    const int total = WORLD_X * WORLD_Y * WORLD_Z;
+    _chunks.reserve(total);
+    _chunkMap.reserve(total);
+
+    for (int cx = 0; cx < WORLD_X; ++cx) {
+        for (int cy = 0; cy < WORLD_Y; ++cy) {
+            for (int cz = 0; cz < WORLD_Z; ++cz) {
+                CreateChunk(glm::ivec3(cx, cy, cz));
+            }
+        }
+    }
+}
+
+void VoxelWorld::Update(float /*dt*/, const glm::vec3& cameraPos) {
+    _cameraPos = cameraPos;
+    ApplyPendingEdits();
+    UpdateLODs(cameraPos);
+    RebuildDirtyChunks(remeshBudgetMs);
 }
 
 void VoxelWorld::SubmitRenderCommands(Renderer* renderer,
@@ -99,35 +107,327 @@ void VoxelWorld::SubmitRenderCommands(Renderer* renderer,
 }
 
 uint8_t VoxelWorld::GetVoxel(int wx, int wy, int wz) const {
-    int cx = wx / VoxelChunkComponent::SIZE, lx = wx % VoxelChunkComponent::SIZE;
-    int cy = wy / VoxelChunkComponent::SIZE, ly = wy % VoxelChunkComponent::SIZE;
-    int cz = wz / VoxelChunkComponent::SIZE, lz = wz % VoxelChunkComponent::SIZE;
-    VoxelChunkComponent* c = GetChunk(cx, cy, cz);
-    return c ? c->GetVoxel(lx, ly, lz) : 0;
+    using C = VoxelChunkComponent;
+    C* c = GetChunkCached(C::WorldToChunk(wx), C::WorldToChunk(wy), C::WorldToChunk(wz));
+    return c ? c->GetVoxel(C::WorldToLocal(wx), C::WorldToLocal(wy), C::WorldToLocal(wz)) : 0;
 }
 
 void VoxelWorld::SetVoxel(int wx, int wy, int wz, uint8_t type) {
-    int cx = wx / VoxelChunkComponent::SIZE, lx = wx % VoxelChunkComponent::SIZE;
-    int cy = wy / VoxelChunkComponent::SIZE, ly = wy % VoxelChunkComponent::SIZE;
-    int cz = wz / VoxelChunkComponent::SIZE, lz = wz % VoxelChunkComponent::SIZE;
-    VoxelChunkComponent* c = GetChunk(cx, cy, cz);
-    if (c) c->SetVoxel(lx, ly, lz, type);
+    WriteVoxel(wx, wy, wz, type);
+}
+
+void VoxelWorld::QueueEdit(int wx, int wy, int wz, uint8_t type) {
+    _pendingEdits[glm::ivec3(wx, wy, wz)] = type;
+}
+
+void VoxelWorld::ApplyPendingEdits() {
+    if (_pendingEdits.empty()) return;
+    ZoneScoped;
+    for (const auto& [p, type] : _pendingEdits) {
+        WriteVoxel(p.x, p.y, p.z, type);
+    }
+    _pendingEdits.clear();
+}
+
+void VoxelWorld::WriteVoxel(int wx, int wy, int wz, uint8_t type) {
+    using C = VoxelChunkComponent;
+    const int cx = C::WorldToChunk(wx), cy = C::WorldToChunk(wy), cz = C::WorldToChunk(wz);
+    const glm::ivec3 local(C::WorldToLocal(wx), C::WorldToLocal(wy), C::WorldToLocal(wz));
+
+    C* c = GetChunkCached(cx, cy, cz);
+    if (!c || c->GetVoxel(local.x, local.y, local.z) == type) return;
+    c->SetVoxel(local.x, local.y, local.z, type); // marks c dirty
+    DirtyNeighbours(cx, cy, cz, local, local + 1);
+}
+
+void VoxelWorld::DirtyNeighbours(int cx, int cy, int cz, const glm::ivec3& lo, const glm::ivec3& hi) {
+    using C = VoxelChunkComponent;
+    // Chunks only cull faces against horizontal neighbours, so only edits
+    // near an x/z border can change another chunk's mesh.  `gap` is the
+    // distance from the box to the shared face.
+    constexpr int REACH = 1 << C::MAX_LOD;
+    auto dirty = [this, cy](int nx, int nz, int gap) {
+        if (gap >= REACH) return;
+        if (C* nb = GetChunk(nx, cy, nz); nb && gap < (1 << nb->GetLOD())) nb->MarkDirty();
+    };
+    dirty(cx - 1, cz, lo.x);
+    dirty(cx + 1, cz, C::SIZE - hi.x);
+    dirty(cx, cz - 1, lo.z);
+    dirty(cx, cz + 1, C::SIZE - hi.z);
+}
+
+void VoxelWorld::FillRegion(const glm::ivec3& min, const glm::ivec3& max, uint8_t type) {
+    using C = VoxelChunkComponent;
+    if (glm::any(glm::greaterThanEqual(min, max))) return;
+
+    const glm::ivec3 cmin(C::WorldToChunk(min.x), C::WorldToChunk(min.y), C::WorldToChunk(min.z));
+    const glm::ivec3 cmax(C::WorldToChunk(max.x - 1), C::WorldToChunk(max.y - 1), C::WorldToChunk(max.z - 1));
+
+    for (int cx = cmin.x; cx <= cmax.x; ++cx) {
+        for (int cy = cmin.y; cy <= cmax.y; ++cy) {
+            for (int cz = cmin.z; cz <= cmax.z; ++cz) {
+                C* c = GetChunk(cx, cy, cz);
+                if (!c) continue;
+                // Clip the box to this chunk, in local coordinates
+                const glm::ivec3 base = glm::ivec3(cx, cy, cz) * C::SIZE;
+                const glm::ivec3 lo = glm::max(min - base, glm::ivec3(0));
+                const glm::ivec3 hi = glm::min(max - base, glm::ivec3(C::SIZE));
+                for (int x = lo.x; x < hi.x; ++x)
+                    for (int y = lo.y; y < hi.y; ++y)
+                        for (int z = lo.z; z < hi.z; ++z)
+                            c->SetVoxel(x, y, z, type);
+                DirtyNeighbours(cx, cy, cz, lo, hi);
+            }
+        }
+    }
+}
+
+void VoxelWorld::ReadRegion(const glm::ivec3& min, const glm::ivec3& max,
+                            std::vector<uint8_t>& out) const
+{
+    using C = VoxelChunkComponent;
+    if (glm::any(glm::greaterThanEqual(min, max))) { out.clear(); return; }
+
+    const glm::ivec3 ext = max - min;
+    out.assign((size_t)ext.x * ext.y * ext.z, 0);
+
+    const glm::ivec3 cmin(C::WorldToChunk(min.x), C::WorldToChunk(min.y), C::WorldToChunk(min.z));
+    const glm::ivec3 cmax(C::WorldToChunk(max.x - 1), C::WorldToChunk(max.y - 1), C::WorldToChunk(max.z - 1));
+
+    for (int cx = cmin.x; cx <= cmax.x; ++cx) {
+        for (int cy = cmin.y; cy <= cmax.y; ++cy) {
+            for (int cz = cmin.z; cz <= cmax.z; ++cz) {
+                const C* c = GetChunk(cx, cy, cz);
+                if (!c) continue; // missing chunks stay air
+                const glm::ivec3 base = glm::ivec3(cx, cy, cz) * C::SIZE;
+                const glm::ivec3 lo = glm::max(min - base, glm::ivec3(0));
+                const glm::ivec3 hi = glm::min(max - base, glm::ivec3(C::SIZE));
+                for (int x = lo.x; x < hi.x; ++x) {
+                    for (int y = lo.y; y < hi.y; ++y) {
+                        size_t row = ((size_t)(base.x + x - min.x) * ext.y + (base.y + y - min.y)) * ext.z;
+                        for (int z = lo.z; z < hi.z; ++z)
+                            out[row + (base.z + z - min.z)] = c->GetVoxel(x, y, z);
+                    }
+                }
+            }
+        }
+    }
+}
+
+uint8_t VoxelWorld::SampleVoxel(const glm::ivec3& w, ChunkCursor& cursor) const {
+    using C = VoxelChunkComponent;
+    glm::ivec3 cp(C::WorldToChunk(w.x), C::WorldToChunk(w.y), C::WorldToChunk(w.z));
+    if (cp != cursor.pos) {
+        cursor.pos   = cp;
+        cursor.chunk = GetChunk(cp.x, cp.y, cp.z);
+    }
+    return cursor.chunk
+        ? cursor.chunk->GetVoxel(C::WorldToLocal(w.x), C::WorldToLocal(w.y), C::WorldToLocal(w.z))
+        : 0;
+}
+
+bool VoxelWorld::Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance,
+                         VoxelRaycastHit& hit) const
+{
+    using C = VoxelChunkComponent;
+    float len = glm::length(direction);
+    if (!(len > 0.0f) || _chunks.empty()) return false;
+    const glm::vec3 dir = direction / len;
+
+    // Clip to the loaded chunks: nothing outside them can be hit, and the
+    // walk must end even when maxDistance is infinite.
+    const glm::vec3 boxMin = glm::vec3(_chunkMin) * (float)C::SIZE;
+    const glm::vec3 boxMax = glm::vec3(_chunkMax + 1) * (float)C::SIZE;
+    float tStart = 0.0f, tEnd = maxDistance;
+    int   entryAxis = -1;// axis whose face the ray enters the box through
+    for (int a = 0; a < 3; ++a) {
+        if (dir[a] == 0.0f) {
+            if (origin[a] < boxMin[a] || origin[a] > boxMax[a]) return false;
+            continue;
+        }
+        float t0 = (boxMin[a] - origin[a]) / dir[a];
+        float t1 = (boxMax[a] - origin[a]) / dir[a];
+        if (std::min(t0, t1) > tStart) {
+            tStart    = std::min(t0, t1);
+            entryAxis = a;
+        }
+        tEnd = std::min(tEnd, std::max(t0, t1));
+    }
+    if (tStart > tEnd) return false;
+
+    // Walk from where the ray enters the box, not from the origin: a ray
+    // cast from far outside would otherwise step through every empty cell
+    // on the way.  The clamp keeps rounding at the entry face inside it.
+    const glm::vec3 entry = origin + dir * tStart;
+    glm::ivec3 cell   = glm::clamp(glm::ivec3(glm::floor(entry)), glm::ivec3(boxMin), glm::ivec3(boxMax) - 1);
+    glm::ivec3 step   = glm::ivec3(glm::sign(dir));
+    glm::ivec3 normal = glm::ivec3(0);
+    if (entryAxis >= 0) normal[entryAxis] = -step[entryAxis];
+    glm::vec3  tMax, tDelta;
+    for (int a = 0; a < 3; ++a) {
+        if (step[a] != 0) {
+            tDelta[a] = std::abs(1.0f / dir[a]);
+            float boundary = (step[a] > 0) ? (float)(cell[a] + 1) : (float)cell[a];
+            tMax[a] = (boundary - origin[a]) / dir[a];
+        } else {
+            tDelta[a] = std::numeric_limits<float>::infinity();
+            tMax[a]   = std::numeric_limits<float>::infinity();
+        }
+    }
+
+    ChunkCursor cursor;
+    float t = tStart;
+    while (t <= tEnd) {
+        if (uint8_t type = SampleVoxel(cell, cursor)) {
+            hit = { .voxel = cell, .normal = normal, .distance = t, .type = type };
+            return true;
+        }
+        // Advance across the nearest cell boundary
+        int a = (tMax.x < tMax.y) ? ((tMax.x < tMax.z) ? 0 : 2) : ((tMax.y < tMax.z) ? 1 : 2);
+        t        = tMax[a];
+        cell[a] += step[a];
+        tMax[a] += tDelta[a];
+        normal    = glm::ivec3(0);
+        normal[a] = -step[a];
+    }
+    return false;
+}
+
+size_t VoxelWorld::RaycastBatch(const VoxelRay* rays, VoxelRaycastHit* hits, size_t count) const {
+    ZoneScoped;
+    constexpr size_t GRAIN = 256;
+    JobCounter batch;
+    for (size_t begin = 0; begin < count; begin += GRAIN) {
+        size_t end = std::min(count, begin + GRAIN);
+        JobSystem::Get()->Execute([this, rays, hits, begin, end](int /*threadID*/) {
+            for (size_t i = begin; i < end; ++i) {
+                hits[i].type = 0;
+                Raycast(rays[i].origin, rays[i].direction, rays[i].maxDistance, hits[i]);
+            }
+        }, batch);
+    }
+    JobSystem::Get()->Wait(batch);
+
+    size_t numHits = 0;
+    for (size_t i = 0; i < count; ++i)
+        numHits += (hits[i].type != 0);
+    return numHits;
+}
+
+bool VoxelWorld::OverlapBox(const glm::vec3& min, const glm::vec3& max) const {
+    const glm::ivec3 lo = glm::ivec3(glm::floor(min));
+    const glm::ivec3 hi = glm::ivec3(glm::ceil(max)); // exclusive
+    ChunkCursor cursor;
+    for (int x = lo.x; x < hi.x; ++x)
+        for (int z = lo.z; z < hi.z; ++z)
+            for (int y = lo.y; y < hi.y; ++y)
+                if (SampleVoxel(glm::ivec3(x, y, z), cursor)) return true;
+    return false;
+}
+
+bool VoxelWorld::OverlapSphere(const glm::vec3& center, float radius) const {
+    const glm::ivec3 lo = glm::ivec3(glm::floor(center - radius));
+    const glm::ivec3 hi = glm::ivec3(glm::ceil(center + radius));
+    const float r2 = radius * radius;
+    ChunkCursor cursor;
+    for (int x = lo.x; x < hi.x; ++x) {
+        for (int z = lo.z; z < hi.z; ++z) {
+            for (int y = lo.y; y < hi.y; ++y) {
+                // Closest point of the unit cell to the sphere centre
+                glm::vec3 cellMin(x, y, z);
+                glm::vec3 d = glm::clamp(center, cellMin, cellMin + 1.0f) - center;
+                if (glm::dot(d, d) > r2) continue;
+                if (SampleVoxel(glm::ivec3(x, y, z), cursor)) return true;
+            }
+        }
+    }
+    return false;
+}
+
+VoxelChunkComponent* VoxelWorld::CreateChunk(const glm::ivec3& chunkPos) {
+    if (VoxelChunkComponent* existing = GetChunk(chunkPos.x, chunkPos.y, chunkPos.z))
+        return existing;
+
+    VoxelChunkComponent* comp;
+    if (_app) {
+        glm::vec3 worldPos = glm::vec3(chunkPos) * static_cast<float>(VoxelChunkComponent::SIZE);
+        GameObject* go = _app->CreateGameObject(worldPos);
+        go->SetName("VoxelChunk_" + std::to_string(chunkPos.x) + "_" +
+                    std::to_string(chunkPos.y) + "_" + std::to_string(chunkPos.z));
+        comp = new VoxelChunkComponent(go, _gfx, chunkPos);
+        go->AddComponent(comp);
+    } else {
+        comp = _ownedChunks.emplace_back(std::make_unique<VoxelChunkComponent>(nullptr, nullptr, chunkPos)).get();
+    }
+    _chunks.push_back(comp);
+    _chunkMap.emplace(chunkPos, comp);
+    _chunkMin = glm::min(_chunkMin, chunkPos);
+    _chunkMax = glm::max(_chunkMax, chunkPos);
+    _lastChunk    = nullptr; // a cached miss may now resolve to this chunk
+    _lastChunkPos = glm::ivec3(INT32_MIN);
+
+    // Link horizontally adjacent chunks both ways
+    for (int dx = -1; dx <= 1; ++dx) {
+        for (int dz = -1; dz <= 1; ++dz) {
+            if (dx == 0 && dz == 0) continue;
+            VoxelChunkComponent* nb = GetChunk(chunkPos.x + dx, chunkPos.y, chunkPos.z + dz);
+            comp->SetNeighbor(dx, dz, nb);
+            if (!nb) continue;
+            nb->SetNeighbor(-dx, -dz, comp);
+            // Meshing only looks across faces, never diagonally
+            if (dx == 0 || dz == 0) nb->MarkDirty();
+        }
+    }
+    return comp;
 }
 
 VoxelChunkComponent* VoxelWorld::GetChunk(int cx, int cy, int cz) const {
-    int idx = ChunkIndex(cx, cy, cz);
-    if (idx < 0) return nullptr;
-    return _chunks[idx];
+    auto it = _chunkMap.find(glm::ivec3(cx, cy, cz));
+    return it != _chunkMap.end() ? it->second : nullptr;
+}
+
+VoxelChunkComponent* VoxelWorld::GetChunkCached(int cx, int cy, int cz) const {
+    glm::ivec3 pos(cx, cy, cz);
+    if (pos != _lastChunkPos) {
+        _lastChunkPos = pos;
+        _lastChunk    = GetChunk(cx, cy, cz);
+    }
+    return _lastChunk;
 }
 
-int VoxelWorld::ChunkIndex(int cx, int cy, int cz) const {
-    if (cx < 0 || cx >= WORLD_X) return -1;
-    if (cy < 0 || cy >= WORLD_Y) return -1;
-    if (cz < 0 || cz >= WORLD_Z) return -1;
-    return cx * WORLD_Y * WORLD_Z + cy * WORLD_Z + cz;
+int VoxelWorld::GetTerrainHeight(int wx, int wz) const {
+    using C = VoxelChunkComponent;
+    const int cx = C::WorldToChunk(wx), cz = C::WorldToChunk(wz);
+    if (cx < 0 || cz < 0 || cx >= WORLD_X || cz >= WORLD_Z || _columns.empty()) return 0;
+    const TerrainColumn& col = _columns[cx * WORLD_Z + cz];
+    return col.generated ? col.height[C::WorldToLocal(wx)][C::WorldToLocal(wz)] : 0;
 }
 
-void VoxelWorld::GenerateTerrain() {
+void VoxelWorld::GenerateTerrain(bool parallel) {
+    ZoneScoped;
+    _columns.resize(WORLD_X * WORLD_Z);
+
+    // One job per chunk column. Every voxel depends only on the seed and its
+    // world coordinates and each job writes disjoint chunks, so the result is
+    // identical for any worker count.
+    JobCounter counter;
+    for (int cx = 0; cx < WORLD_X; ++cx) {
+        for (int cz = 0; cz < WORLD_Z; ++cz) {
+            if (_columns[cx * WORLD_Z + cz].generated) continue;
+            if (!parallel) {
+                GenerateColumn(cx, cz);
+                continue;
+            }
+            JobSystem::Get()->Execute([this, cx, cz](int /*threadID*/) { GenerateColumn(cx, cz); }, counter);
+        }
+    }
+    JobSystem::Get()->Wait(counter);
+}
+
+void VoxelWorld::GenerateColumn(int cx, int cz) {
+    ZoneScopedN("VoxelWorld::GenerateColumn");
+    constexpr int S = VoxelChunkComponent::SIZE;
+
     FastNoiseLite heightNoise;
     heightNoise.SetSeed(_seed);
     heightNoise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
@@ -143,58 +443,91 @@ void VoxelWorld::GenerateTerrain() {
     caveNoise.SetFrequency(0.04f);
 
     // Match VX: height = noise * 32 + 32, voxel_id = wy + 1 (palette driven by height)
-    const int worldYVoxels = WORLD_Y * VoxelChunkComponent::SIZE;
-
-    for (int cx = 0; cx < WORLD_X; ++cx) {
-        for (int cz = 0; cz < WORLD_Z; ++cz) {
-            for (int lx = 0; lx < VoxelChunkComponent::SIZE; ++lx) {
-                for (int lz = 0; lz < VoxelChunkComponent::SIZE; ++lz) {
-                    int wx = cx * VoxelChunkComponent::SIZE + lx;
-                    int wz = cz * VoxelChunkComponent::SIZE + lz;
-
-                    float h = heightNoise.GetNoise((float)wx, (float)wz);
-                    int height = std::clamp((int)(h * 32.0f + 32.0f), 0, worldYVoxels - 1);
-
-                    for (int wy = 0; wy < height; ++wy) {
-                        float cv = caveNoise.GetNoise((float)wx, (float)wy, (float)wz);
-                        if (cv > 0.55f && wy > 4) continue;
-
-                        int cy = wy / VoxelChunkComponent::SIZE;
-                        int ly = wy % VoxelChunkComponent::SIZE;
-                        VoxelChunkComponent* chunk = GetChunk(cx, cy, cz);
-                        if (!chunk) continue;
-
-                        // voxel_id = wy + 1, matching VX's height-based palette
-                        chunk->SetVoxel(lx, ly, lz, (uint8_t)std::min(wy + 1, 255));
-                    }
+    const int worldYVoxels = WORLD_Y * S;
+
+    // Heightmap: evaluated once per column, shared by all vertical chunks
+    TerrainColumn& col = _columns[cx * WORLD_Z + cz];
+    float h[S * S];
+    for (int lx = 0; lx < S; ++lx)
+        for (int lz = 0; lz < S; ++lz)
+            h[lx * S + lz] = heightNoise.GetNoise((float)(cx * S + lx), (float)(cz * S + lz));
+    for (int i = 0; i < S * S; ++i)
+        col.height[i / S][i % S] = (int16_t)std::clamp((int)(h[i] * 32.0f + 32.0f), 0, worldYVoxels - 1);
+
+    // Cave noise is evaluated a whole y-run at a time into a flat buffer, then
+    // thresholded in a separate pass.  Voxels at wy <= 4 are never carved.
+    float cave[WORLD_Y * S];
+    for (int lx = 0; lx < S; ++lx) {
+        for (int lz = 0; lz < S; ++lz) {
+            const int wx = cx * S + lx;
+            const int wz = cz * S + lz;
+            const int height = col.height[lx][lz];
+
+            for (int wy = 5; wy < height; ++wy)
+                cave[wy] = caveNoise.GetNoise((float)wx, (float)wy, (float)wz);
+
+            for (int cy = 0; cy * S < height; ++cy) {
+                VoxelChunkComponent* chunk = GetChunk(cx, cy, cz);
+                if (!chunk) continue;
+                const int yEnd = std::min(height, (cy + 1) * S);
+                for (int wy = cy * S; wy < yEnd; ++wy) {
+                    if (wy > 4 && cave[wy] > 0.55f) continue;
+                    // voxel_id = wy + 1, matching VX's height-based palette
+                    chunk->SetVoxel(lx, wy - cy * S, lz, (uint8_t)std::min(wy + 1, 255));
                 }
             }
         }
     }
+    col.generated = true;
 }
 
-void VoxelWorld::LinkNeighbors() {
-    for (int cx = 0; cx < WORLD_X; ++cx) {
-        for (int cy = 0; cy < WORLD_Y; ++cy) {
-            for (int cz = 0; cz < WORLD_Z; ++cz) {
-                VoxelChunkComponent* chunk = GetChunk(cx, cy, cz);
-                if (!chunk) continue;
+int VoxelWorld::SelectLOD(int currentLod, float distance) {
+    int lod = std::clamp(currentLod, 0, VoxelChunkComponent::MAX_LOD);
+    // Coarsen only once clearly past the threshold, refine only once clearly inside it
+    while (lod < VoxelChunkComponent::MAX_LOD && distance > LOD_DISTANCES[lod] + LOD_HYSTERESIS)
+        ++lod;
+    while (lod > 0 && distance < LOD_DISTANCES[lod - 1] - LOD_HYSTERESIS)
+        --lod;
+    return lod;
+}
 
-                for (int dx = -1; dx <= 1; ++dx) {
-                    for (int dz = -1; dz <= 1; ++dz) {
-                        if (dx == 0 && dz == 0) continue;
-                        chunk->SetNeighbor(dx, dz, GetChunk(cx + dx, cy, cz + dz));
-                    }
-                }
-            }
+void VoxelWorld::UpdateLODs(const glm::vec3& cameraPos) {
+    static constexpr int OFFSETS[4][2] = { {1, 0}, {-1, 0}, {0, 1}, {0, -1} };
+
+    for (auto* chunk : _chunks) {
+        float dist = glm::distance(cameraPos, chunk->GetBoundingSphereCenter());
+        int   lod  = SelectLOD(chunk->GetLOD(), dist);
+        if (lod == chunk->GetLOD()) continue;
+
+        chunk->SetLOD(lod);
+        // Neighbours decide whether to emit a skirt against this chunk
+        glm::ivec3 cp = chunk->GetChunkPos();
+        for (const auto& o : OFFSETS) {
+            if (VoxelChunkComponent* nb = GetChunk(cp.x + o[0], cp.y, cp.z + o[1]))
+                nb->MarkDirty();
         }
     }
 }
 
-void VoxelWorld::RebuildDirtyChunks() {
+void VoxelWorld::RebuildDirtyChunks(float budgetMs) {
+    ZoneScoped;
+    std::vector<std::pair<float, VoxelChunkComponent*>> dirty;
     for (auto* chunk : _chunks) {
         if (chunk->IsDirty()) {
-            chunk->RebuildMesh();
+            glm::vec3 d = chunk->GetBoundingSphereCenter() - _cameraPos;
+            dirty.emplace_back(glm::dot(d, d), chunk);
         }
     }
+    if (dirty.empty()) return;
+
+    std::sort(dirty.begin(), dirty.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    for (auto& [dist2, chunk] : dirty) {
+        chunk->RebuildMesh();
+        std::chrono::duration<float, std::milli> elapsed = Clock::now() - start;
+        if (elapsed.count() >= budgetMs) break;
+    }
 }
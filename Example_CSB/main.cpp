@@ -1,5 +1,7 @@
 #include "Atmospheric.hpp"
 
+#include <chrono>
+
 class CSBDemo : public Application {
     using Application::Application;
 
@@ -40,6 +42,7 @@ class CSBDemo : public Application {
         console.Info("1 - Toggle debug grid/coordinate system");
         console.Info("2 - Toggle node info overlay");
         console.Info("R - Reload scene");
+        console.Info("B - Benchmark CSB loading");
         console.Info("ESC - Quit");
     }
 
@@ -205,6 +208,10 @@ class CSBDemo : public Application {
             ReloadScene();
         }
 
+        if (input.IsKeyPressed(Key::B)) {
+            RunLoadBenchmark();
+        }
+
         if (input.IsKeyDown(Key::ESCAPE)) {
             Quit();
         }
@@ -219,6 +226,47 @@ class CSBDemo : public Application {
         }
     }
 
+    // Loads Canvas.csb from memory repeatedly, releasing the scene arena after
+    // each load, and reports what one load costs.  Heap allocation counts for
+    // arena vs per-object builds are in bench/scene_arena_bench.
+    void RunLoadBenchmark() {
+        constexpr int LOADS = 100;
+        auto bytes = FileSystem::Get().ReadSync("assets/scenes/Canvas.csb");
+        if (bytes.empty()) {
+            console.Warn("Benchmark: assets/scenes/Canvas.csb not found");
+            return;
+        }
+        SceneLoadConfig config;
+        config.loadTextures = false;
+        config.overrideRootPosition = true;
+
+        ReleaseSceneArena();
+        loadedScene = {};
+        const SceneArena& arena = GetSceneArena();
+        size_t blocksBefore = arena.GetBlockAllocations();
+        size_t arenaBytes = 0, nodes = 0;
+        std::chrono::duration<double, std::milli> elapsed{ 0 };
+        for (int i = 0; i < LOADS; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            SceneLoadResult result = sceneLoader->LoadFromBuffer(bytes.data(), bytes.size(), config);
+            elapsed += std::chrono::steady_clock::now() - start;
+            arenaBytes = arena.GetBytesUsed();
+            nodes = result.allNodes.size();
+            ReleaseSceneArena();
+        }
+        console.Info(fmt::format(
+          "Benchmark: {} loads of {} nodes, {:.3f} ms/load, {} arena bytes/load, "
+          "{} arena blocks allocated in total",
+          LOADS,
+          nodes,
+          elapsed.count() / LOADS,
+          arenaBytes,
+          arena.GetBlockAllocations() - blocksBefore
+        ));
+
+        loadedScene = sceneLoader->Load("assets/scenes/Canvas.csb", glm::vec3(0.0f), CanvasLayer::LAYER_WORLD);
+    }
+
     void DrawDebugGrid() {
         // Draw using ImGui overlay
         ImGui::SetNextWindowPos(ImVec2(0, 0));
@@ -24,7 +24,7 @@ class VoxelWorldApp : public Application {
             bloom->bloomStrength = 0.06f;
         }
 
-        console.Info("VoxelWorld loaded. WASD move, RF up/down, IJKL look, ESC quit.");
+        console.Info("VoxelWorld loaded. WASD move, RF up/down, IJKL look, SPACE dig, ESC quit.");
     }
 
     void OnUpdate(float dt, float /*time*/) override {
@@ -49,6 +49,19 @@ class VoxelWorldApp : public Application {
 
         mainCamera->gameObject->SetPosition(pos);
 
+        // SPACE: dig a small crater where the camera is looking
+        if (input.IsKeyPressed(Key::SPACE)) {
+            VoxelRaycastHit hit;
+            if (_world.Raycast(mainCamera->GetEyePosition(), mainCamera->GetEyeDirection(), 256.0f, hit)) {
+                const int r = 3;
+                for (int x = -r; x <= r; ++x)
+                    for (int y = -r; y <= r; ++y)
+                        for (int z = -r; z <= r; ++z)
+                            if (x * x + y * y + z * z <= r * r)
+                                _world.QueueEdit(hit.voxel.x + x, hit.voxel.y + y, hit.voxel.z + z, 0);
+            }
+        }
+
         _world.Update(dt, pos);
 
         glm::mat4 viewProj = mainCamera->GetProjectionMatrix() * mainCamera->GetViewMatrix();
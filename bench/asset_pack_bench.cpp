@@ -0,0 +1,125 @@
+// Loading a project's worth of small assets from a mounted pack against
+// loose files, through FileSystem as the engine does: ConsumeSync for loose
+// files, ReadView for the pack.  Cold runs evict every file from the OS page
+// cache first (Linux only), so they include the disk; warm runs don't.  Both
+// touch one byte per page of every asset, so mapped pages are really read.
+#include "asset_pack.hpp"
+#include "bench.hpp"
+#include "console.hpp"
+#include "file_system.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    namespace fs = std::filesystem;
+
+    constexpr int RUNS = 10;
+    constexpr int FILES = 2000;
+
+    // Flushes the file, then asks the kernel to drop its cached pages.
+    // Best effort: returns false where that isn't possible.
+    bool Evict(const std::string& path) {
+#if defined(__linux__)
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        bool evicted = fdatasync(fd) == 0 && posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+        close(fd);
+        return evicted;
+#else
+        (void)path;
+        return false;
+#endif
+    }
+
+    size_t Touch(std::span<const uint8_t> bytes) {
+        size_t sum = 0;
+        for (size_t i = 0; i < bytes.size(); i += 4096) sum += bytes[i];
+        return bytes.empty() ? sum : sum + bytes.back();
+    }
+
+    // Sizes from 1 KiB to 128 KiB, skewed small like textures, meshes and scripts
+    std::vector<std::string> WriteProject(const fs::path& root, AssetPackWriter& pack) {
+        std::mt19937 rng(41);
+        std::uniform_int_distribution<int> shift(10, 17);
+        std::vector<std::string> paths;
+        size_t total = 0;
+        for (int i = 0; i < FILES; ++i) {
+            fs::path path = root / "assets" / std::to_string(i / 100) / ("a" + std::to_string(i) + ".bin");
+            fs::create_directories(path.parent_path());
+            std::vector<uint8_t> bytes(size_t(1) << shift(rng));
+            for (auto& byte : bytes) byte = uint8_t(rng());
+            std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+            total += bytes.size();
+            paths.push_back(path.string());
+            pack.Add(paths.back(), std::move(bytes));
+        }
+        std::printf("%d files, %.1f MiB\n", FILES, double(total) / (1 << 20));
+        return paths;
+    }
+}// namespace
+
+int main() {
+    Console console;// MountPack logs through it
+    fs::path root = fs::temp_directory_path() / "ae_asset_pack_bench";
+    fs::remove_all(root);
+    AssetPackWriter writer;
+    std::vector<std::string> paths = WriteProject(root, writer);
+    std::string packPath = (root / "assets.aepack").string();
+    std::string error;
+    if (!writer.Write(packPath, &error)) {
+        std::printf("failed to write the pack: %s\n", error.c_str());
+        return 1;
+    }
+
+    FileSystem& files = FileSystem::Get();
+    auto loadLoose = [&] {
+        size_t sum = 0;
+        for (const auto& path : paths) sum += Touch(files.ConsumeSync(path));
+        bench::KeepAlive(sum);
+    };
+    auto loadPack = [&] {
+        size_t sum = 0;
+        for (const auto& path : paths) sum += Touch(files.ReadView(path));
+        bench::KeepAlive(sum);
+    };
+
+    bool canEvict = Evict(packPath);
+    for (const auto& path : paths) canEvict = Evict(path) && canEvict;
+    if (canEvict) {
+        double loose = bench::MeasureEach("loose files, cold", RUNS, [&] {
+            for (const auto& path : paths) Evict(path);
+        }, loadLoose);
+        // Mounting is part of a cold start: it maps the pack and reads its tables
+        double pack = bench::MeasureEach("pack, cold (mount included)", RUNS, [&] {
+            files.UnmountPacks();
+            Evict(packPath);
+        }, [&] {
+            files.MountPack(packPath);
+            loadPack();
+        });
+        std::printf("    %.1fx\n", loose / pack);
+        files.UnmountPacks();
+    } else {
+        std::printf("can't evict the page cache here, skipping cold runs\n");
+    }
+
+    double loose = bench::Measure("loose files, warm", RUNS, loadLoose);
+    files.MountPack(packPath);
+    double pack = bench::Measure("pack, warm", RUNS, loadPack);
+    std::printf("    %.1fx\n", loose / pack);
+    files.UnmountPacks();
+    fs::remove_all(root);
+    return 0;
+}
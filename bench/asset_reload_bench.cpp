@@ -0,0 +1,110 @@
+// Hot reload of one texture in a 10k-asset project, headless: how long the
+// dependency graph takes to find what a changed file invalidates, against
+// visiting every asset as a reload-everything approach would, and how long
+// FileWatcher::Poll takes to spot one rewritten file among 10k watched ones.
+#include "asset_graph.hpp"
+#include "bench.hpp"
+#include "file_watcher.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+    namespace fs = std::filesystem;
+
+    constexpr int RUNS = 200;
+    constexpr int TEXTURES = 6000, MATERIALS = 2500, MESHES = 1200, SCENES = 20;
+
+    std::string TexturePath(int i) {
+        return "assets/textures/" + std::to_string(i / 500) + "/t" + std::to_string(i) + ".png";
+    }
+
+    // Materials use 3 textures, meshes a file and a material, scenes 300
+    // textures each; TEXTURES + MATERIALS + MESHES + SCENES ≈ 10k assets
+    void BuildProject(AssetGraph& graph) {
+        std::vector<AssetHandle> textures, materials;
+        for (int i = 0; i < TEXTURES; ++i) {
+            AssetHandle texture = graph.Register(AssetKind::Texture, TexturePath(i));
+            graph.AddDependency(texture, graph.Register(AssetKind::File, TexturePath(i)));
+            textures.push_back(texture);
+        }
+        for (int i = 0; i < MATERIALS; ++i) {
+            AssetHandle material = graph.Register(AssetKind::Material, "m" + std::to_string(i));
+            for (int k = 0; k < 3; ++k) graph.AddDependency(material, textures[(i * 3 + k) % TEXTURES]);
+            materials.push_back(material);
+        }
+        for (int i = 0; i < MESHES; ++i) {
+            std::string path = "assets/meshes/mesh" + std::to_string(i) + ".aemesh";
+            AssetHandle mesh = graph.Register(AssetKind::Mesh, path);
+            graph.AddDependency(mesh, graph.Register(AssetKind::File, path));
+            graph.AddDependency(mesh, materials[i % MATERIALS]);
+        }
+        for (int i = 0; i < SCENES; ++i) {
+            AssetHandle scene = graph.Register(AssetKind::Scene, "scene" + std::to_string(i));
+            for (int k = 0; k < 300; ++k) graph.AddDependency(scene, textures[(i * 300 + k) % TEXTURES]);
+        }
+    }
+
+    void RunGraph() {
+        AssetGraph graph;
+        bench::Measure("build 10k-asset graph", 5, [&] {
+            graph.Clear();
+            BuildProject(graph);
+        });
+        std::printf("    %zu nodes (files included)\n", graph.GetCount());
+
+        AssetHandle file = graph.Find(AssetKind::File, TexturePath(42));
+        size_t invalidated = 0;
+        double ms = bench::Measure("invalidate one texture's file ×1000", RUNS, [&] {
+            for (int i = 0; i < 1000; ++i) invalidated = graph.Invalidate(file).size();
+        });
+        std::printf("    %zu assets invalidated, file included; %.2f µs each\n", invalidated, ms);
+
+        size_t visited = 0;
+        bench::Measure("visit every asset (reload-all)", RUNS, [&] {
+            visited = 0;
+            for (int kind = 0; kind < int(AssetKind::Count); ++kind) {
+                graph.ForEach(AssetKind(kind), [&](AssetHandle, const std::string&) { ++visited; });
+            }
+        });
+        std::printf("    %zu assets visited\n", visited);
+    }
+
+    void RunWatcher() {
+        FileWatcher watcher;
+        if (!watcher.IsSupported()) {
+            std::printf("file watching unsupported here, skipping Poll\n");
+            return;
+        }
+        fs::path root = fs::temp_directory_path() / "ae_asset_reload_bench";
+        fs::remove_all(root);
+        std::vector<std::string> paths;
+        for (int i = 0; i < 10000; ++i) {
+            fs::path path = root / TexturePath(i);
+            fs::create_directories(path.parent_path());
+            std::ofstream(path) << i;
+            paths.push_back(path.string());
+        }
+        for (const auto& path : paths) watcher.Watch(path);
+        watcher.Poll();
+
+        bench::Measure("Poll, nothing changed (10k watched)", RUNS, [&] { bench::KeepAlive(watcher.Poll().size()); });
+        size_t reported = 0;
+        int run = 0;
+        bench::Measure("rewrite one file + Poll", RUNS, [&] {
+            std::ofstream(paths[4242]) << ++run;
+            reported = watcher.Poll().size();
+        });
+        std::printf("    %zu path(s) reported per rewrite\n", reported);
+        fs::remove_all(root);
+    }
+}// namespace
+
+int main() {
+    RunGraph();
+    RunWatcher();
+    return 0;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Minimal benchmark harness
+//
+// Measure() runs a callable `runs` times after one warm-up call and prints the
+// fastest and median wall time; the median is returned for derived figures
+// (throughput, per-item cost).  MeasureEach() skips the warm-up and runs an
+// untimed setup before every run instead, for runs that must start from a
+// given state such as a cold page cache.  KeepAlive() stops the optimizer
+// from deleting work whose result is otherwise unused.
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace bench {
+
+template<typename T> inline void KeepAlive(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// Median milliseconds per run; setup() runs untimed before each one
+template<typename Setup, typename Fn> double MeasureEach(const char* name, int runs, Setup&& setup, Fn&& fn) {
+    using Clock = std::chrono::steady_clock;
+    std::vector<double> ms(std::max(runs, 1));
+    for (double& sample : ms) {
+        setup();
+        auto start = Clock::now();
+        fn();
+        sample = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+    std::sort(ms.begin(), ms.end());
+    double median = ms[ms.size() / 2];
+    std::printf("%-40s min %9.3f ms   median %9.3f ms   (%zu runs)\n", name, ms.front(), median, ms.size());
+    return median;
+}
+
+// Median milliseconds per run
+template<typename Fn> double Measure(const char* name, int runs, Fn&& fn) {
+    fn();// warm-up: caches, lazy allocations, thread pool start
+    return MeasureEach(name, runs, [] {}, fn);
+}
+
+}// namespace bench
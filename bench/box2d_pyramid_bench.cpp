@@ -0,0 +1,68 @@
+// Box2D step time for a large box pyramid, serial and bridged onto the
+// JobSystem at 2 to N workers.  Like Example_Physics2D's spawner piling
+// polygons up, but with every body in contact from the first step.
+#include "bench.hpp"
+#include "box2d_task_scheduler.hpp"
+#include "job_system.hpp"
+
+#include <box2d/box2d.h>
+
+#include <cstdio>
+#include <memory>
+
+namespace {
+    constexpr int BASE = 100;// 5050 boxes
+    constexpr int STEPS = 120;
+
+    b2WorldId MakePyramid(Box2DTaskScheduler* scheduler) {
+        b2WorldDef worldDef = b2DefaultWorldDef();
+        if (scheduler) scheduler->Configure(worldDef);
+        b2WorldId world = b2CreateWorld(&worldDef);
+
+        b2BodyDef groundDef = b2DefaultBodyDef();
+        groundDef.position = { 0.0f, -1.0f };
+        b2BodyId ground = b2CreateBody(world, &groundDef);
+        b2ShapeDef shapeDef = b2DefaultShapeDef();
+        b2Polygon groundBox = b2MakeBox(200.0f, 1.0f);
+        b2CreatePolygonShape(ground, &shapeDef, &groundBox);
+
+        b2Polygon box = b2MakeBox(0.5f, 0.5f);
+        for (int row = 0; row < BASE; ++row) {
+            for (int i = 0; i < BASE - row; ++i) {
+                b2BodyDef bodyDef = b2DefaultBodyDef();
+                bodyDef.type = b2_dynamicBody;
+                bodyDef.position = { (float)i + 0.5f * (float)row - 0.5f * (float)BASE, 0.5f + (float)row };
+                b2BodyId body = b2CreateBody(world, &bodyDef);
+                b2CreatePolygonShape(body, &shapeDef, &box);
+            }
+        }
+        return world;
+    }
+
+    void Run(int workers) {
+        std::unique_ptr<Box2DTaskScheduler> scheduler;
+        if (workers > 1) scheduler = std::make_unique<Box2DTaskScheduler>(*JobSystem::Get(), workers);
+        char name[64];
+        std::snprintf(name, sizeof(name), "%d worker(s)", scheduler ? scheduler->GetWorkerCount() : 1);
+
+        double ms = bench::Measure(name, 3, [&] {
+            b2WorldId world = MakePyramid(scheduler.get());
+            for (int step = 0; step < STEPS; ++step) {
+                b2World_Step(world, 1.0f / 60.0f, 4);
+                if (scheduler) scheduler->EndStep();
+            }
+            b2DestroyWorld(world);
+        });
+        std::printf("    %.3f ms per step (including setup)\n", ms / STEPS);
+    }
+}// namespace
+
+int main() {
+    const int threads = (int)JobSystem::Get()->GetThreadCount();
+    std::printf("%d boxes, %d steps per run, %d JobSystem threads\n", BASE * (BASE + 1) / 2, STEPS, threads);
+    Run(1);
+    for (int workers = 2; workers < threads; workers *= 2)
+        Run(workers);
+    if (threads > 1) Run(threads);
+    return 0;
+}
@@ -0,0 +1,93 @@
+// Back-to-front sorting of 100k elements: the comparison sort WorldCanvasPass
+// used to do (glm::length in the comparator) against DepthSorter on fresh
+// frames, coherent frames where everything moved a little, and 16-bit keys.
+#include "bench.hpp"
+#include "depth_sort.hpp"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+    constexpr uint32_t COUNT = 100000;
+    constexpr int RUNS = 30;
+
+    std::vector<glm::vec3> MakePositions(uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> coord(-200.0f, 200.0f);
+        std::vector<glm::vec3> positions(COUNT);
+        for (auto& p : positions)
+            p = glm::vec3(coord(rng), coord(rng), coord(rng));
+        return positions;
+    }
+
+    void FarKeys(const std::vector<glm::vec3>& positions, const glm::vec3& eye, int bits, std::vector<uint32_t>& keys) {
+        const uint32_t top = (1u << bits) - 1;
+        for (size_t i = 0; i < positions.size(); ++i) {
+            glm::vec3 d = positions[i] - eye;
+            keys[i] = top - QuantizeDepth(glm::dot(d, d), bits);
+        }
+    }
+}// namespace
+
+int main() {
+    auto positions = MakePositions(1);
+    const glm::vec3 eye(0.0f, 10.0f, -300.0f);
+    std::vector<uint32_t> keys(COUNT);
+    std::printf("%u elements\n", COUNT);
+
+    std::vector<uint32_t> order(COUNT);
+    bench::Measure("std::sort, glm::length comparator", RUNS, [&] {
+        std::iota(order.begin(), order.end(), 0u);
+        std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+            return glm::length(positions[a] - eye) > glm::length(positions[b] - eye);
+        });
+        bench::KeepAlive(order[0]);
+    });
+
+    bench::Measure("std::sort, precomputed 31-bit keys", RUNS, [&] {
+        FarKeys(positions, eye, 31, keys);
+        std::iota(order.begin(), order.end(), 0u);
+        std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+        bench::KeepAlive(order[0]);
+    });
+
+    // A fresh sorter each run: no history, straight to the radix sort
+    bench::Measure("DepthSorter, 31-bit keys, no history", RUNS, [&] {
+        DepthSorter sorter;
+        FarKeys(positions, eye, 31, keys);
+        bench::KeepAlive(sorter.Sort(keys.data(), COUNT)[0]);
+    });
+    bench::Measure("DepthSorter, 16-bit keys, no history", RUNS, [&] {
+        DepthSorter sorter;
+        FarKeys(positions, eye, 16, keys);
+        bench::KeepAlive(sorter.Sort(keys.data(), COUNT)[0]);
+    });
+
+    // The camera creeps forward: last frame's order is nearly right
+    DepthSorter coherent;
+    glm::vec3 moving = eye;
+    int insertionFrames = 0, frames = 0;
+    bench::Measure("DepthSorter, 31-bit keys, camera moving", RUNS, [&] {
+        moving.z += 0.05f;
+        FarKeys(positions, moving, 31, keys);
+        bench::KeepAlive(coherent.Sort(keys.data(), COUNT)[0]);
+        insertionFrames += coherent.UsedInsertionSort();
+        ++frames;
+    });
+    std::printf("    %d of %d frames finished with insertion sort\n", insertionFrames, frames);
+
+    // Every element jumps: history is useless and the insertion budget is spent
+    auto other = MakePositions(2);
+    bool flip = false;
+    bench::Measure("DepthSorter, 31-bit keys, all moved", RUNS, [&] {
+        flip = !flip;
+        FarKeys(flip ? other : positions, eye, 31, keys);
+        bench::KeepAlive(coherent.Sort(keys.data(), COUNT)[0]);
+    });
+    return 0;
+}
@@ -0,0 +1,105 @@
+// File cache contention: threads hammering Find/Insert on a shared key set,
+// against the sharded FileCache and against the single-mutex map it replaced.
+#include "bench.hpp"
+#include "file_cache.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    constexpr int KEYS = 4096;
+    constexpr int OPS_PER_THREAD = 200000;
+    constexpr size_t FILE_SIZE = 4096;
+    constexpr int RUNS = 5;
+
+    // The previous g_cache: one map, one lock, copies out on every hit
+    class SingleLockCache {
+    public:
+        FileSystem::Bytes Find(const std::string& key) {
+            std::lock_guard<std::mutex> lk(_mutex);
+            auto it = _map.find(key);
+            return it != _map.end() ? it->second : FileSystem::Bytes();
+        }
+        void Insert(const std::string& key, FileSystem::Bytes bytes) {
+            std::lock_guard<std::mutex> lk(_mutex);
+            _map[key] = std::move(bytes);
+        }
+
+    private:
+        std::mutex _mutex;
+        std::unordered_map<std::string, FileSystem::Bytes> _map;
+    };
+
+    std::vector<std::string> MakeKeys() {
+        std::vector<std::string> keys;
+        for (int i = 0; i < KEYS; ++i)
+            keys.push_back("assets/textures/tile_" + std::to_string(i) + ".png");
+        return keys;
+    }
+
+    // 90% reads, 10% inserts, each thread with its own key stream
+    template <typename Cache>
+    double Run(const char* label, Cache& cache, const std::vector<std::string>& keys, int threadCount) {
+        char name[64];
+        std::snprintf(name, sizeof(name), "%s, %d threads", label, threadCount);
+        return bench::Measure(name, RUNS, [&] {
+            std::vector<std::thread> threads;
+            for (int t = 0; t < threadCount; ++t) {
+                threads.emplace_back([&, t] {
+                    std::mt19937 rng(t);
+                    std::uniform_int_distribution<int> key(0, KEYS - 1), op(0, 9);
+                    size_t sum = 0;
+                    for (int n = 0; n < OPS_PER_THREAD; ++n) {
+                        const auto& k = keys[key(rng)];
+                        if (op(rng) == 0) {
+                            cache.Insert(k, FileSystem::Bytes(FILE_SIZE, 1));
+                        } else if constexpr (std::is_same_v<Cache, FileCache>) {
+                            auto bytes = cache.Find(k);
+                            sum += bytes ? bytes->size() : 0;
+                        } else {
+                            sum += cache.Find(k).size();
+                        }
+                    }
+                    bench::KeepAlive(sum);
+                });
+            }
+            for (auto& thread : threads)
+                thread.join();
+        });
+    }
+}// namespace
+
+int main() {
+    auto keys = MakeKeys();
+    unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::printf("%d keys of %zu bytes, %d ops per thread, %u hardware threads\n", KEYS, FILE_SIZE, OPS_PER_THREAD, hardware);
+
+    for (int threadCount : { 1, 2, 4, 8, 16 }) {
+        if (threadCount > 1 && (unsigned)threadCount > hardware * 2) break;
+        SingleLockCache single;
+        FileCache sharded;
+        for (const auto& k : keys) {
+            single.Insert(k, FileSystem::Bytes(FILE_SIZE, 1));
+            sharded.Insert(k, FileSystem::Bytes(FILE_SIZE, 1));
+        }
+        double before = Run("single lock", single, keys, threadCount);
+        double after = Run("sharded", sharded, keys, threadCount);
+        std::printf("    %.1fx\n", before / after);
+    }
+
+    // Half the working set fits: every insert evicts
+    FileCache tight;
+    tight.SetBudget(KEYS / 2 * FILE_SIZE);
+    Run("sharded, evicting", tight, keys, 4);
+    auto stats = tight.GetStats();
+    std::printf("    %llu hits, %llu misses, %llu evictions\n", (unsigned long long)stats.hits,
+                (unsigned long long)stats.misses, (unsigned long long)stats.evictions);
+    return 0;
+}
@@ -0,0 +1,152 @@
+// Cooked meshes: ACMR (transformed vertices per triangle, 16-entry FIFO)
+// and time for each mesh_cooker optimisation pass on a sphere and a grid in
+// scrambled triangle order, then load time for the runtime's two paths —
+// importing the OBJ text against reading and parsing the .aemesh.
+#include "bench.hpp"
+#include "mesh_format.hpp"
+#include "mesh_import.hpp"
+#include "mesh_optimizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    namespace fs = std::filesystem;
+
+    constexpr int RUNS = 5;
+
+    // Scrambles triangle order, as exporters that emit per-material or
+    // per-smoothing-group batches effectively do
+    void ShuffleTriangles(std::vector<uint32_t>& indices, uint32_t seed) {
+        std::vector<uint32_t> order(indices.size() / 3);
+        for (uint32_t i = 0; i < order.size(); ++i) order[i] = i;
+        std::shuffle(order.begin(), order.end(), std::mt19937(seed));
+        std::vector<uint32_t> shuffled;
+        shuffled.reserve(indices.size());
+        for (uint32_t t : order) shuffled.insert(shuffled.end(), &indices[t * 3], &indices[t * 3] + 3);
+        indices.swap(shuffled);
+    }
+
+    MeshSource Grid(uint32_t cells) {
+        MeshSource mesh;
+        const uint32_t side = cells + 1;
+        for (uint32_t z = 0; z < side; ++z) {
+            for (uint32_t x = 0; x < side; ++x) {
+                mesh.positions.insert(mesh.positions.end(), { float(x), std::sin(x * 0.1f) * std::cos(z * 0.1f), float(z) });
+                mesh.uvs.insert(mesh.uvs.end(), { float(x) / cells, float(z) / cells });
+            }
+        }
+        for (uint32_t z = 0; z < cells; ++z) {
+            for (uint32_t x = 0; x < cells; ++x) {
+                uint32_t i = z * side + x;
+                mesh.indices.insert(mesh.indices.end(), { i, i + side, i + 1, i + 1, i + side, i + side + 1 });
+            }
+        }
+        return mesh;
+    }
+
+    MeshSource Sphere(uint32_t rings, uint32_t segments) {
+        MeshSource mesh;
+        const float pi = 3.14159265f;
+        for (uint32_t r = 0; r <= rings; ++r) {
+            float phi = pi * r / rings;
+            for (uint32_t s = 0; s <= segments; ++s) {
+                float theta = 2.0f * pi * s / segments;
+                mesh.positions.insert(mesh.positions.end(), { std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta) });
+                mesh.uvs.insert(mesh.uvs.end(), { float(s) / segments, 1.0f - float(r) / rings });
+            }
+        }
+        for (uint32_t r = 0; r < rings; ++r) {
+            for (uint32_t s = 0; s < segments; ++s) {
+                uint32_t i = r * (segments + 1) + s, below = i + segments + 1;
+                mesh.indices.insert(mesh.indices.end(), { i, i + 1, below, i + 1, below + 1, below });
+            }
+        }
+        return mesh;
+    }
+
+    void WriteOBJ(const fs::path& path, const MeshSource& mesh) {
+        std::ofstream out(path);
+        char line[128];
+        for (size_t v = 0; v < mesh.GetVertexCount(); ++v) {
+            std::snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvt %.6f %.6f\n", mesh.positions[v * 3], mesh.positions[v * 3 + 1],
+                          mesh.positions[v * 3 + 2], mesh.uvs[v * 2], 1.0f - mesh.uvs[v * 2 + 1]);
+            out << line;
+        }
+        for (size_t i = 0; i < mesh.indices.size(); i += 3) {
+            uint32_t a = mesh.indices[i] + 1, b = mesh.indices[i + 1] + 1, c = mesh.indices[i + 2] + 1;
+            std::snprintf(line, sizeof(line), "f %u/%u %u/%u %u/%u\n", a, a, b, b, c, c);
+            out << line;
+        }
+    }
+
+    std::vector<uint8_t> ReadFile(const fs::path& path) {
+        std::ifstream in(path, std::ios::binary);
+        return { std::istreambuf_iterator<char>(in), {} };
+    }
+
+    void Run(const char* name, MeshSource mesh, const fs::path& dir) {
+        const size_t vertexCount = mesh.GetVertexCount(), triCount = mesh.indices.size() / 3;
+        ShuffleTriangles(mesh.indices, 1);
+        std::printf("%s: %zu vertices, %zu triangles\n", name, vertexCount, triCount);
+        GenerateMissingAttributes(mesh);
+        const float scrambled = ComputeACMR(mesh.indices, vertexCount);
+
+        std::vector<uint32_t> indices;
+        bench::Measure("  vertex cache (Forsyth)", RUNS, [&] {
+            indices = mesh.indices;
+            OptimizeVertexCache(indices, vertexCount);
+        });
+        const float cached = ComputeACMR(indices, vertexCount);
+        std::vector<uint32_t> cacheOrder = indices;
+        bench::Measure("  overdraw clusters, 1.05×", RUNS, [&] {
+            indices = cacheOrder;
+            OptimizeOverdraw(indices, mesh.positions, 1.05f);
+        });
+        const float overdraw = ComputeACMR(indices, vertexCount);
+        mesh.indices = indices;
+        MeshSource fetched;
+        bench::Measure("  vertex fetch", RUNS, [&] {
+            fetched = mesh;
+            OptimizeVertexFetch(fetched);
+        });
+        std::printf("    ACMR %.3f scrambled → %.3f vertex cache → %.3f overdraw order (ideal ~0.5)\n", scrambled, cached, overdraw);
+
+        // Load: what AssetManager did before cooking against what it does now
+        fs::path obj = dir / (std::string(name) + ".obj"), cooked = dir / (std::string(name) + ".aemesh");
+        WriteOBJ(obj, fetched);
+        auto bytes = WriteMeshFile(fetched);
+        std::ofstream(cooked, std::ios::binary).write(reinterpret_cast<const char*>(bytes.data()), (std::streamsize)bytes.size());
+        std::printf("    %.1f KB OBJ, %.1f KB cooked\n", fs::file_size(obj) / 1024.0, fs::file_size(cooked) / 1024.0);
+
+        bench::Measure("  load OBJ + normals/tangents", RUNS, [&] {
+            MeshSource loaded;
+            std::string error;
+            ImportOBJ(obj.string(), loaded, error);
+            GenerateMissingAttributes(loaded);
+            bench::KeepAlive(loaded.indices.size());
+        });
+        bench::Measure("  load .aemesh (read + parse)", RUNS, [&] {
+            auto file = ReadFile(cooked);
+            MeshView view;
+            bench::KeepAlive(ParseMeshFile(file, view));
+        });
+        MeshView view;
+        bench::Measure("  parse .aemesh only", RUNS * 20, [&] { bench::KeepAlive(ParseMeshFile(bytes, view)); });
+    }
+}// namespace
+
+int main() {
+    fs::path dir = fs::temp_directory_path() / "ae_mesh_bench";
+    fs::create_directories(dir);
+    Run("sphere", Sphere(256, 512), dir);
+    Run("grid", Grid(512), dir);
+    fs::remove_all(dir);
+    return 0;
+}
@@ -0,0 +1,118 @@
+// 200k CPU particles bouncing in a walled pit: integration plus collision per
+// collider kind on one thread, then every collider at once split across the
+// JobSystem the way ParticleServer slices it.
+#include "bench.hpp"
+#include "job_system.hpp"
+#include "particle_collision.hpp"
+#include "voxel_world.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Atmospheric;
+
+namespace {
+    constexpr uint32_t COUNT = 200000;
+    constexpr uint32_t GRAIN = 16384;
+    constexpr int RUNS = 20;
+    constexpr float DT = 1.0f / 60.0f;
+
+    // Particles scattered over a 64 m square, up to 8 m above the ground
+    ParticleStorage MakeParticles() {
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> xz(0.0f, 64.0f), y(0.0f, 8.0f), v(-4.0f, 4.0f);
+        ParticleStorage s;
+        s.Allocate(COUNT);
+        for (uint32_t i = 0; i < COUNT; ++i) {
+            s.px[i] = xz(rng);
+            s.py[i] = y(rng);
+            s.pz[i] = xz(rng);
+            s.vx[i] = v(rng);
+            s.vy[i] = v(rng);
+            s.vz[i] = v(rng);
+            s.life[i] = 1.0e6f;
+        }
+        s.count = COUNT;
+        return s;
+    }
+
+    const ParticleIntegrateParams INTEGRATE = { .gravity = glm::vec3(0.0f, -9.8f, 0.0f), .damping = 1.0f, .dt = DT };
+    const ParticleCollisionParams COLLIDE = { .restitution = 0.6f, .friction = 0.2f, .radius = 0.05f, .dt = DT };
+
+    void Run(const char* name, const ParticleColliders& colliders) {
+        auto s = MakeParticles();
+        double ms = bench::Measure(name, RUNS, [&] {
+            IntegrateParticles(s, 0, s.count, INTEGRATE);
+            CollideParticles(s, 0, s.count, colliders, COLLIDE);
+        });
+        std::printf("    %.2f ns per particle\n", ms * 1.0e6 / COUNT);
+    }
+}// namespace
+
+int main() {
+    std::printf("%u particles, %u workers\n", COUNT, JobSystem::Get()->GetThreadCount());
+
+    // Ground plus four walls around the pit
+    ParticleColliders planes;
+    planes.planes = {
+        { glm::vec3(0.0f, 1.0f, 0.0f), 0.0f },    { glm::vec3(1.0f, 0.0f, 0.0f), 0.0f },
+        { glm::vec3(-1.0f, 0.0f, 0.0f), -64.0f }, { glm::vec3(0.0f, 0.0f, 1.0f), 0.0f },
+        { glm::vec3(0.0f, 0.0f, -1.0f), -64.0f },
+    };
+
+    ParticleColliders shapes;
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> xz(4.0f, 60.0f), r(0.5f, 3.0f);
+    for (int i = 0; i < 16; ++i) {
+        shapes.spheres.push_back({ glm::vec3(xz(rng), 1.0f, xz(rng)), r(rng) });
+        glm::vec3 c(xz(rng), 1.0f, xz(rng)), e(r(rng));
+        shapes.boxes.push_back({ c - e, c + e });
+    }
+
+    // 65x65 rolling heightfield over the pit
+    std::vector<float> heights(65 * 65);
+    for (int z = 0; z < 65; ++z)
+        for (int x = 0; x < 65; ++x)
+            heights[z * 65 + x] = 1.0f + std::sin(x * 0.3f) * std::cos(z * 0.2f);
+    ParticleColliders terrain;
+    terrain.heightfields.push_back({ heights.data(), 65, 65, glm::vec3(0.0f), 1.0f });
+
+    auto world = std::make_unique<VoxelWorld>();
+    world->InitHeadless(42);
+    ParticleColliders voxels;
+    voxels.voxels = world.get();
+
+    Run("planes", planes);
+    Run("16 spheres + 16 boxes", shapes);
+    Run("heightfield", terrain);
+    Run("voxels", voxels);
+
+    ParticleColliders all = shapes;
+    all.planes = planes.planes;
+    all.heightfields = terrain.heightfields;
+    all.voxels = world.get();
+    Run("all, serial", all);
+
+    auto* jobs = JobSystem::Get();
+    auto s = MakeParticles();
+    double ms = bench::Measure("all, jobs", RUNS, [&] {
+        JobCounter counter;
+        for (uint32_t begin = 0; begin < s.count; begin += GRAIN) {
+            uint32_t end = std::min(begin + GRAIN, s.count);
+            jobs->Execute(
+              [&, begin, end](int) {
+                  IntegrateParticles(s, begin, end, INTEGRATE);
+                  CollideParticles(s, begin, end, all, COLLIDE);
+              },
+              counter
+            );
+        }
+        jobs->Wait(counter);
+    });
+    std::printf("    %.2f ns per particle\n", ms * 1.0e6 / COUNT);
+    return 0;
+}
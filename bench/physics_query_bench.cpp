@@ -0,0 +1,59 @@
+// 10k rays per frame against 2k static boxes: single Raycast calls against
+// RaycastBatch and RaycastAllBatch split across the JobSystem.
+#include "bench.hpp"
+#include "game_object.hpp"
+#include "job_system.hpp"
+#include "physics_server.hpp"
+#include "rigidbody_component.hpp"
+
+#include <btBulletDynamicsCommon.h>
+
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+    constexpr size_t RAYS = 10000;
+    constexpr int    BOXES = 2000;
+    constexpr int    RUNS = 10;
+}// namespace
+
+int main() {
+    PhysicsServer physics;
+    physics.Init(nullptr);
+
+    std::mt19937 rng(32);
+    std::uniform_real_distribution<float> pos(-100.0f, 100.0f), half(0.25f, 2.0f);
+    std::vector<std::unique_ptr<btBoxShape>> shapes;
+    std::vector<std::unique_ptr<GameObject>> objects;
+    for (int i = 0; i < BOXES; ++i) {
+        auto& shape = shapes.emplace_back(std::make_unique<btBoxShape>(btVector3(half(rng), half(rng), half(rng))));
+        auto& go = objects.emplace_back(std::make_unique<GameObject>(nullptr, glm::vec3(pos(rng), pos(rng) * 0.1f, pos(rng))));
+        physics.AddRigidbody(new RigidbodyComponent(go.get(), RigidbodyProps { .mass = 0.0f, .shape = shape.get() }));
+    }
+
+    std::vector<RayQuery> rays(RAYS);
+    for (auto& ray : rays)
+        ray = { .from = glm::vec3(pos(rng), 5.0f, pos(rng)), .to = glm::vec3(pos(rng), -5.0f, pos(rng)) };
+    std::vector<RaycastHit> hits(RAYS * 8);
+    std::vector<uint32_t> offsets(RAYS + 1);
+
+    std::printf("%zu rays, %d boxes, %u workers\n", RAYS, BOXES, JobSystem::Get()->GetThreadCount());
+    bench::Measure("Raycast x 10k", RUNS, [&] {
+        size_t count = 0;
+        for (size_t i = 0; i < RAYS; ++i)
+            count += physics.Raycast(rays[i].from, rays[i].to, hits[i]);
+        bench::KeepAlive(count);
+    });
+    bench::Measure("RaycastBatch", RUNS, [&] {
+        bench::KeepAlive(physics.RaycastBatch(rays.data(), RAYS, hits.data()));
+    });
+    bench::Measure("RaycastAllBatch", RUNS, [&] {
+        bench::KeepAlive(physics.RaycastAllBatch(rays.data(), RAYS, hits.data(), hits.size(), offsets.data()));
+    });
+    std::printf("    %u hits in total\n", offsets.back());
+
+    physics.Reset();
+    return 0;
+}
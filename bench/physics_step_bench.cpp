@@ -0,0 +1,69 @@
+// Frame cost of PhysicsServer::Process around a 250 ms hitch, with 2k boxes
+// falling onto a floor.  With the substep cap the hitch frame runs at most
+// maxSubSteps steps; uncapped it runs all 15 and the frames after it stay
+// slow if a step costs more than the frame budget.
+#include "game_object.hpp"
+#include "physics_server.hpp"
+#include "rigidbody_component.hpp"
+
+#include <btBulletDynamicsCommon.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace {
+    constexpr int BODIES = 2000;
+    constexpr int FRAMES = 180;
+    constexpr int HITCH_FRAME = 60;
+
+    struct Scene {
+        btBoxShape floorShape { btVector3(100.0f, 1.0f, 100.0f) };
+        btBoxShape boxShape { btVector3(0.5f, 0.5f, 0.5f) };
+        std::vector<std::unique_ptr<GameObject>> objects;
+
+        void Populate(PhysicsServer& physics) {
+            auto add = [&](glm::vec3 position, float mass, btCollisionShape* shape) {
+                auto& go = objects.emplace_back(std::make_unique<GameObject>(nullptr, position));
+                physics.AddRigidbody(new RigidbodyComponent(go.get(), RigidbodyProps { .mass = mass, .shape = shape }));
+            };
+            add(glm::vec3(0.0f, -1.0f, 0.0f), 0.0f, &floorShape);
+            for (int i = 0; i < BODIES; ++i)
+                add(glm::vec3((float)(i % 20) * 2.0f - 20.0f, 2.0f + (float)(i / 400) * 2.0f, (float)(i / 20 % 20) * 2.0f - 20.0f), 1.0f, &boxShape);
+        }
+    };
+
+    // Worst frame, and the mean of the frames after the hitch, in ms
+    void Run(PhysicsServer& physics, int maxSubSteps) {
+        Scene scene;
+        scene.Populate(physics);
+        physics.SetMaxSubSteps(maxSubSteps);
+
+        double worst = 0.0, after = 0.0;
+        int steps = 0;
+        for (int frame = 0; frame < FRAMES; ++frame) {
+            float dt = frame == HITCH_FRAME ? 0.25f : 1.0f / 60.0f;
+            auto start = std::chrono::steady_clock::now();
+            physics.Process(dt);
+            physics.SyncTransforms();
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            worst = std::max(worst, ms);
+            if (frame > HITCH_FRAME) after += ms;
+            steps += physics.GetLastStepCount();
+        }
+        std::printf("maxSubSteps %-3d  worst frame %8.3f ms   after hitch %8.3f ms/frame   %d steps\n",
+                    maxSubSteps, worst, after / (FRAMES - HITCH_FRAME - 1), steps);
+        physics.Reset();
+    }
+}// namespace
+
+int main() {
+    PhysicsServer physics;
+    physics.Init(nullptr);
+    std::printf("%d bodies, %d frames at 60 Hz, one 250 ms hitch\n", BODIES, FRAMES);
+    Run(physics, 4);
+    Run(physics, 1000);
+    return 0;
+}
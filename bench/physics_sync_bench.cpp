@@ -0,0 +1,56 @@
+// Transform write-back for 20k bodies of which 1k are awake: the
+// change-driven PhysicsServer::SyncTransforms against visiting every body,
+// as the per-entity loop in Application::Update used to.
+#include "bench.hpp"
+#include "game_object.hpp"
+#include "physics_server.hpp"
+#include "rigidbody_component.hpp"
+
+#include <btBulletDynamicsCommon.h>
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace {
+    constexpr int RESTING = 19000;
+    constexpr int FALLING = 1000;
+    constexpr int GRID = 140;// resting boxes are 2 m apart and never touch
+}// namespace
+
+int main() {
+    PhysicsServer physics;
+    physics.Init(nullptr);
+
+    btBoxShape floorShape(btVector3(GRID + 10.0f, 0.5f, GRID + 10.0f));
+    btBoxShape boxShape(btVector3(0.5f, 0.5f, 0.5f));
+    std::vector<std::unique_ptr<GameObject>> objects;
+    std::vector<RigidbodyComponent*> bodies;
+    auto add = [&](glm::vec3 position, float mass, btCollisionShape* shape) {
+        auto& go = objects.emplace_back(std::make_unique<GameObject>(nullptr, position));
+        bodies.push_back(new RigidbodyComponent(go.get(), RigidbodyProps { .mass = mass, .shape = shape }));
+        physics.AddRigidbody(bodies.back());
+    };
+    add(glm::vec3(0.0f, -0.5f, 0.0f), 0.0f, &floorShape);
+    for (int i = 0; i < RESTING; ++i)
+        add(glm::vec3((float)(i % GRID) * 2.0f - GRID, 0.5f, (float)(i / GRID) * 2.0f - GRID), 1.0f, &boxShape);
+    // High enough to still be falling when the timing starts
+    for (int i = 0; i < FALLING; ++i)
+        add(glm::vec3((float)(i % 40) * 2.0f - 40.0f, 3000.0f, (float)(i / 40) * 2.0f - 40.0f), 1.0f, &boxShape);
+
+    std::printf("%d bodies, %d awake; settling...\n", RESTING + FALLING, FALLING);
+    for (int frame = 0; frame < 180; ++frame)// resting bodies sleep after 2 s
+        physics.Process(1.0f / 60.0f);
+    physics.Process(1.0f / 60.0f);
+
+    const float alpha = physics.GetInterpolationAlpha();
+    double all = bench::Measure("sync every body", 20, [&] {
+        for (auto* rb : bodies)
+            if (!rb->IsKinematic()) rb->gameObject->SyncObjectTransform(rb->GetInterpolatedTransform(alpha));
+    });
+    double moved = bench::Measure("SyncTransforms (moved only)", 20, [&] { physics.SyncTransforms(); });
+    std::printf("    %.1fx less time\n", all / moved);
+
+    physics.Reset();
+    return 0;
+}
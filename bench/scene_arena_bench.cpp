@@ -0,0 +1,129 @@
+// Building and tearing down a CSB-sized scene: every node as one object plus
+// one component plus its name, allocated one by one from the heap (how
+// SceneLoader built scenes before) against a SceneArena reserved up front and
+// released in one go.  The stand-ins own a string and a vector like
+// GameObject and SpriteComponent do, so their destructors still run.
+//
+// This binary replaces global operator new to count heap allocations; that
+// is why it is a bench and not part of any example.
+#include "bench.hpp"
+#include "scene_arena.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static std::atomic<size_t> g_allocations{ 0 };
+
+void* operator new(size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+    constexpr int RUNS = 20;
+
+    struct Node {
+        std::string name;
+        std::vector<Node*> children;
+        float transform[16] = {};
+        Node* parent = nullptr;
+        bool active = true;
+    };
+
+    struct Sprite {
+        explicit Sprite(Node* node) : node(node) {}
+        Node* node;
+        std::vector<float> vertices = std::vector<float>(16);
+        float color[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+        int textureID = -1;
+    };
+
+    std::string NodeName(size_t i) {
+        return "Panel_" + std::to_string(i) + "_Background";// past SSO, as most CSB names are
+    }
+
+    struct HeapScene {
+        std::vector<Node*> nodes;
+        std::vector<Sprite*> sprites;
+        std::vector<std::string> names;
+
+        void Build(size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                Node* node = new Node();
+                node->parent = i ? nodes[(i - 1) / 4] : nullptr;
+                nodes.push_back(node);
+                sprites.push_back(new Sprite(node));
+                names.push_back(NodeName(i));
+            }
+        }
+
+        void Release() {
+            for (Sprite* sprite : sprites) delete sprite;
+            for (Node* node : nodes) delete node;
+            sprites.clear();
+            nodes.clear();
+            names.clear();
+        }
+    };
+
+    struct ArenaScene {
+        SceneArena arena;
+        std::vector<Node*> nodes;
+        std::vector<std::string_view> names;
+
+        void Build(size_t count) {
+            // The loader's pre-pass knows these before creating anything
+            nodes.reserve(count);
+            names.reserve(count);
+            arena.Reserve(count * (SceneArena::SizeFor<Node>() + SceneArena::SizeFor<Sprite>() + 32));
+            for (size_t i = 0; i < count; ++i) {
+                Node* node = arena.New<Node>();
+                node->parent = i ? nodes[(i - 1) / 4] : nullptr;
+                nodes.push_back(node);
+                arena.New<Sprite>(node);
+                names.push_back(arena.CopyString(NodeName(i)));
+            }
+        }
+
+        void Release() {
+            arena.Release();
+            nodes.clear();
+            names.clear();
+        }
+    };
+
+    template<typename Scene> void Run(const char* name, size_t count) {
+        Scene scene;
+        size_t allocations = 0, loads = 0;
+        bench::Measure(name, RUNS, [&] {
+            size_t before = g_allocations.load(std::memory_order_relaxed);
+            scene.Build(count);
+            bench::KeepAlive(scene.nodes.back());
+            scene.Release();
+            allocations += g_allocations.load(std::memory_order_relaxed) - before;
+            ++loads;
+        });
+        std::printf("    %.1f heap allocations per build + release\n", double(allocations) / double(loads));
+    }
+}// namespace
+
+int main() {
+    for (size_t count : { 500u, 5000u }) {
+        std::printf("%zu nodes\n", count);
+        Run<HeapScene>("  heap, object by object", count);
+        Run<ArenaScene>("  scene arena, reserved", count);
+    }
+    return 0;
+}
@@ -0,0 +1,212 @@
+// Texture decode for the engine's default_assets images: a cold load (decode,
+// mip chain, optional BC1/BC3 encode) against a warm load from the decoded
+// disk cache, plus what the range-fit BC encoder costs and how close its
+// output stays to the source (PSNR of level 0), on those images and on a
+// synthetic 1024² one.
+//
+//   texture_decode_bench [default_assets/textures]
+#include "bench.hpp"
+#include "texture_disk_cache.hpp"
+#include "texture_pipeline.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifndef AE_DEFAULT_ASSETS_DIR
+#define AE_DEFAULT_ASSETS_DIR "AtmosphericEngine/default_assets"
+#endif
+
+namespace {
+    namespace fs = std::filesystem;
+
+    constexpr int RUNS = 10;
+
+    struct SourceFile {
+        std::string          name;
+        std::vector<uint8_t> bytes;
+    };
+
+    std::vector<SourceFile> LoadImages(const fs::path& dir) {
+        std::vector<SourceFile> files;
+        for (const auto& entry : fs::directory_iterator(dir)) {
+            auto ext = entry.path().extension();
+            if (ext != ".png" && ext != ".jpg" && ext != ".jpeg") continue;
+            std::ifstream in(entry.path(), std::ios::binary);
+            files.push_back({ entry.path().filename().string(), { std::istreambuf_iterator<char>(in), {} } });
+        }
+        std::sort(files.begin(), files.end(), [](const auto& a, const auto& b) { return a.name < b.name; });
+        return files;
+    }
+
+    // A gradient with noise and a soft wave, optionally with an alpha ramp
+    TexturePayload Synthetic(uint32_t size, bool translucent) {
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int> noise(-6, 6);
+        TexturePayload payload;
+        payload.mips.push_back({ size, size, std::vector<uint8_t>((size_t)size * size * 4) });
+        uint8_t* texel = payload.mips[0].data.data();
+        for (uint32_t y = 0; y < size; ++y) {
+            for (uint32_t x = 0; x < size; ++x, texel += 4) {
+                texel[0] = static_cast<uint8_t>(std::clamp(int(x * 255 / size) + noise(rng), 0, 255));
+                texel[1] = static_cast<uint8_t>(std::clamp(int(y * 255 / size) + noise(rng), 0, 255));
+                texel[2] = static_cast<uint8_t>(128 + int(64 * std::sin(x * 0.05f) * std::cos(y * 0.03f)));
+                texel[3] = translucent ? static_cast<uint8_t>((x + y) * 255 / (2 * size)) : 255;
+            }
+        }
+        return payload;
+    }
+
+    // ── Reference BC decoder, level 0 only ───────────────────────────────────
+    void Expand565(uint16_t c, int rgb[3]) {
+        int r = c >> 11, g = (c >> 5) & 63, b = c & 31;
+        rgb[0] = (r << 3) | (r >> 2);
+        rgb[1] = (g << 2) | (g >> 4);
+        rgb[2] = (b << 3) | (b >> 2);
+    }
+
+    void DecodeColorBlock(const uint8_t* in, uint8_t* out, uint32_t stride) {
+        uint16_t c0 = static_cast<uint16_t>(in[0] | in[1] << 8), c1 = static_cast<uint16_t>(in[2] | in[3] << 8);
+        int palette[4][3];
+        Expand565(c0, palette[0]);
+        Expand565(c1, palette[1]);
+        for (int c = 0; c < 3; ++c) {
+            if (c0 > c1) {
+                palette[2][c] = (2 * palette[0][c] + palette[1][c] + 1) / 3;
+                palette[3][c] = (palette[0][c] + 2 * palette[1][c] + 1) / 3;
+            } else {
+                palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+                palette[3][c] = 0;
+            }
+        }
+        uint32_t indices = in[4] | in[5] << 8 | in[6] << 16 | (uint32_t)in[7] << 24;
+        for (int i = 0; i < 16; ++i) {
+            const int* rgb = palette[(indices >> (2 * i)) & 3];
+            uint8_t* texel = out + (i / 4) * stride + (i % 4) * 4;
+            for (int c = 0; c < 3; ++c) texel[c] = static_cast<uint8_t>(rgb[c]);
+        }
+    }
+
+    void DecodeAlphaBlock(const uint8_t* in, uint8_t* out, uint32_t stride) {
+        int a0 = in[0], a1 = in[1], palette[8] = { a0, a1 };
+        for (int i = 2; i < 8; ++i) {
+            if (a0 > a1) {
+                palette[i] = ((8 - i) * a0 + (i - 1) * a1) / 7;
+            } else {
+                palette[i] = i < 6 ? ((6 - i) * a0 + (i - 1) * a1) / 5 : (i == 6 ? 0 : 255);
+            }
+        }
+        uint64_t indices = 0;
+        for (int k = 0; k < 6; ++k) indices |= static_cast<uint64_t>(in[2 + k]) << (8 * k);
+        for (int i = 0; i < 16; ++i) {
+            out[(i / 4) * stride + (i % 4) * 4 + 3] = static_cast<uint8_t>(palette[(indices >> (3 * i)) & 7]);
+        }
+    }
+
+    std::vector<uint8_t> DecodeBC(const TexturePayload& payload) {
+        const TextureMip& mip = payload.mips[0];
+        const bool bc3 = payload.format == TexturePixelFormat::BC3;
+        const uint32_t stride = mip.width * 4;
+        std::vector<uint8_t> rgba((size_t)stride * mip.height, 255);
+        const uint8_t* in = mip.data.data();
+        for (uint32_t by = 0; by < mip.height / 4; ++by) {
+            for (uint32_t bx = 0; bx < mip.width / 4; ++bx) {
+                uint8_t* out = rgba.data() + (size_t)by * 4 * stride + bx * 16;
+                if (bc3) {
+                    DecodeAlphaBlock(in, out, stride);
+                    in += 8;
+                }
+                DecodeColorBlock(in, out, stride);
+                in += 8;
+            }
+        }
+        return rgba;
+    }
+
+    double PSNR(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+        double squared = 0.0;
+        for (size_t i = 0; i < a.size(); ++i) {
+            double d = double(a[i]) - double(b[i]);
+            squared += d * d;
+        }
+        double mse = squared / double(a.size());
+        return mse == 0.0 ? INFINITY : 10.0 * std::log10(255.0 * 255.0 / mse);
+    }
+
+    // Encoder cost and quality on level 0 alone
+    void MeasureEncode(const TexturePayload& source) {
+        TexturePayload encoded;
+        bench::Measure("  BC encode, level 0", RUNS, [&] {
+            encoded = source;
+            CompressTextureBC(encoded);
+        });
+        if (encoded.format == TexturePixelFormat::RGBA8) {
+            std::printf("    not a multiple of 4, left uncompressed\n");
+            return;
+        }
+        std::printf("    %s, %zu → %zu bytes, PSNR %.2f dB\n", encoded.format == TexturePixelFormat::BC1 ? "BC1" : "BC3",
+                    source.mips[0].data.size(), encoded.mips[0].data.size(), PSNR(source.mips[0].data, DecodeBC(encoded)));
+    }
+}// namespace
+
+int main(int argc, char** argv) {
+    fs::path dir = argc > 1 ? fs::path(argv[1]) : fs::path(AE_DEFAULT_ASSETS_DIR) / "textures";
+    if (!fs::is_directory(dir)) {
+        std::fprintf(stderr, "no texture directory at '%s'\n", dir.string().c_str());
+        return 1;
+    }
+    auto files = LoadImages(dir);
+    std::printf("%zu images from %s\n", files.size(), dir.string().c_str());
+
+    fs::path cacheDir = fs::temp_directory_path() / "ae_texture_decode_bench";
+    fs::remove_all(cacheDir);
+    TextureDiskCache cache(cacheDir.string());
+
+    for (const auto& file : files) {
+        TexturePayload probe;
+        if (!DecodeTextureImage(file.bytes, probe)) {
+            std::printf("%s: decode failed\n", file.name.c_str());
+            continue;
+        }
+        std::printf("%s (%u×%u, %zu bytes)\n", file.name.c_str(), probe.mips[0].width, probe.mips[0].height, file.bytes.size());
+
+        bench::Measure("  decode only", RUNS, [&] {
+            TexturePayload payload;
+            DecodeTextureImage(file.bytes, payload);
+            bench::KeepAlive(payload.mips[0].data[0]);
+        });
+        for (bool compress : { false, true }) {
+            TexturePayload stored;
+            bench::Measure(compress ? "  cold: decode + mips + BC" : "  cold: decode + mips", RUNS, [&] {
+                stored = TexturePayload();
+                DecodeTextureImage(file.bytes, stored);
+                GenerateMipChain(stored, MipFilter::Box);
+                if (compress) CompressTextureBC(stored);
+            });
+            cache.Store(TextureDiskCache::MakeKey(TextureDiskCache::HashContents(file.bytes), MipFilter::Box, compress), stored);
+            // What a warm launch does instead: hash the file, read the payload back
+            bench::Measure(compress ? "  warm: disk cache, BC" : "  warm: disk cache", RUNS, [&] {
+                TexturePayload payload;
+                uint64_t key = TextureDiskCache::MakeKey(TextureDiskCache::HashContents(file.bytes), MipFilter::Box, compress);
+                bench::KeepAlive(cache.Load(key, payload));
+            });
+        }
+        if (probe.format == TexturePixelFormat::RGBA8) MeasureEncode(probe);
+    }
+
+    // The shipped defaults are small; the synthetic image shows the encoder
+    // at a realistic texture size, opaque (BC1) and translucent (BC3)
+    for (bool translucent : { false, true }) {
+        std::printf("synthetic 1024×1024, %s\n", translucent ? "alpha ramp" : "opaque");
+        MeasureEncode(Synthetic(1024, translucent));
+    }
+
+    fs::remove_all(cacheDir);
+    return 0;
+}
@@ -0,0 +1,102 @@
+// Texture pipeline CPU stages, headless: mip generation per filter, and the
+// full decode → mips → upload path for a batch of textures through a sink
+// that only counts bytes, inline against 1..N textures in flight as
+// JobSystem jobs.
+#include "bench.hpp"
+#include "texture_pipeline.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    namespace fs = std::filesystem;
+
+    constexpr uint32_t SIZE      = 1024;
+    constexpr int      FILES     = 32;
+    constexpr uint32_t FILE_SIZE = 256;
+    constexpr int      RUNS      = 5;
+
+    std::vector<uint8_t> Noise(uint32_t width, uint32_t height, uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::vector<uint8_t> rgba((size_t)width * height * 4);
+        for (size_t i = 0; i < rgba.size(); ++i) rgba[i] = (i % 4 == 3) ? 255 : static_cast<uint8_t>(rng());
+        return rgba;
+    }
+
+    // Uncompressed 32-bit TGA, top-left origin
+    void WriteTGA(const std::string& path, uint32_t width, uint32_t height, const std::vector<uint8_t>& rgba) {
+        std::vector<uint8_t> file(18, 0);
+        file[2]  = 2;
+        file[12] = static_cast<uint8_t>(width), file[13] = static_cast<uint8_t>(width >> 8);
+        file[14] = static_cast<uint8_t>(height), file[15] = static_cast<uint8_t>(height >> 8);
+        file[16] = 32;
+        file[17] = 0x28;
+        for (size_t i = 0; i < rgba.size(); i += 4) file.insert(file.end(), { rgba[i + 2], rgba[i + 1], rgba[i], rgba[i + 3] });
+        std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(file.data()), (std::streamsize)file.size());
+    }
+
+    class CountingSink : public TextureUploadSink {
+    public:
+        TextureHandle CreatePlaceholder() override {
+            return ++_handles;
+        }
+        void UploadLevel(TextureHandle, const TexturePayload& payload, uint32_t level) override {
+            bytes += payload.mips[level].data.size();
+        }
+
+        size_t bytes = 0;
+
+    private:
+        TextureHandle _handles = 0;
+    };
+}// namespace
+
+int main() {
+    std::printf("%u² RGBA level 0; pipeline batch of %d × %u² files\n", SIZE, FILES, FILE_SIZE);
+    const auto level0 = Noise(SIZE, SIZE, 1);
+    for (MipFilter filter : { MipFilter::Box, MipFilter::Kaiser }) {
+        bench::Measure(filter == MipFilter::Box ? "mip chain, box" : "mip chain, Kaiser", RUNS, [&] {
+            TexturePayload payload;
+            payload.mips.push_back({ SIZE, SIZE, level0 });
+            GenerateMipChain(payload, filter);
+            bench::KeepAlive(payload.mips.back().data[0]);
+        });
+    }
+
+    fs::path dir = fs::temp_directory_path() / "ae_texture_pipeline_bench";
+    fs::create_directories(dir);
+    std::vector<std::string> paths;
+    for (int i = 0; i < FILES; ++i) {
+        paths.push_back((dir / ("tex_" + std::to_string(i) + ".tga")).string());
+        WriteTGA(paths.back(), FILE_SIZE, FILE_SIZE, Noise(FILE_SIZE, FILE_SIZE, i));
+    }
+
+    int hardware = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<int> workerCounts = { 0, 1 };
+    for (int count : { hardware / 2, hardware }) {
+        if (count > workerCounts.back()) workerCounts.push_back(count);
+    }
+    for (int workers : workerCounts) {
+        char name[64];
+        std::snprintf(name, sizeof(name), "batch, %d jobs%s", workers, workers == 0 ? " (inline)" : "");
+        bench::Measure(name, RUNS, [&] {
+            CountingSink sink;
+            TexturePipeline pipeline(sink, { .workerCount = workers });
+            for (const auto& path : paths) pipeline.Request(path);
+            while (pipeline.GetPendingCount() > 0) {
+                if (pipeline.Pump(SIZE_MAX) == 0) std::this_thread::yield();
+            }
+            bench::KeepAlive(sink.bytes);
+        });
+    }
+
+    fs::remove_all(dir);
+    return 0;
+}
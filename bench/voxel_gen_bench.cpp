@@ -0,0 +1,21 @@
+// Terrain generation for the full WORLD_X × WORLD_Y × WORLD_Z grid, i.e. the
+// load phase of Example_VoxelWorld minus meshing.
+#include "bench.hpp"
+#include "job_system.hpp"
+#include "voxel_world.hpp"
+
+#include <cstdio>
+#include <memory>
+
+int main() {
+    constexpr int columns = VoxelWorld::WORLD_X * VoxelWorld::WORLD_Z;
+    std::printf("%d chunk columns, %u workers\n", columns, JobSystem::Get()->GetThreadCount());
+
+    double ms = bench::Measure("generate world", 5, [] {
+        auto world = std::make_unique<VoxelWorld>();
+        world->InitHeadless(42);
+        bench::KeepAlive(world->GetTerrainHeight(100, 100));
+    });
+    std::printf("    %.3f ms per column\n", ms / columns);
+    return 0;
+}
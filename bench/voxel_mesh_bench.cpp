@@ -0,0 +1,32 @@
+// Greedy meshing cost and vertex count of one terrain chunk at each LOD.
+#include "bench.hpp"
+#include "voxel_chunk_component.hpp"
+
+#include <cstdio>
+
+int main() {
+    using C = VoxelChunkComponent;
+    C chunk(nullptr, nullptr, glm::ivec3(0));
+    for (int x = 0; x < C::SIZE; ++x) {
+        for (int z = 0; z < C::SIZE; ++z) {
+            int height = 12 + (x * 7 + z * 13) % 9 + (x / 8 + z / 8) % 5;
+            for (int y = 0; y < height; ++y)
+                chunk.SetVoxel(x, y, z, (uint8_t)(1 + y / 6));
+        }
+    }
+
+    for (int lod = 0; lod <= C::MAX_LOD; ++lod) {
+        chunk.SetLOD(lod);
+        size_t verts = 0;
+        char name[64];
+        std::snprintf(name, sizeof(name), "mesh chunk lod %d", lod);
+        bench::Measure(name, 200, [&] {
+            VoxelMeshBuilder builder;
+            chunk.BuildMesh(builder);
+            verts = builder.GetVertexCount();
+            bench::KeepAlive(verts);
+        });
+        std::printf("    %zu vertices\n", verts);
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+// Voxel raycast throughput over a generated world: single rays on one thread
+// against RaycastBatch split across the JobSystem, bounded and unbounded.
+#include "bench.hpp"
+#include "job_system.hpp"
+#include "voxel_world.hpp"
+
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+    constexpr size_t RAY_COUNT = 100000;
+    constexpr int    RUNS = 5;
+
+    // Rays from above the terrain, mostly pointing down into it
+    std::vector<VoxelRay> MakeRays(float maxDistance) {
+        std::mt19937 rng(7);
+        const float extentX = (float)(VoxelWorld::WORLD_X * VoxelChunkComponent::SIZE);
+        const float extentZ = (float)(VoxelWorld::WORLD_Z * VoxelChunkComponent::SIZE);
+        std::uniform_real_distribution<float> x(0.0f, extentX), z(0.0f, extentZ), unit(-1.0f, 1.0f);
+        std::vector<VoxelRay> rays(RAY_COUNT);
+        for (auto& ray : rays) {
+            ray = { .origin = glm::vec3(x(rng), 120.0f, z(rng)),
+                    .direction = glm::vec3(unit(rng), -1.0f, unit(rng)),
+                    .maxDistance = maxDistance };
+        }
+        return rays;
+    }
+
+    void Run(const VoxelWorld& world, const char* label, float maxDistance) {
+        auto rays = MakeRays(maxDistance);
+        std::vector<VoxelRaycastHit> hits(rays.size());
+        char name[64];
+
+        std::snprintf(name, sizeof(name), "%s, serial", label);
+        double serial = bench::Measure(name, RUNS, [&] {
+            size_t count = 0;
+            for (size_t i = 0; i < rays.size(); ++i)
+                count += world.Raycast(rays[i].origin, rays[i].direction, rays[i].maxDistance, hits[i]);
+            bench::KeepAlive(count);
+        });
+        std::snprintf(name, sizeof(name), "%s, batch", label);
+        double batch = bench::Measure(name, RUNS, [&] {
+            bench::KeepAlive(world.RaycastBatch(rays.data(), hits.data(), rays.size()));
+        });
+        std::printf("    %.2f / %.2f Mrays/s\n", RAY_COUNT / serial / 1000.0, RAY_COUNT / batch / 1000.0);
+    }
+}// namespace
+
+int main() {
+    auto world = std::make_unique<VoxelWorld>();
+    world->InitHeadless(42);
+    std::printf("%zu rays, %u workers\n", RAY_COUNT, JobSystem::Get()->GetThreadCount());
+
+    Run(*world, "maxDistance 256", 256.0f);
+    Run(*world, "maxDistance inf", std::numeric_limits<float>::infinity());
+    return 0;
+}
@@ -129,7 +129,8 @@ function CharacterController:update(dt)
     go.position = pos
 end
 
-function CharacterController:onCollision(other)
+-- Once per contact; onCollision would fire every frame while touching
+function CharacterController:onCollisionEnter(other)
     print("[CharacterController] Collided with: " .. tostring(other))
 end
 
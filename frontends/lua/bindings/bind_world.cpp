@@ -131,6 +131,12 @@ void BindWorldAPI(sol::state& lua, LuaApplication* app)
                     scriptComp->OnCollision(other);
                 }
             });
+            go->SetCollisionEnterCallback([go](GameObject* other) {
+                auto* scriptComp = go->GetComponent<ScriptableComponent>();
+                if (scriptComp) {
+                    scriptComp->OnCollisionEnter(other);
+                }
+            });
 
             return go;
         },
@@ -21,6 +21,7 @@ ScriptableComponent::~ScriptableComponent() {
     _updateFunc = sol::lua_nil;
     _physicsUpdateFunc = sol::lua_nil;
     _onCollisionFunc = sol::lua_nil;
+    _onCollisionEnterFunc = sol::lua_nil;
     _onDestroyFunc = sol::lua_nil;
 }
 
@@ -98,6 +99,7 @@ void ScriptableComponent::CacheMethods() {
     _updateFunc = cacheMethod("update");
     _physicsUpdateFunc = cacheMethod("physicsUpdate");
     _onCollisionFunc = cacheMethod("onCollision");
+    _onCollisionEnterFunc = cacheMethod("onCollisionEnter");
     _onDestroyFunc = cacheMethod("onDestroy");
 }
 
@@ -129,6 +131,12 @@ void ScriptableComponent::OnCollision(GameObject* other) {
     }
 }
 
+void ScriptableComponent::OnCollisionEnter(GameObject* other) {
+    if (_onCollisionEnterFunc.valid()) {
+        CallMethodSafeWithArgs(_onCollisionEnterFunc, "onCollisionEnter", other);
+    }
+}
+
 bool ScriptableComponent::HasMethod(const std::string& methodName) const {
     if (!_instance.valid()) return false;
 
@@ -30,6 +30,9 @@ class LuaApplication;
 ///     -- movement logic
 ///   end
 ///
+///   -- Optional collision hooks: onCollisionEnter(other) once when contact
+///   -- begins, onCollision(other) every frame while touching
+///
 ///   -- Attach to a GameObject
 ///   local player = atmos.world.spawn()
 ///   player:addScript("PlayerController")
@@ -70,6 +73,7 @@ public:
 
     /// Handle collision events (called from C++ collision system)
     void OnCollision(GameObject* other);
+    void OnCollisionEnter(GameObject* other);
 
     /// Get the Lua instance table for advanced manipulation
     sol::table& GetInstance() {
@@ -97,6 +101,7 @@ private:
     sol::protected_function _updateFunc;
     sol::protected_function _physicsUpdateFunc;
     sol::protected_function _onCollisionFunc;
+    sol::protected_function _onCollisionEnterFunc;
     sol::protected_function _onDestroyFunc;
 
     /// Create an instance of the Lua class
@@ -0,0 +1,164 @@
+#include "asset_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+    size_t Position(const std::vector<AssetHandle>& order, AssetHandle handle) {
+        return size_t(std::find(order.begin(), order.end(), handle) - order.begin());
+    }
+
+    // file ─ texture ─┬─ material ─┬─ mesh ─ file
+    //                 └────────────┴─ scene
+    struct Project {
+        AssetGraph graph;
+        AssetHandle textureFile, texture, material, meshFile, mesh, scene, otherTexture;
+
+        Project() {
+            textureFile = graph.Register(AssetKind::File, "a.png");
+            texture = graph.Register(AssetKind::Texture, "a.png");
+            material = graph.Register(AssetKind::Material, "stone");
+            meshFile = graph.Register(AssetKind::File, "rock.aemesh");
+            mesh = graph.Register(AssetKind::Mesh, "rock.aemesh");
+            scene = graph.Register(AssetKind::Scene, "main");
+            otherTexture = graph.Register(AssetKind::Texture, "b.png");
+            graph.AddDependency(texture, textureFile);
+            graph.AddDependency(material, texture);
+            graph.AddDependency(mesh, meshFile);
+            graph.AddDependency(mesh, material);
+            graph.AddDependency(scene, texture);
+            graph.AddDependency(scene, material);
+            graph.AddDependency(scene, mesh);
+        }
+    };
+}// namespace
+
+TEST(AssetGraph, RegisterIsPerKindAndIdempotent) {
+    AssetGraph graph;
+    AssetHandle file = graph.Register(AssetKind::File, "a.png");
+    AssetHandle texture = graph.Register(AssetKind::Texture, "a.png");
+    EXPECT_NE(file, texture);
+    EXPECT_EQ(graph.Register(AssetKind::File, "a.png"), file);
+    EXPECT_EQ(graph.Find(AssetKind::Texture, "a.png"), texture);
+    EXPECT_FALSE(graph.Find(AssetKind::Shader, "a.png").IsValid());
+    EXPECT_EQ(graph.GetKind(texture), AssetKind::Texture);
+    EXPECT_EQ(graph.GetName(texture), "a.png");
+    EXPECT_EQ(graph.GetCount(), 2u);
+}
+
+TEST(AssetGraph, InvalidateReachesOnlyDependentsInDependencyOrder) {
+    Project p;
+    std::vector<AssetHandle> order = p.graph.Invalidate(p.textureFile);
+    ASSERT_EQ(order.size(), 5u);
+    EXPECT_EQ(order.front(), p.textureFile);
+    EXPECT_LT(Position(order, p.texture), Position(order, p.material));
+    EXPECT_LT(Position(order, p.material), Position(order, p.mesh));
+    EXPECT_LT(Position(order, p.mesh), Position(order, p.scene));
+    EXPECT_EQ(Position(order, p.meshFile), order.size());
+    EXPECT_EQ(Position(order, p.otherTexture), order.size());
+
+    EXPECT_EQ(p.graph.GetVersion(p.scene), 1u);
+    EXPECT_EQ(p.graph.GetVersion(p.meshFile), 0u);
+    EXPECT_EQ(p.graph.GetVersion(p.otherTexture), 0u);
+
+    // The mesh file's change skips the texture and material entirely
+    order = p.graph.Invalidate(p.meshFile);
+    EXPECT_EQ(order, (std::vector<AssetHandle>{ p.meshFile, p.mesh, p.scene }));
+    EXPECT_EQ(p.graph.GetVersion(p.scene), 2u);
+    EXPECT_EQ(p.graph.GetVersion(p.texture), 1u);
+}
+
+TEST(AssetGraph, DuplicateAndSelfEdgesAreIgnored) {
+    Project p;
+    p.graph.AddDependency(p.scene, p.texture);
+    p.graph.AddDependency(p.scene, p.scene);
+    EXPECT_EQ(p.graph.GetDependencies(p.scene).size(), 3u);
+    EXPECT_EQ(p.graph.GetDependents(p.texture).size(), 2u);
+}
+
+TEST(AssetGraph, CyclesStillInvalidateEveryNodeOnce) {
+    AssetGraph graph;
+    AssetHandle file = graph.Register(AssetKind::File, "lit.vert");
+    AssetHandle a = graph.Register(AssetKind::Shader, "a");
+    AssetHandle b = graph.Register(AssetKind::Shader, "b");
+    graph.AddDependency(a, file);
+    graph.AddDependency(b, a);
+    graph.AddDependency(a, b);
+    std::vector<AssetHandle> order = graph.Invalidate(file);
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(order.front(), file);
+    EXPECT_NE(Position(order, a), order.size());
+    EXPECT_NE(Position(order, b), order.size());
+    EXPECT_EQ(graph.GetVersion(a), 1u);
+    EXPECT_EQ(graph.GetVersion(b), 1u);
+}
+
+TEST(AssetGraph, RemoveUnlinksAndStalesTheHandle) {
+    Project p;
+    EXPECT_EQ(p.graph.GetRefCount(p.texture), 2u);
+    p.graph.Remove(p.material);
+    EXPECT_FALSE(p.graph.IsAlive(p.material));
+    EXPECT_EQ(p.graph.GetRefCount(p.texture), 1u);
+    EXPECT_EQ(p.graph.GetDependencies(p.scene).size(), 2u);
+    EXPECT_EQ(p.graph.GetName(p.material), "");
+    EXPECT_FALSE(p.graph.Find(AssetKind::Material, "stone").IsValid());
+
+    // The slot is reused under a new generation; the old handle stays dead
+    AssetHandle reused = p.graph.Register(AssetKind::Material, "brick");
+    EXPECT_EQ(reused.index, p.material.index);
+    EXPECT_NE(reused, p.material);
+    EXPECT_FALSE(p.graph.IsAlive(p.material));
+    EXPECT_TRUE(p.graph.Invalidate(p.material).empty());
+    p.graph.AddDependency(p.material, p.texture);
+    EXPECT_TRUE(p.graph.GetDependencies(reused).empty());
+}
+
+TEST(AssetGraph, RefCountsIncludeDependents) {
+    Project p;
+    EXPECT_EQ(p.graph.GetRefCount(p.otherTexture), 0u);
+    p.graph.AddRef(p.otherTexture);
+    EXPECT_EQ(p.graph.GetRefCount(p.otherTexture), 1u);
+    p.graph.Release(p.otherTexture);
+    p.graph.Release(p.otherTexture);// never below zero
+    EXPECT_EQ(p.graph.GetRefCount(p.otherTexture), 0u);
+
+    p.graph.RemoveDependencies(p.scene);
+    EXPECT_EQ(p.graph.GetRefCount(p.mesh), 0u);
+    EXPECT_EQ(p.graph.GetRefCount(p.texture), 1u);
+}
+
+TEST(AssetGraph, ForEachVisitsOneKind) {
+    Project p;
+    std::vector<std::string> files;
+    p.graph.ForEach(AssetKind::File, [&](AssetHandle, const std::string& name) { files.push_back(name); });
+    std::sort(files.begin(), files.end());
+    EXPECT_EQ(files, (std::vector<std::string>{ "a.png", "rock.aemesh" }));
+
+    p.graph.Clear();
+    EXPECT_EQ(p.graph.GetCount(), 0u);
+    EXPECT_FALSE(p.graph.IsAlive(p.scene));
+}
+
+TEST(AssetGraph, OneTextureInALargeProjectInvalidatesOnlyItsDependents) {
+    AssetGraph graph;
+    std::vector<AssetHandle> textures;
+    for (int i = 0; i < 4000; ++i) {
+        std::string name = "t" + std::to_string(i) + ".png";
+        AssetHandle texture = graph.Register(AssetKind::Texture, name);
+        graph.AddDependency(texture, graph.Register(AssetKind::File, name));
+        textures.push_back(texture);
+    }
+    for (int i = 0; i < 2000; ++i) {
+        AssetHandle material = graph.Register(AssetKind::Material, "m" + std::to_string(i));
+        graph.AddDependency(material, textures[(i * 2) % textures.size()]);
+        graph.AddDependency(material, textures[(i * 2 + 1) % textures.size()]);
+    }
+    // t1.png: its texture and material m0
+    std::vector<AssetHandle> order = graph.Invalidate(graph.Find(AssetKind::File, "t1.png"));
+    EXPECT_EQ(order.size(), 3u);
+    EXPECT_EQ(graph.GetVersion(graph.Find(AssetKind::Material, "m0")), 1u);
+    EXPECT_EQ(graph.GetVersion(graph.Find(AssetKind::Material, "m1")), 0u);
+}
@@ -0,0 +1,92 @@
+#include "asset_load_stats.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace {
+    AssetLoadRecord Load(const std::string& name, AssetKind kind, AssetCacheStatus cache, uint64_t bytes = 0) {
+        AssetLoadRecord record{ name, kind, cache };
+        record.bytes = bytes;
+        return record;
+    }
+}// namespace
+
+TEST(AssetLoadStats, MemoryHitsAreCountedOnTheLoadNotRecorded) {
+    AssetLoadStats stats;
+    stats.Record(Load("rock.png", AssetKind::Texture, AssetCacheStatus::Miss, 100));
+    stats.Record(Load("rock.aemesh", AssetKind::Mesh, AssetCacheStatus::Miss, 200));
+    for (int frame = 0; frame < 10000; ++frame) {
+        stats.Record(Load("rock.png", AssetKind::Texture, AssetCacheStatus::Memory));
+    }
+    // Same name, other kind: counted on its own asset
+    stats.Record(Load("rock.aemesh", AssetKind::Mesh, AssetCacheStatus::Memory));
+
+    ASSERT_EQ(stats.GetRecords().size(), 2u);
+    EXPECT_EQ(stats.GetRecords()[0].memoryHits, 10000u);
+    EXPECT_EQ(stats.GetRecords()[1].memoryHits, 1u);
+}
+
+TEST(AssetLoadStats, HitsGoToTheLatestLoadOfAnAsset) {
+    AssetLoadStats stats;
+    stats.Record(Load("a.png", AssetKind::Texture, AssetCacheStatus::Miss));
+    stats.Record(Load("a.png", AssetKind::Texture, AssetCacheStatus::Disk));// reloaded
+    stats.Record(Load("a.png", AssetKind::Texture, AssetCacheStatus::Memory));
+    ASSERT_EQ(stats.GetRecords().size(), 2u);
+    EXPECT_EQ(stats.GetRecords()[0].memoryHits, 0u);
+    EXPECT_EQ(stats.GetRecords()[1].memoryHits, 1u);
+
+    // After Clear, the first hit on an already loaded asset starts its record
+    stats.Clear();
+    stats.Record(Load("a.png", AssetKind::Texture, AssetCacheStatus::Memory));
+    stats.Record(Load("a.png", AssetKind::Texture, AssetCacheStatus::Memory));
+    ASSERT_EQ(stats.GetRecords().size(), 1u);
+    EXPECT_EQ(stats.GetRecords()[0].cache, AssetCacheStatus::Memory);
+    EXPECT_EQ(stats.GetRecords()[0].memoryHits, 2u);
+}
+
+TEST(AssetLoadStats, DedupedLoadsAddUpTheirBytes) {
+    AssetLoadStats stats;
+    stats.Record(Load("a.png", AssetKind::Texture, AssetCacheStatus::Miss, 1000));
+    stats.Record(Load("a_copy.png", AssetKind::Texture, AssetCacheStatus::Dedup, 1000));
+    stats.Record(Load("b.aemesh", AssetKind::Mesh, AssetCacheStatus::Dedup, 500));
+    EXPECT_EQ(stats.GetDedupedBytes(), 1500u);
+    EXPECT_EQ(stats.GetRecords().size(), 3u);
+}
+
+TEST(AssetLoadStats, RecordsStopAtTheCapButLoadsAreStillCounted) {
+    AssetLoadStats stats;
+    for (size_t i = 0; i < AssetLoadStats::MAX_RECORDS + 5; ++i) {
+        stats.Record(Load("t" + std::to_string(i) + ".png", AssetKind::Texture, AssetCacheStatus::Dedup, 1));
+    }
+    EXPECT_EQ(stats.GetRecords().size(), AssetLoadStats::MAX_RECORDS);
+    EXPECT_EQ(stats.GetDroppedCount(), 5u);
+    EXPECT_EQ(stats.GetDedupedBytes(), AssetLoadStats::MAX_RECORDS + 5);
+
+    // Kept assets still count their hits; dropped ones are only counted
+    stats.Record(Load("t0.png", AssetKind::Texture, AssetCacheStatus::Memory));
+    stats.Record(Load("never.png", AssetKind::Texture, AssetCacheStatus::Memory));
+    EXPECT_EQ(stats.GetRecords()[0].memoryHits, 1u);
+    EXPECT_EQ(stats.GetRecords().size(), AssetLoadStats::MAX_RECORDS);
+    EXPECT_EQ(stats.GetDroppedCount(), 6u);
+
+    stats.Clear();
+    EXPECT_TRUE(stats.GetRecords().empty());
+    EXPECT_EQ(stats.GetDroppedCount(), 0u);
+}
+
+TEST(AssetLoadStats, ExportsIncludeHitCounts) {
+    AssetLoadStats stats;
+    stats.Record(Load("a,b.png", AssetKind::Texture, AssetCacheStatus::Miss, 42));
+    stats.Record(Load("a,b.png", AssetKind::Texture, AssetCacheStatus::Memory));
+
+    std::string csv = stats.ToCSV();
+    EXPECT_EQ(csv.substr(0, csv.find('\n')),
+              "name,kind,cache,bytes,content_hash,read_ms,decode_ms,upload_ms,total_ms,memory_hits");
+    EXPECT_NE(csv.find("\"a,b.png\",texture,miss,42,"), std::string::npos);
+    EXPECT_EQ(csv.substr(csv.size() - 3), ",1\n");
+
+    std::string json = stats.ToJSON();
+    EXPECT_NE(json.find("\"memoryHits\": 1"), std::string::npos);
+    EXPECT_NE(json.find("\"droppedRecords\": 0"), std::string::npos);
+}
@@ -0,0 +1,241 @@
+#include "asset_pack.hpp"
+#include "file_system.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    namespace fs = std::filesystem;
+
+    // Offsets of the fields the corruption tests patch
+    constexpr size_t ENTRY_TABLE = sizeof(AssetPackHeader);
+    constexpr size_t RAW_SIZE_FIELD = offsetof(AssetPackEntry, rawSize);
+    constexpr size_t COMPRESSION_FIELD = offsetof(AssetPackEntry, compression);
+
+    std::vector<uint8_t> RandomBytes(size_t size, uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::vector<uint8_t> bytes(size);
+        for (auto& b : bytes)
+            b = static_cast<uint8_t>(rng());
+        return bytes;
+    }
+
+    // Compresses well with either codec
+    std::vector<uint8_t> RepetitiveBytes(size_t size, uint32_t seed) {
+        std::vector<uint8_t> bytes(size);
+        for (size_t i = 0; i < size; ++i)
+            bytes[i] = static_cast<uint8_t>("atmospheric"[(i + seed) % 11]);
+        return bytes;
+    }
+
+    std::string AssetPath(int i) {
+        return "assets/test/file_" + std::to_string(i) + ".bin";
+    }
+
+    class AssetPackTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            const char* test = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+            _path = (fs::temp_directory_path() / (std::string("ae_pack_") + test + ".aepk")).string();
+        }
+
+        void TearDown() override {
+            std::error_code ec;
+            fs::remove(_path, ec);
+        }
+
+        void Write(const AssetPackWriter& writer) {
+            std::string error;
+            ASSERT_TRUE(writer.Write(_path, &error)) << error;
+        }
+
+        // Overwrites `size` bytes at `offset` in the written pack
+        void Patch(size_t offset, const void* data, size_t size) {
+            std::fstream file(_path, std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(static_cast<std::streamoff>(offset));
+            file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        }
+
+        void PatchEntry(size_t index, uint32_t compression, uint64_t rawSize) {
+            size_t entry = ENTRY_TABLE + index * sizeof(AssetPackEntry);
+            Patch(entry + COMPRESSION_FIELD, &compression, sizeof(compression));
+            Patch(entry + RAW_SIZE_FIELD, &rawSize, sizeof(rawSize));
+        }
+
+        std::string _path;
+    };
+}// namespace
+
+// ── Round trip ───────────────────────────────────────────────────────────────
+
+TEST_F(AssetPackTest, StoredEntriesRoundTrip) {
+    AssetPackWriter writer;
+    std::vector<std::vector<uint8_t>> files;
+    for (int i = 0; i < 200; ++i) {
+        files.push_back(RandomBytes(static_cast<size_t>(i) * 37, i));
+        writer.Add(AssetPath(i), files.back());
+    }
+    Write(writer);
+
+    AssetPack pack;
+    std::string error;
+    ASSERT_TRUE(pack.Open(_path, &error)) << error;
+    ASSERT_EQ(pack.GetEntries().size(), 200u);
+    for (int i = 0; i < 200; ++i) {
+        const AssetPackEntry* entry = pack.Find(AssetPath(i));
+        ASSERT_NE(entry, nullptr) << AssetPath(i);
+        EXPECT_EQ(pack.GetPath(*entry), AssetPath(i));
+        EXPECT_EQ(entry->offset % AssetPack::ALIGNMENT, 0u);
+        auto view = pack.View(*entry);
+        ASSERT_EQ(view.size(), files[i].size());
+        EXPECT_TRUE(std::equal(view.begin(), view.end(), files[i].begin()));
+    }
+    EXPECT_EQ(pack.Find("assets/test/missing.bin"), nullptr);
+    EXPECT_EQ(pack.Find("assets/test/file_1.bi"), nullptr);
+}
+
+TEST_F(AssetPackTest, CompressedEntriesRoundTrip) {
+    for (auto compression : { AssetPackCompression::LZ4, AssetPackCompression::Zstd }) {
+        if (!IsCompressionAvailable(compression)) continue;
+        AssetPackWriter writer;
+        writer.Add("assets/a.txt", RepetitiveBytes(100000, 1), compression);
+        writer.Add("assets/b.bin", RandomBytes(4096, 2), compression);// incompressible: stored
+        Write(writer);
+
+        AssetPack pack;
+        ASSERT_TRUE(pack.Open(_path));
+        const AssetPackEntry* a = pack.Find("assets/a.txt");
+        const AssetPackEntry* b = pack.Find("assets/b.bin");
+        ASSERT_TRUE(a && b);
+        EXPECT_EQ(a->compression, static_cast<uint32_t>(compression));
+        EXPECT_LT(a->size, a->rawSize);
+        EXPECT_EQ(b->compression, static_cast<uint32_t>(AssetPackCompression::None));
+
+        auto view = pack.View(*a);
+        auto expected = RepetitiveBytes(100000, 1);
+        ASSERT_EQ(view.size(), expected.size());
+        EXPECT_TRUE(std::equal(view.begin(), view.end(), expected.begin()));
+        // Inflated once: a copy of the entry finds the same buffer
+        AssetPackEntry copy = *a;
+        EXPECT_EQ(pack.View(copy).data(), view.data());
+    }
+}
+
+TEST_F(AssetPackTest, ConcurrentViewsInflateEachEntryOnce) {
+    auto compression = IsCompressionAvailable(AssetPackCompression::LZ4) ? AssetPackCompression::LZ4
+                                                                          : AssetPackCompression::Zstd;
+    if (!IsCompressionAvailable(compression)) GTEST_SKIP() << "built without AE_USE_LZ4 / AE_USE_ZSTD";
+
+    AssetPackWriter writer;
+    for (int i = 0; i < 64; ++i)
+        writer.Add(AssetPath(i), RepetitiveBytes(20000 + i, i), compression);
+    Write(writer);
+    AssetPack pack;
+    ASSERT_TRUE(pack.Open(_path));
+
+    std::vector<std::vector<const uint8_t*>> seen(8, std::vector<const uint8_t*>(64));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&, t] {
+            for (int n = 0; n < 64; ++n) {
+                int i = (n + t * 7) % 64;
+                seen[t][i] = pack.View(*pack.Find(AssetPath(i))).data();
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    for (int i = 0; i < 64; ++i) {
+        ASSERT_NE(seen[0][i], nullptr);
+        for (int t = 1; t < 8; ++t)
+            EXPECT_EQ(seen[t][i], seen[0][i]) << AssetPath(i);
+    }
+}
+
+// ── Validation ───────────────────────────────────────────────────────────────
+
+TEST_F(AssetPackTest, RejectsTruncatedAndForeignFiles) {
+    AssetPackWriter writer;
+    writer.Add("assets/a.bin", RandomBytes(1000, 1));
+    Write(writer);
+    fs::resize_file(_path, 40);// header plus part of the entry table
+
+    AssetPack pack;
+    std::string error;
+    EXPECT_FALSE(pack.Open(_path, &error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_FALSE(pack.IsOpen());
+
+    Patch(0, "ZZZZ", 4);
+    EXPECT_FALSE(pack.Open(_path));
+    EXPECT_FALSE(pack.Open(_path + ".missing"));
+}
+
+TEST_F(AssetPackTest, RejectsUnknownCompression) {
+    AssetPackWriter writer;
+    writer.Add("assets/a.bin", RandomBytes(1000, 1));
+    Write(writer);
+    PatchEntry(0, 7, 1000);
+
+    AssetPack pack;
+    EXPECT_FALSE(pack.Open(_path));
+}
+
+TEST_F(AssetPackTest, RejectsRawSizePastTheCodecRatio) {
+    AssetPackWriter writer;
+    writer.Add("assets/a.bin", RandomBytes(1000, 1));
+    Write(writer);
+    AssetPack pack;
+    const uint64_t ratio = AssetPack::MaxInflateRatio(AssetPackCompression::LZ4);
+
+    PatchEntry(0, static_cast<uint32_t>(AssetPackCompression::LZ4), 1000 * ratio);
+    EXPECT_TRUE(pack.Open(_path));
+    pack.Close();
+    PatchEntry(0, static_cast<uint32_t>(AssetPackCompression::LZ4), 1001 * ratio);
+    EXPECT_FALSE(pack.Open(_path));
+    PatchEntry(0, static_cast<uint32_t>(AssetPackCompression::LZ4), UINT64_MAX);
+    EXPECT_FALSE(pack.Open(_path));
+}
+
+TEST_F(AssetPackTest, RejectsRawSizePastTheHardCap) {
+    // Large enough that the zstd ratio alone would allow more than the cap
+    const size_t size = AssetPack::MAX_RAW_SIZE / AssetPack::MaxInflateRatio(AssetPackCompression::Zstd) + 4096;
+    AssetPackWriter writer;
+    writer.Add("assets/a.bin", RandomBytes(size, 1));
+    Write(writer);
+    AssetPack pack;
+
+    PatchEntry(0, static_cast<uint32_t>(AssetPackCompression::Zstd), AssetPack::MAX_RAW_SIZE);
+    EXPECT_TRUE(pack.Open(_path));
+    pack.Close();
+    PatchEntry(0, static_cast<uint32_t>(AssetPackCompression::Zstd), AssetPack::MAX_RAW_SIZE + 1);
+    EXPECT_FALSE(pack.Open(_path));
+}
+
+// ── FileSystem ───────────────────────────────────────────────────────────────
+
+TEST_F(AssetPackTest, MountedPackServesReads) {
+    AssetPackWriter writer;
+    auto bytes = RandomBytes(5000, 3);
+    writer.Add("assets/packed/only_in_pack.bin", bytes);
+    Write(writer);
+
+    auto& files = FileSystem::Get();
+    ASSERT_TRUE(files.MountPack(_path));
+    auto view = files.ReadView("./assets/packed/only_in_pack.bin");
+    ASSERT_EQ(view.size(), bytes.size());
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), bytes.begin()));
+    EXPECT_TRUE(files.Exists("assets/packed/only_in_pack.bin"));
+    EXPECT_EQ(files.ReadSync("assets/packed/only_in_pack.bin"), bytes);
+
+    files.UnmountPacks();
+    EXPECT_TRUE(files.ReadView("assets/packed/only_in_pack.bin").empty());
+}
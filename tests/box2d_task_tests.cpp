@@ -0,0 +1,140 @@
+#include "box2d_task_scheduler.hpp"
+#include "job_system.hpp"
+
+#include <box2d/box2d.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace {
+    // Records which items each chunk ran and on which worker slot
+    struct Visits {
+        std::vector<std::atomic<int>> items;
+        std::atomic<uint32_t> maxWorker { 0 };
+
+        explicit Visits(int count) : items(count) {}
+
+        static void Run(int start, int end, uint32_t worker, void* context) {
+            auto* self = static_cast<Visits*>(context);
+            for (int i = start; i < end; ++i)
+                self->items[i].fetch_add(1, std::memory_order_relaxed);
+            uint32_t seen = self->maxWorker.load();
+            while (worker > seen && !self->maxWorker.compare_exchange_weak(seen, worker)) {}
+        }
+    };
+
+    // Box2D's `minRange` is a lower bound on items per chunk
+    void RunTask(b2WorldDef& def, Visits& visits, int minRange) {
+        void* handle = def.enqueueTask(&Visits::Run, (int)visits.items.size(), minRange, &visits, def.userTaskContext);
+        if (handle) def.finishTask(handle, def.userTaskContext);
+    }
+
+    // A pyramid of unit boxes on a static ground, as in Example_Physics2D
+    b2WorldId MakePyramid(Box2DTaskScheduler* scheduler, int base) {
+        b2WorldDef worldDef = b2DefaultWorldDef();
+        if (scheduler) scheduler->Configure(worldDef);
+        b2WorldId world = b2CreateWorld(&worldDef);
+
+        b2BodyDef groundDef = b2DefaultBodyDef();
+        groundDef.position = { 0.0f, -1.0f };
+        b2BodyId ground = b2CreateBody(world, &groundDef);
+        b2ShapeDef shapeDef = b2DefaultShapeDef();
+        b2Polygon groundBox = b2MakeBox(200.0f, 1.0f);
+        b2CreatePolygonShape(ground, &shapeDef, &groundBox);
+
+        b2Polygon box = b2MakeBox(0.5f, 0.5f);
+        for (int row = 0; row < base; ++row) {
+            for (int i = 0; i < base - row; ++i) {
+                b2BodyDef bodyDef = b2DefaultBodyDef();
+                bodyDef.type = b2_dynamicBody;
+                bodyDef.position = { (float)i + 0.5f * (float)row - 0.5f * (float)base, 0.5f + (float)row };
+                b2BodyId body = b2CreateBody(world, &bodyDef);
+                b2CreatePolygonShape(body, &shapeDef, &box);
+            }
+        }
+        return world;
+    }
+
+    // FNV-1a over every body's transform, via the move events of the step
+    uint64_t StepAndHash(b2WorldId world, Box2DTaskScheduler* scheduler) {
+        b2World_Step(world, 1.0f / 60.0f, 4);
+        if (scheduler) scheduler->EndStep();
+        b2BodyEvents events = b2World_GetBodyEvents(world);
+        uint64_t hash = 14695981039346656037ull ^ (uint64_t)events.moveCount;
+        for (int i = 0; i < events.moveCount; ++i) {
+            const b2Transform& t = events.moveEvents[i].transform;
+            const float values[4] = { t.p.x, t.p.y, t.q.c, t.q.s };
+            const auto* bytes = reinterpret_cast<const uint8_t*>(values);
+            for (size_t b = 0; b < sizeof(values); ++b) {
+                hash ^= bytes[b];
+                hash *= 1099511628211ull;
+            }
+        }
+        return hash;
+    }
+}// namespace
+
+// ── Task splitting ───────────────────────────────────────────────────────────
+
+TEST(Box2DTaskScheduler, EveryItemRunsExactlyOnce) {
+    Box2DTaskScheduler scheduler(*JobSystem::Get(), 0);
+    b2WorldDef def {};
+    scheduler.Configure(def);
+    EXPECT_EQ(def.workerCount, scheduler.GetWorkerCount());
+
+    for (int count : { 1, 7, 100, 1000, 4099 }) {
+        for (int minRange : { 1, 16, 64, 5000 }) {
+            Visits visits(count);
+            RunTask(def, visits, minRange);
+            for (int i = 0; i < count; ++i)
+                ASSERT_EQ(visits.items[i].load(), 1) << count << " items, minRange " << minRange << ", item " << i;
+            EXPECT_LT(visits.maxWorker.load(), (uint32_t)scheduler.GetWorkerCount());
+        }
+        scheduler.EndStep();
+    }
+}
+
+TEST(Box2DTaskScheduler, RunsInlineOnceOutOfTaskRecords) {
+    Box2DTaskScheduler scheduler(*JobSystem::Get(), 0);
+    b2WorldDef def {};
+    scheduler.Configure(def);
+
+    // One step's worth of tasks, more than there are records for
+    std::vector<std::unique_ptr<Visits>> tasks;
+    std::vector<void*> handles;
+    for (int t = 0; t < Box2DTaskScheduler::MAX_TASKS + 10; ++t) {
+        auto& visits = tasks.emplace_back(std::make_unique<Visits>(300));
+        handles.push_back(def.enqueueTask(&Visits::Run, 300, 8, visits.get(), def.userTaskContext));
+    }
+    for (void* handle : handles)
+        if (handle) def.finishTask(handle, def.userTaskContext);
+    EXPECT_EQ(handles.back(), nullptr);
+    for (const auto& visits : tasks)
+        for (const auto& item : visits->items)
+            ASSERT_EQ(item.load(), 1);
+}
+
+TEST(Box2DTaskScheduler, WorkerCountIsClampedToTheJobSystem) {
+    const int threads = (int)JobSystem::Get()->GetThreadCount();
+    EXPECT_EQ(Box2DTaskScheduler(*JobSystem::Get(), 1).GetWorkerCount(), 1);
+    EXPECT_EQ(Box2DTaskScheduler(*JobSystem::Get(), 0).GetWorkerCount(), threads);
+    EXPECT_EQ(Box2DTaskScheduler(*JobSystem::Get(), 1000).GetWorkerCount(), threads);
+}
+
+// ── Determinism ──────────────────────────────────────────────────────────────
+
+TEST(Box2DTaskScheduler, FixedWorkerCountIsDeterministic) {
+    Box2DTaskScheduler first(*JobSystem::Get(), 0), second(*JobSystem::Get(), 0);
+    b2WorldId a = MakePyramid(&first, 20);
+    b2WorldId b = MakePyramid(&second, 20);
+
+    for (int step = 0; step < 240; ++step) {
+        uint64_t ha = StepAndHash(a, &first);
+        uint64_t hb = StepAndHash(b, &second);
+        ASSERT_EQ(ha, hb) << "diverged at step " << step;
+    }
+    b2DestroyWorld(a);
+    b2DestroyWorld(b);
+}
@@ -0,0 +1,231 @@
+#include "contact_tracker.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace {
+    // Bodies and objects are opaque to the tracker: any distinct addresses do
+    struct Scene {
+        std::vector<int> bodies;
+        std::vector<GameObject*> objects;
+
+        explicit Scene(size_t count) : bodies(count), objects(count) {
+            for (size_t i = 0; i < count; ++i)
+                objects[i] = reinterpret_cast<GameObject*>(&bodies[i]);
+        }
+
+        // Touching pair (i, j); body i sits on layer 1 << (i % 4)
+        void Touch(ContactTracker& tracker, int i, int j, float impulse = 1.0f) const {
+            tracker.AddContact(&bodies[i], &bodies[j], ContactEvent {
+              .a = objects[i],
+              .b = objects[j],
+              .layerA = 1 << (i % 4),
+              .layerB = 1 << (j % 4),
+              .point = glm::vec3((float)i, (float)j, 0.0f),
+              .normal = glm::vec3(0, 1, 0),
+              .impulse = impulse,
+            });
+        }
+
+        std::pair<int, int> Indices(const ContactEvent& e) const {
+            int a = (int)(reinterpret_cast<int*>(e.a) - bodies.data());
+            int b = (int)(reinterpret_cast<int*>(e.b) - bodies.data());
+            return { std::min(a, b), std::max(a, b) };
+        }
+
+        std::set<std::pair<int, int>> Pairs(const std::vector<ContactEvent>& events) const {
+            std::set<std::pair<int, int>> out;
+            for (const auto& e : events)
+                out.insert(Indices(e));
+            return out;
+        }
+    };
+}// namespace
+
+// ── Begin / stay / end ───────────────────────────────────────────────────────
+
+TEST(ContactTracker, PairLifetimeIsBeginStayEnd) {
+    Scene scene(2);
+    ContactTracker tracker;
+
+    scene.Touch(tracker, 0, 1);
+    tracker.Update();
+    EXPECT_EQ(tracker.GetEvents().begin.size(), 1u);
+    EXPECT_TRUE(tracker.GetEvents().stay.empty());
+
+    for (int step = 0; step < 3; ++step) {
+        scene.Touch(tracker, 1, 0);// order of the bodies does not matter
+        tracker.Update();
+        EXPECT_TRUE(tracker.GetEvents().begin.empty());
+        EXPECT_EQ(tracker.GetEvents().stay.size(), 1u);
+    }
+
+    tracker.Update();
+    EXPECT_EQ(tracker.GetEvents().end.size(), 1u);
+    EXPECT_TRUE(tracker.GetEvents().stay.empty());
+
+    tracker.Update();
+    const auto& events = tracker.GetEvents();
+    EXPECT_TRUE(events.begin.empty() && events.stay.empty() && events.end.empty());
+}
+
+TEST(ContactTracker, ManifoldsOfOnePairMergeIntoOneEvent) {
+    Scene scene(2);
+    ContactTracker tracker;
+    scene.Touch(tracker, 0, 1, 2.0f);
+    scene.Touch(tracker, 1, 0, 3.0f);// a second manifold, e.g. a compound child
+    tracker.Update();
+
+    ASSERT_EQ(tracker.GetEvents().begin.size(), 1u);
+    EXPECT_FLOAT_EQ(tracker.GetEvents().begin[0].impulse, 5.0f);
+}
+
+TEST(ContactTracker, MergedManifoldsKeepTheDeepestPoint) {
+    Scene scene(2);
+    ContactTracker tracker;
+    auto manifold = [&](int a, int b, glm::vec3 point, glm::vec3 normal, float depth) {
+        tracker.AddContact(&scene.bodies[a], &scene.bodies[b], ContactEvent {
+          .a = scene.objects[a], .b = scene.objects[b], .layerA = 1, .layerB = 1,
+          .point = point, .normal = normal, .impulse = 1.0f, .depth = depth,
+        });
+    };
+    manifold(0, 1, glm::vec3(1, 0, 0), glm::vec3(0, 1, 0), 0.01f);
+    manifold(1, 0, glm::vec3(2, 0, 0), glm::vec3(0, -1, 0), 0.05f);// deepest, bodies swapped
+    manifold(0, 1, glm::vec3(3, 0, 0), glm::vec3(1, 0, 0), 0.02f);
+    tracker.Update();
+
+    ASSERT_EQ(tracker.GetEvents().begin.size(), 1u);
+    const ContactEvent& e = tracker.GetEvents().begin[0];
+    EXPECT_EQ(e.point, glm::vec3(2, 0, 0));
+    // Normal on B, whichever of the two bodies the event names as B
+    EXPECT_EQ(e.normal, e.b == scene.objects[1] ? glm::vec3(0, 1, 0) : glm::vec3(0, -1, 0));
+    EXPECT_FLOAT_EQ(e.depth, 0.05f);
+    EXPECT_FLOAT_EQ(e.impulse, 3.0f);
+}
+
+TEST(ContactTracker, RandomScriptMatchesSetDifference) {
+    constexpr int N = 24;
+    Scene scene(N);
+    ContactTracker tracker;
+    std::mt19937 rng(31);
+    std::bernoulli_distribution touching(0.15);
+
+    std::set<std::pair<int, int>> prev;
+    for (int step = 0; step < 200; ++step) {
+        std::set<std::pair<int, int>> curr;
+        for (int i = 0; i < N; ++i)
+            for (int j = i + 1; j < N; ++j)
+                if (touching(rng)) curr.insert({ i, j });
+        // Feed pairs in a scrambled order, some twice, bodies swapped
+        std::vector<std::pair<int, int>> feed(curr.begin(), curr.end());
+        std::shuffle(feed.begin(), feed.end(), rng);
+        for (size_t k = 0; k < feed.size(); ++k) {
+            auto [i, j] = feed[k];
+            k % 2 ? scene.Touch(tracker, j, i) : scene.Touch(tracker, i, j);
+            if (k % 5 == 0) scene.Touch(tracker, i, j);
+        }
+        tracker.Update();
+
+        std::set<std::pair<int, int>> begin, stay, end;
+        std::set_difference(curr.begin(), curr.end(), prev.begin(), prev.end(), std::inserter(begin, begin.end()));
+        std::set_intersection(curr.begin(), curr.end(), prev.begin(), prev.end(), std::inserter(stay, stay.end()));
+        std::set_difference(prev.begin(), prev.end(), curr.begin(), curr.end(), std::inserter(end, end.end()));
+
+        const auto& events = tracker.GetEvents();
+        ASSERT_EQ(scene.Pairs(events.begin), begin) << "step " << step;
+        ASSERT_EQ(scene.Pairs(events.stay), stay) << "step " << step;
+        ASSERT_EQ(scene.Pairs(events.end), end) << "step " << step;
+        EXPECT_EQ(events.begin.size() + events.stay.size(), curr.size());
+        prev = std::move(curr);
+    }
+}
+
+TEST(ContactTracker, RemovedBodyNeverEnds) {
+    Scene scene(3);
+    ContactTracker tracker;
+    scene.Touch(tracker, 0, 1);
+    scene.Touch(tracker, 1, 2);
+    tracker.Update();
+
+    tracker.RemoveBody(&scene.bodies[1]);
+    tracker.Update();
+    EXPECT_TRUE(tracker.GetEvents().end.empty());
+}
+
+// ── Subscribers ──────────────────────────────────────────────────────────────
+
+TEST(ContactTracker, SubscribersSeeOnlyEventsPassingTheirFilter) {
+    Scene scene(8);
+    ContactTracker tracker;
+    std::set<std::pair<int, int>> all, layer2, withBody5;
+    tracker.Subscribe({}, [&](const ContactEvents& e) { all = scene.Pairs(e.begin); });
+    tracker.Subscribe({ .layerMask = 1 << 2 }, [&](const ContactEvents& e) { layer2 = scene.Pairs(e.begin); });
+    ContactFilter body5 { .predicate = [&](const GameObject* go) { return go == scene.objects[5]; } };
+    tracker.Subscribe(body5, [&](const ContactEvents& e) { withBody5 = scene.Pairs(e.begin); });
+
+    scene.Touch(tracker, 0, 1);
+    scene.Touch(tracker, 1, 2);// body 2 is on layer 1 << 2
+    scene.Touch(tracker, 3, 5);
+    scene.Touch(tracker, 5, 6);// body 6 is on layer 1 << 2 as well
+    tracker.Update();
+    tracker.Dispatch();
+
+    EXPECT_EQ(all.size(), 4u);
+    EXPECT_EQ(layer2, (std::set<std::pair<int, int>> { { 1, 2 }, { 5, 6 } }));
+    EXPECT_EQ(withBody5, (std::set<std::pair<int, int>> { { 3, 5 }, { 5, 6 } }));
+}
+
+TEST(ContactTracker, SubscriptionChangesDuringDispatchApplyAfterIt) {
+    Scene scene(2);
+    ContactTracker tracker;
+    int firstCalls = 0, secondCalls = 0, lateCalls = 0;
+    ContactSubscriberID first = 0, second = 0;
+
+    // The first listener drops itself and the second, and adds a new one
+    first = tracker.Subscribe({}, [&](const ContactEvents&) {
+        ++firstCalls;
+        tracker.Unsubscribe(first);
+        tracker.Unsubscribe(second);
+        for (int i = 0; i < 64; ++i)// enough to reallocate the subscriber list
+            tracker.Subscribe({}, [&](const ContactEvents&) { ++lateCalls; });
+    });
+    second = tracker.Subscribe({}, [&](const ContactEvents&) { ++secondCalls; });
+
+    scene.Touch(tracker, 0, 1);
+    tracker.Update();
+    tracker.Dispatch();
+    EXPECT_EQ(firstCalls, 1);
+    EXPECT_EQ(secondCalls, 0);
+    EXPECT_EQ(lateCalls, 0);
+
+    scene.Touch(tracker, 0, 1);
+    tracker.Update();
+    tracker.Dispatch();
+    EXPECT_EQ(firstCalls, 1);
+    EXPECT_EQ(lateCalls, 64);
+}
+
+TEST(ContactTracker, SubscribeAndUnsubscribeWithinOneDispatch) {
+    Scene scene(2);
+    ContactTracker tracker;
+    int lateCalls = 0;
+    bool once = true;
+    tracker.Subscribe({}, [&](const ContactEvents&) {
+        if (!once) return;
+        once = false;
+        ContactSubscriberID late = tracker.Subscribe({}, [&](const ContactEvents&) { ++lateCalls; });
+        tracker.Unsubscribe(late);
+    });
+
+    for (int step = 0; step < 2; ++step) {
+        scene.Touch(tracker, 0, 1);
+        tracker.Update();
+        tracker.Dispatch();
+    }
+    EXPECT_EQ(lateCalls, 0);
+}
@@ -0,0 +1,67 @@
+#include "content_hash.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+    std::vector<uint8_t> Bytes(const std::string& text) {
+        return std::vector<uint8_t>(text.begin(), text.end());
+    }
+
+    uint64_t Hash(const std::string& text) {
+        std::vector<uint8_t> bytes = Bytes(text);
+        return HashContent(bytes);
+    }
+}// namespace
+
+TEST(ContentHash, DependsOnlyOnTheBytes) {
+    EXPECT_EQ(Hash("rock diffuse"), Hash("rock diffuse"));
+    EXPECT_NE(Hash("rock diffuse"), Hash("rock diffusf"));
+    EXPECT_NE(Hash("ab"), Hash("ba"));
+    EXPECT_EQ(HashContent({}), Hash(""));
+}
+
+// The lookups AssetManager does: a second path with the same bytes finds the
+// first as its holder and shares its texture or mesh
+TEST(ContentIndex, IdenticalBytesUnderTwoPathsShareOneHolder) {
+    ContentIndex index;
+    uint64_t rock = Hash("rock"), sand = Hash("sand");
+    EXPECT_EQ(index.Find(rock), nullptr);
+
+    EXPECT_EQ(index.Insert(rock, "a/rock.png"), "a/rock.png");
+    ASSERT_NE(index.Find(rock), nullptr);
+    EXPECT_EQ(*index.Find(rock), "a/rock.png");
+    // The copy under another path dedups onto the first, which stays the holder
+    EXPECT_EQ(index.Insert(rock, "b/rock_copy.png"), "a/rock.png");
+    EXPECT_EQ(index.Find(sand), nullptr);
+    EXPECT_EQ(index.GetCount(), 1u);
+
+    // Erasing the alias, which holds nothing, keeps the holder
+    index.Erase("b/rock_copy.png");
+    EXPECT_EQ(*index.Find(rock), "a/rock.png");
+}
+
+TEST(ContentIndex, ChangedHolderNoLongerClaimsItsOldBytes) {
+    ContentIndex index;
+    uint64_t before = Hash("v1"), after = Hash("v2");
+    index.Insert(before, "hero.aemesh");
+
+    // Hot reload erases the holder, so a path still holding v1 loads fresh
+    index.Erase("hero.aemesh");
+    EXPECT_EQ(index.Find(before), nullptr);
+    EXPECT_EQ(index.Insert(before, "hero_copy.aemesh"), "hero_copy.aemesh");
+
+    // Re-inserting a name with new bytes gives up its old hash
+    index.Insert(after, "hero_copy.aemesh");
+    EXPECT_EQ(index.Find(before), nullptr);
+    EXPECT_EQ(*index.Find(after), "hero_copy.aemesh");
+    EXPECT_EQ(index.GetCount(), 1u);
+
+    index.Clear();
+    EXPECT_EQ(index.GetCount(), 0u);
+    EXPECT_EQ(index.Find(after), nullptr);
+}
@@ -0,0 +1,109 @@
+#include "depth_sort.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+    std::vector<uint32_t> RandomKeys(uint32_t count, uint32_t seed, uint32_t range = UINT32_MAX) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<uint32_t> key(0, range);
+        std::vector<uint32_t> keys(count);
+        for (auto& k : keys)
+            k = key(rng);
+        return keys;
+    }
+
+    // Reference: indices in ascending key order, ties by index
+    std::vector<uint32_t> StableOrder(const std::vector<uint32_t>& keys) {
+        std::vector<uint32_t> order(keys.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+        return order;
+    }
+
+    bool IsSortedBy(const std::vector<uint32_t>& order, const std::vector<uint32_t>& keys) {
+        for (size_t i = 1; i < order.size(); ++i)
+            if (keys[order[i - 1]] > keys[order[i]]) return false;
+        return true;
+    }
+}// namespace
+
+// ── Keys ─────────────────────────────────────────────────────────────────────
+
+TEST(DepthSortKeys, FloatKeyPreservesOrder) {
+    const std::vector<float> values = { -1.0e30f, -2.5f, -1.0f, -1.0e-30f, -0.0f, 0.0f, 1.0e-30f, 1.0f, 2.5f, 1.0e30f };
+    for (size_t i = 1; i < values.size(); ++i)
+        EXPECT_LE(FloatSortKey(values[i - 1]), FloatSortKey(values[i])) << values[i - 1] << " vs " << values[i];
+    EXPECT_LT(FloatSortKey(-1.0f), FloatSortKey(1.0f));
+}
+
+TEST(DepthSortKeys, QuantizedDepthIsMonotoneAndFitsItsBits) {
+    for (int bits : { 16, 23, 31 }) {
+        uint32_t previous = 0;
+        for (float d = 0.0f; d < 1.0e6f; d = d * 1.1f + 0.01f) {
+            uint32_t key = QuantizeDepth(d, bits);
+            EXPECT_LT(key, 1u << bits);
+            EXPECT_GE(key, previous) << "depth " << d;
+            previous = key;
+        }
+        EXPECT_EQ(QuantizeDepth(-5.0f, bits), 0u);
+    }
+}
+
+// ── Sorting ──────────────────────────────────────────────────────────────────
+
+TEST(DepthSorter, RandomKeysMatchStableSort) {
+    DepthSorter sorter;
+    for (uint32_t count : { 0u, 1u, 2u, 1000u, 100000u, 0u }) {
+        auto keys = RandomKeys(count, count);
+        EXPECT_EQ(sorter.Sort(keys.data(), count), StableOrder(keys)) << count;
+    }
+}
+
+TEST(DepthSorter, NarrowKeysWithTiesMatchStableSort) {
+    DepthSorter sorter;
+    auto keys = RandomKeys(50000, 3, 0xFF);
+    EXPECT_EQ(sorter.Sort(keys.data(), 50000), StableOrder(keys));
+}
+
+TEST(DepthSorter, CoherentFrameUsesInsertionSort) {
+    DepthSorter sorter;
+    auto keys = RandomKeys(10000, 4, 1u << 24);
+    sorter.Sort(keys.data(), 10000);
+    EXPECT_FALSE(sorter.UsedInsertionSort());
+
+    // Every key drifts a little, as depths do between frames
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> drift(-8, 8);
+    for (auto& k : keys)
+        k = (uint32_t)std::max(0, (int)k + drift(rng));
+    const auto& order = sorter.Sort(keys.data(), 10000);
+    EXPECT_TRUE(sorter.UsedInsertionSort());
+    EXPECT_TRUE(IsSortedBy(order, keys));
+}
+
+TEST(DepthSorter, ShuffledFrameFallsBackToRadix) {
+    DepthSorter sorter;
+    auto keys = RandomKeys(10000, 6);
+    sorter.Sort(keys.data(), 10000);
+    keys = RandomKeys(10000, 7);
+    const auto& order = sorter.Sort(keys.data(), 10000);
+    EXPECT_FALSE(sorter.UsedInsertionSort());
+    EXPECT_TRUE(IsSortedBy(order, keys));
+}
+
+TEST(DepthSorter, ChangedCountDropsHistory) {
+    DepthSorter sorter;
+    auto keys = RandomKeys(10001, 8);
+    std::sort(keys.begin(), keys.end());
+    sorter.Sort(keys.data(), 10000);
+    // Sorted keys would pass an insertion check, but a new count means no
+    // history, so the sorter radix sorts without trying
+    const auto& order = sorter.Sort(keys.data(), 10001);
+    EXPECT_FALSE(sorter.UsedInsertionSort());
+    EXPECT_EQ(order, StableOrder(keys));
+}
@@ -0,0 +1,214 @@
+#include "file_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    FileSystem::Bytes Filled(size_t size, uint8_t value) {
+        return FileSystem::Bytes(size, value);
+    }
+
+    std::string Key(int i) {
+        return "assets/file_" + std::to_string(i);
+    }
+
+    // Keys that land in one shard, so LRU order inside it is observable
+    std::vector<std::string> SameShardKeys(size_t count) {
+        std::vector<std::string> keys;
+        const size_t shard = std::hash<std::string>{}(Key(0)) % FileCache::SHARD_COUNT;
+        for (int i = 0; keys.size() < count; ++i) {
+            if (std::hash<std::string>{}(Key(i)) % FileCache::SHARD_COUNT == shard) keys.push_back(Key(i));
+        }
+        return keys;
+    }
+}// namespace
+
+// ── Lookup and stats ─────────────────────────────────────────────────────────
+
+TEST(FileCache, FindReturnsTheSharedBufferAndCountsHits) {
+    FileCache cache;
+    auto inserted = cache.Insert("a", Filled(100, 1));
+    auto found = cache.Find("a");
+    EXPECT_EQ(found.get(), inserted.get());// no copy
+    EXPECT_EQ(cache.Find("b"), nullptr);
+    EXPECT_TRUE(cache.Contains("a"));
+    EXPECT_FALSE(cache.Contains("b"));
+
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);// Contains doesn't count
+    EXPECT_EQ(stats.entries, 1u);
+    EXPECT_EQ(stats.bytes, 100u);
+    EXPECT_EQ(stats.pinnedBytes, 100u);
+    inserted.reset();
+    found.reset();
+    EXPECT_EQ(cache.GetStats().pinnedBytes, 0u);
+}
+
+TEST(FileCache, ReinsertReplacesTheEntry) {
+    FileCache cache;
+    cache.Insert("a", Filled(100, 1));
+    cache.Insert("a", Filled(40, 2));
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.entries, 1u);
+    EXPECT_EQ(stats.bytes, 40u);
+    EXPECT_EQ((*cache.Find("a"))[0], 2);
+}
+
+TEST(FileCache, TakeMovesUnsharedBytesOut) {
+    FileCache cache;
+    const uint8_t* storage = cache.Insert("a", Filled(100, 1))->data();
+    bool found = false;
+    auto bytes = cache.Take("a", found);
+    EXPECT_TRUE(found);
+    EXPECT_EQ(bytes.data(), storage);
+    EXPECT_FALSE(cache.Contains("a"));
+    EXPECT_EQ(cache.GetStats().bytes, 0u);
+
+    cache.Take("a", found);
+    EXPECT_FALSE(found);
+}
+
+TEST(FileCache, TakeCopiesBytesAReaderStillHolds) {
+    FileCache cache;
+    auto reader = cache.Insert("a", Filled(100, 1));
+    bool found = false;
+    auto bytes = cache.Take("a", found);
+    ASSERT_TRUE(found);
+    EXPECT_NE(bytes.data(), reader->data());
+    EXPECT_EQ(bytes, *reader);
+}
+
+// ── Eviction ─────────────────────────────────────────────────────────────────
+
+TEST(FileCache, EvictsLeastRecentlyUsedFirst) {
+    FileCache cache;
+    cache.SetBudget(300);
+    auto keys = SameShardKeys(4);
+    cache.Insert(keys[0], Filled(100, 0));
+    cache.Insert(keys[1], Filled(100, 1));
+    cache.Insert(keys[2], Filled(100, 2));
+    cache.Find(keys[0]);// keys[1] is now the oldest
+
+    cache.Insert(keys[3], Filled(100, 3));
+    EXPECT_TRUE(cache.Contains(keys[0]));
+    EXPECT_FALSE(cache.Contains(keys[1]));
+    EXPECT_TRUE(cache.Contains(keys[2]));
+    EXPECT_TRUE(cache.Contains(keys[3]));
+    EXPECT_EQ(cache.GetStats().evictions, 1u);
+    EXPECT_EQ(cache.GetStats().bytes, 300u);
+}
+
+TEST(FileCache, BudgetIsSharedAcrossShards) {
+    FileCache cache;
+    cache.SetBudget(1000);
+    for (int i = 0; i < 100; ++i) {
+        cache.Insert(Key(i), Filled(100, 0));
+        EXPECT_LE(cache.GetStats().bytes, 1000u) << i;
+    }
+    EXPECT_EQ(cache.GetStats().entries, 10u);
+    EXPECT_EQ(cache.GetStats().evictions, 90u);
+    EXPECT_TRUE(cache.Contains(Key(99)));
+}
+
+TEST(FileCache, PinnedEntriesSurviveEviction) {
+    FileCache cache;
+    cache.SetBudget(200);
+    auto pinned = cache.Insert(Key(0), Filled(100, 0));
+    for (int i = 1; i < 20; ++i)
+        cache.Insert(Key(i), Filled(100, 0));
+    EXPECT_TRUE(cache.Contains(Key(0)));
+    EXPECT_LE(cache.GetStats().bytes, 200u);
+
+    pinned.reset();
+    cache.SetBudget(100);
+    EXPECT_FALSE(cache.Contains(Key(0)));
+    EXPECT_LE(cache.GetStats().bytes, 100u);
+}
+
+TEST(FileCache, EntryLargerThanTheBudgetStillRoundTrips) {
+    FileCache cache;
+    cache.SetBudget(100);
+    cache.Insert("small", Filled(50, 0));
+    cache.Insert("huge", Filled(1000, 1));
+    EXPECT_FALSE(cache.Contains("small"));
+    ASSERT_TRUE(cache.Contains("huge"));
+    bool found = false;
+    EXPECT_EQ(cache.Take("huge", found).size(), 1000u);
+}
+
+TEST(FileCache, ClearDropsEverything) {
+    FileCache cache;
+    for (int i = 0; i < 50; ++i)
+        cache.Insert(Key(i), Filled(10, 0));
+    cache.Clear();
+    EXPECT_EQ(cache.GetStats().entries, 0u);
+    EXPECT_EQ(cache.GetStats().bytes, 0u);
+    cache.Insert("a", Filled(10, 0));
+    EXPECT_EQ(cache.GetStats().bytes, 10u);
+}
+
+// ── Concurrency ──────────────────────────────────────────────────────────────
+
+TEST(FileCacheStress, MixedOperationsKeepTheBudgetAndPins) {
+    constexpr int THREADS = 8, OPS = 20000, KEYS = 512;
+    constexpr size_t BUDGET = 64 * 1024;
+    FileCache cache;
+    cache.SetBudget(BUDGET);
+    // Each thread owns one pinned entry for the whole run
+    std::vector<FileSystem::SharedBytes> pins;
+    for (int t = 0; t < THREADS; ++t)
+        pins.push_back(cache.Insert("pinned_" + std::to_string(t), Filled(256, (uint8_t)t)));
+
+    std::atomic<int> corrupt{ 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            std::mt19937 rng(t);
+            std::uniform_int_distribution<int> key(0, KEYS - 1), op(0, 9), size(1, 1024);
+            for (int n = 0; n < OPS; ++n) {
+                int k = key(rng);
+                switch (op(rng)) {
+                case 0:
+                case 1:
+                case 2: cache.Insert(Key(k), Filled((size_t)size(rng), (uint8_t)k)); break;
+                case 3: {
+                    bool found = false;
+                    auto bytes = cache.Take(Key(k), found);
+                    if (found && !bytes.empty() && bytes[0] != (uint8_t)k) ++corrupt;
+                    break;
+                }
+                case 4: cache.Erase(Key(k)); break;
+                default: {
+                    auto bytes = cache.Find(Key(k));
+                    if (bytes && !bytes->empty() && (*bytes)[0] != (uint8_t)k) ++corrupt;
+                    break;
+                }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(corrupt.load(), 0);
+    auto stats = cache.GetStats();
+    // One in-flight insert per thread may overshoot before it evicts
+    EXPECT_LE(stats.bytes, BUDGET + THREADS * 1024);
+    EXPECT_GT(stats.evictions, 0u);
+    for (int t = 0; t < THREADS; ++t)
+        EXPECT_EQ(cache.Find("pinned_" + std::to_string(t)), pins[t]);
+
+    // The global byte count didn't drift: after a clear, 90 bytes fit in 100
+    cache.Clear();
+    cache.SetBudget(100);
+    cache.Insert("x", Filled(60, 0));
+    cache.Insert("y", Filled(30, 0));
+    EXPECT_EQ(cache.GetStats().evictions, stats.evictions);
+    EXPECT_TRUE(cache.Contains("x"));
+}
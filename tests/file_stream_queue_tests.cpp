@@ -0,0 +1,257 @@
+#include "file_stream_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    using Priority = FileSystem::Priority;
+    using namespace std::chrono_literals;
+
+    // Throttled fake disk: every read takes `latency`, and reads block while
+    // the gate is closed.  Records the order paths were read in.
+    class FakeDisk {
+    public:
+        FileSystem::Bytes Read(const std::string& path) {
+            std::unique_lock<std::mutex> lk(_mutex);
+            _reads.push_back(path);
+            _changed.notify_all();
+            _changed.wait(lk, [this] { return _open; });
+            lk.unlock();
+            std::this_thread::sleep_for(_latency);
+            if (path.starts_with("missing/")) return {};
+            return FileSystem::Bytes(path.begin(), path.end());
+        }
+
+        FileStreamQueue::ReadFn Fn() {
+            return [this](const std::string& path) { return Read(path); };
+        }
+
+        void Close() {
+            std::lock_guard<std::mutex> lk(_mutex);
+            _open = false;
+        }
+        void Open() {
+            {
+                std::lock_guard<std::mutex> lk(_mutex);
+                _open = true;
+            }
+            _changed.notify_all();
+        }
+        void SetLatency(std::chrono::microseconds latency) {
+            _latency = latency;
+        }
+
+        // Blocks until `count` reads have started
+        void WaitForReads(size_t count) {
+            std::unique_lock<std::mutex> lk(_mutex);
+            ASSERT_TRUE(_changed.wait_for(lk, 5s, [&] { return _reads.size() >= count; }));
+        }
+        std::vector<std::string> GetReads() {
+            std::lock_guard<std::mutex> lk(_mutex);
+            return _reads;
+        }
+
+    private:
+        std::mutex _mutex;
+        std::condition_variable _changed;
+        std::vector<std::string> _reads;
+        bool _open = true;
+        std::chrono::microseconds _latency{ 0 };
+    };
+
+    struct Delivery {
+        std::string path;
+        FileSystem::Bytes bytes;
+        bool ok;
+    };
+
+    FileSystem::ReadCallback Record(std::vector<Delivery>& out, std::string path) {
+        return [&out, path](FileSystem::Bytes bytes, bool ok) { out.push_back({ path, std::move(bytes), ok }); };
+    }
+
+    // Pumps from the test (main) thread until `count` callbacks have run
+    void PumpUntil(FileStreamQueue& queue, const std::vector<Delivery>& delivered, size_t count) {
+        auto giveUp = std::chrono::steady_clock::now() + 5s;
+        while (delivered.size() < count && std::chrono::steady_clock::now() < giveUp) {
+            if (queue.Pump(1.0f) == 0) std::this_thread::sleep_for(1ms);
+        }
+        ASSERT_EQ(delivered.size(), count);
+    }
+}// namespace
+
+// ── Ordering ─────────────────────────────────────────────────────────────────
+
+TEST(FileStreamQueue, ReadsByPriorityThenDeadlineThenSubmission) {
+    FakeDisk disk;
+    FileStreamQueue queue(disk.Fn(), 1);
+    std::vector<Delivery> delivered;
+
+    // Hold the only read slot so everything else queues up behind it
+    disk.Close();
+    queue.Submit("blocker", Priority::Low, 0.0f, Record(delivered, "blocker"));
+    disk.WaitForReads(1);
+
+    queue.Submit("low", Priority::Low, 0.0f, Record(delivered, "low"));
+    queue.Submit("normal_late", Priority::Normal, 2.0f, Record(delivered, "normal_late"));
+    queue.Submit("normal_first", Priority::Normal, 0.0f, Record(delivered, "normal_first"));
+    queue.Submit("normal_soon", Priority::Normal, 1.0f, Record(delivered, "normal_soon"));
+    queue.Submit("normal_second", Priority::Normal, 0.0f, Record(delivered, "normal_second"));
+    queue.Submit("critical", Priority::Critical, 0.0f, Record(delivered, "critical"));
+    queue.Submit("high", Priority::High, 0.0f, Record(delivered, "high"));
+    disk.Open();
+
+    PumpUntil(queue, delivered, 8);
+    const std::vector<std::string> expected = { "blocker",      "critical",      "high",          "normal_soon",
+                                                "normal_late",  "normal_first",  "normal_second", "low" };
+    EXPECT_EQ(disk.GetReads(), expected);
+    for (size_t i = 0; i < delivered.size(); ++i) {
+        EXPECT_EQ(delivered[i].path, expected[i]);
+        EXPECT_TRUE(delivered[i].ok);
+        EXPECT_EQ(std::string(delivered[i].bytes.begin(), delivered[i].bytes.end()), expected[i]);
+    }
+    EXPECT_EQ(queue.GetPendingCount(), 0u);
+}
+
+// ── Frame budget ─────────────────────────────────────────────────────────────
+
+TEST(FileStreamQueue, PumpDoesNotWaitForTheDisk) {
+    FakeDisk disk;
+    FileStreamQueue queue(disk.Fn(), 2);
+    std::vector<Delivery> delivered;
+    disk.Close();
+    for (int i = 0; i < 4; ++i)
+        queue.Submit("file_" + std::to_string(i), Priority::Normal, 0.0f, Record(delivered, "file"));
+    // Reads run on JobSystem workers; a single-core machine has one
+    disk.WaitForReads(std::min<size_t>(2, JobSystem::Get()->GetThreadCount()));
+
+    // Every read in flight is stuck; a frame's pump returns at once
+    for (int frame = 0; frame < 10; ++frame) {
+        auto start = std::chrono::steady_clock::now();
+        EXPECT_EQ(queue.Pump(0.002f), 0u);
+        EXPECT_LT(std::chrono::steady_clock::now() - start, 20ms);
+    }
+    EXPECT_EQ(queue.GetPendingCount(), 4u);
+
+    disk.Open();
+    PumpUntil(queue, delivered, 4);
+}
+
+TEST(FileStreamQueue, PumpStopsWhenTheBudgetIsSpent) {
+    FakeDisk disk;
+    FileStreamQueue queue(disk.Fn(), 2);
+    int ran = 0;
+    for (int i = 0; i < 20; ++i) {
+        queue.Submit("file_" + std::to_string(i), Priority::Normal, 0.0f, [&](FileSystem::Bytes, bool) {
+            ++ran;
+            std::this_thread::sleep_for(2ms);
+        });
+    }
+    disk.WaitForReads(20);
+    auto giveUp = std::chrono::steady_clock::now() + 5s;
+    while (queue.GetPendingCount() > 0 && std::chrono::steady_clock::now() < giveUp) {
+        size_t before = ran;
+        size_t pumped = queue.Pump(0.005f);
+        // Budget 5 ms at 2 ms per callback: a handful per frame, never all
+        EXPECT_LE(pumped, 4u);
+        EXPECT_EQ((size_t)ran, before + pumped);
+        if (pumped == 0) std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_EQ(ran, 20);
+}
+
+TEST(FileStreamQueue, ZeroBudgetStillRunsOneCallback) {
+    FakeDisk disk;
+    FileStreamQueue queue(disk.Fn(), 1);
+    std::vector<Delivery> delivered;
+    for (int i = 0; i < 3; ++i)
+        queue.Submit("file_" + std::to_string(i), Priority::Normal, 0.0f, Record(delivered, "file"));
+    disk.WaitForReads(3);
+    while (queue.GetPendingCount() > 0) {
+        size_t before = delivered.size();
+        size_t pumped = queue.Pump(0.0f);
+        EXPECT_LE(pumped, 1u);
+        EXPECT_EQ(delivered.size(), before + pumped);
+        if (pumped == 0) std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_EQ(delivered.size(), 3u);
+}
+
+// ── Cancellation and results ─────────────────────────────────────────────────
+
+TEST(FileStreamQueue, CancelledRequestsAreNeverDelivered) {
+    FakeDisk disk;
+    FileStreamQueue queue(disk.Fn(), 1);
+    std::vector<Delivery> delivered;
+    disk.Close();
+    queue.Submit("blocker", Priority::Normal, 0.0f, Record(delivered, "blocker"));
+    disk.WaitForReads(1);
+    auto queued = queue.Submit("queued", Priority::Normal, 0.0f, Record(delivered, "queued"));
+    queue.Submit("kept", Priority::Low, 0.0f, Record(delivered, "kept"));
+
+    EXPECT_TRUE(queue.Cancel(queued));
+    EXPECT_FALSE(queue.Cancel(queued));
+    EXPECT_EQ(queue.GetPendingCount(), 2u);
+    disk.Open();
+    PumpUntil(queue, delivered, 2);
+    EXPECT_EQ(delivered[0].path, "blocker");
+    EXPECT_EQ(delivered[1].path, "kept");
+    // Cancelled while queued: never read either
+    for (const auto& path : disk.GetReads())
+        EXPECT_NE(path, "queued");
+}
+
+TEST(FileStreamQueue, CancelAfterTheReadDropsTheCallback) {
+    FakeDisk disk;
+    FileStreamQueue queue(disk.Fn(), 1);
+    std::vector<Delivery> delivered;
+    auto done = queue.Submit("done", Priority::Normal, 0.0f, Record(delivered, "done"));
+    queue.Submit("after", Priority::Normal, 0.0f, Record(delivered, "after"));
+    disk.WaitForReads(2);
+    std::this_thread::sleep_for(10ms);// both completions queued, none pumped
+
+    EXPECT_TRUE(queue.Cancel(done));
+    PumpUntil(queue, delivered, 1);
+    EXPECT_EQ(delivered[0].path, "after");
+    EXPECT_EQ(queue.Pump(1.0f), 0u);
+}
+
+TEST(FileStreamQueue, ReportsFailuresAndDropsBytesWhenAsked) {
+    FakeDisk disk;
+    FileStreamQueue queue(disk.Fn(), 2);
+    std::vector<Delivery> delivered;
+    queue.Submit("missing/file", Priority::Normal, 0.0f, Record(delivered, "missing"));
+    queue.Submit("present", Priority::Normal, 0.0f, Record(delivered, "prefetch"), false);
+    PumpUntil(queue, delivered, 2);
+    for (const auto& d : delivered) {
+        EXPECT_TRUE(d.bytes.empty());
+        EXPECT_EQ(d.ok, d.path == "prefetch") << d.path;
+    }
+}
+
+TEST(FileStreamQueue, ThrottledDiskDrainsAcrossFrames) {
+    FakeDisk disk;
+    disk.SetLatency(2ms);
+    FileStreamQueue queue(disk.Fn(), 2);
+    std::vector<Delivery> delivered;
+    for (int i = 0; i < 50; ++i)
+        queue.Submit("file_" + std::to_string(i), Priority::Normal, 0.0f, Record(delivered, "file"));
+
+    // Simulated 60 Hz frames: the pump never holds a frame up on I/O
+    int frames = 0;
+    while (delivered.size() < 50 && frames < 1000) {
+        auto start = std::chrono::steady_clock::now();
+        queue.Pump(0.002f);
+        EXPECT_LT(std::chrono::steady_clock::now() - start, 20ms);
+        std::this_thread::sleep_for(16ms);
+        ++frames;
+    }
+    EXPECT_EQ(delivered.size(), 50u);
+    EXPECT_GT(frames, 1);
+}
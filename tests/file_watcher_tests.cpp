@@ -0,0 +1,113 @@
+#include "file_watcher.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    namespace fs = std::filesystem;
+
+    class FileWatcherTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            _dir = fs::temp_directory_path() / ("ae_file_watcher_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+            fs::remove_all(_dir);
+            fs::create_directories(_dir / "sub");
+        }
+        void TearDown() override {
+            fs::remove_all(_dir);
+        }
+
+        std::string Write(const std::string& name, const std::string& text) {
+            fs::path path = _dir / name;
+            std::ofstream(path) << text;
+            return path.string();
+        }
+
+        // inotify reports at once; the mtime fallback needs POLL_INTERVAL and
+        // a coarse clock to tick
+        std::vector<std::string> PollAfterWrite(FileWatcher& watcher) {
+#ifndef __linux__
+            std::this_thread::sleep_for(FileWatcher::POLL_INTERVAL + std::chrono::milliseconds(600));
+#endif
+            std::vector<std::string> changed = watcher.Poll();
+            std::sort(changed.begin(), changed.end());
+            return changed;
+        }
+
+        fs::path _dir;
+    };
+}// namespace
+
+TEST_F(FileWatcherTest, ReportsRewrittenWatchedFilesOnce) {
+    FileWatcher watcher;
+    if (!watcher.IsSupported()) GTEST_SKIP() << "no file watching on this platform";
+    std::string a = Write("a.txt", "1"), b = Write("sub/b.txt", "1");
+    watcher.Watch(a);
+    watcher.Watch(b);
+    watcher.Watch(a);
+    EXPECT_TRUE(PollAfterWrite(watcher).empty());
+
+    Write("a.txt", "2");
+    Write("unwatched.txt", "2");
+    Write("a.txt", "3");
+    EXPECT_EQ(PollAfterWrite(watcher), (std::vector<std::string>{ a }));
+    EXPECT_TRUE(watcher.Poll().empty());
+}
+
+#ifdef __linux__
+TEST_F(FileWatcherTest, CatchesSavesByRename) {
+    FileWatcher watcher;
+    if (!watcher.IsSupported()) GTEST_SKIP() << "inotify unavailable";
+    std::string a = Write("a.txt", "1");
+    watcher.Watch(a);
+    Write("a.txt.tmp", "2");
+    fs::rename(_dir / "a.txt.tmp", a);
+    EXPECT_EQ(watcher.Poll(), (std::vector<std::string>{ a }));
+}
+
+TEST_F(FileWatcherTest, QueueOverflowReportsEveryWatchedFile) {
+    FileWatcher watcher;
+    if (!watcher.IsSupported()) GTEST_SKIP() << "inotify unavailable";
+    size_t maxQueued = 0;
+    std::ifstream("/proc/sys/fs/inotify/max_queued_events") >> maxQueued;
+    if (maxQueued == 0 || maxQueued > 200000) GTEST_SKIP() << "queue limit unknown or too large to fill";
+
+    std::string a = Write("a.txt", "1"), b = Write("sub/b.txt", "1");
+    watcher.Watch(a);
+    watcher.Watch(b);
+    // Unwatched writes in a watched directory still queue events; distinct
+    // names, as inotify merges identical consecutive ones
+    for (size_t i = 0; i <= maxQueued; ++i) Write("noise" + std::to_string(i), "x");
+    EXPECT_EQ(PollAfterWrite(watcher), (std::vector<std::string>{ a, b }));
+    EXPECT_TRUE(watcher.Poll().empty());
+}
+#endif
+
+TEST_F(FileWatcherTest, UnwatchedFilesAreNoLongerReported) {
+    FileWatcher watcher;
+    if (!watcher.IsSupported()) GTEST_SKIP() << "no file watching on this platform";
+    std::string a = Write("a.txt", "1"), b = Write("b.txt", "1"), c = Write("sub/c.txt", "1");
+    watcher.Watch(a);
+    watcher.Watch(b);
+    watcher.Watch(c);
+    watcher.Unwatch(a);
+    watcher.Unwatch(c);// last in its directory
+    watcher.Unwatch("never/watched.txt");
+
+    Write("a.txt", "2");
+    Write("b.txt", "2");
+    Write("sub/c.txt", "2");
+    EXPECT_EQ(PollAfterWrite(watcher), (std::vector<std::string>{ b }));
+
+    // Watching again after the directory was dropped works
+    watcher.Watch(c);
+    Write("sub/c.txt", "3");
+    EXPECT_EQ(PollAfterWrite(watcher), (std::vector<std::string>{ c }));
+}
@@ -0,0 +1,82 @@
+#include "fixed_step_clock.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace {
+    constexpr float STEP = 1.0f / 60.0f;
+
+    FixedStepClock MakeClock(int maxSubSteps = 4) {
+        FixedStepClock clock;
+        clock.step = STEP;
+        clock.maxSubSteps = maxSubSteps;
+        return clock;
+    }
+}// namespace
+
+TEST(FixedStepClock, StepsMatchElapsedTimeBelowTheCap) {
+    FixedStepClock clock = MakeClock();
+    std::mt19937 rng(33);
+    std::uniform_real_distribution<float> frame(0.002f, 0.05f);// under maxSubSteps * step
+
+    double elapsed = 0.0;
+    long steps = 0;
+    for (int i = 0; i < 2000; ++i) {
+        float dt = frame(rng);
+        int n = clock.Advance(dt);
+        ASSERT_GE(n, 0);
+        ASSERT_LE(n, clock.maxSubSteps);
+        elapsed += dt;
+        steps += n;
+        // No time is lost: whatever was not stepped is still accumulated
+        ASSERT_NEAR(steps * (double)STEP + clock.accumulator, elapsed, 1e-3);
+        ASSERT_GE(clock.GetAlpha(), 0.0f);
+        ASSERT_LT(clock.GetAlpha(), 1.0f);
+    }
+}
+
+TEST(FixedStepClock, HitchIsCappedAndDilated) {
+    FixedStepClock clock = MakeClock(4);
+    EXPECT_EQ(clock.Advance(0.5f), 4);// 30 steps due, 4 run
+    // The surplus is dropped rather than carried into later frames
+    EXPECT_LT(clock.accumulator, STEP);
+    EXPECT_EQ(clock.Advance(STEP), 1);
+}
+
+TEST(FixedStepClock, FractionalFramesAccumulate) {
+    FixedStepClock clock = MakeClock();
+    int steps = 0;
+    for (int i = 0; i < 10; ++i)
+        steps += clock.Advance(STEP * 0.25f);
+    EXPECT_EQ(steps, 2);// 2.5 steps of time
+    EXPECT_NEAR(clock.GetAlpha(), 0.5f, 1e-4f);
+
+    clock.Reset();
+    EXPECT_EQ(clock.Advance(0.0f), 0);
+    EXPECT_EQ(clock.GetAlpha(), 0.0f);
+}
+
+// A body moving at constant speed, stepped by the clock and rendered at
+// lerp(previous, current, alpha), lags the true motion by exactly one step
+// whatever the frame times are, so its rendered path never judders.
+TEST(FixedStepClock, InterpolatedPoseTrailsByOneStep) {
+    constexpr float speed = 3.0f;
+    FixedStepClock clock = MakeClock(1000);// never capped here
+    std::mt19937 rng(34);
+    std::uniform_real_distribution<float> frame(0.001f, 0.04f);
+
+    double time = 0.0;
+    float previous = 0.0f, current = 0.0f;
+    for (int i = 0; i < 1000; ++i) {
+        float dt = frame(rng);
+        time += dt;
+        for (int n = clock.Advance(dt); n > 0; --n) {
+            previous = current;
+            current += speed * STEP;
+        }
+        float rendered = previous + (current - previous) * clock.GetAlpha();
+        if (time < STEP) continue;// nothing to trail yet
+        ASSERT_NEAR(rendered, speed * (time - STEP), 2e-3) << "frame " << i;
+    }
+}
@@ -0,0 +1,212 @@
+#include "mesh_format.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+    // (cells + 1)² vertices on the XZ plane, facing +Y, two triangles per cell
+    MeshSource Grid(uint32_t cells) {
+        MeshSource mesh;
+        const uint32_t side = cells + 1;
+        for (uint32_t z = 0; z < side; ++z) {
+            for (uint32_t x = 0; x < side; ++x) {
+                mesh.positions.insert(mesh.positions.end(), { float(x) * 0.5f, std::sin(float(x + z)) * 0.1f, float(z) * 0.5f });
+                mesh.uvs.insert(mesh.uvs.end(), { float(x) / float(cells), float(z) / float(cells) });
+                mesh.normals.insert(mesh.normals.end(), { 0.0f, 1.0f, 0.0f });
+                mesh.tangents.insert(mesh.tangents.end(), { 1.0f, 0.0f, 0.0f, x % 2 ? -1.0f : 1.0f });
+            }
+        }
+        for (uint32_t z = 0; z < cells; ++z) {
+            for (uint32_t x = 0; x < cells; ++x) {
+                uint32_t i = z * side + x;
+                mesh.indices.insert(mesh.indices.end(), { i, i + side, i + 1, i + 1, i + side, i + side + 1 });
+            }
+        }
+        return mesh;
+    }
+
+    MeshFileHeader& HeaderOf(std::vector<uint8_t>& file) {
+        return *reinterpret_cast<MeshFileHeader*>(file.data());
+    }
+
+    void SetIndex(std::vector<uint8_t>& file, size_t i, uint32_t value) {
+        const MeshFileHeader& header = HeaderOf(file);
+        if (header.flags & MESH_FILE_INDEX32) {
+            std::memcpy(file.data() + header.indexOffset + i * 4, &value, 4);
+        } else {
+            uint16_t index = static_cast<uint16_t>(value);
+            std::memcpy(file.data() + header.indexOffset + i * 2, &index, 2);
+        }
+    }
+
+    bool Parses(const std::vector<uint8_t>& file, std::string* error = nullptr) {
+        MeshView view;
+        return ParseMeshFile(file, view, error);
+    }
+}// namespace
+
+// ── Quantisation ─────────────────────────────────────────────────────────────
+
+TEST(MeshFormat, HalfFloatRoundTrip) {
+    for (float value : { 0.0f, -0.0f, 1.0f, -2.5f, 0.333f, 1024.0f, 65504.0f, 6.1e-5f, 3.0e-7f }) {
+        float back = HalfToFloat(FloatToHalf(value));
+        EXPECT_NEAR(back, value, std::fabs(value) / 1024.0f + 1e-7f) << value;
+    }
+    EXPECT_TRUE(std::isinf(HalfToFloat(FloatToHalf(1.0e6f))));
+    EXPECT_TRUE(std::isnan(HalfToFloat(FloatToHalf(NAN))));
+    EXPECT_EQ(FloatToHalf(1.0f), 0x3C00);
+}
+
+TEST(MeshFormat, Snorm1010102RoundTrip) {
+    const float inputs[][3] = { { 0.0f, 1.0f, 0.0f }, { -1.0f, 0.0f, 1.0f }, { 0.577f, -0.577f, 0.577f }, { 2.0f, -2.0f, 0.0f } };
+    for (const auto& v : inputs) {
+        float out[3];
+        UnpackSnorm1010102(PackSnorm1010102(v[0], v[1], v[2]), out);
+        for (int k = 0; k < 3; ++k) EXPECT_NEAR(out[k], std::clamp(v[k], -1.0f, 1.0f), 1.0f / 511.0f);
+    }
+}
+
+// ── Round trip ───────────────────────────────────────────────────────────────
+
+TEST(MeshFormat, WrittenMeshParsesBack) {
+    MeshSource mesh = Grid(8);
+    std::vector<uint8_t> file = WriteMeshFile(mesh);
+
+    MeshView view;
+    std::string error;
+    ASSERT_TRUE(ParseMeshFile(file, view, &error)) << error;
+    EXPECT_FALSE(view.Is32BitIndices());
+    ASSERT_EQ(view.vertices.size(), mesh.GetVertexCount());
+    ASSERT_EQ(view.GetIndexCount(), mesh.indices.size());
+    EXPECT_EQ(view.indices.size(), mesh.indices.size() * 2);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(view.vertices.data()) % MESH_FILE_ALIGNMENT, 0u);
+    for (size_t i = 0; i < mesh.indices.size(); ++i) EXPECT_EQ(view.GetIndex(i), mesh.indices[i]);
+
+    for (size_t v = 0; v < view.vertices.size(); ++v) {
+        const PackedVertex& p = view.vertices[v];
+        EXPECT_EQ(std::memcmp(p.position, &mesh.positions[v * 3], sizeof(p.position)), 0);
+        for (int k = 0; k < 2; ++k) EXPECT_NEAR(HalfToFloat(p.uv[k]), mesh.uvs[v * 2 + k], 1.0f / 1024.0f);
+        float n[3], t[3], b[3];
+        UnpackSnorm1010102(p.normal, n);
+        UnpackSnorm1010102(p.tangent, t);
+        UnpackSnorm1010102(p.bitangent, b);
+        EXPECT_NEAR(n[1], 1.0f, 1.0f / 511.0f);
+        EXPECT_NEAR(t[0], 1.0f, 1.0f / 511.0f);
+        // B = cross(N, T) * w = (0, 0, -w)
+        EXPECT_NEAR(b[2], -mesh.tangents[v * 4 + 3], 1.0f / 511.0f);
+    }
+
+    const MeshFileHeader& header = *view.header;
+    EXPECT_FLOAT_EQ(header.boundsMin[0], 0.0f);
+    EXPECT_FLOAT_EQ(header.boundsMax[0], 4.0f);
+    EXPECT_FLOAT_EQ(header.boundsMax[2], 4.0f);
+    for (size_t v = 0; v < mesh.GetVertexCount(); ++v) {
+        float dx = mesh.positions[v * 3] - header.sphereCenter[0], dy = mesh.positions[v * 3 + 1] - header.sphereCenter[1],
+              dz = mesh.positions[v * 3 + 2] - header.sphereCenter[2];
+        EXPECT_LE(std::sqrt(dx * dx + dy * dy + dz * dz), header.sphereRadius * 1.0001f) << v;
+    }
+}
+
+TEST(MeshFormat, LargeMeshesUse32BitIndices) {
+    MeshSource mesh = Grid(256);// 257² > 65536 vertices
+    std::vector<uint8_t> file = WriteMeshFile(mesh);
+    MeshView view;
+    ASSERT_TRUE(ParseMeshFile(file, view));
+    EXPECT_TRUE(view.Is32BitIndices());
+    EXPECT_EQ(view.GetIndex(view.GetIndexCount() - 1), mesh.indices.back());
+    EXPECT_GE(mesh.indices.back(), 65536u);
+}
+
+// ── Validation ───────────────────────────────────────────────────────────────
+
+TEST(MeshFormat, RejectsIndicesPastTheVertexCount) {
+    for (uint32_t cells : { 4u, 256u }) {
+        std::vector<uint8_t> file = WriteMeshFile(Grid(cells));
+        const uint32_t vertexCount = HeaderOf(file).vertexCount;
+        const size_t last = HeaderOf(file).indexCount - 1;
+
+        SetIndex(file, last, vertexCount - 1);
+        EXPECT_TRUE(Parses(file));
+        SetIndex(file, last, vertexCount);
+        std::string error;
+        EXPECT_FALSE(Parses(file, &error));
+        EXPECT_EQ(error, "index out of range");
+        SetIndex(file, 0, 0xFFFFFFFFu);
+        SetIndex(file, last, 0);
+        EXPECT_FALSE(Parses(file));
+    }
+}
+
+TEST(MeshFormat, RejectsBadHeadersAndSections) {
+    const std::vector<uint8_t> good = WriteMeshFile(Grid(4));
+    ASSERT_TRUE(Parses(good));
+
+    auto file = good;
+    file.resize(sizeof(MeshFileHeader) - 1);
+    EXPECT_FALSE(Parses(file));
+
+    file = good;
+    file[0] = 'X';
+    EXPECT_FALSE(Parses(file));
+
+    file = good;
+    HeaderOf(file).version = MESH_FILE_VERSION + 1;
+    EXPECT_FALSE(Parses(file));
+
+    file = good;
+    HeaderOf(file).vertexStride = 32;
+    EXPECT_FALSE(Parses(file));
+
+    file = good;
+    HeaderOf(file).indexCount -= 1;
+    EXPECT_FALSE(Parses(file));
+
+    file = good;
+    file.resize(file.size() - 2);// last index cut off
+    EXPECT_FALSE(Parses(file));
+
+    file = good;
+    HeaderOf(file).vertexCount += 1000;// vertices overlap the indices
+    EXPECT_FALSE(Parses(file));
+
+    file = good;
+    HeaderOf(file).indexOffset += 4;
+    EXPECT_FALSE(Parses(file));
+}
+
+TEST(MeshFormat, RejectsOffsetsThatWrapAround) {
+    const std::vector<uint8_t> good = WriteMeshFile(Grid(1));// 4 vertices, 112 bytes
+    ASSERT_TRUE(Parses(good));
+
+    // vertexOffset + 112 wraps to 96: the vertices would start 16 bytes
+    // before the buffer and end where the (empty) index section begins
+    auto file = good;
+    HeaderOf(file).vertexOffset = 0xFFFFFFFFFFFFFFF0ull;
+    HeaderOf(file).indexOffset  = 96;
+    HeaderOf(file).indexCount   = 0;
+    EXPECT_FALSE(Parses(file));
+
+    // indexOffset + 24 wraps to 8, past the end of the address space
+    file = good;
+    HeaderOf(file).indexOffset = 0xFFFFFFFFFFFFFFF0ull;
+    HeaderOf(file).indexCount  = 12;
+    EXPECT_FALSE(Parses(file));
+
+    file = good;
+    HeaderOf(file).vertexOffset = 0xFFFFFFFFFFFFFFF0ull;
+    HeaderOf(file).indexOffset  = 0xFFFFFFFFFFFFFFF0ull;
+    EXPECT_FALSE(Parses(file));
+}
+
+TEST(MeshFormat, EmptyMeshParses) {
+    std::vector<uint8_t> file = WriteMeshFile(MeshSource{});
+    MeshView view;
+    ASSERT_TRUE(ParseMeshFile(file, view));
+    EXPECT_EQ(view.GetIndexCount(), 0u);
+    EXPECT_TRUE(view.vertices.empty());
+}
@@ -0,0 +1,124 @@
+// tools/mesh_cooker's optimisation passes, compiled into the test directly
+#include "mesh_optimizer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+    using Triangle = std::array<uint32_t, 3>;
+
+    // (cells + 1)² vertices on the XZ plane, two triangles per cell, with the
+    // triangle order shuffled so the cache has something to fix
+    MeshSource ShuffledGrid(uint32_t cells, uint32_t seed) {
+        MeshSource mesh;
+        const uint32_t side = cells + 1;
+        for (uint32_t z = 0; z < side; ++z) {
+            for (uint32_t x = 0; x < side; ++x) {
+                mesh.positions.insert(mesh.positions.end(), { float(x), 0.0f, float(z) });
+                mesh.normals.insert(mesh.normals.end(), { 0.0f, 1.0f, 0.0f });
+            }
+        }
+        std::vector<Triangle> triangles;
+        for (uint32_t z = 0; z < cells; ++z) {
+            for (uint32_t x = 0; x < cells; ++x) {
+                uint32_t i = z * side + x;
+                triangles.push_back({ i, i + side, i + 1 });
+                triangles.push_back({ i + 1, i + side, i + side + 1 });
+            }
+        }
+        std::shuffle(triangles.begin(), triangles.end(), std::mt19937(seed));
+        for (const auto& t : triangles) mesh.indices.insert(mesh.indices.end(), t.begin(), t.end());
+        return mesh;
+    }
+
+    // Rotated so the smallest index leads; winding is kept
+    std::vector<Triangle> CanonicalTriangles(const std::vector<uint32_t>& indices) {
+        std::vector<Triangle> triangles;
+        for (size_t i = 0; i < indices.size(); i += 3) {
+            Triangle t = { indices[i], indices[i + 1], indices[i + 2] };
+            std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+            triangles.push_back(t);
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    }
+
+    // Same, by corner positions, for passes that renumber vertices
+    std::vector<std::array<float, 9>> TrianglePositions(const MeshSource& mesh) {
+        using Corner = std::array<float, 3>;
+        std::vector<std::array<float, 9>> triangles;
+        for (size_t i = 0; i < mesh.indices.size(); i += 3) {
+            std::array<Corner, 3> corners;
+            for (int k = 0; k < 3; ++k)
+                for (int c = 0; c < 3; ++c) corners[k][c] = mesh.positions[mesh.indices[i + k] * 3 + c];
+            std::rotate(corners.begin(), std::min_element(corners.begin(), corners.end()), corners.end());
+            std::array<float, 9> flat;
+            for (int k = 0; k < 3; ++k) std::copy(corners[k].begin(), corners[k].end(), flat.begin() + k * 3);
+            triangles.push_back(flat);
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    }
+}// namespace
+
+TEST(MeshOptimizer, ACMRCountsFifoMisses) {
+    EXPECT_EQ(ComputeACMR({}, 0), 0.0f);
+    EXPECT_EQ(ComputeACMR({ 0, 1, 2 }, 3), 3.0f);
+    EXPECT_EQ(ComputeACMR({ 0, 1, 2, 2, 1, 3 }, 4), 2.0f);
+    // A 3-entry cache has forgotten vertex 0 by the third triangle
+    EXPECT_EQ(ComputeACMR({ 0, 1, 2, 3, 4, 5, 0, 1, 2 }, 6, 3), 3.0f);
+    EXPECT_EQ(ComputeACMR({ 0, 1, 2, 3, 4, 5, 0, 1, 2 }, 6, 16), 2.0f);
+}
+
+TEST(MeshOptimizer, VertexCacheOrderKeepsTrianglesAndCutsMisses) {
+    MeshSource mesh = ShuffledGrid(64, 1);
+    const auto before = CanonicalTriangles(mesh.indices);
+    const float shuffled = ComputeACMR(mesh.indices, mesh.GetVertexCount());
+
+    OptimizeVertexCache(mesh.indices, mesh.GetVertexCount());
+    EXPECT_EQ(CanonicalTriangles(mesh.indices), before);
+    const float optimized = ComputeACMR(mesh.indices, mesh.GetVertexCount());
+    EXPECT_GT(shuffled, 2.5f);
+    // A regular grid's ideal is 0.5; a 16-entry FIFO gets well under 1
+    EXPECT_LT(optimized, 0.8f);
+}
+
+TEST(MeshOptimizer, OverdrawOrderStaysWithinTheCacheBudget) {
+    MeshSource mesh = ShuffledGrid(64, 2);
+    OptimizeVertexCache(mesh.indices, mesh.GetVertexCount());
+    const auto before = CanonicalTriangles(mesh.indices);
+    const float cacheOptimal = ComputeACMR(mesh.indices, mesh.GetVertexCount());
+
+    for (float threshold : { 1.0f, 1.05f, 1.5f }) {
+        MeshSource copy = mesh;
+        OptimizeOverdraw(copy.indices, copy.positions, threshold);
+        EXPECT_EQ(CanonicalTriangles(copy.indices), before) << threshold;
+        EXPECT_LE(ComputeACMR(copy.indices, copy.GetVertexCount()), cacheOptimal * threshold + 0.05f) << threshold;
+    }
+}
+
+TEST(MeshOptimizer, VertexFetchRenumbersByFirstUseAndDropsUnused) {
+    MeshSource mesh = ShuffledGrid(16, 3);
+    // An unreferenced vertex at the front
+    mesh.positions.insert(mesh.positions.begin(), { -1.0f, -1.0f, -1.0f });
+    mesh.normals.insert(mesh.normals.begin(), { 0.0f, 0.0f, 1.0f });
+    for (uint32_t& index : mesh.indices) ++index;
+    const auto before = TrianglePositions(mesh);
+    const size_t used = mesh.GetVertexCount() - 1;
+
+    OptimizeVertexFetch(mesh);
+    EXPECT_EQ(mesh.GetVertexCount(), used);
+    EXPECT_EQ(mesh.normals.size(), used * 3);
+    EXPECT_EQ(TrianglePositions(mesh), before);
+    uint32_t next = 0;
+    for (uint32_t index : mesh.indices) {
+        ASSERT_LE(index, next);
+        if (index == next) ++next;
+    }
+    EXPECT_EQ(next, used);
+}
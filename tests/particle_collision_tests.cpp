@@ -0,0 +1,251 @@
+#include "particle_collision.hpp"
+#include "voxel_world.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Atmospheric;
+
+namespace {
+    constexpr float EPS = 1e-5f;
+
+    struct State {
+        glm::vec3 p;
+        glm::vec3 v;
+    };
+
+    ParticleStorage MakeStorage(const std::vector<State>& particles) {
+        ParticleStorage s;
+        s.Allocate(static_cast<uint32_t>(particles.size()));
+        for (uint32_t i = 0; i < particles.size(); ++i) {
+            s.px[i] = particles[i].p.x;
+            s.py[i] = particles[i].p.y;
+            s.pz[i] = particles[i].p.z;
+            s.vx[i] = particles[i].v.x;
+            s.vy[i] = particles[i].v.y;
+            s.vz[i] = particles[i].v.z;
+            s.life[i] = 1.0f;
+        }
+        s.count = static_cast<uint32_t>(particles.size());
+        return s;
+    }
+
+    glm::vec3 Pos(const ParticleStorage& s, uint32_t i) {
+        return { s.px[i], s.py[i], s.pz[i] };
+    }
+
+    glm::vec3 Vel(const ParticleStorage& s, uint32_t i) {
+        return { s.vx[i], s.vy[i], s.vz[i] };
+    }
+
+    void ExpectNear(const glm::vec3& actual, const glm::vec3& expected, float eps = EPS) {
+        EXPECT_NEAR(actual.x, expected.x, eps);
+        EXPECT_NEAR(actual.y, expected.y, eps);
+        EXPECT_NEAR(actual.z, expected.z, eps);
+    }
+
+    // Reflection with restitution e and friction f: v' = vt (1 - f) - vn e
+    glm::vec3 Bounced(const glm::vec3& v, const glm::vec3& n, float e, float f) {
+        float vn = glm::dot(v, n);
+        return (v - n * vn) * (1.0f - f) - n * (vn * e);
+    }
+
+    ParticleCollisionParams Bounce(float e = 0.5f, float f = 0.25f) {
+        return { .response = ParticleCollisionResponse::Bounce, .restitution = e, .friction = f, .dt = 1.0f / 60.0f };
+    }
+
+    ParticleCollisionParams Kill() {
+        return { .response = ParticleCollisionResponse::Kill, .dt = 1.0f / 60.0f };
+    }
+
+    void Collide(ParticleStorage& s, const ParticleColliders& colliders, const ParticleCollisionParams& params) {
+        CollideParticles(s, 0, s.count, colliders, params);
+    }
+}// namespace
+
+// ── Planes ───────────────────────────────────────────────────────────────────
+
+TEST(ParticleCollision, PlaneBounceReflectsWithRestitutionAndFriction) {
+    ParticleColliders colliders;
+    colliders.planes.push_back({ glm::vec3(0.0f, 1.0f, 0.0f), 0.0f });
+    auto s = MakeStorage({
+      { { 1.0f, -0.1f, 2.0f }, { 2.0f, -4.0f, 0.0f } },// penetrating, approaching
+      { { 0.0f, 0.5f, 0.0f }, { 2.0f, -4.0f, 0.0f } }, // above: untouched
+      { { 0.0f, -0.2f, 0.0f }, { 0.0f, 3.0f, 0.0f } }, // penetrating, separating: only pushed
+    });
+
+    Collide(s, colliders, Bounce());
+    ExpectNear(Pos(s, 0), { 1.0f, 0.0f, 2.0f });
+    ExpectNear(Vel(s, 0), { 1.5f, 2.0f, 0.0f });
+    ExpectNear(Pos(s, 1), { 0.0f, 0.5f, 0.0f });
+    ExpectNear(Vel(s, 1), { 2.0f, -4.0f, 0.0f });
+    ExpectNear(Pos(s, 2), { 0.0f, 0.0f, 0.0f });
+    ExpectNear(Vel(s, 2), { 0.0f, 3.0f, 0.0f });
+}
+
+TEST(ParticleCollision, TiltedPlaneMatchesAnalyticReflection) {
+    const glm::vec3 n = glm::normalize(glm::vec3(1.0f, 1.0f, 0.0f));
+    ParticleColliders colliders;
+    colliders.planes.push_back({ n, 1.0f });
+    const glm::vec3 p(0.3f, 0.3f, 0.0f), v(-1.0f, -3.0f, 0.5f);
+    auto s = MakeStorage({ { p, v } });
+
+    Collide(s, colliders, Bounce(0.8f, 0.1f));
+    float depth = 1.0f - glm::dot(n, p);
+    ExpectNear(Pos(s, 0), p + n * depth);
+    ExpectNear(Vel(s, 0), Bounced(v, n, 0.8f, 0.1f));
+    EXPECT_NEAR(glm::dot(n, Pos(s, 0)), 1.0f, EPS);
+}
+
+TEST(ParticleCollision, PlaneContactUsesParticleRadius) {
+    ParticleColliders colliders;
+    colliders.planes.push_back({ glm::vec3(0.0f, 1.0f, 0.0f), 0.0f });
+    auto s = MakeStorage({ { { 0.0f, 0.05f, 0.0f }, { 0.0f, -1.0f, 0.0f } } });
+    auto params = Bounce(1.0f, 0.0f);
+    params.radius = 0.1f;
+
+    Collide(s, colliders, params);
+    EXPECT_NEAR(s.py[0], 0.1f, EPS);
+    EXPECT_NEAR(s.vy[0], 1.0f, EPS);
+}
+
+TEST(ParticleCollision, KillZeroesLifeOnlyOnContact) {
+    ParticleColliders colliders;
+    colliders.planes.push_back({ glm::vec3(0.0f, 1.0f, 0.0f), 0.0f });
+    colliders.spheres.push_back({ glm::vec3(10.0f, 0.0f, 0.0f), 2.0f });
+    auto s = MakeStorage({
+      { { 0.0f, -0.1f, 0.0f }, { 0.0f, -1.0f, 0.0f } },
+      { { 0.0f, 1.0f, 0.0f }, { 0.0f, -1.0f, 0.0f } },
+      { { 10.0f, 1.5f, 0.0f }, { 0.0f, 0.0f, 0.0f } },
+    });
+
+    Collide(s, colliders, Kill());
+    EXPECT_EQ(s.life[0], 0.0f);
+    EXPECT_EQ(s.life[1], 1.0f);
+    EXPECT_EQ(s.life[2], 0.0f);
+    // Killed particles stay where they are; compaction removes them
+    ExpectNear(Pos(s, 0), { 0.0f, -0.1f, 0.0f });
+    EXPECT_EQ(CompactParticles(s), 2u);
+    EXPECT_EQ(s.count, 1u);
+}
+
+// ── Spheres and boxes ────────────────────────────────────────────────────────
+
+TEST(ParticleCollision, SpherePushesOutAlongTheRadius) {
+    const glm::vec3 center(1.0f, 2.0f, 3.0f);
+    ParticleColliders colliders;
+    colliders.spheres.push_back({ center, 2.0f });
+    const glm::vec3 dir = glm::normalize(glm::vec3(1.0f, 2.0f, -2.0f));
+    const glm::vec3 v(-2.0f, -1.0f, 0.5f);
+    auto s = MakeStorage({
+      { center + dir * 1.5f, v },
+      { center + dir * 2.5f, v },
+    });
+
+    Collide(s, colliders, Bounce(0.5f, 0.2f));
+    ExpectNear(Pos(s, 0), center + dir * 2.0f);
+    ExpectNear(Vel(s, 0), Bounced(v, dir, 0.5f, 0.2f));
+    ExpectNear(Pos(s, 1), center + dir * 2.5f);
+    ExpectNear(Vel(s, 1), v);
+}
+
+TEST(ParticleCollision, BoxExitsThroughTheNearestFace) {
+    ParticleColliders colliders;
+    colliders.boxes.push_back({ glm::vec3(-1.0f), glm::vec3(1.0f) });
+    auto s = MakeStorage({
+      { { 0.9f, 0.0f, 0.2f }, { -3.0f, 1.0f, 0.0f } },// nearest +x
+      { { 0.1f, -0.8f, 0.0f }, { 0.0f, 2.0f, 1.0f } },// nearest -y
+      { { 0.0f, 1.5f, 0.0f }, { 0.0f, -1.0f, 0.0f } },// outside
+    });
+
+    Collide(s, colliders, Bounce(0.5f, 0.0f));
+    ExpectNear(Pos(s, 0), { 1.0f, 0.0f, 0.2f });
+    ExpectNear(Vel(s, 0), { 1.5f, 1.0f, 0.0f });
+    ExpectNear(Pos(s, 1), { 0.1f, -1.0f, 0.0f });
+    ExpectNear(Vel(s, 1), { 0.0f, -1.0f, 1.0f });
+    ExpectNear(Pos(s, 2), { 0.0f, 1.5f, 0.0f });
+}
+
+// ── Heightfields and voxels ──────────────────────────────────────────────────
+
+TEST(ParticleCollision, HeightfieldSlopeMatchesItsPlane) {
+    // h = 0.5 x over a 5x5 grid of 2 m cells, raised by 1: the plane y = 0.5 x + 1
+    std::vector<float> heights(5 * 5);
+    for (int z = 0; z < 5; ++z)
+        for (int x = 0; x < 5; ++x)
+            heights[z * 5 + x] = 0.5f * 2.0f * (float)x;
+    ParticleColliders colliders;
+    colliders.heightfields.push_back({ heights.data(), 5, 5, glm::vec3(0.0f, 1.0f, 0.0f), 2.0f });
+
+    const glm::vec3 n = glm::normalize(glm::vec3(-0.5f, 1.0f, 0.0f));
+    const glm::vec3 v(1.0f, -2.0f, 0.5f);
+    auto s = MakeStorage({
+      { { 3.0f, 2.0f, 3.0f }, v },  // surface at 2.5
+      { { 3.0f, 3.0f, 3.0f }, v },  // above
+      { { -1.0f, -5.0f, 3.0f }, v },// off the grid
+    });
+
+    Collide(s, colliders, Bounce(0.5f, 0.25f));
+    // Pushed along the normal by the perpendicular depth, 0.5 * n.y
+    ExpectNear(Pos(s, 0), { 3.0f + n.x * 0.5f * n.y, 2.0f + n.y * 0.5f * n.y, 3.0f });
+    ExpectNear(Vel(s, 0), Bounced(v, n, 0.5f, 0.25f));
+    ExpectNear(Pos(s, 1), { 3.0f, 3.0f, 3.0f });
+    ExpectNear(Pos(s, 2), { -1.0f, -5.0f, 3.0f });
+}
+
+TEST(ParticleCollision, VoxelFaceIsFoundFromThePreviousCell) {
+    VoxelWorld world;
+    world.CreateChunk({ 0, 0, 0 });
+    for (int x = 0; x < 8; ++x)
+        for (int z = 0; z < 8; ++z)
+            world.SetVoxel(x, 3, z, 1);// floor slab, top at y = 4
+    world.SetVoxel(6, 4, 2, 1);        // wall cell, -x face at x = 6
+    ParticleColliders colliders;
+    colliders.voxels = &world;
+
+    auto params = Bounce(0.5f, 0.0f);
+    params.dt = 0.1f;
+    auto s = MakeStorage({
+      { { 2.5f, 3.9f, 2.5f }, { 0.0f, -2.0f, 0.0f } },// fell through the top face
+      { { 6.1f, 4.5f, 2.5f }, { 3.0f, 0.0f, 0.0f } }, // ran into the wall
+      { { 2.5f, 5.0f, 2.5f }, { 0.0f, -2.0f, 0.0f } },// in the air
+    });
+
+    Collide(s, colliders, params);
+    EXPECT_NEAR(s.py[0], 4.0f, 2e-3f);
+    ExpectNear(Vel(s, 0), { 0.0f, 1.0f, 0.0f });
+    EXPECT_NEAR(s.px[1], 6.0f, 2e-3f);
+    ExpectNear(Vel(s, 1), { -1.5f, 0.0f, 0.0f });
+    ExpectNear(Pos(s, 2), { 2.5f, 5.0f, 2.5f });
+}
+
+// ── Integrated motion ────────────────────────────────────────────────────────
+
+TEST(ParticleCollision, DroppedParticleReboundsToRestitutionSquaredHeight) {
+    // Falling from h, a bounce with restitution e peaks at e^2 h
+    constexpr float H = 2.0f, E = 0.6f, DT = 1.0f / 2000.0f;
+    ParticleColliders colliders;
+    colliders.planes.push_back({ glm::vec3(0.0f, 1.0f, 0.0f), 0.0f });
+    auto s = MakeStorage({ { { 0.0f, H, 0.0f }, glm::vec3(0.0f) } });
+    const ParticleIntegrateParams integrate = { .gravity = glm::vec3(0.0f, -9.8f, 0.0f), .damping = 1.0f, .dt = DT };
+    auto params = Bounce(E, 0.0f);
+    params.dt = DT;
+
+    bool bounced = false;
+    float apex = 0.0f;
+    for (int step = 0; step < 4000; ++step) {
+        IntegrateParticles(s, 0, s.count, integrate);
+        CollideParticles(s, 0, s.count, colliders, params);
+        EXPECT_GE(s.py[0], 0.0f);
+        if (s.vy[0] > 0.0f) bounced = true;
+        if (bounced) {
+            apex = std::max(apex, s.py[0]);
+            if (s.vy[0] < 0.0f) break;
+        }
+    }
+    ASSERT_TRUE(bounced);
+    EXPECT_NEAR(apex, E * E * H, 0.02f * E * E * H);
+}
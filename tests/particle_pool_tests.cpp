@@ -0,0 +1,232 @@
+#include "particle_emitter.hpp"
+#include "particle_pool.hpp"
+#include "particle_server.hpp"
+#include "rng.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+using namespace Atmospheric;
+
+namespace {
+    // 800/s over 1/8 s asks for exactly 100 spawns
+    constexpr float RATE = 800.0f;
+    constexpr float DT = 0.125f;
+    constexpr uint32_t WANTED = 100;
+
+    ParticleEmitterProps CPUProps(uint32_t seed = 1, int priority = 0) {
+        ParticleEmitterProps props;
+        props.backend = ParticleBackend::CPU;
+        props.emissionRate = RATE;
+        props.lifetimeMin = 10.0f;// nothing dies during a test
+        props.lifetimeMax = 20.0f;
+        props.seed = seed;
+        props.priority = priority;
+        return props;
+    }
+
+    // Headless emitters: no GameObject, ParticleServer never Init()ed
+    class ParticleBudget : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            auto& pool = ParticlePool::Get();
+            pool.Trim();
+            pool.SetBudget(1u << 20);
+            ASSERT_EQ(pool.GetInUse(), 0u);
+            auto& server = ParticleServer::GetInstance();
+            server.SetSpawnBudget(50000);
+            server.SetViewerPosition(glm::vec3(0.0f));
+        }
+
+        void TearDown() override {
+            for (auto& emitter : _emitters)
+                emitter->OnDetach();
+            _emitters.clear();
+            EXPECT_EQ(ParticlePool::Get().GetInUse(), 0u);
+            ParticlePool::Get().SetBudget(1u << 20);
+            ParticlePool::Get().Trim();
+        }
+
+        ParticleEmitterComponent& Add(const ParticleEmitterProps& props, uint32_t maxParticles = 10000) {
+            auto& emitter = _emitters.emplace_back(std::make_unique<ParticleEmitterComponent>(props, maxParticles));
+            emitter->OnAttach();
+            return *emitter;
+        }
+
+        std::vector<std::unique_ptr<ParticleEmitterComponent>> _emitters;
+    };
+
+    class ParticlePoolTest : public ParticleBudget {};
+}// namespace
+
+// ── Pool growth and reuse ────────────────────────────────────────────────────
+
+TEST_F(ParticlePoolTest, GrowsInPowerOfTwoStepsUpToTheLimit) {
+    auto& pool = ParticlePool::Get();
+    ParticleStorage s;
+
+    EXPECT_EQ(pool.Grow(s, 1, 1000), ParticlePool::MIN_CAPACITY);
+    EXPECT_EQ(pool.Grow(s, 100, 1000), 128u);
+    EXPECT_EQ(pool.Grow(s, 100, 1000), 128u);// already large enough
+    EXPECT_EQ(pool.Grow(s, 900, 1000), 1000u);// bit_ceil would be 1024
+    EXPECT_EQ(pool.GetInUse(), 1000u);
+
+    pool.Release(s);
+    EXPECT_EQ(s.capacity, 0u);
+    EXPECT_EQ(pool.GetInUse(), 0u);
+}
+
+TEST_F(ParticlePoolTest, GrowthKeepsAliveParticles) {
+    auto& pool = ParticlePool::Get();
+    ParticleStorage s;
+    pool.Grow(s, 10, 1000);
+    for (uint32_t i = 0; i < 10; ++i) {
+        s.px[i] = (float)i;
+        s.life[i] = 1.0f + (float)i;
+        s.SetSize(i, 0.25f);
+    }
+    s.count = 10;
+
+    pool.Grow(s, 500, 1000);
+    ASSERT_EQ(s.capacity, 512u);
+    ASSERT_EQ(s.count, 10u);
+    for (uint32_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(s.px[i], (float)i);
+        EXPECT_EQ(s.life[i], 1.0f + (float)i);
+        EXPECT_EQ(s.GetSize(i), 0.25f);
+    }
+    pool.Release(s);
+}
+
+TEST_F(ParticlePoolTest, GlobalBudgetCapsCapacity) {
+    auto& pool = ParticlePool::Get();
+    pool.SetBudget(300);
+    ParticleStorage a, b;
+
+    EXPECT_EQ(pool.Grow(a, 256, 10000), 256u);
+    EXPECT_EQ(pool.Grow(b, 256, 10000), 44u);// what the budget has left
+    EXPECT_EQ(pool.Grow(b, 256, 10000), 44u);// spent: unchanged
+    EXPECT_EQ(pool.GetInUse(), 300u);
+
+    pool.Release(a);
+    EXPECT_EQ(pool.Grow(b, 256, 10000), 256u);
+    pool.Release(b);
+}
+
+TEST_F(ParticlePoolTest, ReleasedStorageIsRecycled) {
+    auto& pool = ParticlePool::Get();
+    ParticleStorage a;
+    pool.Grow(a, 100, 1000);
+    const float* memory = a.px.data();
+    a.count = 50;
+    pool.Release(a);
+
+    ParticleStorage b;
+    pool.Grow(b, 100, 1000);
+    EXPECT_EQ(b.px.data(), memory);
+    EXPECT_EQ(b.count, 0u);
+    pool.Release(b);
+}
+
+TEST_F(ParticlePoolTest, DetachedEmitterReturnsItsCapacity) {
+    auto& emitter = Add(CPUProps());
+    ParticleServer::GetInstance().Simulate(DT);
+    EXPECT_EQ(emitter.GetDrawCount(), WANTED);
+    EXPECT_EQ(ParticlePool::Get().GetInUse(), 128u);
+
+    emitter.OnDetach();
+    _emitters.clear();
+    EXPECT_EQ(ParticlePool::Get().GetInUse(), 0u);
+}
+
+TEST_F(ParticlePoolTest, EmitterCapacityStopsAtThePoolBudget) {
+    ParticlePool::Get().SetBudget(256);
+    auto props = CPUProps();
+    props.emissionRate = RATE * 10.0f;
+    auto& emitter = Add(props);
+
+    ParticleServer::GetInstance().Simulate(DT);
+    EXPECT_EQ(emitter.GetStorage().capacity, 256u);
+    EXPECT_EQ(emitter.GetDrawCount(), 256u);
+}
+
+// ── Per-frame spawn budget ───────────────────────────────────────────────────
+
+TEST_F(ParticleBudget, HigherPriorityIsServedFirst) {
+    auto& server = ParticleServer::GetInstance();
+    server.SetSpawnBudget(150);
+    auto& low = Add(CPUProps(1, 0));
+    auto& high = Add(CPUProps(2, 1));
+
+    server.Simulate(DT);
+    EXPECT_EQ(high.GetDrawCount(), WANTED);
+    EXPECT_EQ(low.GetDrawCount(), 50u);
+    EXPECT_EQ(server.GetSpawnsDeniedLastFrame(), 50u);
+}
+
+TEST_F(ParticleBudget, DeniedSpawnsAreDroppedNotDeferred) {
+    auto& server = ParticleServer::GetInstance();
+    server.SetSpawnBudget(40);
+    auto& emitter = Add(CPUProps());
+
+    server.Simulate(DT);
+    EXPECT_EQ(emitter.GetDrawCount(), 40u);
+    server.SetSpawnBudget(50000);
+    server.Simulate(DT);
+    EXPECT_EQ(emitter.GetDrawCount(), 40u + WANTED);
+    EXPECT_EQ(server.GetSpawnsDeniedLastFrame(), 0u);
+}
+
+TEST_F(ParticleBudget, RateFadesWithViewerDistance) {
+    auto& server = ParticleServer::GetInstance();
+    auto props = CPUProps();
+    props.throttleDistance = 10.0f;
+    auto& emitter = Add(props);
+
+    server.SetViewerPosition(glm::vec3(0.0f, 0.0f, 5.0f));
+    server.Simulate(DT);
+    EXPECT_EQ(emitter.GetDrawCount(), WANTED / 2);
+
+    server.SetViewerPosition(glm::vec3(0.0f, 0.0f, 20.0f));
+    server.Simulate(DT);
+    EXPECT_EQ(emitter.GetDrawCount(), WANTED / 2);
+}
+
+// ── Deterministic spawning ───────────────────────────────────────────────────
+
+TEST(ParticleRNG, CounterGeneratorIsStateless) {
+    CounterRNG a{ 7, 0 }, b{ 7, 100 };
+    for (int i = 0; i < 100; ++i)
+        a.Next();
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(a.Next(), b.Next());
+    for (uint32_t i = 0; i < 1000; ++i) {
+        float f = CounterRNG{ 3, i }.RandomFloat();
+        EXPECT_GE(f, 0.0f);
+        EXPECT_LT(f, 1.0f);
+    }
+}
+
+TEST_F(ParticleBudget, SameSeedSpawnsTheSameParticles) {
+    auto& a = Add(CPUProps(42));
+    auto& b = Add(CPUProps(42));
+    auto& c = Add(CPUProps(43));
+    ParticleServer::GetInstance().Simulate(DT);
+
+    const auto& sa = a.GetStorage();
+    const auto& sb = b.GetStorage();
+    const auto& sc = c.GetStorage();
+    ASSERT_EQ(sa.count, WANTED);
+    ASSERT_EQ(sb.count, WANTED);
+    int differs = 0;
+    for (uint32_t i = 0; i < WANTED; ++i) {
+        EXPECT_EQ(sa.px[i], sb.px[i]);
+        EXPECT_EQ(sa.vy[i], sb.vy[i]);
+        EXPECT_EQ(sa.lifetime[i], sb.lifetime[i]);
+        EXPECT_EQ(sa.size[i], sb.size[i]);
+        differs += sa.vy[i] != sc.vy[i];
+    }
+    EXPECT_GT(differs, 0);
+}
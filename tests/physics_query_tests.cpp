@@ -0,0 +1,219 @@
+#include "game_object.hpp"
+#include "physics_server.hpp"
+#include "rigidbody_component.hpp"
+
+#include <btBulletDynamicsCommon.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+    struct Box {
+        glm::vec3 min;
+        glm::vec3 max;
+    };
+
+    // Segment parameter where [from, to] enters the box, or -1 if it misses
+    float SegmentEntry(const glm::vec3& from, const glm::vec3& to, const Box& box) {
+        glm::vec3 d = to - from;
+        float tNear = 0.0f, tFar = 1.0f;
+        for (int a = 0; a < 3; ++a) {
+            if (d[a] == 0.0f) {
+                if (from[a] < box.min[a] || from[a] > box.max[a]) return -1.0f;
+                continue;
+            }
+            float t0 = (box.min[a] - from[a]) / d[a];
+            float t1 = (box.max[a] - from[a]) / d[a];
+            tNear = std::max(tNear, std::min(t0, t1));
+            tFar = std::min(tFar, std::max(t0, t1));
+        }
+        return tNear <= tFar ? tNear : -1.0f;
+    }
+
+    float DistanceToBox(const glm::vec3& p, const Box& box) {
+        return glm::length(glm::clamp(p, box.min, box.max) - p);
+    }
+}// namespace
+
+// A static field of axis-aligned boxes, shared by every test: PhysicsServer
+// is a singleton and cannot be created twice in one process.
+class PhysicsQueries : public ::testing::Test {
+protected:
+    static inline PhysicsServer* physics = nullptr;
+    static inline std::vector<std::unique_ptr<btBoxShape>> shapes;
+    static inline std::vector<std::unique_ptr<GameObject>> objects;
+    static inline std::vector<Box> boxes;
+
+    static void SetUpTestSuite() {
+        physics = new PhysicsServer();
+        physics->Init(nullptr);
+
+        std::mt19937 rng(32);
+        std::uniform_real_distribution<float> pos(-40.0f, 40.0f), half(0.25f, 2.0f);
+        for (int i = 0; i < 400; ++i) {
+            glm::vec3 center(pos(rng), pos(rng) * 0.25f, pos(rng));
+            glm::vec3 extent(half(rng), half(rng), half(rng));
+            auto& shape = shapes.emplace_back(std::make_unique<btBoxShape>(btVector3(extent.x, extent.y, extent.z)));
+            shape->setMargin(0.0f);
+            auto& go = objects.emplace_back(std::make_unique<GameObject>(nullptr, center));
+            // Not attached to the GameObject: attaching registers through the Application
+            auto* rb = new RigidbodyComponent(go.get(), RigidbodyProps { .mass = 0.0f, .shape = shape.get() });
+            physics->AddRigidbody(rb);
+            boxes.push_back({ center - extent, center + extent });
+        }
+    }
+
+    static void TearDownTestSuite() {
+        physics->Reset();
+        delete physics;
+        objects.clear();
+        shapes.clear();
+    }
+
+    static std::vector<RayQuery> MakeRays(size_t count, uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+        std::vector<RayQuery> rays(count);
+        for (auto& ray : rays)
+            ray = { .from = glm::vec3(pos(rng), pos(rng) * 0.25f, pos(rng)), .to = glm::vec3(pos(rng), pos(rng) * 0.25f, pos(rng)) };
+        return rays;
+    }
+
+    static size_t IndexOf(const GameObject* go) {
+        for (size_t i = 0; i < objects.size(); ++i)
+            if (objects[i].get() == go) return i;
+        return SIZE_MAX;
+    }
+};
+
+TEST_F(PhysicsQueries, RaycastBatchMatchesSingleRays) {
+    auto rays = MakeRays(1000, 1);
+    std::vector<RaycastHit> hits(rays.size());
+    size_t count = physics->RaycastBatch(rays.data(), rays.size(), hits.data());
+
+    size_t expected = 0;
+    for (size_t i = 0; i < rays.size(); ++i) {
+        RaycastHit hit {};
+        bool found = physics->Raycast(rays[i].from, rays[i].to, hit);
+        expected += found;
+        ASSERT_EQ(hits[i].gameObject != nullptr, found) << "ray " << i;
+        if (!found) {
+            EXPECT_EQ(hits[i].hitFraction, 1.0f);
+            continue;
+        }
+        EXPECT_EQ(hits[i].gameObject, hit.gameObject) << "ray " << i;
+        EXPECT_NEAR(glm::length(hits[i].point - hit.point), 0.0f, 1e-4f);
+        EXPECT_NEAR(hits[i].hitDistance, glm::length(hit.point - rays[i].from), 1e-3f);
+    }
+    EXPECT_EQ(count, expected);
+    EXPECT_GT(count, 100u);
+}
+
+TEST_F(PhysicsQueries, RaycastBatchMatchesBruteForce) {
+    auto rays = MakeRays(10000, 2);// many job slices
+    std::vector<RaycastHit> hits(rays.size());
+    physics->RaycastBatch(rays.data(), rays.size(), hits.data());
+
+    for (size_t i = 0; i < rays.size(); ++i) {
+        float nearest = 2.0f;
+        bool startsInside = false;
+        for (const auto& box : boxes) {
+            float t = SegmentEntry(rays[i].from, rays[i].to, box);
+            if (t >= 0.0f) nearest = std::min(nearest, t);
+            startsInside |= t == 0.0f;
+        }
+        // Bullet does not report the box a ray starts in
+        if (startsInside) continue;
+        if (nearest <= 1.0f) {
+            ASSERT_NE(hits[i].gameObject, nullptr) << "ray " << i;
+            EXPECT_NEAR(hits[i].hitFraction, nearest, 1e-3f) << "ray " << i;
+        }
+    }
+}
+
+TEST_F(PhysicsQueries, RaycastAllPacksEveryHitNearestFirst) {
+    auto rays = MakeRays(2000, 3);
+    std::vector<RaycastHit> hits(rays.size() * 16);
+    std::vector<uint32_t> offsets(rays.size() + 1, 12345);
+    size_t count = physics->RaycastAllBatch(rays.data(), rays.size(), hits.data(), hits.size(), offsets.data());
+    ASSERT_LT(offsets.back(), hits.size());// nothing was dropped
+
+    std::vector<RaycastHit> closest(rays.size());
+    EXPECT_EQ(physics->RaycastBatch(rays.data(), rays.size(), closest.data()), count);
+
+    EXPECT_EQ(offsets[0], 0u);
+    for (size_t i = 0; i < rays.size(); ++i) {
+        ASSERT_LE(offsets[i], offsets[i + 1]);
+        uint32_t first = offsets[i], last = offsets[i + 1];
+
+        size_t crossed = 0;
+        for (const auto& box : boxes)
+            crossed += SegmentEntry(rays[i].from, rays[i].to, box) > 0.0f;// entered from outside
+        EXPECT_GE(last - first, crossed) << "ray " << i;
+
+        for (uint32_t k = first; k + 1 < last; ++k)
+            EXPECT_LE(hits[k].hitFraction, hits[k + 1].hitFraction);
+        for (uint32_t k = first; k < last; ++k)
+            EXPECT_NE(IndexOf(hits[k].gameObject), SIZE_MAX);
+        if (first < last) {
+            EXPECT_EQ(hits[first].gameObject, closest[i].gameObject) << "ray " << i;
+            EXPECT_FLOAT_EQ(hits[first].hitFraction, closest[i].hitFraction);
+        } else {
+            EXPECT_EQ(closest[i].gameObject, nullptr);
+        }
+    }
+}
+
+TEST_F(PhysicsQueries, RaycastAllDropsWhatDoesNotFit) {
+    auto rays = MakeRays(1000, 4);
+    std::vector<RaycastHit> full(rays.size() * 16);
+    std::vector<uint32_t> fullOffsets(rays.size() + 1);
+    physics->RaycastAllBatch(rays.data(), rays.size(), full.data(), full.size(), fullOffsets.data());
+    const uint32_t total = fullOffsets.back();
+    ASSERT_GT(total, 10u);
+
+    const size_t capacity = total / 2;
+    std::vector<RaycastHit> hits(capacity);
+    std::vector<uint32_t> offsets(rays.size() + 1);
+    physics->RaycastAllBatch(rays.data(), rays.size(), hits.data(), capacity, offsets.data());
+
+    EXPECT_EQ(offsets.back(), capacity);
+    for (size_t i = 0; i <= rays.size(); ++i)
+        EXPECT_EQ(offsets[i], std::min<uint32_t>(fullOffsets[i], (uint32_t)capacity));
+    for (size_t k = 0; k < capacity; ++k) {
+        EXPECT_EQ(hits[k].gameObject, full[k].gameObject);
+        EXPECT_EQ(hits[k].hitFraction, full[k].hitFraction);
+    }
+}
+
+TEST_F(PhysicsQueries, OverlapBatchMatchesBruteForce) {
+    constexpr float radius = 1.5f;
+    Shape sphere { .type = ShapeType::Sphere };
+    sphere.data.sphereData.radius = radius;
+    ColliderID probe = physics->CreateCollider(sphere);
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> pos(-45.0f, 45.0f);
+    std::vector<OverlapQuery> queries(1000);
+    for (auto& q : queries)
+        q = { .shape = probe, .position = glm::vec3(pos(rng), pos(rng) * 0.25f, pos(rng)) };
+
+    constexpr size_t cap = 32;
+    std::vector<GameObject*> results(queries.size() * cap);
+    std::vector<uint32_t> counts(queries.size());
+    physics->OverlapBatch(queries.data(), queries.size(), results.data(), cap, counts.data());
+
+    for (size_t i = 0; i < queries.size(); ++i) {
+        std::vector<GameObject*> found(results.begin() + i * cap, results.begin() + i * cap + counts[i]);
+        for (size_t b = 0; b < boxes.size(); ++b) {
+            float d = DistanceToBox(queries[i].position, boxes[b]);
+            if (std::abs(d - radius) < 0.1f) continue;// contact margins decide
+            bool overlapping = std::find(found.begin(), found.end(), objects[b].get()) != found.end();
+            EXPECT_EQ(overlapping, d < radius) << "query " << i << " box " << b;
+        }
+    }
+    physics->DestroyCollider(probe);
+}
@@ -0,0 +1,285 @@
+#include "console.hpp"
+#include "game_object.hpp"
+#include "physics_server.hpp"
+#include "physics_server_2d.hpp"
+#include "rigidbody_2d_component.hpp"
+#include "rigidbody_component.hpp"
+
+#include <btBulletDynamicsCommon.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+// A tumbling stack of boxes, pushed sideways by scripted input; or the same
+// boxes scattered high in the air, where nothing touches
+class PhysicsSnapshots : public ::testing::Test {
+protected:
+    PhysicsServer physics;
+    btBoxShape floorShape { btVector3(50.0f, 0.5f, 50.0f) };
+    btBoxShape boxShape { btVector3(0.5f, 0.5f, 0.5f) };
+    std::vector<std::unique_ptr<GameObject>> objects;
+    std::vector<RigidbodyComponent*> bodies;
+
+    static void SetUpTestSuite() {
+        static Console console;// LoadSnapshot reports bad data through it
+    }
+
+    explicit PhysicsSnapshots(bool stacked = true) {
+        physics.Init(nullptr);
+        Add(glm::vec3(0.0f, -0.5f, 0.0f), 0.0f, &floorShape);
+        for (int i = 0; i < 12; ++i) {
+            glm::vec3 position = stacked
+                                   ? glm::vec3(0.1f * (float)(i % 3), 0.5f + 1.05f * (float)i, 0.07f * (float)(i % 2))
+                                   : glm::vec3(4.0f * (float)(i % 4), 50.0f + 4.0f * (float)(i / 4), 4.0f * (float)(i % 3));
+            Add(position, 1.0f, &boxShape);
+        }
+    }
+
+    ~PhysicsSnapshots() override {
+        physics.Reset();
+    }
+
+    RigidbodyComponent* Add(glm::vec3 position, float mass, btCollisionShape* shape) {
+        auto& go = objects.emplace_back(std::make_unique<GameObject>(nullptr, position));
+        // Not attached to the GameObject: attaching registers through the Application
+        bodies.push_back(new RigidbodyComponent(go.get(), RigidbodyProps { .mass = mass, .shape = shape }));
+        physics.AddRigidbody(bodies.back());
+        return bodies.back();
+    }
+
+    void Input(int step) {
+        if (step % 7 == 0) bodies[1 + step % 12]->AddForce(glm::vec3(40.0f, 0.0f, (float)(step % 5) - 2.0f));
+    }
+
+    glm::vec3 Position(size_t body) {
+        return glm::vec3(bodies[body]->GetWorldTransform()[3]);
+    }
+
+    // State hash after each of `steps` steps, applying Input(first + i)
+    std::vector<uint64_t> Run(int first, int steps) {
+        std::vector<uint64_t> hashes;
+        for (int i = 0; i < steps; ++i) {
+            Input(first + i);
+            physics.Process(1.0f / 60.0f);
+            hashes.push_back(physics.ComputeStateHash());
+        }
+        return hashes;
+    }
+};
+
+class PhysicsSnapshotsInFlight : public PhysicsSnapshots {
+protected:
+    PhysicsSnapshotsInFlight() : PhysicsSnapshots(false) {
+    }
+};
+
+TEST_F(PhysicsSnapshotsInFlight, RollbackMatchesUninterruptedStepping) {
+    Run(0, 10);
+    PhysicsSnapshot snapshot;
+    physics.SaveSnapshot(snapshot);
+    auto uninterrupted = Run(10, 60);
+
+    ASSERT_TRUE(physics.LoadSnapshot(snapshot));
+    auto rolledBack = Run(10, 60);
+    for (size_t i = 0; i < uninterrupted.size(); ++i)
+        ASSERT_EQ(rolledBack[i], uninterrupted[i]) << "diverged at step " << i;
+    EXPECT_NE(uninterrupted.front(), uninterrupted.back());
+}
+
+// What dropping the cached manifolds costs: bodies in contact lose their
+// warm start on load, so the rolled back stack leaves the saved run's exact
+// path, though not by much over a few steps
+TEST_F(PhysicsSnapshots, RollbackThroughContactsDriftsSlightly) {
+    Run(0, 30);
+    PhysicsSnapshot snapshot;
+    physics.SaveSnapshot(snapshot);
+    auto uninterrupted = Run(30, 10);
+    std::vector<glm::vec3> expected;
+    for (size_t i = 0; i < bodies.size(); ++i)
+        expected.push_back(Position(i));
+
+    ASSERT_TRUE(physics.LoadSnapshot(snapshot));
+    auto rolledBack = Run(30, 10);
+    EXPECT_NE(rolledBack.back(), uninterrupted.back());
+    for (size_t i = 0; i < bodies.size(); ++i)
+        EXPECT_LT(glm::length(Position(i) - expected[i]), 0.05f) << "body " << i;
+}
+
+TEST_F(PhysicsSnapshots, SaveStepLoadStepIsBitIdentical) {
+    Run(0, 30);
+    PhysicsSnapshot snapshot;
+    physics.SaveSnapshot(snapshot);
+    ASSERT_FALSE(snapshot.IsEmpty());
+    const uint64_t saved = physics.ComputeStateHash();
+
+    // Loads drop cached manifolds (see above), so two runs from the same
+    // loaded snapshot match bit for bit
+    ASSERT_TRUE(physics.LoadSnapshot(snapshot));
+    EXPECT_EQ(physics.ComputeStateHash(), saved);
+    auto first = Run(30, 120);
+    ASSERT_TRUE(physics.LoadSnapshot(snapshot));
+    EXPECT_EQ(physics.ComputeStateHash(), saved);
+    auto second = Run(30, 120);
+
+    ASSERT_EQ(first.size(), second.size());
+    for (size_t i = 0; i < first.size(); ++i)
+        ASSERT_EQ(first[i], second[i]) << "diverged at step " << i;
+    EXPECT_NE(first.front(), first.back());// the stack did move
+}
+
+TEST_F(PhysicsSnapshots, ResimulateMatchesSteppingFromTheSnapshot) {
+    Run(0, 20);
+    PhysicsSnapshot snapshot;
+    physics.SaveSnapshot(snapshot);
+
+    ASSERT_TRUE(physics.LoadSnapshot(snapshot));
+    auto stepped = Run(20, 60);
+    ASSERT_TRUE(physics.Resimulate(snapshot, 60, [&](int i) { Input(20 + i); }));
+    EXPECT_EQ(physics.ComputeStateHash(), stepped.back());
+}
+
+TEST_F(PhysicsSnapshots, RemovedBodiesLeaveTheSnapshot) {
+    PhysicsSnapshot before;
+    physics.SaveSnapshot(before);
+
+    RigidbodyComponent* extra = Add(glm::vec3(10.0f, 1.0f, 10.0f), 1.0f, &boxShape);
+    PhysicsSnapshot withExtra;
+    physics.SaveSnapshot(withExtra);
+    EXPECT_GT(withExtra.data.size(), before.data.size());
+
+    physics.RemoveRigidbody(extra);
+    bodies.pop_back();
+    PhysicsSnapshot after;
+    physics.SaveSnapshot(after);
+    EXPECT_EQ(after.data.size(), before.data.size());
+    EXPECT_TRUE(physics.LoadSnapshot(before));
+    EXPECT_FALSE(physics.LoadSnapshot(withExtra));// body count no longer matches
+    delete extra;
+}
+
+TEST_F(PhysicsSnapshots, RejectsForeignAndTruncatedData) {
+    PhysicsSnapshot snapshot;
+    physics.SaveSnapshot(snapshot);
+
+    PhysicsSnapshot truncated = snapshot;
+    truncated.data.resize(truncated.data.size() - 3);
+    EXPECT_FALSE(physics.LoadSnapshot(truncated));
+
+    PhysicsSnapshot foreign = snapshot;
+    foreign.data[0] ^= 0xFF;
+    EXPECT_FALSE(physics.LoadSnapshot(foreign));
+
+    PhysicsSnapshot padded = snapshot;
+    padded.data.push_back(0);
+    EXPECT_FALSE(physics.LoadSnapshot(padded));
+    EXPECT_TRUE(physics.LoadSnapshot(snapshot));
+}
+
+TEST_F(PhysicsSnapshots, FailedLoadLeavesTheWorldUnchanged) {
+    PhysicsSnapshot snapshot;
+    physics.SaveSnapshot(snapshot);
+    Run(0, 30);
+    const uint64_t before = physics.ComputeStateHash();
+
+    // Cuts inside the last body's record, after every other body parsed
+    // fine, and inside the first
+    for (size_t keep : { snapshot.data.size() - 1, snapshot.data.size() - 12, size_t(30) }) {
+        PhysicsSnapshot truncated = snapshot;
+        truncated.data.resize(keep);
+        EXPECT_FALSE(physics.LoadSnapshot(truncated)) << keep << " bytes";
+        EXPECT_EQ(physics.ComputeStateHash(), before) << keep << " bytes";
+    }
+}
+
+// ── 2D ───────────────────────────────────────────────────────────────────────
+
+// Boxes thrown about high above a floor, spinning under scripted input
+class Physics2DSnapshots : public ::testing::Test {
+protected:
+    Physics2DServer physics;
+    std::vector<std::unique_ptr<GameObject>> objects;
+    std::vector<std::unique_ptr<Rigidbody2DComponent>> bodies;// destroyed before the world
+
+    static void SetUpTestSuite() {
+        static Console console;// Init and LoadSnapshot log through it
+    }
+
+    Physics2DSnapshots() {
+        physics.SetWorkerCount(1);
+        physics.Init(nullptr);
+        Add(glm::vec2(0.0f, 550.0f), BodyType2D::Static, glm::vec2(10000.0f, 100.0f));
+        for (int i = 0; i < 12; ++i)
+            Add(glm::vec2(400.0f * (float)(i % 4), -5000.0f - 400.0f * (float)(i / 4)), BodyType2D::Dynamic, glm::vec2(50.0f));
+    }
+
+    void Add(glm::vec2 position, BodyType2D type, glm::vec2 size) {
+        auto& go = objects.emplace_back(std::make_unique<GameObject>(nullptr, glm::vec3(position, 0.0f)));
+        Rigidbody2DProps props { .type = type };
+        props.shape.boxSize = size;
+        auto* rb = bodies.emplace_back(std::make_unique<Rigidbody2DComponent>(go.get(), props)).get();
+        go->AddComponent(rb);
+    }
+
+    void Input(int step) {
+        if (step % 7 != 0) return;
+        bodies[1 + step % 12]->ApplyForceToCenter(glm::vec2(5.0f, (float)(step % 5) - 2.0f));
+        bodies[1 + (step + 5) % 12]->ApplyTorque(0.5f);
+    }
+
+    std::vector<uint64_t> Run(int first, int steps) {
+        std::vector<uint64_t> hashes;
+        for (int i = 0; i < steps; ++i) {
+            Input(first + i);
+            physics.Process(1.0f / 60.0f);
+            hashes.push_back(physics.ComputeStateHash());
+        }
+        return hashes;
+    }
+};
+
+TEST_F(Physics2DSnapshots, RollbackMatchesUninterruptedStepping) {
+    Run(0, 10);
+    PhysicsSnapshot snapshot;
+    physics.SaveSnapshot(snapshot);
+    const uint64_t saved = physics.ComputeStateHash();
+    auto uninterrupted = Run(10, 60);
+
+    ASSERT_TRUE(physics.LoadSnapshot(snapshot));
+    EXPECT_EQ(physics.ComputeStateHash(), saved);
+    auto rolledBack = Run(10, 60);
+    for (size_t i = 0; i < uninterrupted.size(); ++i)
+        ASSERT_EQ(rolledBack[i], uninterrupted[i]) << "diverged at step " << i;
+    EXPECT_NE(uninterrupted.front(), uninterrupted.back());
+}
+
+TEST_F(Physics2DSnapshots, ResimulateMatchesSteppingFromTheSnapshot) {
+    Run(0, 10);
+    PhysicsSnapshot snapshot;
+    physics.SaveSnapshot(snapshot);
+
+    ASSERT_TRUE(physics.LoadSnapshot(snapshot));
+    auto stepped = Run(10, 30);
+    ASSERT_TRUE(physics.Resimulate(snapshot, 30, [&](int i) { Input(10 + i); }));
+    EXPECT_EQ(physics.ComputeStateHash(), stepped.back());
+}
+
+TEST_F(Physics2DSnapshots, FailedLoadLeavesTheWorldUnchanged) {
+    PhysicsSnapshot snapshot;
+    physics.SaveSnapshot(snapshot);
+    Run(0, 30);
+    const uint64_t before = physics.ComputeStateHash();
+
+    for (size_t keep : { snapshot.data.size() - 1, snapshot.data.size() - 12, size_t(20) }) {
+        PhysicsSnapshot truncated = snapshot;
+        truncated.data.resize(keep);
+        EXPECT_FALSE(physics.LoadSnapshot(truncated)) << keep << " bytes";
+        EXPECT_EQ(physics.ComputeStateHash(), before) << keep << " bytes";
+    }
+    PhysicsSnapshot foreign = snapshot;
+    foreign.data[0] ^= 0xFF;
+    EXPECT_FALSE(physics.LoadSnapshot(foreign));
+    EXPECT_EQ(physics.ComputeStateHash(), before);
+    EXPECT_TRUE(physics.LoadSnapshot(snapshot));
+    EXPECT_NE(physics.ComputeStateHash(), before);
+}
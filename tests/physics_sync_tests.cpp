@@ -0,0 +1,171 @@
+#include "console.hpp"
+#include "game_object.hpp"
+#include "physics_server.hpp"
+#include "physics_server_2d.hpp"
+#include "rigidbody_2d_component.hpp"
+#include "rigidbody_component.hpp"
+
+#include <btBulletDynamicsCommon.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+    const glm::vec3 SENTINEL(1000.0f, 1000.0f, 1000.0f);
+}// namespace
+
+// Boxes dropped onto a floor, stepped at a steady 60 Hz
+class PhysicsSync : public ::testing::Test {
+protected:
+    PhysicsServer physics;
+    btBoxShape floorShape { btVector3(50.0f, 0.5f, 50.0f) };
+    btBoxShape boxShape { btVector3(0.5f, 0.5f, 0.5f) };
+    std::vector<std::unique_ptr<GameObject>> objects;
+
+    PhysicsSync() {
+        physics.Init(nullptr);
+        Add(glm::vec3(0.0f, -0.5f, 0.0f), 0.0f, &floorShape);
+    }
+
+    ~PhysicsSync() override {
+        physics.Reset();
+    }
+
+    std::pair<GameObject*, RigidbodyComponent*> Add(glm::vec3 position, float mass, btCollisionShape* shape) {
+        auto& go = objects.emplace_back(std::make_unique<GameObject>(nullptr, position));
+        // Not attached to the GameObject: attaching registers through the Application
+        auto* rb = new RigidbodyComponent(go.get(), RigidbodyProps { .mass = mass, .shape = shape });
+        physics.AddRigidbody(rb);
+        return { go.get(), rb };
+    }
+
+    void Frames(int count) {
+        for (int i = 0; i < count; ++i) {
+            physics.Process(1.0f / 60.0f);
+            physics.SyncTransforms();
+        }
+    }
+};
+
+TEST_F(PhysicsSync, SleepingBodiesAreNotWritten) {
+    std::vector<GameObject*> resting;
+    for (int x = 0; x < 5; ++x)
+        for (int z = 0; z < 5; ++z)
+            resting.push_back(Add(glm::vec3(x * 3.0f, 0.5f, z * 3.0f), 1.0f, &boxShape).first);
+    Frames(300);// Bullet deactivates bodies after 2 s at rest
+
+    for (auto* go : resting)
+        go->SetPosition(SENTINEL);
+    auto [falling, fallingBody] = Add(glm::vec3(-30.0f, 40.0f, -30.0f), 1.0f, &boxShape);
+    float previousY = falling->GetPosition().y;
+    for (int i = 0; i < 30; ++i) {
+        Frames(1);
+        EXPECT_LT(falling->GetPosition().y, previousY) << "frame " << i;
+        previousY = falling->GetPosition().y;
+    }
+    for (auto* go : resting)
+        EXPECT_EQ(go->GetPosition(), SENTINEL);
+}
+
+TEST_F(PhysicsSync, MovingBodyShowsInterpolatedPose) {
+    auto [go, rb] = Add(glm::vec3(0.0f, 100.0f, 0.0f), 1.0f, &boxShape);
+    // Uneven frames so the accumulator fraction varies
+    const float frames[] = { 0.007f, 0.021f, 0.016f, 0.033f, 0.011f, 0.019f };
+    for (int i = 0; i < 60; ++i) {
+        physics.Process(frames[i % 6]);
+        physics.SyncTransforms();
+        glm::vec3 expected = glm::vec3(rb->GetInterpolatedTransform(physics.GetInterpolationAlpha())[3]);
+        EXPECT_NEAR(glm::length(go->GetPosition() - expected), 0.0f, 1e-4f) << "frame " << i;
+    }
+}
+
+TEST_F(PhysicsSync, StoppedBodySnapsToItsFinalPose) {
+    auto [go, rb] = Add(glm::vec3(0.0f, 3.0f, 0.0f), 1.0f, &boxShape);
+    Frames(400);
+    glm::vec3 rest = glm::vec3(rb->GetWorldTransform()[3]);
+    EXPECT_NEAR(rest.y, 0.5f, 0.05f);
+    EXPECT_NEAR(glm::length(go->GetPosition() - rest), 0.0f, 1e-4f);
+}
+
+// The same checks for Physics2DServer, whose movers come from Box2D body
+// move events: a floor and boxes in pixels, y pointing down
+class Physics2DSync : public ::testing::Test {
+protected:
+    Physics2DServer physics;
+    std::vector<std::unique_ptr<GameObject>> objects;
+    std::vector<std::unique_ptr<Rigidbody2DComponent>> bodies;// destroyed before the world
+
+    static void SetUpTestSuite() {
+        static Console console;// Init logs through it
+    }
+
+    Physics2DSync() {
+        physics.SetWorkerCount(1);
+        physics.Init(nullptr);
+        Add(glm::vec2(0.0f, 550.0f), BodyType2D::Static, glm::vec2(10000.0f, 100.0f));// top at y = 500
+    }
+
+    std::pair<GameObject*, Rigidbody2DComponent*> Add(
+      glm::vec2 position, BodyType2D type = BodyType2D::Dynamic, glm::vec2 size = glm::vec2(50.0f)
+    ) {
+        auto& go = objects.emplace_back(std::make_unique<GameObject>(nullptr, glm::vec3(position, 0.0f)));
+        Rigidbody2DProps props { .type = type };
+        props.shape.boxSize = size;
+        auto* rb = bodies.emplace_back(std::make_unique<Rigidbody2DComponent>(go.get(), props)).get();
+        go->AddComponent(rb);// creates the body at the GameObject's position
+        return { go.get(), rb };
+    }
+
+    void Frames(int count) {
+        for (int i = 0; i < count; ++i)
+            physics.Process(1.0f / 60.0f);
+    }
+};
+
+TEST_F(Physics2DSync, SleepingBodiesAreNotWritten) {
+    std::vector<GameObject*> resting;
+    for (int x = 0; x < 5; ++x)
+        resting.push_back(Add(glm::vec2(x * 100.0f, 475.0f)).first);
+    Frames(300);// Box2D puts bodies to sleep after 0.5 s at rest
+
+    for (auto* go : resting)
+        go->SetPosition(SENTINEL);
+    auto [falling, fallingBody] = Add(glm::vec2(-3000.0f, -1000.0f));
+    float previousY = falling->GetPosition().y;
+    for (int i = 0; i < 30; ++i) {
+        Frames(1);
+        EXPECT_GT(falling->GetPosition().y, previousY) << "frame " << i;
+        previousY = falling->GetPosition().y;
+    }
+    for (auto* go : resting)
+        EXPECT_EQ(go->GetPosition(), SENTINEL);
+}
+
+TEST_F(Physics2DSync, MovingBodyShowsInterpolatedPose) {
+    auto [go, rb] = Add(glm::vec2(0.0f, -5000.0f));
+    // Uneven frames, each shorter than a step, so there is at most one step
+    // per frame and the last two body poses are known
+    const float frames[] = { 0.007f, 0.013f, 0.016f, 0.004f, 0.011f, 0.015f };
+    glm::vec2 prev = rb->GetPosition(), curr = prev;
+    for (int i = 0; i < 60; ++i) {
+        glm::vec2 before = rb->GetPosition();
+        physics.Process(frames[i % 6]);
+        ASSERT_LE(physics.GetLastStepCount(), 1);
+        if (physics.GetLastStepCount() == 1) {
+            prev = before;
+            curr = rb->GetPosition();
+        }
+        glm::vec2 expected = prev + (curr - prev) * physics.GetInterpolationAlpha();
+        EXPECT_NEAR(glm::length(glm::vec2(go->GetPosition()) - expected), 0.0f, 1e-3f) << "frame " << i;
+    }
+    EXPECT_GT(curr.y, -5000.0f);
+}
+
+TEST_F(Physics2DSync, StoppedBodySnapsToItsFinalPose) {
+    auto [go, rb] = Add(glm::vec2(0.0f, 300.0f));
+    Frames(400);
+    glm::vec2 rest = rb->GetPosition();
+    EXPECT_NEAR(rest.y, 475.0f, 2.0f);
+    EXPECT_NEAR(glm::length(glm::vec2(go->GetPosition()) - rest), 0.0f, 1e-3f);
+}
@@ -0,0 +1,114 @@
+#include "scene_arena.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+    // Logs its id on destruction, to check Release's order
+    struct Tracked {
+        Tracked(std::vector<int>& log, int id) : log(log), id(id) {}
+        ~Tracked() {
+            log.push_back(id);
+        }
+        std::vector<int>& log;
+        int id;
+    };
+
+    struct alignas(64) Wide {
+        float values[16];
+    };
+}// namespace
+
+TEST(SceneArena, AllocationsAreAlignedAndOwned) {
+    SceneArena arena;
+    for (size_t alignment : { 1u, 2u, 8u, 16u, 64u }) {
+        arena.Allocate(1, 1);// knock the offset off any boundary
+        void* p = arena.Allocate(24, alignment);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % alignment, 0u) << alignment;
+        EXPECT_TRUE(arena.Owns(p));
+    }
+    Wide* wide = arena.New<Wide>();
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(wide) % 64, 0u);
+
+    int outside = 0;
+    EXPECT_FALSE(arena.Owns(&outside));
+    arena.Release();
+    EXPECT_FALSE(arena.Owns(wide));
+    EXPECT_EQ(arena.GetBytesUsed(), 0u);
+}
+
+TEST(SceneArena, ReleaseDestroysNewestFirst) {
+    std::vector<int> log;
+    SceneArena arena;
+    for (int i = 0; i < 4; ++i) arena.New<Tracked>(log, i);
+    arena.New<int>(7);
+    EXPECT_TRUE(log.empty());
+    arena.Release();
+    EXPECT_EQ(log, (std::vector<int>{ 3, 2, 1, 0 }));
+
+    // Nothing is destroyed twice
+    arena.Release();
+    EXPECT_EQ(log.size(), 4u);
+}
+
+TEST(SceneArena, DestructorReleases) {
+    std::vector<int> log;
+    {
+        SceneArena arena;
+        arena.New<Tracked>(log, 1);
+        arena.New<std::string>(100, 'x');
+    }
+    EXPECT_EQ(log, (std::vector<int>{ 1 }));
+}
+
+TEST(SceneArena, ReserveFitsASceneInOneBlock) {
+    constexpr size_t COUNT = 5000;
+    SceneArena arena;
+    arena.Reserve(COUNT * (SceneArena::SizeFor<std::string>() + SceneArena::SizeFor<Wide>()));
+    const size_t blocks = arena.GetBlockAllocations();
+    EXPECT_EQ(blocks, 1u);
+    for (size_t i = 0; i < COUNT; ++i) {
+        arena.New<std::string>("node");
+        arena.New<Wide>();
+    }
+    EXPECT_EQ(arena.GetBlockAllocations(), blocks);
+    EXPECT_EQ(arena.GetBlockCount(), 1u);
+}
+
+TEST(SceneArena, ReleaseKeepsTheLargestBlockForTheNextScene) {
+    SceneArena arena;
+    // Outgrow the default block a few times, as an unreserved load would
+    for (int i = 0; i < 3000; ++i) arena.New<Wide>();
+    ASSERT_GT(arena.GetBlockCount(), 1u);
+    arena.Release();
+    EXPECT_EQ(arena.GetBlockCount(), 1u);
+
+    // A scene that fits the kept block allocates nothing new
+    const size_t blocks = arena.GetBlockAllocations();
+    arena.Reserve(SceneArena::DEFAULT_BLOCK_SIZE);
+    for (int i = 0; i < 500; ++i) arena.New<Wide>();
+    EXPECT_EQ(arena.GetBlockAllocations(), blocks);
+}
+
+TEST(SceneArena, OversizedAllocationGetsItsOwnBlock) {
+    SceneArena arena;
+    arena.Allocate(16, 8);
+    const size_t size = SceneArena::DEFAULT_BLOCK_SIZE * 3;
+    auto* p = static_cast<std::byte*>(arena.Allocate(size, 16));
+    EXPECT_TRUE(arena.Owns(p));
+    EXPECT_TRUE(arena.Owns(p + size - 1));
+    EXPECT_EQ(arena.GetBlockCount(), 2u);
+}
+
+TEST(SceneArena, CopyStringOwnsItsCharacters) {
+    SceneArena arena;
+    std::string source = "Panel_Background";
+    std::string_view copy = arena.CopyString(source);
+    source.assign(source.size(), '?');
+    EXPECT_EQ(copy, "Panel_Background");
+    EXPECT_TRUE(arena.Owns(copy.data()));
+    EXPECT_TRUE(arena.CopyString("").empty());
+}
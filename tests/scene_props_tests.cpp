@@ -0,0 +1,440 @@
+#include "scene_bake.hpp"
+#include "scene_props.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    namespace fs = std::filesystem;
+
+    // Every component type, every default, short vectors, nested and
+    // unbuildable actions, and the layer names only sprites accept
+    constexpr const char* kScene = R"({
+      "name": "props",
+      "textures": ["assets/a.png", "assets/b.png"],
+      "shaders": {
+        "lit": { "vert": "lit.vert", "frag": "lit.frag" },
+        "terrain": { "vert": "t.vert", "frag": "t.frag", "tesc": "t.tesc", "tese": "t.tese" },
+        "blank": { "vert": "b.vert", "frag": "b.frag", "tesc": "" }
+      },
+      "entities": [
+        {
+          "name": "Root",
+          "position": [1, 2, 3],
+          "rotation": [90, 0, 180],
+          "scale": [2],
+          "components": [
+            { "type": "SpriteComponent", "texture": "assets/a.png", "size": [64, 32], "pivot": [0],
+              "color": [1, 0.5], "layer": "LAYER_WORLD_2D", "flipX": true, "zOrder": 7 },
+            { "type": "SpriteComponent" },
+            { "type": "TextComponent", "text": "hello", "fontPath": "fonts/a.ttf", "fontSize": 32,
+              "hAlign": "Right", "vAlign": "Center", "layer": "LAYER_UI", "zOrder": -2 },
+            { "type": "TextComponent", "layer": "LAYER_WORLD_2D" },
+            { "type": "CameraComponent", "fieldOfView": 60, "farClip": 1000, "verticalAngle": 0.5,
+              "eyeOffset": [0, 1] },
+            { "type": "NotAComponent", "value": 1 }
+          ],
+          "children": [
+            {
+              "name": "Child",
+              "active": false,
+              "components": [
+                { "type": "CameraComponent", "orthographic": true, "width": 1920, "height": 1080 },
+                { "type": "LightComponent" },
+                { "type": "LightComponent", "lightType": "Spot", "ambient": [0.2, 0.3, 0.4],
+                  "direction": [1, 0, 0], "intensity": 2.5, "castShadow": true },
+                { "type": "LightComponent", "lightType": "Sun" }
+              ],
+              "children": [ { "name": "Grandchild" } ]
+            },
+            {
+              "name": "Sibling",
+              "components": [
+                { "type": "Animator2D", "autoPlay": "walk", "animations": [
+                  { "name": "walk", "frames": [
+                    { "duration": 0.2, "uvMin": [0, 0], "uvMax": [0.25, 1] },
+                    { "uvMin": [0.25] }
+                  ] },
+                  { "name": "idle", "loop": false, "frames": [] }
+                ] },
+                { "type": "ActionManager", "actions": [
+                  { "type": "MoveTo", "duration": 1, "position": [5, 6], "easing": "QuadOut" },
+                  { "type": "RotateBy", "duration": 2, "deltaRotation": [0, 0, 90] },
+                  { "type": "FadeTo", "duration": 0.5, "alpha": 0.25, "easing": "Nope" },
+                  { "type": "Sequence", "actions": [
+                    { "type": "ScaleTo", "duration": 1, "scale": [3, 3, 3], "easing": "BounceInOut" },
+                    { "type": "RepeatForever", "action": { "type": "MoveBy", "duration": 1 } },
+                    { "type": "Sequence", "actions": [ { "type": "ColorTo", "duration": 1, "color": [0, 1, 0] } ] }
+                  ] },
+                  { "type": "RepeatForever", "action": { "type": "Sequence", "actions": [
+                    { "type": "RotateTo", "duration": 1, "rotation": [0, 180, 0] }
+                  ] } },
+                  { "type": "RepeatForever", "action": { "type": "RepeatForever", "action": { "type": "MoveBy" } } },
+                  { "type": "Sequence", "actions": [] },
+                  { "type": "Teleport" }
+                ] }
+              ]
+            }
+          ]
+        },
+        { "name": "Second", "components": [] }
+      ]
+    })";
+
+    void ExpectSame(const glm::vec2& a, const glm::vec2& b) {
+        EXPECT_EQ(a.x, b.x);
+        EXPECT_EQ(a.y, b.y);
+    }
+
+    void ExpectSame(const glm::vec3& a, const glm::vec3& b) {
+        EXPECT_EQ(a.x, b.x);
+        EXPECT_EQ(a.y, b.y);
+        EXPECT_EQ(a.z, b.z);
+    }
+
+    void ExpectSame(const glm::vec4& a, const glm::vec4& b) {
+        EXPECT_EQ(a.x, b.x);
+        EXPECT_EQ(a.y, b.y);
+        EXPECT_EQ(a.z, b.z);
+        EXPECT_EQ(a.w, b.w);
+    }
+
+    void ExpectSame(const SceneActionProps& a, const SceneActionProps& b) {
+        EXPECT_EQ(a.type, b.type);
+        EXPECT_EQ(a.duration, b.duration);
+        EXPECT_EQ(a.easing, b.easing);
+        ExpectSame(a.value, b.value);
+        ASSERT_EQ(a.children.size(), b.children.size());
+        for (size_t i = 0; i < a.children.size(); ++i) ExpectSame(a.children[i], b.children[i]);
+    }
+
+    void ExpectSame(const SceneComponentProps& a, const SceneComponentProps& b) {
+        ASSERT_EQ(a.index(), b.index());
+        if (const auto* sprite = std::get_if<SceneSpriteProps>(&a)) {
+            const auto& other = std::get<SceneSpriteProps>(b);
+            ExpectSame(sprite->props.size, other.props.size);
+            ExpectSame(sprite->props.pivot, other.props.pivot);
+            ExpectSame(sprite->props.color, other.props.color);
+            EXPECT_EQ(sprite->props.layer, other.props.layer);
+            EXPECT_EQ(sprite->props.flipX, other.props.flipX);
+            EXPECT_EQ(sprite->props.flipY, other.props.flipY);
+            EXPECT_EQ(sprite->props.zOrder, other.props.zOrder);
+            EXPECT_EQ(sprite->texture, other.texture);
+        } else if (const auto* text = std::get_if<TextProps>(&a)) {
+            const auto& other = std::get<TextProps>(b);
+            EXPECT_EQ(text->text, other.text);
+            EXPECT_EQ(text->fontPath, other.fontPath);
+            EXPECT_EQ(text->fontSize, other.fontSize);
+            ExpectSame(text->size, other.size);
+            ExpectSame(text->pivot, other.pivot);
+            ExpectSame(text->color, other.color);
+            EXPECT_EQ(text->hAlign, other.hAlign);
+            EXPECT_EQ(text->vAlign, other.vAlign);
+            EXPECT_EQ(text->layer, other.layer);
+            EXPECT_EQ(text->zOrder, other.zOrder);
+        } else if (const auto* camera = std::get_if<CameraProps>(&a)) {
+            // Only the projection in use is part of the scene
+            const auto& other = std::get<CameraProps>(b);
+            ASSERT_EQ(camera->isOrthographic, other.isOrthographic);
+            if (camera->isOrthographic) {
+                EXPECT_EQ(camera->orthographic.width, other.orthographic.width);
+                EXPECT_EQ(camera->orthographic.height, other.orthographic.height);
+                EXPECT_EQ(camera->orthographic.nearClip, other.orthographic.nearClip);
+                EXPECT_EQ(camera->orthographic.farClip, other.orthographic.farClip);
+            } else {
+                EXPECT_EQ(camera->perspective.fieldOfView, other.perspective.fieldOfView);
+                EXPECT_EQ(camera->perspective.aspectRatio, other.perspective.aspectRatio);
+                EXPECT_EQ(camera->perspective.nearClip, other.perspective.nearClip);
+                EXPECT_EQ(camera->perspective.farClip, other.perspective.farClip);
+            }
+            EXPECT_EQ(camera->verticalAngle, other.verticalAngle);
+            EXPECT_EQ(camera->horizontalAngle, other.horizontalAngle);
+            ExpectSame(camera->eyeOffset, other.eyeOffset);
+        } else if (const auto* light = std::get_if<LightProps>(&a)) {
+            const auto& other = std::get<LightProps>(b);
+            EXPECT_EQ(light->type, other.type);
+            ExpectSame(light->ambient, other.ambient);
+            ExpectSame(light->diffuse, other.diffuse);
+            ExpectSame(light->specular, other.specular);
+            ExpectSame(light->direction, other.direction);
+            ExpectSame(light->attenuation, other.attenuation);
+            EXPECT_EQ(light->intensity, other.intensity);
+            EXPECT_EQ(light->castShadow, other.castShadow);
+        } else if (const auto* animator = std::get_if<SceneAnimatorProps>(&a)) {
+            const auto& other = std::get<SceneAnimatorProps>(b);
+            EXPECT_EQ(animator->autoPlay, other.autoPlay);
+            ASSERT_EQ(animator->clips.size(), other.clips.size());
+            for (size_t i = 0; i < animator->clips.size(); ++i) {
+                const AnimationClip& clip = animator->clips[i];
+                EXPECT_EQ(clip.name, other.clips[i].name);
+                EXPECT_EQ(clip.loop, other.clips[i].loop);
+                ASSERT_EQ(clip.frames.size(), other.clips[i].frames.size());
+                for (size_t f = 0; f < clip.frames.size(); ++f) {
+                    EXPECT_EQ(clip.frames[f].duration, other.clips[i].frames[f].duration);
+                    ExpectSame(clip.frames[f].uvMin, other.clips[i].frames[f].uvMin);
+                    ExpectSame(clip.frames[f].uvMax, other.clips[i].frames[f].uvMax);
+                }
+            }
+        } else {
+            const auto& actions = std::get<SceneActionsProps>(a).actions;
+            const auto& other = std::get<SceneActionsProps>(b).actions;
+            ASSERT_EQ(actions.size(), other.size());
+            for (size_t i = 0; i < actions.size(); ++i) ExpectSame(actions[i], other[i]);
+        }
+    }
+
+    void ExpectSame(const SceneProps& a, const SceneProps& b) {
+        EXPECT_EQ(a.name, b.name);
+        EXPECT_EQ(a.textures, b.textures);
+        ASSERT_EQ(a.shaders.size(), b.shaders.size());
+        for (const auto& [name, props] : a.shaders) {
+            SCOPED_TRACE("shader " + name);
+            auto it = b.shaders.find(name);
+            ASSERT_NE(it, b.shaders.end());
+            EXPECT_EQ(props.vert, it->second.vert);
+            EXPECT_EQ(props.frag, it->second.frag);
+            EXPECT_EQ(props.tesc, it->second.tesc);
+            EXPECT_EQ(props.tese, it->second.tese);
+        }
+        ASSERT_EQ(a.entities.size(), b.entities.size());
+        for (size_t e = 0; e < a.entities.size(); ++e) {
+            const SceneEntityProps& entity = a.entities[e];
+            const SceneEntityProps& other = b.entities[e];
+            SCOPED_TRACE("entity " + entity.name);
+            EXPECT_EQ(entity.name, other.name);
+            EXPECT_EQ(entity.parent, other.parent);
+            EXPECT_EQ(entity.active, other.active);
+            ExpectSame(entity.position, other.position);
+            ExpectSame(entity.rotation, other.rotation);
+            ExpectSame(entity.scale, other.scale);
+            ASSERT_EQ(entity.components.size(), other.components.size());
+            for (size_t c = 0; c < entity.components.size(); ++c) {
+                SCOPED_TRACE("component " + std::to_string(c));
+                ExpectSame(entity.components[c], other.components[c]);
+            }
+        }
+    }
+
+    SceneProps ReadJSON(const std::string& json) {
+        SceneProps scene;
+        std::string error;
+        EXPECT_TRUE(ReadSceneJSON(json, scene, &error)) << error;
+        return scene;
+    }
+
+    SceneProps BakeAndRead(const std::string& json) {
+        std::vector<uint8_t> bytes;
+        std::string error;
+        EXPECT_TRUE(BakeScene(json, bytes, &error)) << error;
+        SceneProps scene;
+        EXPECT_TRUE(ReadBakedScene(bytes, scene));
+        return scene;
+    }
+
+    const SceneEntityProps& Entity(const SceneProps& scene, const std::string& name) {
+        for (const auto& entity : scene.entities) {
+            if (entity.name == name) return entity;
+        }
+        throw std::runtime_error("no entity " + name);
+    }
+
+    template<typename T> std::vector<const T*> ComponentsOf(const SceneEntityProps& entity) {
+        std::vector<const T*> found;
+        for (const auto& component : entity.components) {
+            if (const auto* props = std::get_if<T>(&component)) found.push_back(props);
+        }
+        return found;
+    }
+}// namespace
+
+// ── JSON rules ───────────────────────────────────────────────────────────────
+// What the JSON loader has always done; the baked path inherits all of it.
+
+TEST(SceneJSON, EntitiesArePreOrderWithParentIndices) {
+    SceneProps scene = ReadJSON(kScene);
+    ASSERT_EQ(scene.entities.size(), 5u);
+    std::vector<std::string> names;
+    std::vector<int> parents;
+    for (const auto& entity : scene.entities) {
+        names.push_back(entity.name);
+        parents.push_back(entity.parent);
+    }
+    EXPECT_EQ(names, (std::vector<std::string>{ "Root", "Child", "Grandchild", "Sibling", "Second" }));
+    EXPECT_EQ(parents, (std::vector<int>{ -1, 0, 1, 0, -1 }));
+    EXPECT_FALSE(Entity(scene, "Child").active);
+    EXPECT_TRUE(Entity(scene, "Grandchild").active);
+}
+
+TEST(SceneJSON, TransformsFillDefaultsAndConvertDegrees) {
+    SceneProps scene = ReadJSON(kScene);
+    const SceneEntityProps& root = Entity(scene, "Root");
+    ExpectSame(root.position, glm::vec3(1.0f, 2.0f, 3.0f));
+    EXPECT_NEAR(root.rotation.x, 1.5707963f, 1e-6f);
+    EXPECT_NEAR(root.rotation.z, 3.1415927f, 1e-6f);
+    ExpectSame(root.scale, glm::vec3(2.0f, 1.0f, 1.0f));
+    const SceneEntityProps& grandchild = Entity(scene, "Grandchild");
+    ExpectSame(grandchild.position, glm::vec3(0.0f));
+    ExpectSame(grandchild.scale, glm::vec3(1.0f));
+}
+
+TEST(SceneJSON, ShaderStagesTreatEmptyAsAbsent) {
+    SceneProps scene = ReadJSON(kScene);
+    ASSERT_EQ(scene.shaders.size(), 3u);
+    EXPECT_EQ(scene.shaders.at("terrain").tesc, std::optional<std::string>("t.tesc"));
+    EXPECT_EQ(scene.shaders.at("lit").tesc, std::nullopt);
+    EXPECT_EQ(scene.shaders.at("blank").tesc, std::nullopt);
+}
+
+TEST(SceneJSON, ComponentDefaultsMatchTheLoader) {
+    SceneProps scene = ReadJSON(kScene);
+    const SceneEntityProps& root = Entity(scene, "Root");
+    // The unknown component type is dropped
+    ASSERT_EQ(root.components.size(), 5u);
+
+    auto sprites = ComponentsOf<SceneSpriteProps>(root);
+    ASSERT_EQ(sprites.size(), 2u);
+    ExpectSame(sprites[0]->props.pivot, glm::vec2(0.0f, 0.5f));
+    ExpectSame(sprites[0]->props.color, glm::vec4(1.0f, 0.5f, 1.0f, 1.0f));
+    EXPECT_EQ(sprites[0]->props.layer, CanvasLayer::LAYER_WORLD_2D);
+    ExpectSame(sprites[1]->props.size, glm::vec2(100.0f));
+    ExpectSame(sprites[1]->props.pivot, glm::vec2(0.5f));
+    EXPECT_EQ(sprites[1]->texture, "");
+
+    auto texts = ComponentsOf<TextProps>(root);
+    ASSERT_EQ(texts.size(), 2u);
+    EXPECT_EQ(texts[0]->hAlign, TextHAlignment::Right);
+    EXPECT_EQ(texts[0]->vAlign, TextVAlignment::Center);
+    EXPECT_EQ(texts[0]->layer, CanvasLayer::LAYER_UI);
+    // Text never recognised LAYER_WORLD_2D
+    EXPECT_EQ(texts[1]->layer, CanvasLayer::LAYER_WORLD);
+    ExpectSame(texts[1]->pivot, glm::vec2(0.0f));
+    EXPECT_EQ(texts[1]->fontSize, 24.0f);
+
+    auto cameras = ComponentsOf<CameraProps>(Entity(scene, "Child"));
+    ASSERT_EQ(cameras.size(), 1u);
+    EXPECT_TRUE(cameras[0]->isOrthographic);
+    EXPECT_EQ(cameras[0]->orthographic.width, 1920.0f);
+    EXPECT_EQ(cameras[0]->orthographic.nearClip, -1.0f);
+    EXPECT_EQ(cameras[0]->orthographic.farClip, 1.0f);
+
+    auto lights = ComponentsOf<LightProps>(Entity(scene, "Child"));
+    ASSERT_EQ(lights.size(), 3u);
+    EXPECT_EQ(lights[0]->type, LightType::Directional);
+    ExpectSame(lights[0]->ambient, glm::vec3(0.1f));
+    ExpectSame(lights[0]->direction, glm::vec3(0.0f, -1.0f, 0.0f));
+    EXPECT_EQ(lights[0]->intensity, 1.0f);
+    EXPECT_EQ(lights[1]->type, LightType::Spot);
+    EXPECT_TRUE(lights[1]->castShadow);
+    EXPECT_EQ(lights[2]->type, LightType::Directional);
+
+    auto animators = ComponentsOf<SceneAnimatorProps>(Entity(scene, "Sibling"));
+    ASSERT_EQ(animators.size(), 1u);
+    ASSERT_EQ(animators[0]->clips.size(), 2u);
+    const AnimationFrame& frame = animators[0]->clips[0].frames[1];
+    EXPECT_FLOAT_EQ(frame.duration, 0.1f);
+    ExpectSame(frame.uvMin, glm::vec2(0.25f, 0.0f));
+    ExpectSame(frame.uvMax, glm::vec2(1.0f));
+    EXPECT_FALSE(animators[0]->clips[1].loop);
+}
+
+TEST(SceneJSON, ActionTreesKeepOnlyWhatBuilds) {
+    SceneProps scene = ReadJSON(kScene);
+    auto components = ComponentsOf<SceneActionsProps>(Entity(scene, "Sibling"));
+    ASSERT_EQ(components.size(), 1u);
+    const auto& actions = components[0]->actions;
+    // Nested RepeatForever, an empty Sequence and an unknown type are dropped
+    ASSERT_EQ(actions.size(), 5u);
+
+    EXPECT_EQ(actions[0].type, SceneActionType::MoveTo);
+    EXPECT_EQ(actions[0].easing, EasingType::QuadOut);
+    ExpectSame(actions[0].value, glm::vec4(5.0f, 6.0f, 0.0f, 0.0f));
+    EXPECT_NEAR(actions[1].value.z, 1.5707963f, 1e-6f);
+    EXPECT_EQ(actions[2].easing, EasingType::Linear);
+    EXPECT_EQ(actions[2].value.x, 0.25f);
+
+    // A Sequence skips a RepeatForever step but keeps a nested Sequence
+    const SceneActionProps& sequence = actions[3];
+    EXPECT_EQ(sequence.type, SceneActionType::Sequence);
+    ASSERT_EQ(sequence.children.size(), 2u);
+    EXPECT_EQ(sequence.children[0].easing, EasingType::BounceInOut);
+    EXPECT_EQ(sequence.children[1].type, SceneActionType::Sequence);
+    ExpectSame(sequence.children[1].children[0].value, glm::vec4(0.0f, 1.0f, 0.0f, 1.0f));
+
+    const SceneActionProps& repeat = actions[4];
+    EXPECT_EQ(repeat.type, SceneActionType::RepeatForever);
+    ASSERT_EQ(repeat.children.size(), 1u);
+    EXPECT_EQ(repeat.children[0].type, SceneActionType::Sequence);
+}
+
+TEST(SceneJSON, MalformedJSONFailsWithAReason) {
+    SceneProps scene;
+    scene.name = "stale";
+    std::string error;
+    EXPECT_FALSE(ReadSceneJSON("{\"name\": ", scene, &error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_TRUE(scene.name.empty());
+    // Well-formed JSON of the wrong shape is reported the same way
+    error.clear();
+    EXPECT_FALSE(ReadSceneJSON(R"({"textures": [1, 2]})", scene, &error));
+    EXPECT_FALSE(error.empty());
+}
+
+// ── JSON ↔ baked equivalence ─────────────────────────────────────────────────
+
+TEST(SceneBake, BakedSceneReadsBackAsItsJSON) {
+    SceneProps json = ReadJSON(kScene);
+    SceneProps baked = BakeAndRead(kScene);
+    ExpectSame(json, baked);
+}
+
+TEST(SceneBake, ShippedScenesReadBackAsTheirJSON) {
+    int checked = 0;
+    for (const auto& entry : fs::recursive_directory_iterator(AE_SOURCE_DIR)) {
+        const fs::path& path = entry.path();
+        if (path.extension() != ".json" || path.parent_path().filename() != "scenes") continue;
+        if (path.string().find("/_") != std::string::npos) continue;// build trees
+        SCOPED_TRACE(path.string());
+        std::ifstream in(path);
+        std::stringstream text;
+        text << in.rdbuf();
+        ExpectSame(ReadJSON(text.str()), BakeAndRead(text.str()));
+        ++checked;
+    }
+    EXPECT_GT(checked, 0);
+}
+
+TEST(SceneBake, BakeRecordsItsSourceHash) {
+    std::vector<uint8_t> bytes;
+    ASSERT_TRUE(BakeScene(kScene, bytes));
+    uint64_t hash = 0;
+    ASSERT_TRUE(GetBakedSceneSourceHash(bytes, hash));
+    EXPECT_EQ(hash, HashSceneSource(kScene));
+    EXPECT_NE(hash, HashSceneSource(std::string(kScene) + " "));
+
+    SceneProps scene;
+    ASSERT_TRUE(ReadBakedScene(bytes, scene));
+    EXPECT_EQ(scene.sourceHash, hash);
+}
+
+TEST(SceneBake, RejectsInvalidInput) {
+    std::vector<uint8_t> bytes;
+    std::string error;
+    EXPECT_FALSE(BakeScene("[", bytes, &error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_TRUE(bytes.empty());
+
+    ASSERT_TRUE(BakeScene(kScene, bytes));
+    SceneProps scene;
+    uint64_t hash = 0;
+    std::vector<uint8_t> truncated(bytes.begin(), bytes.begin() + bytes.size() / 2);
+    EXPECT_FALSE(ReadBakedScene(truncated, scene));
+    EXPECT_FALSE(GetBakedSceneSourceHash(truncated, hash));
+    std::vector<uint8_t> garbage(256, 0xAB);
+    EXPECT_FALSE(ReadBakedScene(garbage, scene));
+}
@@ -0,0 +1,390 @@
+#include "texture_pipeline.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    namespace fs = std::filesystem;
+    using namespace std::chrono_literals;
+
+    std::vector<uint8_t> Solid(uint32_t width, uint32_t height, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+        std::vector<uint8_t> rgba((size_t)width * height * 4);
+        for (size_t i = 0; i < rgba.size(); i += 4) {
+            rgba[i] = r, rgba[i + 1] = g, rgba[i + 2] = b, rgba[i + 3] = a;
+        }
+        return rgba;
+    }
+
+    // Uncompressed 32-bit TGA, top-left origin: the simplest format stb_image reads
+    std::vector<uint8_t> EncodeTGA(uint32_t width, uint32_t height, const std::vector<uint8_t>& rgba) {
+        std::vector<uint8_t> file(18, 0);
+        file[2]  = 2;// true colour
+        file[12] = static_cast<uint8_t>(width), file[13] = static_cast<uint8_t>(width >> 8);
+        file[14] = static_cast<uint8_t>(height), file[15] = static_cast<uint8_t>(height >> 8);
+        file[16] = 32;
+        file[17] = 0x28;// 8 alpha bits, top-left origin
+        for (size_t i = 0; i < rgba.size(); i += 4) {
+            file.insert(file.end(), { rgba[i + 2], rgba[i + 1], rgba[i], rgba[i + 3] });
+        }
+        return file;
+    }
+
+    TexturePayload Level0(uint32_t width, uint32_t height, std::vector<uint8_t> rgba) {
+        TexturePayload payload;
+        payload.mips.push_back({ width, height, std::move(rgba) });
+        return payload;
+    }
+
+    // Records every GPU call; all of them arrive on the thread calling Pump
+    class StubSink : public TextureUploadSink {
+    public:
+        struct Upload {
+            TextureHandle handle;
+            uint32_t      level;
+            uint32_t      width;
+            size_t        bytes;
+        };
+        struct Completion {
+            TextureHandle      handle;
+            std::string        path;
+            TexturePixelFormat format;
+            size_t             mipCount;
+            uint32_t           width;
+            TextureLoadTimes   times;
+        };
+
+        TextureHandle CreatePlaceholder() override {
+            return ++placeholders;
+        }
+        void UploadLevel(TextureHandle handle, const TexturePayload& payload, uint32_t level) override {
+            uploads.push_back({ handle, level, payload.mips[level].width, payload.mips[level].data.size() });
+        }
+        void OnComplete(TextureHandle handle, const std::string& path, const TexturePayload& payload,
+                        const TextureLoadTimes& times) override {
+            completed.push_back({ handle, path, payload.format, payload.mips.size(), payload.mips[0].width, times });
+        }
+        void OnFailed(TextureHandle handle, const std::string& /*path*/) override {
+            failed.push_back(handle);
+        }
+
+        TextureHandle              placeholders = 0;
+        std::vector<Upload>        uploads;
+        std::vector<Completion>    completed;
+        std::vector<TextureHandle> failed;
+    };
+
+    // Pumps until nothing is pending; returns the non-zero results of each Pump
+    std::vector<size_t> Drain(TexturePipeline& pipeline, size_t byteBudget) {
+        std::vector<size_t> frames;
+        auto giveUp = std::chrono::steady_clock::now() + 5s;
+        while (pipeline.GetPendingCount() > 0 && std::chrono::steady_clock::now() < giveUp) {
+            if (size_t bytes = pipeline.Pump(byteBudget)) {
+                frames.push_back(bytes);
+            } else {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+        EXPECT_EQ(pipeline.GetPendingCount(), 0u);
+        return frames;
+    }
+
+    class TexturePipelineTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            const char* test = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+            _dir = fs::temp_directory_path() / (std::string("ae_textures_") + test);
+            fs::remove_all(_dir);
+            fs::create_directories(_dir);
+        }
+
+        void TearDown() override {
+            std::error_code ec;
+            fs::remove_all(_dir, ec);
+        }
+
+        std::string WriteImage(const std::string& name, uint32_t width, uint32_t height, const std::vector<uint8_t>& rgba) {
+            std::string path = (_dir / name).string();
+            auto file = EncodeTGA(width, height, rgba);
+            std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(file.data()), (std::streamsize)file.size());
+            return path;
+        }
+
+        fs::path _dir;
+    };
+}// namespace
+
+// ── CPU stages ───────────────────────────────────────────────────────────────
+
+TEST(TextureStages, DecodeExpandsToRGBA) {
+    std::vector<uint8_t> rgba = Solid(3, 2, 10, 20, 30, 40);
+    rgba[4] = 200;// texel (1, 0) red
+    auto file = EncodeTGA(3, 2, rgba);
+
+    TexturePayload payload;
+    ASSERT_TRUE(DecodeTextureImage(file, payload));
+    EXPECT_EQ(payload.format, TexturePixelFormat::RGBA8);
+    ASSERT_EQ(payload.mips.size(), 1u);
+    EXPECT_EQ(payload.mips[0].width, 3u);
+    EXPECT_EQ(payload.mips[0].height, 2u);
+    EXPECT_EQ(payload.mips[0].data, rgba);
+
+    std::vector<uint8_t> garbage(64, 0xAB);
+    EXPECT_FALSE(DecodeTextureImage(garbage, payload));
+}
+
+TEST(TextureStages, BoxMipsAverageDownToOneTexel) {
+    // 8×2 columns alternating black / white
+    std::vector<uint8_t> rgba = Solid(8, 2, 0, 0, 0, 255);
+    for (uint32_t y = 0; y < 2; ++y)
+        for (uint32_t x = 1; x < 8; x += 2)
+            for (int c = 0; c < 3; ++c) rgba[(y * 8 + x) * 4 + c] = 255;
+    auto payload = Level0(8, 2, rgba);
+    GenerateMipChain(payload, MipFilter::Box);
+
+    ASSERT_EQ(payload.mips.size(), 4u);
+    const uint32_t widths[] = { 8, 4, 2, 1 };
+    for (size_t level = 0; level < 4; ++level) {
+        EXPECT_EQ(payload.mips[level].width, widths[level]);
+        EXPECT_EQ(payload.mips[level].height, level == 0 ? 2u : 1u);
+        EXPECT_EQ(payload.mips[level].data.size(), (size_t)widths[level] * payload.mips[level].height * 4);
+    }
+    for (size_t level = 1; level < 4; ++level) {
+        for (size_t i = 0; i < payload.mips[level].data.size(); i += 4) {
+            EXPECT_EQ(payload.mips[level].data[i], 128) << "level " << level;
+            EXPECT_EQ(payload.mips[level].data[i + 3], 255);
+        }
+    }
+}
+
+TEST(TextureStages, KaiserMipsKeepFlatColoursAndOddSizes) {
+    auto payload = Level0(5, 3, Solid(5, 3, 90, 160, 30, 255));
+    GenerateMipChain(payload, MipFilter::Kaiser);
+
+    ASSERT_EQ(payload.mips.size(), 3u);
+    EXPECT_EQ(payload.mips[1].width, 2u);
+    EXPECT_EQ(payload.mips[1].height, 1u);
+    EXPECT_EQ(payload.mips[2].width, 1u);
+    for (const auto& mip : payload.mips) {
+        EXPECT_EQ(mip.data, Solid(mip.width, mip.height, 90, 160, 30, 255));
+    }
+}
+
+TEST(TextureStages, MipChainSkipsBlockCompressedPayloads) {
+    TexturePayload payload = Level0(8, 8, std::vector<uint8_t>(32));
+    payload.format = TexturePixelFormat::BC1;
+    GenerateMipChain(payload, MipFilter::Box);
+    EXPECT_EQ(payload.mips.size(), 1u);
+}
+
+TEST(TextureStages, BlockCompressionPicksBC1OrBC3) {
+    auto opaque = Level0(8, 8, Solid(8, 8, 255, 0, 0, 255));
+    GenerateMipChain(opaque, MipFilter::Box);
+    ASSERT_TRUE(CompressTextureBC(opaque));
+    EXPECT_EQ(opaque.format, TexturePixelFormat::BC1);
+    ASSERT_EQ(opaque.mips.size(), 4u);
+    EXPECT_EQ(opaque.mips[0].data.size(), 4u * 8);// 2×2 blocks
+    EXPECT_EQ(opaque.mips[3].data.size(), 8u);    // 1×1 still takes a whole block
+    // Solid red: both endpoints are 0xF800 and every index is 0
+    const std::vector<uint8_t> red = { 0x00, 0xF8, 0x00, 0xF8, 0, 0, 0, 0 };
+    EXPECT_EQ(std::vector<uint8_t>(opaque.mips[0].data.begin(), opaque.mips[0].data.begin() + 8), red);
+
+    auto translucent = Level0(8, 4, Solid(8, 4, 0, 0, 255, 255));
+    translucent.mips[0].data[3] = 0;
+    ASSERT_TRUE(CompressTextureBC(translucent));
+    EXPECT_EQ(translucent.format, TexturePixelFormat::BC3);
+    EXPECT_EQ(translucent.mips[0].data.size(), 2u * 16);
+}
+
+TEST(TextureStages, BlockCompressionNeedsMultiplesOfFour) {
+    auto payload = Level0(6, 6, Solid(6, 6, 1, 2, 3, 255));
+    auto before  = payload.mips[0].data;
+    EXPECT_FALSE(CompressTextureBC(payload));
+    EXPECT_EQ(payload.format, TexturePixelFormat::RGBA8);
+    EXPECT_EQ(payload.mips[0].data, before);
+}
+
+// ── Pipeline ─────────────────────────────────────────────────────────────────
+
+TEST_F(TexturePipelineTest, PlaceholderIsValidBeforeAnyUpload) {
+    std::string path = WriteImage("a.tga", 16, 16, Solid(16, 16, 1, 2, 3, 255));
+    for (int workers : { 0, 2 }) {
+        StubSink sink;
+        TexturePipeline pipeline(sink, { .workerCount = workers });
+        TextureHandle handle = pipeline.Request(path);
+        EXPECT_EQ(handle, sink.placeholders);
+        EXPECT_TRUE(sink.uploads.empty());
+        EXPECT_EQ(pipeline.GetPendingCount(), 1u);
+
+        Drain(pipeline, SIZE_MAX);
+        ASSERT_EQ(sink.completed.size(), 1u);
+        EXPECT_EQ(sink.completed[0].handle, handle);
+        EXPECT_EQ(sink.completed[0].path, path);
+        EXPECT_EQ(sink.completed[0].mipCount, 5u);
+        EXPECT_EQ(sink.completed[0].times.fileBytes, 18u + 16 * 16 * 4);
+        EXPECT_TRUE(sink.failed.empty());
+    }
+}
+
+TEST_F(TexturePipelineTest, LevelsArriveSmallestFirstWithinTheByteBudget) {
+    std::string path = WriteImage("a.tga", 64, 64, Solid(64, 64, 1, 2, 3, 255));
+    for (int workers : { 0, 2 }) {
+        StubSink sink;
+        TexturePipeline pipeline(sink, { .workerCount = workers });
+        TextureHandle handle = pipeline.Request(path);
+
+        // Levels 6..2 (1364 bytes) fit; level 1 (4096) would overflow; level 0
+        // (16384) is over budget on its own but still goes when it's first
+        EXPECT_EQ(Drain(pipeline, 4096), (std::vector<size_t>{ 1364, 4096, 16384 }));
+        ASSERT_EQ(sink.uploads.size(), 7u);
+        for (uint32_t i = 0; i < 7; ++i) {
+            EXPECT_EQ(sink.uploads[i].handle, handle);
+            EXPECT_EQ(sink.uploads[i].level, 6 - i);
+            EXPECT_EQ(sink.uploads[i].width, 64u >> (6 - i));
+        }
+        EXPECT_EQ(sink.completed.size(), 1u);
+    }
+}
+
+TEST_F(TexturePipelineTest, TinyBudgetUploadsOneLevelPerPump) {
+    std::string path = WriteImage("a.tga", 8, 8, Solid(8, 8, 1, 2, 3, 255));
+    StubSink sink;
+    TexturePipeline pipeline(sink, { .workerCount = 0 });
+    pipeline.Request(path);
+    EXPECT_EQ(Drain(pipeline, 1), (std::vector<size_t>{ 4, 16, 64, 256 }));
+}
+
+TEST_F(TexturePipelineTest, MissingFileKeepsThePlaceholder) {
+    for (int workers : { 0, 2 }) {
+        StubSink sink;
+        TexturePipeline pipeline(sink, { .workerCount = workers });
+        TextureHandle handle = pipeline.Request((_dir / "missing.tga").string());
+        Drain(pipeline, SIZE_MAX);
+        EXPECT_EQ(sink.failed, std::vector<TextureHandle>{ handle });
+        EXPECT_TRUE(sink.uploads.empty());
+        EXPECT_TRUE(sink.completed.empty());
+    }
+}
+
+TEST_F(TexturePipelineTest, SamePathLoadsRepeatedly) {
+    // Each load shares the cached file bytes rather than consuming them
+    std::string path = WriteImage("a.tga", 16, 16, Solid(16, 16, 1, 2, 3, 255));
+    StubSink sink;
+    TexturePipeline pipeline(sink, { .workerCount = 2 });
+    TextureHandle first  = pipeline.Request(path);
+    TextureHandle second = pipeline.Request(path);
+    Drain(pipeline, SIZE_MAX);
+    pipeline.Reload(first, path);
+    Drain(pipeline, SIZE_MAX);
+
+    ASSERT_EQ(sink.completed.size(), 3u);
+    EXPECT_TRUE(sink.failed.empty());
+    for (const auto& done : sink.completed) EXPECT_EQ(done.mipCount, 5u);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(sink.completed[2].handle, first);
+}
+
+TEST_F(TexturePipelineTest, ReloadSupersedesTheLoadInFlight) {
+    std::string small = WriteImage("small.tga", 16, 16, Solid(16, 16, 1, 2, 3, 255));
+    std::string large = WriteImage("large.tga", 32, 32, Solid(32, 32, 1, 2, 3, 255));
+    StubSink sink;
+    TexturePipeline pipeline(sink, { .workerCount = 0 });
+    TextureHandle handle = pipeline.Request(small);
+    pipeline.Reload(handle, large);
+    Drain(pipeline, SIZE_MAX);
+
+    ASSERT_EQ(sink.completed.size(), 1u);
+    EXPECT_EQ(sink.completed[0].path, large);
+    EXPECT_EQ(sink.completed[0].width, 32u);
+    EXPECT_EQ(sink.uploads.size(), 6u);
+    EXPECT_EQ(sink.uploads.back().width, 32u);
+}
+
+TEST_F(TexturePipelineTest, CancelDropsQueuedAndHalfUploadedResults) {
+    std::string path = WriteImage("a.tga", 16, 16, Solid(16, 16, 1, 2, 3, 255));
+    StubSink sink;
+    TexturePipeline pipeline(sink, { .workerCount = 0 });
+
+    TextureHandle queued = pipeline.Request(path);
+    pipeline.Cancel(queued);
+    EXPECT_EQ(pipeline.GetPendingCount(), 0u);
+    EXPECT_EQ(pipeline.Pump(SIZE_MAX), 0u);
+
+    TextureHandle halfway = pipeline.Request(path);
+    EXPECT_GT(pipeline.Pump(1), 0u);
+    pipeline.Cancel(halfway);
+    EXPECT_EQ(pipeline.Pump(SIZE_MAX), 0u);
+    EXPECT_EQ(sink.uploads.size(), 1u);
+    EXPECT_TRUE(sink.completed.empty());
+    EXPECT_TRUE(sink.failed.empty());
+}
+
+TEST_F(TexturePipelineTest, BlockCompressWithS3TC) {
+    std::string path = WriteImage("a.tga", 16, 16, Solid(16, 16, 1, 2, 3, 255));
+    StubSink sink;
+    TexturePipeline pipeline(sink, { .preferS3TC = true, .blockCompress = true, .workerCount = 0 });
+    pipeline.Request(path);
+    Drain(pipeline, SIZE_MAX);
+    ASSERT_EQ(sink.completed.size(), 1u);
+    EXPECT_EQ(sink.completed[0].format, TexturePixelFormat::BC1);
+    EXPECT_EQ(sink.uploads.back().bytes, 4u * 4 * 8);
+}
+
+TEST_F(TexturePipelineTest, DiskCacheServesTheSecondLaunch) {
+    std::string path = WriteImage("a.tga", 32, 32, Solid(32, 32, 7, 8, 9, 255));
+    TexturePipelineConfig config{ .workerCount = 0, .diskCacheDir = (_dir / "cache").string() };
+    for (bool warm : { false, true }) {
+        StubSink sink;
+        TexturePipeline pipeline(sink, config);
+        pipeline.Request(path);
+        Drain(pipeline, SIZE_MAX);
+        ASSERT_EQ(sink.completed.size(), 1u);
+        EXPECT_EQ(sink.completed[0].times.diskCacheHit, warm);
+        EXPECT_NE(sink.completed[0].times.contentHash, 0u);
+        EXPECT_EQ(sink.completed[0].mipCount, 6u);
+    }
+}
+
+TEST_F(TexturePipelineTest, CorruptDiskCacheEntryIsRecooked) {
+    std::string path = WriteImage("a.tga", 32, 32, Solid(32, 32, 7, 8, 9, 255));
+    TexturePipelineConfig config{ .workerCount = 0, .diskCacheDir = (_dir / "cache").string() };
+    auto load = [&] {
+        StubSink sink;
+        TexturePipeline pipeline(sink, config);
+        pipeline.Request(path);
+        Drain(pipeline, SIZE_MAX);
+        EXPECT_EQ(sink.completed.size(), 1u);
+        EXPECT_TRUE(sink.failed.empty());
+        EXPECT_EQ(sink.uploads.size(), 6u);
+        EXPECT_EQ(sink.uploads.back().width, 32u);
+        EXPECT_EQ(sink.uploads.back().bytes, 32u * 32 * 4);
+        return sink.completed.empty() ? false : sink.completed[0].times.diskCacheHit;
+    };
+    EXPECT_FALSE(load());
+    fs::path entry = fs::directory_iterator(_dir / "cache")->path();
+
+    // A record is { uint32 width, uint32 height, uint64 byteSize }; the first
+    // follows the 24-byte header, the last precedes the 4 bytes of the 1×1 level
+    auto patch = [&](std::streamoff offset, uint64_t value, size_t bytes) {
+        std::fstream file(entry, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(offset);
+        file.write(reinterpret_cast<const char*>(&value), (std::streamsize)bytes);
+    };
+    // Level 0 claims to be larger than its data
+    patch(24, 64, 4);
+    EXPECT_FALSE(load());
+    EXPECT_TRUE(load());
+
+    // The 1×1 level is a byte short but the file still parses to the end
+    auto size = (std::streamoff)fs::file_size(entry);
+    patch(size - 4 - 16 + 8, 3, 8);
+    fs::resize_file(entry, size - 1);
+    EXPECT_FALSE(load());
+    EXPECT_TRUE(load());
+}
@@ -0,0 +1,198 @@
+#include "voxel_chunk_component.hpp"
+#include "voxel_world.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace {
+    using C = VoxelChunkComponent;
+
+    // Headless chunk: no GameObject, no GraphicsServer
+    std::unique_ptr<C> MakeChunk(glm::ivec3 chunkPos) {
+        return std::make_unique<C>(nullptr, nullptr, chunkPos);
+    }
+
+    void Link(C& a, C& b, int dx, int dz) {
+        a.SetNeighbor(dx, dz, &b);
+        b.SetNeighbor(-dx, -dz, &a);
+    }
+
+    // Fills the half-open local box [lo, hi)
+    void FillBox(C& chunk, glm::ivec3 lo, glm::ivec3 hi, uint8_t type) {
+        for (int x = lo.x; x < hi.x; ++x)
+            for (int y = lo.y; y < hi.y; ++y)
+                for (int z = lo.z; z < hi.z; ++z)
+                    chunk.SetVoxel(x, y, z, type);
+    }
+
+    // Heightmap terrain with a few materials; deterministic for a seed
+    void FillTerrain(C& chunk, uint32_t seed) {
+        for (int x = 0; x < C::SIZE; ++x) {
+            for (int z = 0; z < C::SIZE; ++z) {
+                uint32_t h = (uint32_t)x * 73856093u ^ (uint32_t)z * 19349663u ^ seed * 83492791u;
+                h ^= h >> 13;
+                h *= 0x5bd1e995u;
+                int height = 10 + (int)((x + z) / 4) + (int)(h % 4);
+                for (int y = 0; y < height; ++y)
+                    chunk.SetVoxel(x, y, z, (uint8_t)(1 + y / 8));
+            }
+        }
+    }
+
+    std::vector<VoxelVertex> MeshOf(C& chunk, int lod) {
+        chunk.SetLOD(lod);
+        VoxelMeshBuilder builder;
+        chunk.BuildMesh(builder);
+        return builder.Build();
+    }
+
+    // Total area of the quads facing `dir` that lie on the plane
+    // coordinate[axis] == plane.  Quads are 6 vertices (two triangles).
+    int FaceArea(const std::vector<VoxelVertex>& verts, FaceDir dir, int axis, int plane) {
+        int area = 0;
+        for (size_t q = 0; q + 6 <= verts.size(); q += 6) {
+            if (verts[q].face_id != (uint8_t)dir) continue;
+            glm::ivec3 lo(255), hi(0);
+            for (size_t i = q; i < q + 6; ++i) {
+                glm::ivec3 p(verts[i].x, verts[i].y, verts[i].z);
+                lo = glm::min(lo, p);
+                hi = glm::max(hi, p);
+            }
+            if (lo[axis] != plane) continue;
+            glm::ivec3 ext = hi - lo;
+            ext[axis] = 1;
+            area += ext.x * ext.y * ext.z;
+        }
+        return area;
+    }
+}// namespace
+
+// ── Vertex counts per LOD ────────────────────────────────────────────────────
+
+TEST(VoxelLOD, SolidCubeIsSixQuadsAtEveryLOD) {
+    auto chunk = MakeChunk({ 0, 0, 0 });
+    FillBox(*chunk, { 0, 0, 0 }, { 8, 8, 8 }, 1);
+
+    for (int lod = 0; lod <= C::MAX_LOD; ++lod) {
+        auto verts = MeshOf(*chunk, lod);
+        ASSERT_EQ(verts.size(), 36u) << "lod " << lod;
+        // Downsampled quads are scaled back to voxel units
+        uint8_t extent = 0;
+        for (const auto& v : verts)
+            extent = std::max({ extent, v.x, v.y, v.z });
+        EXPECT_EQ(extent, 8) << "lod " << lod;
+    }
+}
+
+TEST(VoxelLOD, ThinFeaturesDisappearAtCoarseLOD) {
+    auto chunk = MakeChunk({ 0, 0, 0 });
+    FillBox(*chunk, { 0, 0, 0 }, { 2, 2, 2 }, 1);
+
+    EXPECT_EQ(MeshOf(*chunk, 0).size(), 36u);
+    EXPECT_EQ(MeshOf(*chunk, 1).size(), 36u);// one 2x2x2 cell, fully solid
+    EXPECT_EQ(MeshOf(*chunk, 2).size(), 0u); // 8 of 64 voxels: below half
+}
+
+TEST(VoxelLOD, CellIsSolidWhenAtLeastHalfIsSolid) {
+    auto chunk = MakeChunk({ 0, 0, 0 });
+    // Bottom layer of the first 2x2x2 cell: exactly half solid
+    FillBox(*chunk, { 0, 0, 0 }, { 2, 1, 2 }, 3);
+    EXPECT_EQ(chunk->GetLODVoxel(0, 0, 0, 1), 3);
+
+    chunk->SetVoxel(1, 0, 1, 0);// three of eight
+    EXPECT_EQ(chunk->GetLODVoxel(0, 0, 0, 1), 0);
+
+    // The cell takes its topmost solid voxel's type
+    chunk->SetVoxel(0, 1, 0, 7);
+    EXPECT_EQ(chunk->GetLODVoxel(0, 0, 0, 1), 7);
+}
+
+TEST(VoxelLOD, TerrainVertexCountFallsWithLOD) {
+    auto chunk = MakeChunk({ 0, 0, 0 });
+    FillTerrain(*chunk, 1);
+
+    size_t previous = SIZE_MAX;
+    for (int lod = 0; lod <= C::MAX_LOD; ++lod) {
+        size_t count = MeshOf(*chunk, lod).size();
+        EXPECT_GT(count, 0u) << "lod " << lod;
+        EXPECT_EQ(count % 6, 0u) << "lod " << lod;
+        EXPECT_LT(count, previous) << "lod " << lod;
+        previous = count;
+    }
+}
+
+TEST(VoxelLOD, RebuildMeshIsHeadlessWithoutGraphicsServer) {
+    auto chunk = MakeChunk({ 0, 0, 0 });
+    FillBox(*chunk, { 0, 0, 0 }, { 4, 4, 4 }, 1);
+    ASSERT_TRUE(chunk->IsDirty());
+
+    chunk->RebuildMesh();
+    EXPECT_FALSE(chunk->IsDirty());
+    EXPECT_EQ(chunk->GetVertexCount(), 36u);
+    EXPECT_EQ(chunk->GetMesh(), nullptr);
+}
+
+// ── Seams between chunks ─────────────────────────────────────────────────────
+
+TEST(VoxelLODSeam, SameLODNeighboursEmitNoBoundaryFaces) {
+    auto a = MakeChunk({ 0, 0, 0 });
+    auto b = MakeChunk({ 1, 0, 0 });
+    Link(*a, *b, 1, 0);
+    FillBox(*a, { 0, 0, 0 }, { C::SIZE, 16, C::SIZE }, 1);
+    FillBox(*b, { 0, 0, 0 }, { C::SIZE, 16, C::SIZE }, 1);
+
+    for (int lod = 0; lod <= C::MAX_LOD; ++lod) {
+        a->SetLOD(lod);
+        b->SetLOD(lod);
+        EXPECT_EQ(FaceArea(MeshOf(*a, lod), FaceDir::RIGHT, 0, C::SIZE), 0) << "lod " << lod;
+        EXPECT_EQ(FaceArea(MeshOf(*b, lod), FaceDir::LEFT, 0, 0), 0) << "lod " << lod;
+    }
+}
+
+TEST(VoxelLODSeam, LODTransitionIsClosedBySkirts) {
+    auto a = MakeChunk({ 0, 0, 0 });
+    auto b = MakeChunk({ 1, 0, 0 });
+    Link(*a, *b, 1, 0);
+    FillTerrain(*a, 7);
+    FillTerrain(*b, 8);
+
+    for (int lodA = 0; lodA <= C::MAX_LOD; ++lodA) {
+        for (int lodB = 0; lodB <= C::MAX_LOD; ++lodB) {
+            if (lodA == lodB) continue;
+            a->SetLOD(lodA);
+            b->SetLOD(lodB);
+            // Across a transition each side walls off its whole boundary
+            // cross-section, so no gap can open between the two surfaces.
+            int expectA = 0, expectB = 0;
+            const int stepA = 1 << lodA, stepB = 1 << lodB;
+            for (int y = 0; y < C::SIZE; y += stepA)
+                for (int z = 0; z < C::SIZE; z += stepA)
+                    expectA += a->GetLODVoxel((C::SIZE - 1) >> lodA, y >> lodA, z >> lodA, lodA) ? stepA * stepA : 0;
+            for (int y = 0; y < C::SIZE; y += stepB)
+                for (int z = 0; z < C::SIZE; z += stepB)
+                    expectB += b->GetLODVoxel(0, y >> lodB, z >> lodB, lodB) ? stepB * stepB : 0;
+
+            EXPECT_GT(expectA, 0);
+            EXPECT_EQ(FaceArea(MeshOf(*a, lodA), FaceDir::RIGHT, 0, C::SIZE), expectA)
+              << "lods " << lodA << "/" << lodB;
+            EXPECT_EQ(FaceArea(MeshOf(*b, lodB), FaceDir::LEFT, 0, 0), expectB) << "lods " << lodA << "/" << lodB;
+        }
+    }
+}
+
+// ── LOD selection ────────────────────────────────────────────────────────────
+
+TEST(VoxelLOD, SelectionIsHysteresisDamped) {
+    const float d0 = VoxelWorld::LOD_DISTANCES[0];
+    const float h = VoxelWorld::LOD_HYSTERESIS;
+
+    EXPECT_EQ(VoxelWorld::SelectLOD(0, d0 + h - 1.0f), 0);
+    EXPECT_EQ(VoxelWorld::SelectLOD(0, d0 + h + 1.0f), 1);
+    EXPECT_EQ(VoxelWorld::SelectLOD(1, d0 - h + 1.0f), 1);
+    EXPECT_EQ(VoxelWorld::SelectLOD(1, d0 - h - 1.0f), 0);
+    EXPECT_EQ(VoxelWorld::SelectLOD(0, 1.0e6f), C::MAX_LOD);
+    EXPECT_EQ(VoxelWorld::SelectLOD(C::MAX_LOD, 0.0f), 0);
+}
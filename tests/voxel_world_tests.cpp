@@ -0,0 +1,493 @@
+#include "voxel_world.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace {
+    using C = VoxelChunkComponent;
+
+    const glm::ivec3 WORLD_MAX(VoxelWorld::WORLD_X * C::SIZE, VoxelWorld::WORLD_Y * C::SIZE, VoxelWorld::WORLD_Z * C::SIZE);
+
+    using Key = std::tuple<int, int, int>;
+
+    // Chunk coordinates the addressing tests populate: both sides of the
+    // origin, and pairs 2^21 chunks apart that a 21-bit packed key would
+    // fold onto each other.
+    const std::vector<glm::ivec3> SAMPLE_CHUNKS = {
+        { 0, 0, 0 },         { -1, 0, 0 },       { 0, -1, -1 },        { -1, -1, -1 },      { 1, 0, -1 },
+        { 1 << 21, 0, 0 },   { 0, 1 << 21, 0 },  { 0, 0, -(1 << 21) }, { 1 << 24, 3, -7 }, { -(1 << 25), -(1 << 25), 1 << 25 },
+    };
+
+    glm::ivec3 RandomVoxelIn(std::mt19937& rng, const glm::ivec3& chunkPos) {
+        std::uniform_int_distribution<int> local(0, C::SIZE - 1);
+        return chunkPos * C::SIZE + glm::ivec3(local(rng), local(rng), local(rng));
+    }
+}// namespace
+
+// ── Addressing ───────────────────────────────────────────────────────────────
+
+TEST(VoxelAddressing, ChunkAndLocalAreFloorDivisionAndRemainder) {
+    std::mt19937 rng(28);
+    std::uniform_int_distribution<int> coord(INT32_MIN / 2, INT32_MAX / 2);
+    for (int i = 0; i < 100000; ++i) {
+        int w = coord(rng);
+        int chunk = C::WorldToChunk(w), local = C::WorldToLocal(w);
+        ASSERT_GE(local, 0);
+        ASSERT_LT(local, C::SIZE);
+        ASSERT_EQ((int64_t)chunk * C::SIZE + local, w);
+        int64_t floorDiv = w >= 0 ? w / C::SIZE : -((-(int64_t)w + C::SIZE - 1) / C::SIZE);
+        ASSERT_EQ(chunk, floorDiv) << w;
+    }
+    EXPECT_EQ(C::WorldToChunk(-1), -1);
+    EXPECT_EQ(C::WorldToLocal(-1), C::SIZE - 1);
+    EXPECT_EQ(C::WorldToChunk(-C::SIZE), -1);
+    EXPECT_EQ(C::WorldToChunk(-C::SIZE - 1), -2);
+}
+
+TEST(VoxelAddressing, FarChunksDoNotAlias) {
+    VoxelWorld world;
+    for (const auto& cp : SAMPLE_CHUNKS)
+        ASSERT_EQ(world.CreateChunk(cp)->GetChunkPos(), cp);
+    for (const auto& cp : SAMPLE_CHUNKS)
+        EXPECT_EQ(world.CreateChunk(cp)->GetChunkPos(), cp);// returns the existing chunk
+}
+
+TEST(VoxelAddressing, RandomWritesReadBack) {
+    VoxelWorld world;
+    for (const auto& cp : SAMPLE_CHUNKS) world.CreateChunk(cp);
+
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<size_t> pick(0, SAMPLE_CHUNKS.size() - 1);
+    std::uniform_int_distribution<int> type(1, 255);
+    std::map<Key, uint8_t> expected;
+    for (int i = 0; i < 20000; ++i) {
+        glm::ivec3 w = RandomVoxelIn(rng, SAMPLE_CHUNKS[pick(rng)]);
+        uint8_t t = (uint8_t)type(rng);
+        world.SetVoxel(w.x, w.y, w.z, t);
+        expected[{ w.x, w.y, w.z }] = t;
+    }
+    for (const auto& [key, t] : expected) {
+        auto [x, y, z] = key;
+        ASSERT_EQ(world.GetVoxel(x, y, z), t) << x << "," << y << "," << z;
+    }
+
+    // Voxels of chunks that don't exist read as air and ignore writes
+    world.SetVoxel(5 * C::SIZE, 0, 0, 9);
+    EXPECT_EQ(world.GetVoxel(5 * C::SIZE, 0, 0), 0);
+    EXPECT_EQ(world.GetVoxel(-2 * C::SIZE, 0, 0), 0);
+}
+
+TEST(VoxelAddressing, RegionsMatchPerVoxelAccess) {
+    VoxelWorld world;
+    for (int cx = -2; cx <= 1; ++cx)
+        for (int cy = -1; cy <= 0; ++cy)
+            for (int cz = -2; cz <= 1; ++cz)
+                if ((cx + cz) % 3 != 0) world.CreateChunk({ cx, cy, cz });// leave holes
+
+    std::mt19937 rng(2);
+    std::uniform_int_distribution<int> corner(-2 * C::SIZE - 8, 2 * C::SIZE + 8);
+    std::uniform_int_distribution<int> extent(1, 48);
+    for (int i = 0; i < 50; ++i) {
+        glm::ivec3 lo(corner(rng), corner(rng) / 2, corner(rng));
+        glm::ivec3 hi = lo + glm::ivec3(extent(rng), extent(rng), extent(rng));
+        world.FillRegion(lo, hi, (uint8_t)(i + 1));
+
+        glm::ivec3 rlo = lo - glm::ivec3(3), rhi = hi + glm::ivec3(3);
+        std::vector<uint8_t> region;
+        world.ReadRegion(rlo, rhi, region);
+        const glm::ivec3 ext = rhi - rlo;
+        ASSERT_EQ(region.size(), (size_t)ext.x * ext.y * ext.z);
+        size_t index = 0;
+        for (int x = rlo.x; x < rhi.x; ++x)
+            for (int y = rlo.y; y < rhi.y; ++y)
+                for (int z = rlo.z; z < rhi.z; ++z)
+                    ASSERT_EQ(region[index++], world.GetVoxel(x, y, z)) << x << "," << y << "," << z;
+    }
+}
+
+TEST(VoxelAddressing, NewChunkDirtiesLoadedNeighbours) {
+    VoxelWorld world;
+    C* west = world.CreateChunk({ -1, 0, 0 });
+    C* north = world.CreateChunk({ 0, 0, 1 });
+    C* diagonal = world.CreateChunk({ 1, 0, 1 });
+    C* above = world.CreateChunk({ 0, 1, 0 });
+    for (C* c : { west, north, diagonal, above }) {
+        c->RebuildMesh();
+        ASSERT_FALSE(c->IsDirty());
+    }
+
+    world.CreateChunk({ 0, 0, 0 });
+    EXPECT_TRUE(west->IsDirty());
+    EXPECT_TRUE(north->IsDirty());
+    EXPECT_FALSE(diagonal->IsDirty());
+    EXPECT_FALSE(above->IsDirty());// chunks don't cull against vertical neighbours
+}
+
+// ── Edits and seams ──────────────────────────────────────────────────────────
+
+namespace {
+    std::vector<VoxelVertex> FreshMesh(C& chunk) {
+        VoxelMeshBuilder builder;
+        chunk.BuildMesh(builder);
+        return builder.Build();
+    }
+
+    bool SameMesh(const std::vector<VoxelVertex>& a, const std::vector<VoxelVertex>& b) {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(VoxelVertex)) == 0;
+    }
+
+    // 3x3 chunks of rolling terrain around the origin chunk
+    std::vector<C*> MakeSeamWorld(VoxelWorld& world) {
+        std::vector<C*> chunks;
+        for (int cx = -1; cx <= 1; ++cx)
+            for (int cz = -1; cz <= 1; ++cz)
+                chunks.push_back(world.CreateChunk({ cx, 0, cz }));
+        for (int x = -C::SIZE; x < 2 * C::SIZE; ++x)
+            for (int z = -C::SIZE; z < 2 * C::SIZE; ++z)
+                world.FillRegion({ x, 0, z }, { x + 1, 12 + (x * 5 + z * 3) % 7, z + 1 }, (uint8_t)(1 + (x & 3)));
+        return chunks;
+    }
+}// namespace
+
+TEST(VoxelEdits, BoundaryEditsDirtyEveryChunkWhoseMeshChanges) {
+    VoxelWorld world;
+    std::vector<C*> chunks = MakeSeamWorld(world);
+    C* centre = world.CreateChunk({ 0, 0, 0 });
+    std::mt19937 rng(29);
+    std::uniform_int_distribution<int> nearEdge(0, 15), y(0, 20), size(1, 4), type(-3, 3), lod(0, C::MAX_LOD);
+
+    // Each phase puts every chunk at one LOD, the last mixes them
+    for (int phase = 0; phase <= C::MAX_LOD + 1; ++phase) {
+        const int scale = 1 << std::min(phase, C::MAX_LOD);// edits big enough to flip coarse cells
+        for (C* c : chunks) c->SetLOD(phase <= C::MAX_LOD ? phase : lod(rng));
+        std::vector<std::vector<VoxelVertex>> meshes;
+        for (C* c : chunks) {
+            c->RebuildMesh();
+            meshes.push_back(FreshMesh(*c));
+        }
+
+        int neighbourChanges = 0;
+        for (int i = 0; i < 30; ++i) {
+            // A box inside the centre chunk, near a face; half of the edits carve
+            auto edge = [&] { int d = nearEdge(rng); return d < 8 ? d : C::SIZE - 16 + d; };
+            glm::ivec3 lo(edge(), y(rng), edge());
+            glm::ivec3 ext(size(rng), size(rng), size(rng));
+            glm::ivec3 hi = glm::min(lo + ext * scale, glm::ivec3(C::SIZE));
+            world.FillRegion(lo, hi, (uint8_t)std::max(type(rng), 0));
+
+            for (size_t k = 0; k < chunks.size(); ++k) {
+                auto mesh = FreshMesh(*chunks[k]);
+                if (!SameMesh(meshes[k], mesh)) {
+                    ASSERT_TRUE(chunks[k]->IsDirty())
+                      << "phase " << phase << ": edit at " << lo.x << "," << lo.z << " left chunk "
+                      << chunks[k]->GetChunkPos().x << "," << chunks[k]->GetChunkPos().z << " (lod "
+                      << chunks[k]->GetLOD() << ") stale";
+                    if (chunks[k] != centre) ++neighbourChanges;
+                    meshes[k] = std::move(mesh);
+                }
+                chunks[k]->RebuildMesh();
+            }
+        }
+        if (phase <= C::MAX_LOD) {
+            EXPECT_GT(neighbourChanges, 0) << "phase " << phase;// the edits did reach across seams
+        }
+    }
+}
+
+TEST(VoxelEdits, SingleVoxelEditsReachNeighboursAtTheirLOD) {
+    VoxelWorld world;
+    std::vector<C*> chunks = MakeSeamWorld(world);
+    C* centre = world.CreateChunk({ 0, 0, 0 });
+    C* west = world.CreateChunk({ -1, 0, 0 });
+
+    for (int lod = 0; lod <= C::MAX_LOD; ++lod) {
+        for (C* c : chunks) c->SetLOD(lod);
+        for (int x = 0; x < 10; ++x) {
+            for (C* c : chunks) c->RebuildMesh();
+            world.SetVoxel(x, 30, 16, (uint8_t)(lod + x + 1));
+            EXPECT_TRUE(centre->IsDirty());
+            // West reads the 2^lod voxels nearest its east face
+            EXPECT_EQ(west->IsDirty(), x < (1 << lod)) << "lod " << lod << " x " << x;
+        }
+    }
+}
+
+TEST(VoxelEdits, InteriorEditDirtiesOnlyItsChunk) {
+    VoxelWorld world;
+    std::vector<C*> chunks = MakeSeamWorld(world);
+    for (C* c : chunks) c->RebuildMesh();
+
+    C* centre = world.CreateChunk({ 0, 0, 0 });
+    world.SetVoxel(16, 20, 16, 5);
+    for (C* c : chunks)
+        EXPECT_EQ(c->IsDirty(), c == centre);
+
+    // At LOD 0 an edit one voxel in from a face is invisible to the neighbour
+    centre->RebuildMesh();
+    world.SetVoxel(1, 20, 16, 5);
+    EXPECT_FALSE(world.CreateChunk({ -1, 0, 0 })->IsDirty());
+    world.SetVoxel(0, 20, 16, 5);
+    EXPECT_TRUE(world.CreateChunk({ -1, 0, 0 })->IsDirty());
+}
+
+TEST(VoxelEdits, QueuedEditsCoalesceAndApplyOnUpdate) {
+    VoxelWorld world;
+    std::vector<C*> chunks = MakeSeamWorld(world);
+    world.remeshBudgetMs = std::numeric_limits<float>::infinity();
+    const glm::vec3 camera(16.0f, 40.0f, 16.0f);
+    world.Update(0.0f, camera);
+
+    world.QueueEdit(31, 30, 5, 9);
+    world.QueueEdit(31, 30, 5, 4);// last write wins
+    world.QueueEdit(-1, 30, 5, 6);// across the seam from the first
+    EXPECT_EQ(world.GetVoxel(31, 30, 5), 0);
+
+    world.Update(0.0f, camera);
+    EXPECT_EQ(world.GetVoxel(31, 30, 5), 4);
+    EXPECT_EQ(world.GetVoxel(-1, 30, 5), 6);
+    for (C* c : chunks) {
+        EXPECT_FALSE(c->IsDirty());
+        EXPECT_EQ(c->GetVertexCount(), FreshMesh(*c).size());
+    }
+}
+
+// ── Raycasts and overlap queries ─────────────────────────────────────────────
+
+namespace {
+    // 3x2x3 chunks around the origin with ~3% of voxels solid
+    std::vector<glm::ivec3> MakeSparseWorld(VoxelWorld& world, uint32_t seed) {
+        for (int cx = -1; cx <= 1; ++cx)
+            for (int cy = -1; cy <= 0; ++cy)
+                for (int cz = -1; cz <= 1; ++cz)
+                    world.CreateChunk({ cx, cy, cz });
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> coord(-C::SIZE, 2 * C::SIZE - 1), y(-C::SIZE, C::SIZE - 1), type(1, 255);
+        std::vector<glm::ivec3> solid;
+        for (int i = 0; i < 18000; ++i) {
+            glm::ivec3 w(coord(rng), y(rng), coord(rng));
+            if (world.GetVoxel(w.x, w.y, w.z)) continue;
+            world.SetVoxel(w.x, w.y, w.z, (uint8_t)type(rng));
+            solid.push_back(w);
+        }
+        return solid;
+    }
+
+    // Distance at which a ray with unit `dir` enters the unit cell at `c`
+    // (0 if it starts inside), or infinity if it misses it
+    float CellEntry(const glm::vec3& origin, const glm::vec3& dir, const glm::ivec3& c) {
+        float tNear = 0.0f, tFar = std::numeric_limits<float>::infinity();
+        for (int a = 0; a < 3; ++a) {
+            if (dir[a] == 0.0f) {
+                if (origin[a] < (float)c[a] || origin[a] >= (float)(c[a] + 1)) return tFar;
+                continue;
+            }
+            float t0 = ((float)c[a] - origin[a]) / dir[a];
+            float t1 = ((float)(c[a] + 1) - origin[a]) / dir[a];
+            tNear = std::max(tNear, std::min(t0, t1));
+            tFar = std::min(tFar, std::max(t0, t1));
+        }
+        return tNear <= tFar ? tNear : std::numeric_limits<float>::infinity();
+    }
+
+    // Nearest solid cell along the ray by testing every cell in its bounds
+    float BruteForceRaycast(const VoxelWorld& world, const glm::vec3& origin, const glm::vec3& dir, float maxDistance) {
+        glm::vec3 end = origin + dir * maxDistance;
+        glm::ivec3 lo = glm::ivec3(glm::floor(glm::min(origin, end))) - 1;
+        glm::ivec3 hi = glm::ivec3(glm::floor(glm::max(origin, end))) + 1;
+        float best = std::numeric_limits<float>::infinity();
+        for (int x = lo.x; x <= hi.x; ++x)
+            for (int y = lo.y; y <= hi.y; ++y)
+                for (int z = lo.z; z <= hi.z; ++z)
+                    if (world.GetVoxel(x, y, z)) best = std::min(best, CellEntry(origin, dir, { x, y, z }));
+        return best <= maxDistance ? best : std::numeric_limits<float>::infinity();
+    }
+}// namespace
+
+TEST(VoxelQueries, RaycastMatchesBruteForce) {
+    VoxelWorld world;
+    MakeSparseWorld(world, 30);
+    std::mt19937 rng(300);
+    std::uniform_real_distribution<float> pos(-40.0f, 72.0f), unit(-1.0f, 1.0f), dist(0.0f, 30.0f);
+
+    int hits = 0;
+    for (int i = 0; i < 500; ++i) {
+        glm::vec3 origin(pos(rng), pos(rng) - 32.0f, pos(rng));
+        glm::vec3 dir(unit(rng), unit(rng), unit(rng));
+        if (glm::length(dir) < 0.1f) continue;
+        dir = glm::normalize(dir);
+        float maxDistance = dist(rng);
+
+        float expected = BruteForceRaycast(world, origin, dir, maxDistance);
+        VoxelRaycastHit hit {};
+        bool found = world.Raycast(origin, dir * 3.0f, maxDistance, hit);// direction need not be unit
+        ASSERT_EQ(found, std::isfinite(expected)) << "ray " << i;
+        if (!found) continue;
+        ++hits;
+        EXPECT_NEAR(hit.distance, expected, 1e-3f) << "ray " << i;
+        EXPECT_EQ(hit.type, world.GetVoxel(hit.voxel.x, hit.voxel.y, hit.voxel.z));
+        EXPECT_NEAR(CellEntry(origin, dir, hit.voxel), hit.distance, 1e-3f);
+        if (hit.distance > 0.0f) {
+            // The normal is the face entered: one axis, against the ray
+            EXPECT_EQ(std::abs(hit.normal.x) + std::abs(hit.normal.y) + std::abs(hit.normal.z), 1);
+            EXPECT_LT(glm::dot(glm::vec3(hit.normal), dir), 0.0f);
+        } else {
+            EXPECT_EQ(hit.normal, glm::ivec3(0));
+        }
+    }
+    EXPECT_GT(hits, 50);
+}
+
+TEST(VoxelQueries, UnboundedRaycastStopsAtLoadedChunks) {
+    VoxelWorld world;
+    VoxelRaycastHit hit {};
+    const float inf = std::numeric_limits<float>::infinity();
+    EXPECT_FALSE(world.Raycast(glm::vec3(0.5f), glm::vec3(1, 0, 0), inf, hit));// no chunks at all
+
+    world.CreateChunk({ 0, 0, 0 });
+    world.CreateChunk({ 3, 0, 0 });// a gap of missing chunks in between
+    world.SetVoxel(100, 4, 4, 2);
+    EXPECT_FALSE(world.Raycast(glm::vec3(0.5f, 4.5f, 4.5f), glm::vec3(-1, 0, 0), inf, hit));
+    EXPECT_FALSE(world.Raycast(glm::vec3(0.5f, 4.5f, 4.5f), glm::vec3(0, 1, 0), inf, hit));
+    EXPECT_FALSE(world.Raycast(glm::vec3(0.5f, 40.5f, 4.5f), glm::vec3(1, 0, 0), inf, hit));// passes above
+
+    ASSERT_TRUE(world.Raycast(glm::vec3(0.5f, 4.5f, 4.5f), glm::vec3(1, 0, 0), inf, hit));
+    EXPECT_EQ(hit.voxel, glm::ivec3(100, 4, 4));
+    EXPECT_EQ(hit.normal, glm::ivec3(-1, 0, 0));
+    EXPECT_FLOAT_EQ(hit.distance, 99.5f);
+
+    // From far outside the loaded box, toward it
+    ASSERT_TRUE(world.Raycast(glm::vec3(-5000.5f, 4.5f, 4.5f), glm::vec3(1, 0, 0), inf, hit));
+    EXPECT_EQ(hit.voxel, glm::ivec3(100, 4, 4));
+    EXPECT_FLOAT_EQ(hit.distance, 5100.5f);
+}
+
+TEST(VoxelQueries, RaycastFromFarOutsideStartsAtTheLoadedBox) {
+    VoxelWorld world;
+    VoxelRaycastHit hit {};
+    const float inf = std::numeric_limits<float>::infinity();
+    world.CreateChunk({ 0, 0, 0 });
+    world.SetVoxel(0, 4, 4, 3);
+    world.SetVoxel(5, 5, 0, 4);
+
+    // 1e9 cells away a float can't step one cell at a time (t + 1 == t), so
+    // this only finishes if the walk begins at the box face
+    ASSERT_TRUE(world.Raycast(glm::vec3(-1e9f, 4.5f, 4.5f), glm::vec3(1, 0, 0), inf, hit));
+    EXPECT_EQ(hit.voxel, glm::ivec3(0, 4, 4));
+    EXPECT_EQ(hit.normal, glm::ivec3(-1, 0, 0));
+    EXPECT_EQ(hit.type, 3);
+    EXPECT_NEAR(hit.distance, 1e9f, 1e3f);
+
+    ASSERT_TRUE(world.Raycast(glm::vec3(5.5f, 5.5f, -1e9f), glm::vec3(0, 0, 1), inf, hit));
+    EXPECT_EQ(hit.voxel, glm::ivec3(5, 5, 0));
+    EXPECT_EQ(hit.normal, glm::ivec3(0, 0, -1));
+
+    // A slab miss, and a ray pointing away, return without walking
+    EXPECT_FALSE(world.Raycast(glm::vec3(-1e9f, 100.5f, 4.5f), glm::vec3(1, 0, 0), inf, hit));
+    EXPECT_FALSE(world.Raycast(glm::vec3(-1e9f, 4.5f, 4.5f), glm::vec3(-1, 0, 0), inf, hit));
+    EXPECT_FALSE(world.Raycast(glm::vec3(-1e9f, 4.5f, 4.5f), glm::vec3(1, 0, 0), 1e6f, hit));// ends short of it
+}
+
+TEST(VoxelQueries, BatchMatchesSingleRays) {
+    VoxelWorld world;
+    MakeSparseWorld(world, 31);
+    std::mt19937 rng(310);
+    std::uniform_real_distribution<float> pos(-32.0f, 64.0f), unit(-1.0f, 1.0f);
+
+    std::vector<VoxelRay> rays(3000);
+    for (auto& ray : rays) {
+        ray = { .origin = glm::vec3(pos(rng), pos(rng) - 32.0f, pos(rng)),
+                .direction = glm::vec3(unit(rng), unit(rng), unit(rng)),
+                .maxDistance = std::numeric_limits<float>::infinity() };
+    }
+    std::vector<VoxelRaycastHit> hits(rays.size());
+    size_t count = world.RaycastBatch(rays.data(), hits.data(), rays.size());
+
+    size_t expectedCount = 0;
+    for (size_t i = 0; i < rays.size(); ++i) {
+        VoxelRaycastHit hit {};
+        bool found = world.Raycast(rays[i].origin, rays[i].direction, rays[i].maxDistance, hit);
+        expectedCount += found;
+        ASSERT_EQ(hits[i].type != 0, found) << "ray " << i;
+        if (found) {
+            EXPECT_EQ(hits[i].voxel, hit.voxel);
+            EXPECT_EQ(hits[i].distance, hit.distance);
+        }
+    }
+    EXPECT_EQ(count, expectedCount);
+}
+
+TEST(VoxelQueries, OverlapsMatchBruteForce) {
+    VoxelWorld world;
+    std::vector<glm::ivec3> solid = MakeSparseWorld(world, 32);
+    std::mt19937 rng(320);
+    std::uniform_real_distribution<float> pos(-36.0f, 68.0f), size(0.1f, 6.0f);
+
+    int boxHits = 0, sphereHits = 0;
+    for (int i = 0; i < 300; ++i) {
+        glm::vec3 min(pos(rng), pos(rng) - 32.0f, pos(rng));
+        glm::vec3 max = min + glm::vec3(size(rng), size(rng), size(rng));
+        bool box = false;
+        for (const auto& v : solid)
+            box |= glm::all(glm::lessThan(glm::vec3(v), max)) && glm::all(glm::greaterThan(glm::vec3(v) + 1.0f, min));
+        EXPECT_EQ(world.OverlapBox(min, max), box) << "box " << i;
+        boxHits += box;
+
+        glm::vec3 center = min;
+        float radius = size(rng);
+        bool sphere = false;
+        for (const auto& v : solid) {
+            glm::vec3 d = glm::clamp(center, glm::vec3(v), glm::vec3(v) + 1.0f) - center;
+            sphere |= glm::dot(d, d) <= radius * radius;
+        }
+        EXPECT_EQ(world.OverlapSphere(center, radius), sphere) << "sphere " << i;
+        sphereHits += sphere;
+    }
+    EXPECT_GT(boxHits, 10);
+    EXPECT_GT(sphereHits, 10);
+}
+
+// ── Terrain generation ───────────────────────────────────────────────────────
+
+TEST(VoxelTerrain, GenerationIsDeterministicPerSeed) {
+    auto parallel = std::make_unique<VoxelWorld>();
+    auto serial = std::make_unique<VoxelWorld>();
+    auto other = std::make_unique<VoxelWorld>();
+    parallel->InitHeadless(42);
+    serial->InitHeadless(42, false);
+    other->InitHeadless(43);
+
+    // Columns are generated by JobSystem workers in whatever order they
+    // finish; the voxels must match generating them one by one in order.
+    std::vector<uint8_t> vp, vs, vo;
+    parallel->ReadRegion(glm::ivec3(0), WORLD_MAX, vp);
+    serial->ReadRegion(glm::ivec3(0), WORLD_MAX, vs);
+    other->ReadRegion(glm::ivec3(0), WORLD_MAX, vo);
+    EXPECT_EQ(vp, vs);
+    EXPECT_NE(vp, vo);
+    for (int wx = 0; wx < WORLD_MAX.x; wx += 29)
+        for (int wz = 0; wz < WORLD_MAX.z; wz += 31)
+            ASSERT_EQ(parallel->GetTerrainHeight(wx, wz), serial->GetTerrainHeight(wx, wz)) << wx << "," << wz;
+}
+
+TEST(VoxelTerrain, HeightmapMatchesVoxels) {
+    auto world = std::make_unique<VoxelWorld>();
+    world->InitHeadless(7);
+    for (int wx = 0; wx < WORLD_MAX.x; wx += 37) {
+        for (int wz = 0; wz < WORLD_MAX.z; wz += 41) {
+            int h = world->GetTerrainHeight(wx, wz);
+            EXPECT_EQ(world->GetVoxel(wx, h, wz), 0) << wx << "," << wz;
+            if (h > 0) {
+                EXPECT_NE(world->GetVoxel(wx, 0, wz), 0) << wx << "," << wz;// bedrock is never carved
+            }
+        }
+    }
+}
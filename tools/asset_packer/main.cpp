@@ -0,0 +1,122 @@
+// asset_packer — packs a directory of loose assets into one asset pack.
+//
+//   asset_packer <assets_dir> <out.pack> [--lz4 | --zstd] [--prefix <name>]
+//
+// Entry paths are "<prefix>/<path relative to assets_dir>", with the prefix
+// defaulting to the directory's own name, so packing build/HelloWorld/assets
+// stores "assets/textures/hero.png" — the same path the game passes to
+// FileSystem.  The written pack is re-opened and compared against the source
+// files before the tool reports success.
+
+#include "asset_pack.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+static bool ReadFile(const fs::path& path, std::vector<uint8_t>& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// Formats that are already compressed gain nothing from a second pass
+static bool IsPrecompressed(const fs::path& path) {
+    static const char* kExts[] = { ".png", ".jpg", ".jpeg", ".ktx2", ".ogg", ".mp3" };
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return std::any_of(std::begin(kExts), std::end(kExts), [&](const char* e) { return ext == e; });
+}
+
+static int Usage() {
+    std::fprintf(stderr, "usage: asset_packer <assets_dir> <out.pack> [--lz4 | --zstd] [--prefix <name>]\n");
+    return 2;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) return Usage();
+    fs::path root = argv[1];
+    std::string outPath = argv[2];
+    std::string prefix = fs::absolute(root).lexically_normal().filename().string();
+    if (prefix.empty()) prefix = fs::absolute(root).lexically_normal().parent_path().filename().string();
+    AssetPackCompression compression = AssetPackCompression::None;
+
+    for (int i = 3; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--lz4") == 0) {
+            compression = AssetPackCompression::LZ4;
+        } else if (std::strcmp(argv[i], "--zstd") == 0) {
+            compression = AssetPackCompression::Zstd;
+        } else if (std::strcmp(argv[i], "--prefix") == 0 && i + 1 < argc) {
+            prefix = argv[++i];
+        } else {
+            return Usage();
+        }
+    }
+    if (!IsCompressionAvailable(compression)) {
+        std::fprintf(stderr, "asset_packer: this build lacks the requested codec (configure with AE_USE_LZ4 / AE_USE_ZSTD)\n");
+        return 1;
+    }
+    if (!fs::is_directory(root)) {
+        std::fprintf(stderr, "asset_packer: '%s' is not a directory\n", root.string().c_str());
+        return 1;
+    }
+
+    std::vector<fs::path> files;
+    for (const auto& entry : fs::recursive_directory_iterator(root)) {
+        if (entry.is_regular_file()) files.push_back(entry.path());
+    }
+    std::sort(files.begin(), files.end());// deterministic output
+
+    AssetPackWriter writer;
+    std::vector<std::string> paths;
+    uint64_t rawBytes = 0;
+    for (const auto& file : files) {
+        std::vector<uint8_t> bytes;
+        if (!ReadFile(file, bytes)) {
+            std::fprintf(stderr, "asset_packer: cannot read '%s'\n", file.string().c_str());
+            return 1;
+        }
+        std::string path = fs::relative(file, root).generic_string();
+        if (!prefix.empty()) path = prefix + "/" + path;
+        rawBytes += bytes.size();
+        paths.push_back(path);
+        writer.Add(path, std::move(bytes), IsPrecompressed(file) ? AssetPackCompression::None : compression);
+    }
+
+    std::string error;
+    if (!writer.Write(outPath, &error)) {
+        std::fprintf(stderr, "asset_packer: %s\n", error.c_str());
+        return 1;
+    }
+
+    // Round-trip check: every file must come back byte-identical
+    AssetPack pack;
+    if (!pack.Open(outPath, &error)) {
+        std::fprintf(stderr, "asset_packer: %s\n", error.c_str());
+        return 1;
+    }
+    for (size_t i = 0; i < files.size(); ++i) {
+        std::vector<uint8_t> expected;
+        ReadFile(files[i], expected);
+        const AssetPackEntry* entry = pack.Find(paths[i]);
+        auto view = entry ? pack.View(*entry) : std::span<const uint8_t>();
+        if (!entry || view.size() != expected.size() || !std::equal(view.begin(), view.end(), expected.begin())) {
+            std::fprintf(stderr, "asset_packer: verification failed for '%s'\n", paths[i].c_str());
+            return 1;
+        }
+    }
+
+    std::printf("asset_packer: %zu files, %llu bytes -> '%s' (%llu bytes)\n", files.size(),
+                static_cast<unsigned long long>(rawBytes), outPath.c_str(),
+                static_cast<unsigned long long>(fs::file_size(outPath)));
+    return 0;
+}
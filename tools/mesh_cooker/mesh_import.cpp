@@ -0,0 +1,478 @@
+#include "mesh_import.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <sstream>
+#include <unordered_map>
+
+namespace fs = std::filesystem;
+using json = nlohmann::json;
+
+static bool ReadFile(const fs::path& path, std::vector<uint8_t>& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// OBJ
+// ─────────────────────────────────────────────────────────────────────────────
+namespace {
+    struct ObjCorner {
+        int v = 0, vt = 0, vn = 0;// 0-based after resolving; -1 = absent
+        bool operator==(const ObjCorner& o) const { return v == o.v && vt == o.vt && vn == o.vn; }
+    };
+    struct ObjCornerHash {
+        size_t operator()(const ObjCorner& c) const {
+            return (size_t(c.v) * 73856093u) ^ (size_t(c.vt + 1) * 19349663u) ^ (size_t(c.vn + 1) * 83492791u);
+        }
+    };
+
+    // OBJ indices are 1-based; negatives count back from the end
+    int ResolveObjIndex(const std::string& token, size_t count) {
+        if (token.empty()) return -1;
+        int index = std::stoi(token);
+        return index < 0 ? static_cast<int>(count) + index : index - 1;
+    }
+}// namespace
+
+bool ImportOBJ(const std::string& path, MeshSource& out, std::string& error) {
+    std::ifstream in(path);
+    if (!in) {
+        error = "cannot open '" + path + "'";
+        return false;
+    }
+    std::vector<float> positions, uvs, normals;
+    std::unordered_map<ObjCorner, uint32_t, ObjCornerHash> corners;
+    bool hasUVs = false, hasNormals = false;
+    out = {};
+
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(in, line)) {
+        ++lineNumber;
+        std::istringstream ss(line);
+        std::string tag;
+        ss >> tag;
+        if (tag == "v") {
+            float x = 0, y = 0, z = 0;
+            ss >> x >> y >> z;
+            positions.insert(positions.end(), { x, y, z });
+        } else if (tag == "vt") {
+            float u = 0, v = 0;
+            ss >> u >> v;
+            uvs.insert(uvs.end(), { u, 1.0f - v });
+        } else if (tag == "vn") {
+            float x = 0, y = 0, z = 0;
+            ss >> x >> y >> z;
+            normals.insert(normals.end(), { x, y, z });
+        } else if (tag == "f") {
+            std::vector<uint32_t> face;
+            std::string token;
+            while (ss >> token) {
+                ObjCorner c;
+                std::string parts[3];
+                size_t part = 0;
+                for (char ch : token) {
+                    if (ch == '/') {
+                        if (++part > 2) break;
+                    } else {
+                        parts[part] += ch;
+                    }
+                }
+                try {
+                    c.v  = ResolveObjIndex(parts[0], positions.size() / 3);
+                    c.vt = ResolveObjIndex(parts[1], uvs.size() / 2);
+                    c.vn = ResolveObjIndex(parts[2], normals.size() / 3);
+                } catch (const std::exception&) {
+                    c.v = -1;
+                }
+                if (c.v < 0 || size_t(c.v) >= positions.size() / 3 || (c.vt >= 0 && size_t(c.vt) >= uvs.size() / 2) ||
+                    (c.vn >= 0 && size_t(c.vn) >= normals.size() / 3)) {
+                    error = "bad face index on line " + std::to_string(lineNumber);
+                    return false;
+                }
+                hasUVs |= c.vt >= 0;
+                hasNormals |= c.vn >= 0;
+
+                auto [it, inserted] = corners.emplace(c, static_cast<uint32_t>(out.GetVertexCount()));
+                if (inserted) {
+                    out.positions.insert(out.positions.end(), &positions[c.v * 3], &positions[c.v * 3] + 3);
+                    if (c.vt >= 0) {
+                        out.uvs.insert(out.uvs.end(), &uvs[c.vt * 2], &uvs[c.vt * 2] + 2);
+                    } else {
+                        out.uvs.insert(out.uvs.end(), { 0.0f, 0.0f });
+                    }
+                    if (c.vn >= 0) {
+                        out.normals.insert(out.normals.end(), &normals[c.vn * 3], &normals[c.vn * 3] + 3);
+                    } else {
+                        out.normals.insert(out.normals.end(), { 0.0f, 0.0f, 0.0f });
+                    }
+                }
+                face.push_back(it->second);
+            }
+            for (size_t i = 2; i < face.size(); ++i) out.indices.insert(out.indices.end(), { face[0], face[i - 1], face[i] });
+        }
+    }
+    if (!hasUVs) out.uvs.clear();
+    if (!hasNormals) out.normals.clear();
+    if (out.indices.empty()) {
+        error = "no faces in '" + path + "'";
+        return false;
+    }
+    return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// glTF
+// ─────────────────────────────────────────────────────────────────────────────
+namespace {
+    using Mat4 = std::array<float, 16>;// column-major, as glTF stores it
+
+    Mat4 Identity() {
+        return { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+    }
+
+    Mat4 Multiply(const Mat4& a, const Mat4& b) {
+        Mat4 r{};
+        for (int c = 0; c < 4; ++c)
+            for (int row = 0; row < 4; ++row)
+                for (int k = 0; k < 4; ++k) r[c * 4 + row] += a[k * 4 + row] * b[c * 4 + k];
+        return r;
+    }
+
+    Mat4 NodeMatrix(const json& node) {
+        if (node.contains("matrix")) {
+            Mat4 m;
+            for (int i = 0; i < 16; ++i) m[i] = node["matrix"][i].get<float>();
+            return m;
+        }
+        auto get = [&](const char* key, std::initializer_list<float> fallback) {
+            std::vector<float> v(fallback);
+            if (node.contains(key)) v = node[key].get<std::vector<float>>();
+            return v;
+        };
+        std::vector<float> t = get("translation", { 0, 0, 0 }), r = get("rotation", { 0, 0, 0, 1 }), s = get("scale", { 1, 1, 1 });
+        float x = r[0], y = r[1], z = r[2], w = r[3];
+        // T * R * S
+        return { (1 - 2 * (y * y + z * z)) * s[0], (2 * (x * y + z * w)) * s[0], (2 * (x * z - y * w)) * s[0], 0,
+                 (2 * (x * y - z * w)) * s[1], (1 - 2 * (x * x + z * z)) * s[1], (2 * (y * z + x * w)) * s[1], 0,
+                 (2 * (x * z + y * w)) * s[2], (2 * (y * z - x * w)) * s[2], (1 - 2 * (x * x + y * y)) * s[2], 0,
+                 t[0], t[1], t[2], 1 };
+    }
+
+    class GltfReader {
+    public:
+        bool Load(const std::string& path, std::string& error) {
+            fs::path file = path;
+            std::vector<uint8_t> bytes;
+            if (!ReadFile(file, bytes)) return Fail(error, "cannot open '" + path + "'");
+
+            std::vector<uint8_t> glbBinary;
+            if (bytes.size() >= 12 && std::memcmp(bytes.data(), "glTF", 4) == 0) {
+                // GLB: 12-byte header, then JSON and BIN chunks
+                size_t offset = 12;
+                std::string jsonText;
+                while (offset + 8 <= bytes.size()) {
+                    uint32_t length, type;
+                    std::memcpy(&length, &bytes[offset], 4);
+                    std::memcpy(&type, &bytes[offset + 4], 4);
+                    if (offset + 8 + length > bytes.size()) return Fail(error, "truncated GLB chunk");
+                    const char* chunk = reinterpret_cast<const char*>(&bytes[offset + 8]);
+                    if (type == 0x4E4F534A) jsonText.assign(chunk, length);                                   // "JSON"
+                    if (type == 0x004E4942) glbBinary.assign(bytes.begin() + offset + 8, bytes.begin() + offset + 8 + length);// "BIN\0"
+                    offset += 8 + length;
+                }
+                _doc = json::parse(jsonText, nullptr, false);
+            } else {
+                _doc = json::parse(bytes.begin(), bytes.end(), nullptr, false);
+            }
+            if (_doc.is_discarded()) return Fail(error, "invalid glTF JSON");
+
+            for (const auto& buffer : _doc.value("buffers", json::array())) {
+                std::vector<uint8_t> data;
+                if (!buffer.contains("uri")) {
+                    data = glbBinary;
+                } else {
+                    std::string uri = buffer["uri"];
+                    size_t comma = uri.find(',');
+                    if (uri.rfind("data:", 0) == 0 && comma != std::string::npos) {
+                        data = DecodeBase64(uri.substr(comma + 1));
+                    } else if (!ReadFile(file.parent_path() / uri, data)) {
+                        return Fail(error, "cannot read buffer '" + uri + "'");
+                    }
+                }
+                _buffers.push_back(std::move(data));
+            }
+            return true;
+        }
+
+        // Reads accessor `index` as floats, `components` per element.  Only
+        // float data and (for indices) unsigned integers are accepted.
+        bool ReadAccessor(size_t index, std::vector<float>* floats, std::vector<uint32_t>* ints, size_t& count, std::string& error) const {
+            const auto& accessors = _doc["accessors"];
+            if (index >= accessors.size()) return Fail(error, "accessor out of range");
+            const json& accessor = accessors[index];
+            static const std::unordered_map<std::string, size_t> kComponents = {
+                { "SCALAR", 1 }, { "VEC2", 2 }, { "VEC3", 3 }, { "VEC4", 4 } };
+            auto type = kComponents.find(accessor.value("type", ""));
+            if (type == kComponents.end()) return Fail(error, "unsupported accessor type");
+            size_t components    = type->second;
+            int    componentType = accessor.value("componentType", 0);
+            size_t componentSize = componentType == 5126 || componentType == 5125 ? 4 : componentType == 5123 ? 2 : 1;
+            count = accessor.value("count", size_t(0));
+            if (!accessor.contains("bufferView")) return Fail(error, "sparse / empty accessors are not supported");
+
+            const json& view   = _doc["bufferViews"][accessor["bufferView"].get<size_t>()];
+            size_t      buffer = view.value("buffer", size_t(0));
+            size_t      stride = view.value("byteStride", components * componentSize);
+            size_t      base   = view.value("byteOffset", size_t(0)) + accessor.value("byteOffset", size_t(0));
+            if (buffer >= _buffers.size() || (count > 0 && base + (count - 1) * stride + components * componentSize > _buffers[buffer].size())) {
+                return Fail(error, "accessor reads past its buffer");
+            }
+            const uint8_t* data = _buffers[buffer].data() + base;
+
+            if (floats) {
+                if (componentType != 5126) return Fail(error, "only float vertex attributes are supported");
+                floats->resize(count * components);
+                for (size_t i = 0; i < count; ++i) std::memcpy(&(*floats)[i * components], data + i * stride, components * 4);
+            } else {
+                if (componentType != 5121 && componentType != 5123 && componentType != 5125) return Fail(error, "unsupported index type");
+                ints->resize(count);
+                for (size_t i = 0; i < count; ++i) {
+                    const uint8_t* p = data + i * stride;
+                    if (componentSize == 1) {
+                        (*ints)[i] = *p;
+                    } else if (componentSize == 2) {
+                        uint16_t v;
+                        std::memcpy(&v, p, 2);
+                        (*ints)[i] = v;
+                    } else {
+                        std::memcpy(&(*ints)[i], p, 4);
+                    }
+                }
+            }
+            return true;
+        }
+
+        const json& Doc() const { return _doc; }
+
+    private:
+        static bool Fail(std::string& error, const std::string& message) {
+            error = message;
+            return false;
+        }
+
+        static std::vector<uint8_t> DecodeBase64(const std::string& text) {
+            std::vector<uint8_t> out;
+            uint32_t accum = 0;
+            int bits = 0;
+            for (char c : text) {
+                int value;
+                if (c >= 'A' && c <= 'Z') value = c - 'A';
+                else if (c >= 'a' && c <= 'z') value = c - 'a' + 26;
+                else if (c >= '0' && c <= '9') value = c - '0' + 52;
+                else if (c == '+') value = 62;
+                else if (c == '/') value = 63;
+                else continue;// padding / whitespace
+                accum = (accum << 6) | static_cast<uint32_t>(value);
+                bits += 6;
+                if (bits >= 8) {
+                    bits -= 8;
+                    out.push_back(static_cast<uint8_t>(accum >> bits));
+                }
+            }
+            return out;
+        }
+
+        json                              _doc;
+        std::vector<std::vector<uint8_t>> _buffers;
+    };
+
+    bool AppendPrimitive(const GltfReader& gltf, const json& primitive, const Mat4& world, MeshSource& out, std::string& error) {
+        if (primitive.value("mode", 4) != 4) return true;// points / lines / strips are skipped
+        const json& attributes = primitive["attributes"];
+        if (!attributes.contains("POSITION")) return true;
+
+        size_t count = 0, n = 0;
+        std::vector<float> positions, normals, uvs, tangents;
+        if (!gltf.ReadAccessor(attributes["POSITION"], &positions, nullptr, count, error)) return false;
+        if (attributes.contains("NORMAL") && !gltf.ReadAccessor(attributes["NORMAL"], &normals, nullptr, n, error)) return false;
+        if (attributes.contains("TEXCOORD_0") && !gltf.ReadAccessor(attributes["TEXCOORD_0"], &uvs, nullptr, n, error)) return false;
+        if (attributes.contains("TANGENT") && !gltf.ReadAccessor(attributes["TANGENT"], &tangents, nullptr, n, error)) return false;
+
+        std::vector<uint32_t> indices;
+        if (primitive.contains("indices")) {
+            if (!gltf.ReadAccessor(primitive["indices"], nullptr, &indices, n, error)) return false;
+        } else {
+            indices.resize(count);
+            for (size_t i = 0; i < count; ++i) indices[i] = static_cast<uint32_t>(i);
+        }
+
+        // Normals and tangents take the cofactor of the upper 3×3 (the
+        // inverse transpose up to scale); mirrored nodes flip the winding
+        const Mat4& m = world;
+        float cof[9] = { m[5] * m[10] - m[6] * m[9], m[6] * m[8] - m[4] * m[10], m[4] * m[9] - m[5] * m[8],
+                         m[2] * m[9] - m[1] * m[10], m[0] * m[10] - m[2] * m[8], m[1] * m[8] - m[0] * m[9],
+                         m[1] * m[6] - m[2] * m[5], m[2] * m[4] - m[0] * m[6], m[0] * m[5] - m[1] * m[4] };
+        float det = m[0] * cof[0] + m[4] * cof[3] + m[8] * cof[6];
+        auto transform = [&](const float* v, float w, float* r) {
+            for (int k = 0; k < 3; ++k) r[k] = m[k] * v[0] + m[4 + k] * v[1] + m[8 + k] * v[2] + m[12 + k] * w;
+        };
+        auto normalize = [](float* v) {
+            float len = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+            if (len > 0) for (int k = 0; k < 3; ++k) v[k] /= len;
+        };
+
+        uint32_t base = static_cast<uint32_t>(out.GetVertexCount());
+        bool allHaveNormals = out.normals.size() == out.positions.size() && normals.size() == count * 3;
+        bool allHaveUVs     = out.uvs.size() == out.GetVertexCount() * 2 && uvs.size() == count * 2;
+        bool allHaveTangents = out.tangents.size() == out.GetVertexCount() * 4 && tangents.size() == count * 4;
+        if (!allHaveNormals) out.normals.clear();
+        if (!allHaveUVs) out.uvs.clear();
+        if (!allHaveTangents) out.tangents.clear();
+        for (size_t i = 0; i < count; ++i) {
+            float p[3];
+            transform(&positions[i * 3], 1.0f, p);
+            out.positions.insert(out.positions.end(), p, p + 3);
+            if (allHaveNormals) {
+                const float* src = &normals[i * 3];
+                float r[3] = { cof[0] * src[0] + cof[3] * src[1] + cof[6] * src[2], cof[1] * src[0] + cof[4] * src[1] + cof[7] * src[2],
+                               cof[2] * src[0] + cof[5] * src[1] + cof[8] * src[2] };
+                normalize(r);
+                out.normals.insert(out.normals.end(), r, r + 3);
+            }
+            if (allHaveUVs) out.uvs.insert(out.uvs.end(), &uvs[i * 2], &uvs[i * 2] + 2);
+            if (allHaveTangents) {
+                float t[3];
+                transform(&tangents[i * 4], 0.0f, t);
+                normalize(t);
+                out.tangents.insert(out.tangents.end(), { t[0], t[1], t[2], tangents[i * 4 + 3] * (det < 0 ? -1.0f : 1.0f) });
+            }
+        }
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            uint32_t a = indices[i], b = indices[i + 1], c = indices[i + 2];
+            if (a >= count || b >= count || c >= count) {
+                error = "index out of range";
+                return false;
+            }
+            if (det < 0) std::swap(b, c);
+            out.indices.insert(out.indices.end(), { base + a, base + b, base + c });
+        }
+        return true;
+    }
+}// namespace
+
+bool ImportGLTF(const std::string& path, MeshSource& out, std::string& error) {
+    GltfReader gltf;
+    if (!gltf.Load(path, error)) return false;
+    const json& doc = gltf.Doc();
+    out = {};
+
+    std::function<bool(size_t, const Mat4&)> visit = [&](size_t nodeIndex, const Mat4& parent) {
+        const json& node = doc["nodes"][nodeIndex];
+        Mat4 world = Multiply(parent, NodeMatrix(node));
+        if (node.contains("mesh")) {
+            for (const auto& primitive : doc["meshes"][node["mesh"].get<size_t>()]["primitives"]) {
+                if (!AppendPrimitive(gltf, primitive, world, out, error)) return false;
+            }
+        }
+        for (const auto& child : node.value("children", json::array())) {
+            if (!visit(child.get<size_t>(), world)) return false;
+        }
+        return true;
+    };
+
+    try {
+        if (doc.contains("scenes") && !doc["scenes"].empty()) {
+            const json& scene = doc["scenes"][doc.value("scene", size_t(0))];
+            for (const auto& root : scene.value("nodes", json::array())) {
+                if (!visit(root.get<size_t>(), Identity())) return false;
+            }
+        } else {
+            // No scene graph: take every mesh untransformed
+            for (const auto& mesh : doc.value("meshes", json::array())) {
+                for (const auto& primitive : mesh["primitives"]) {
+                    if (!AppendPrimitive(gltf, primitive, Identity(), out, error)) return false;
+                }
+            }
+        }
+    } catch (const json::exception& e) {
+        error = std::string("malformed glTF: ") + e.what();
+        return false;
+    }
+    if (out.indices.empty()) {
+        error = "no triangle primitives in '" + path + "'";
+        return false;
+    }
+    return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Generated attributes
+// ─────────────────────────────────────────────────────────────────────────────
+void GenerateMissingAttributes(MeshSource& mesh) {
+    size_t vertexCount = mesh.GetVertexCount();
+    auto normalize = [](float* v) {
+        float len = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        if (len > 1e-12f) for (int k = 0; k < 3; ++k) v[k] /= len;
+    };
+
+    if (mesh.normals.size() != vertexCount * 3) {
+        mesh.normals.assign(vertexCount * 3, 0.0f);
+        for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+            const float* a = &mesh.positions[mesh.indices[i] * 3];
+            const float* b = &mesh.positions[mesh.indices[i + 1] * 3];
+            const float* c = &mesh.positions[mesh.indices[i + 2] * 3];
+            float e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] }, e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+            float n[3]  = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+            for (int k = 0; k < 3; ++k)
+                for (int j = 0; j < 3; ++j) mesh.normals[mesh.indices[i + k] * 3 + j] += n[j];// area-weighted
+        }
+        for (size_t v = 0; v < vertexCount; ++v) normalize(&mesh.normals[v * 3]);
+    }
+
+    if (mesh.tangents.size() != vertexCount * 4 && mesh.uvs.size() == vertexCount * 2) {
+        std::vector<float> tan(vertexCount * 3, 0.0f), bitan(vertexCount * 3, 0.0f);
+        for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+            uint32_t ia = mesh.indices[i], ib = mesh.indices[i + 1], ic = mesh.indices[i + 2];
+            const float *a = &mesh.positions[ia * 3], *b = &mesh.positions[ib * 3], *c = &mesh.positions[ic * 3];
+            const float *ta = &mesh.uvs[ia * 2], *tb = &mesh.uvs[ib * 2], *tc = &mesh.uvs[ic * 2];
+            float e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] }, e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+            float du1 = tb[0] - ta[0], dv1 = tb[1] - ta[1], du2 = tc[0] - ta[0], dv2 = tc[1] - ta[1];
+            float d = du1 * dv2 - du2 * dv1;
+            if (std::fabs(d) < 1e-12f) continue;// degenerate UVs add nothing
+            float r = 1.0f / d;
+            for (uint32_t v : { ia, ib, ic }) {
+                for (int k = 0; k < 3; ++k) {
+                    tan[v * 3 + k] += (e1[k] * dv2 - e2[k] * dv1) * r;
+                    bitan[v * 3 + k] += (e2[k] * du1 - e1[k] * du2) * r;
+                }
+            }
+        }
+        mesh.tangents.assign(vertexCount * 4, 0.0f);
+        for (size_t v = 0; v < vertexCount; ++v) {
+            const float* n = &mesh.normals[v * 3];
+            float* t = &tan[v * 3];
+            // Gram-Schmidt against the normal
+            float nd = n[0] * t[0] + n[1] * t[1] + n[2] * t[2];
+            for (int k = 0; k < 3; ++k) t[k] -= n[k] * nd;
+            normalize(t);
+            float c[3] = { n[1] * t[2] - n[2] * t[1], n[2] * t[0] - n[0] * t[2], n[0] * t[1] - n[1] * t[0] };
+            const float* b = &bitan[v * 3];
+            float w = (c[0] * b[0] + c[1] * b[1] + c[2] * b[2]) < 0.0f ? -1.0f : 1.0f;
+            mesh.tangents[v * 4 + 0] = t[0];
+            mesh.tangents[v * 4 + 1] = t[1];
+            mesh.tangents[v * 4 + 2] = t[2];
+            mesh.tangents[v * 4 + 3] = w;
+        }
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include "mesh_format.hpp"
+
+#include <string>
+
+// Reads a Wavefront OBJ into one indexed triangle list.  Polygons are fanned;
+// identical position/uv/normal triplets share a vertex.  V is flipped to the
+// engine's bottom-up texture convention.
+bool ImportOBJ(const std::string& path, MeshSource& out, std::string& error);
+
+// Reads a glTF 2.0 file (.gltf with external or data-URI buffers, or .glb).
+// Every triangle primitive reachable from the default scene is merged, with
+// node transforms applied.  Materials, skins and morph targets are ignored.
+bool ImportGLTF(const std::string& path, MeshSource& out, std::string& error);
+
+// Fills in what the source lacked: area-weighted smooth normals, then
+// per-vertex tangents from the UV gradients (w = bitangent sign)
+void GenerateMissingAttributes(MeshSource& mesh);
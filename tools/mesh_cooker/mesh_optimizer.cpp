@@ -0,0 +1,266 @@
+#include "mesh_optimizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Vertex cache (Forsyth)
+// ─────────────────────────────────────────────────────────────────────────────
+namespace {
+    constexpr int   FORSYTH_CACHE_SIZE = 32;
+    constexpr float LAST_TRI_SCORE     = 0.75f;
+    constexpr float VALENCE_SCALE      = 2.0f;
+
+    float VertexScore(int cachePosition, uint32_t trianglesLeft) {
+        if (trianglesLeft == 0) return -1.0f;
+        float score = 0.0f;
+        if (cachePosition >= 0) {
+            // The last triangle's three vertices score the same, whatever their order
+            score = cachePosition < 3
+                ? LAST_TRI_SCORE
+                : std::pow(1.0f - float(cachePosition - 3) / (FORSYTH_CACHE_SIZE - 3), 1.5f);
+        }
+        return score + VALENCE_SCALE / std::sqrt(static_cast<float>(trianglesLeft));
+    }
+}// namespace
+
+void OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount) {
+    size_t triCount = indices.size() / 3;
+    if (triCount == 0) return;
+
+    // Vertex → triangles adjacency, in CSR form
+    std::vector<uint32_t> offsets(vertexCount + 1, 0);
+    for (uint32_t v : indices) ++offsets[v + 1];
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<uint32_t> adjacency(indices.size());
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < indices.size(); ++i) adjacency[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+
+    std::vector<uint32_t> trianglesLeft(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) trianglesLeft[v] = offsets[v + 1] - offsets[v];
+    std::vector<int>   cachePosition(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) vertexScore[v] = VertexScore(-1, trianglesLeft[v]);
+
+    std::vector<float> triangleScore(triCount);
+    std::vector<bool>  emitted(triCount, false);
+    for (size_t t = 0; t < triCount; ++t) {
+        triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+    }
+
+    std::vector<uint32_t> cache, nextCache;
+    cache.reserve(FORSYTH_CACHE_SIZE + 3);
+    std::vector<uint32_t> output;
+    output.reserve(indices.size());
+    size_t scanCursor = 0;// fallback search resumes here; emitted triangles never come back
+
+    for (;;) {
+        // Best triangle touching the cache, else the best-scoring one left
+        int64_t best = -1;
+        float bestScore = -1.0f;
+        for (uint32_t v : cache) {
+            for (uint32_t a = offsets[v]; a < offsets[v] + trianglesLeft[v]; ++a) {
+                uint32_t t = adjacency[a];
+                if (triangleScore[t] > bestScore) bestScore = triangleScore[t], best = t;
+            }
+        }
+        if (best < 0) {
+            while (scanCursor < triCount && emitted[scanCursor]) ++scanCursor;
+            if (scanCursor == triCount) break;
+            for (size_t t = scanCursor; t < triCount; ++t) {
+                if (!emitted[t] && triangleScore[t] > bestScore) bestScore = triangleScore[t], best = static_cast<int64_t>(t);
+            }
+        }
+
+        emitted[best] = true;
+        const uint32_t* tri = &indices[best * 3];
+        output.insert(output.end(), tri, tri + 3);
+
+        // Drop the triangle from its vertices' adjacency lists
+        for (int k = 0; k < 3; ++k) {
+            uint32_t v = tri[k];
+            uint32_t* begin = &adjacency[offsets[v]];
+            uint32_t* end   = begin + trianglesLeft[v];
+            *std::find(begin, end, static_cast<uint32_t>(best)) = *(end - 1);
+            --trianglesLeft[v];
+        }
+
+        // Move the triangle's vertices to the front of the LRU cache
+        nextCache.assign(tri, tri + 3);
+        for (uint32_t v : cache) {
+            if (v != tri[0] && v != tri[1] && v != tri[2]) nextCache.push_back(v);
+        }
+        for (size_t i = FORSYTH_CACHE_SIZE; i < nextCache.size(); ++i) {
+            cachePosition[nextCache[i]] = -1;
+            vertexScore[nextCache[i]]   = VertexScore(-1, trianglesLeft[nextCache[i]]);
+        }
+        if (nextCache.size() > FORSYTH_CACHE_SIZE) {
+            // Evicted vertices changed score; their remaining triangles need it
+            for (size_t i = FORSYTH_CACHE_SIZE; i < nextCache.size(); ++i) {
+                uint32_t v = nextCache[i];
+                for (uint32_t a = offsets[v]; a < offsets[v] + trianglesLeft[v]; ++a) {
+                    uint32_t t = adjacency[a];
+                    triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+                }
+            }
+            nextCache.resize(FORSYTH_CACHE_SIZE);
+        }
+        cache.swap(nextCache);
+
+        for (size_t i = 0; i < cache.size(); ++i) {
+            cachePosition[cache[i]] = static_cast<int>(i);
+            vertexScore[cache[i]]   = VertexScore(static_cast<int>(i), trianglesLeft[cache[i]]);
+        }
+        for (uint32_t v : cache) {
+            for (uint32_t a = offsets[v]; a < offsets[v] + trianglesLeft[v]; ++a) {
+                uint32_t t = adjacency[a];
+                triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+            }
+        }
+    }
+    indices.swap(output);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Overdraw
+// ─────────────────────────────────────────────────────────────────────────────
+namespace {
+    // Triangle indices where a cluster starts.  Each cluster is simulated
+    // from a cold FIFO cache, since after sorting it may follow any other.
+    // Hard boundaries are where all three vertices would miss anyway; a soft
+    // boundary closes a cluster once its cold-start ACMR is within
+    // `threshold` of the whole mesh's, so cutting there costs little.
+    std::vector<size_t> FindClusters(const std::vector<uint32_t>& indices, size_t vertexCount, float threshold) {
+        constexpr size_t CACHE_SIZE = 16;
+        size_t triCount = indices.size() / 3;
+        float meshACMR  = ComputeACMR(indices, vertexCount, CACHE_SIZE);
+
+        std::vector<size_t> stamp(vertexCount, 0);
+        size_t time = CACHE_SIZE + 1;// FIFO position as a timestamp
+        auto inCache = [&](uint32_t v) { return time - stamp[v] <= CACHE_SIZE; };
+
+        std::vector<size_t> starts{ 0 };
+        size_t clusterMisses = 0;
+        for (size_t t = 0; t < triCount; ++t) {
+            const uint32_t* tri = &indices[t * 3];
+            size_t clusterTris = t - starts.back();
+            bool hard = clusterTris > 0 && !inCache(tri[0]) && !inCache(tri[1]) && !inCache(tri[2]);
+            bool soft = clusterTris >= 64 && float(clusterMisses) / float(clusterTris) <= meshACMR * threshold;
+            if (hard || soft) {
+                starts.push_back(t);
+                clusterMisses = 0;
+                time += CACHE_SIZE + 1;// cold cache
+            }
+            for (int k = 0; k < 3; ++k) {
+                if (!inCache(tri[k])) {
+                    stamp[tri[k]] = time++;
+                    ++clusterMisses;
+                }
+            }
+        }
+        return starts;
+    }
+}// namespace
+
+void OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<float>& positions, float threshold) {
+    size_t triCount = indices.size() / 3;
+    size_t vertexCount = positions.size() / 3;
+    if (triCount < 2) return;
+
+    std::vector<size_t> starts = FindClusters(indices, vertexCount, threshold);
+    starts.push_back(triCount);
+
+    // Area-weighted centroid and normal of the mesh and of each cluster
+    double meshCentroid[3] = { 0, 0, 0 }, meshArea = 0;
+    struct Cluster {
+        size_t begin, end;
+        double centroid[3] = { 0, 0, 0 };
+        double normal[3]   = { 0, 0, 0 };
+        double area        = 0;
+        double sortKey     = 0;
+    };
+    std::vector<Cluster> clusters;
+    for (size_t c = 0; c + 1 < starts.size(); ++c) {
+        Cluster cluster{ starts[c], starts[c + 1] };
+        for (size_t t = cluster.begin; t < cluster.end; ++t) {
+            const float* a = &positions[indices[t * 3] * 3];
+            const float* b = &positions[indices[t * 3 + 1] * 3];
+            const float* d = &positions[indices[t * 3 + 2] * 3];
+            double e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+            double e2[3] = { d[0] - a[0], d[1] - a[1], d[2] - a[2] };
+            double n[3]  = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+            double area  = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            for (int k = 0; k < 3; ++k) {
+                cluster.normal[k] += n[k];// already area-weighted
+                cluster.centroid[k] += (a[k] + b[k] + d[k]) / 3.0 * area;
+            }
+            cluster.area += area;
+        }
+        for (int k = 0; k < 3; ++k) meshCentroid[k] += cluster.centroid[k];
+        meshArea += cluster.area;
+        clusters.push_back(cluster);
+    }
+    if (meshArea <= 0) return;
+    for (auto& k : meshCentroid) k /= meshArea;
+
+    // Facing away from the centre = drawn first: it tends to occlude the rest
+    for (auto& cluster : clusters) {
+        if (cluster.area <= 0) continue;
+        double len = std::sqrt(cluster.normal[0] * cluster.normal[0] + cluster.normal[1] * cluster.normal[1] +
+                               cluster.normal[2] * cluster.normal[2]);
+        if (len <= 0) continue;
+        for (int k = 0; k < 3; ++k) {
+            cluster.sortKey += (cluster.centroid[k] / cluster.area - meshCentroid[k]) * cluster.normal[k] / len;
+        }
+    }
+    std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& a, const Cluster& b) { return a.sortKey > b.sortKey; });
+
+    std::vector<uint32_t> output;
+    output.reserve(indices.size());
+    for (const auto& cluster : clusters) {
+        output.insert(output.end(), indices.begin() + cluster.begin * 3, indices.begin() + cluster.end * 3);
+    }
+    indices.swap(output);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Vertex fetch
+// ─────────────────────────────────────────────────────────────────────────────
+void OptimizeVertexFetch(MeshSource& mesh) {
+    constexpr uint32_t UNUSED = UINT32_MAX;
+    size_t vertexCount = mesh.GetVertexCount();
+    std::vector<uint32_t> remap(vertexCount, UNUSED);
+    uint32_t next = 0;
+    for (uint32_t& index : mesh.indices) {
+        if (remap[index] == UNUSED) remap[index] = next++;
+        index = remap[index];
+    }
+
+    auto reorder = [&](std::vector<float>& attribute, size_t components) {
+        if (attribute.size() < vertexCount * components) return;
+        std::vector<float> sorted(size_t(next) * components);
+        for (size_t v = 0; v < vertexCount; ++v) {
+            if (remap[v] == UNUSED) continue;
+            std::copy_n(&attribute[v * components], components, &sorted[size_t(remap[v]) * components]);
+        }
+        attribute.swap(sorted);
+    };
+    reorder(mesh.positions, 3);
+    reorder(mesh.uvs, 2);
+    reorder(mesh.normals, 3);
+    reorder(mesh.tangents, 4);
+}
+
+float ComputeACMR(const std::vector<uint32_t>& indices, size_t vertexCount, size_t cacheSize) {
+    if (indices.size() < 3) return 0.0f;
+    std::vector<size_t> stamp(vertexCount, 0);
+    size_t time = cacheSize + 1, misses = 0;
+    for (uint32_t v : indices) {
+        if (time - stamp[v] > cacheSize) {
+            stamp[v] = time++;
+            ++misses;
+        }
+    }
+    return static_cast<float>(misses) / static_cast<float>(indices.size() / 3);
+}
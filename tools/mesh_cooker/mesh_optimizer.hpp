@@ -0,0 +1,27 @@
+#pragma once
+#include "mesh_format.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Offline index / vertex reordering, run in this order:
+//
+//   OptimizeVertexCache  Forsyth's linear-speed greedy ordering: triangles
+//                        whose vertices are hot in a simulated LRU cache (or
+//                        have few triangles left) go first.
+//   OptimizeOverdraw     Splits that order into clusters where the cache
+//                        restarts anyway, then sorts clusters outward-facing
+//                        first so early depth rejects more of what follows.
+//                        Costs at most `threshold`× the cache-optimal ACMR.
+//   OptimizeVertexFetch  Renumbers vertices by first use so the vertex fetch
+//                        walks memory forward; drops unreferenced vertices.
+// ─────────────────────────────────────────────────────────────────────────────
+void OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount);
+void OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<float>& positions, float threshold = 1.05f);
+void OptimizeVertexFetch(MeshSource& mesh);
+
+// Average cache miss ratio: transformed vertices per triangle under a FIFO
+// cache of `cacheSize` entries (0.5 is the ideal for a regular grid, 3 the worst)
+float ComputeACMR(const std::vector<uint32_t>& indices, size_t vertexCount, size_t cacheSize = 16);
@@ -0,0 +1,98 @@
+// scene_baker — bakes JSON scenes into .aesb (see AtmosphericEngine
+// scene_bake.hpp and schemas/BakedScene.fbs).
+//
+//   scene_baker <scene.json> [out.aesb]
+//   scene_baker <scenes_dir>                 bakes every *.json in the directory
+//
+// The output defaults to the input path with its extension swapped, which is
+// where Application::GoScene looks first.  The bake is read back before it is
+// written, and the tool reports how long a runtime load spends reading the
+// scene either way.  That both forms read back identically is checked by
+// tests/scene_props_tests.cpp, not here.
+
+#include "scene_bake.hpp"
+#include "scene_props.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+static int Usage() {
+    std::fprintf(stderr, "usage: scene_baker <scene.json | scenes_dir> [out.aesb]\n");
+    return 2;
+}
+
+static bool ReadFile(const fs::path& path, std::string& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Keeps the timing loops from being optimised away
+static size_t g_sink = 0;
+
+static bool BakeOne(const fs::path& input, const fs::path& output) {
+    std::string text;
+    if (!ReadFile(input, text)) {
+        std::fprintf(stderr, "scene_baker: cannot read '%s'\n", input.string().c_str());
+        return false;
+    }
+    std::vector<uint8_t> bytes;
+    std::string error;
+    if (!BakeScene(text, bytes, &error)) {
+        std::fprintf(stderr, "scene_baker: %s: %s\n", input.string().c_str(), error.c_str());
+        return false;
+    }
+
+    SceneProps scene;
+    if (!ReadBakedScene(bytes, scene)) {
+        std::fprintf(stderr, "scene_baker: %s: baked buffer failed verification\n", input.string().c_str());
+        return false;
+    }
+
+    // What a runtime load pays before instantiating, JSON against baked
+    using clock = std::chrono::steady_clock;
+    constexpr int LOADS = 50;
+    SceneProps loaded;
+    auto start = clock::now();
+    for (int i = 0; i < LOADS; ++i) g_sink += ReadSceneJSON(text, loaded) ? loaded.entities.size() : 0;
+    double jsonMicros = std::chrono::duration<double, std::micro>(clock::now() - start).count() / LOADS;
+    start = clock::now();
+    for (int i = 0; i < LOADS; ++i) g_sink += ReadBakedScene(bytes, loaded) ? loaded.entities.size() : 0;
+    double bakedMicros = std::chrono::duration<double, std::micro>(clock::now() - start).count() / LOADS;
+
+    std::ofstream out(output, std::ios::binary);
+    if (!out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+        std::fprintf(stderr, "scene_baker: cannot write '%s'\n", output.string().c_str());
+        return false;
+    }
+    std::printf("%s: %zu entities, %zu → %zu bytes, read %.1f µs → %.1f µs\n", output.string().c_str(),
+                scene.entities.size(), text.size(), bytes.size(), jsonMicros, bakedMicros);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) return Usage();
+    fs::path input = argv[1];
+
+    if (fs::is_directory(input)) {
+        if (argc == 3) return Usage();
+        bool ok = true;
+        for (const auto& entry : fs::directory_iterator(input)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".json") {
+                ok = BakeOne(entry.path(), fs::path(entry.path()).replace_extension(".aesb")) && ok;
+            }
+        }
+        return ok ? 0 : 1;
+    }
+    fs::path output = argc == 3 ? fs::path(argv[2]) : fs::path(input).replace_extension(".aesb");
+    return BakeOne(input, output) ? 0 : 1;
+}